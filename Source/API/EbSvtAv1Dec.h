@@ -45,6 +45,11 @@ typedef struct EbAV1FrameInfo {
 
     /* Frame presentation time */
     uint64_t frame_presentation_time;
+
+    /* Set when the output planes point directly into an external frame buffer
+     * owned by the decoder. The planes must not be freed by the application
+     * in that case. */
+    EbBool ext_frame_buf;
 } EbAV1FrameInfo;
 
 typedef struct EbSvtAv1DecConfiguration {
@@ -122,6 +127,14 @@ typedef struct EbSvtAv1DecConfiguration {
  *
  * Default is 0. */
     EbBool is_16bit_pipeline;
+
+    /* Outputs 4:2:0 pictures with interleaved chroma: NV12 for 8-bit output,
+     * P010 (samples in the most significant bits of 16-bit words) otherwise.
+     * The cb plane holds the cb/cr pairs and cr is set to NULL. Ignored for the
+     * other colour formats.
+     *
+     * Default is 0. */
+    EbBool semi_planar_output;
 } EbSvtAv1DecConfiguration;
 
 /* STEP 1: Call the library to construct a Component Handle.
@@ -151,6 +164,29 @@ EB_API EbErrorType svt_av1_dec_set_parameter(
      * @ *svt_dec_component  Decoder handle. */
 EB_API EbErrorType svt_av1_dec_init(EbComponentType *svt_dec_component);
 
+/* STEP 3a (optional): Register external frame buffer callbacks. Must be
+     * called before the first call to svt_av1_dec_frame().
+     *
+     * When set, the decoder reconstructs every frame directly into a buffer
+     * obtained from alloc_fb and calls release_fb once the buffer is no longer
+     * referenced. svt_av1_dec_get_picture() then returns the output picture
+     * without a copy, unless film grain synthesis or a bit-depth conversion is
+     * required, and sets ext_frame_buf in the EbAV1FrameInfo. The
+     * private_data of the frame buffer is returned in p_app_private.
+     * Allocated buffers must be at least 32-byte aligned. When alloc_fb fails,
+     * the frame is dropped and the decoding call returns
+     * EB_ErrorInsufficientResources.
+     *
+     * Parameter:
+     * @ *svt_dec_component     Decoder handle.
+     * @ alloc_fb               Frame buffer allocation callback.
+     * @ release_fb             Frame buffer release callback.
+     * @ *fb_priv               Private data passed back to both callbacks. */
+EB_API EbErrorType svt_av1_dec_set_frame_buffer_functions(EbComponentType *     svt_dec_component,
+                                                          EbAllocateFrameBuffer alloc_fb,
+                                                          EbReleaseFrameBuffer  release_fb,
+                                                          void *                fb_priv);
+
 /*!\brief STEP 4: Decodes a frame with associated data. The data in *data
      * should belong to one frame, possibly with sequence header and metadata.
      *
@@ -163,6 +199,31 @@ EB_API EbErrorType svt_av1_dec_init(EbComponentType *svt_dec_component);
 EB_API EbErrorType svt_av1_dec_frame(EbComponentType *svt_dec_component, const uint8_t *data,
                                        const size_t data_size, uint32_t is_annexb);
 
+/* STEP 4 (alternative): Incremental input. Appends data_size bytes of the
+     * bitstream, which may end anywhere, even inside an OBU, and decodes the
+     * complete OBUs received so far. Tiles are decoded as their tile group
+     * arrives when running single threaded, otherwise once the frame's last
+     * tile group has been received. Decoding stops after the first shown
+     * frame: call again, with data_size 0 if there is no new data, to go on
+     * with the data still buffered. Do not mix with svt_av1_dec_frame()
+     * on the same handle.
+     *
+     * Without Annex-B, OBUs must carry their size field. With is_annexb set,
+     * every OBU must be preceded by its leb128 obu_length, and the
+     * temporal_unit_size and frame_unit_size fields must be stripped by the
+     * caller as for svt_av1_dec_frame().
+     *
+     * Parameter:
+     * @ *svt_dec_component     Decoder handle
+     * @ *data                  Buffer with data, copied by the decoder
+     * @ data_size              Data size in bytes
+     *
+     *  Returns EB_ErrorNone when a frame for output is complete, it is then
+     *  available from svt_av1_dec_get_picture(), and EB_DecNoOutputPicture
+     *  when more data is needed. */
+EB_API EbErrorType svt_av1_dec_feed(EbComponentType *svt_dec_component, const uint8_t *data,
+                                    const size_t data_size, uint32_t is_annexb);
+
 /* STEP 5: Get the next decoded picture. When several output pictures
      * have been generated, calling this function multiple times will
      * iterate over the decoded pictures. The previous output picture becomes
@@ -29,8 +29,10 @@ extern "C" {
     0x00000002 // signals that the packet contains a show existing frame at the end
 #define EB_BUFFERFLAG_HAS_TD 0x00000004 // signals that the packet contains a TD
 #define EB_BUFFERFLAG_IS_ALT_REF 0x00000008 // signals that the packet contains an ALT_REF frame
+#define EB_BUFFERFLAG_PARTIAL_TU \
+    0x00000010 // signals that the packet holds the start of a TU, the rest follows in later packets
 #define EB_BUFFERFLAG_ERROR_MASK \
-    0xFFFFFFF0 // mask for signalling error assuming top flags fit in 4 bits. To be changed, if more flags are added.
+    0xFFFFFFE0 // mask for signalling error assuming top flags fit in 5 bits. To be changed, if more flags are added.
 
 /************************************************
  * Prediction Structure Config Entry
@@ -644,10 +646,20 @@ typedef struct EbSvtAv1EncConfiguration {
      * Default is 0. */
     uint32_t recon_enabled;
     /* Log 2 Tile Rows and colums . 0 means no tiling,1 means that we split the dimension
-        * into 2
+        * into 2, -1 means that the encoder picks it from the resolution, the number of
+        * logical processors and the level
         * Default is 0. */
     int32_t tile_columns;
     int32_t tile_rows;
+    /* Sub-frame output. Each tile is sent in its own OBU_TILE_GROUP as soon as
+     * it is entropy coded, in packets flagged EB_BUFFERFLAG_PARTIAL_TU, instead
+     * of waiting for the whole frame. Only the next frame in decode order is
+     * streamed, so with a random access prediction structure the tiles of the
+     * following frames of a temporal unit wait until it is done. Use a low
+     * delay structure for the lowest latency.
+     *
+     * Default is 0. */
+    EbBool subframe_output;
 
     /* To be deprecated.
  * Encoder configuration parameters below this line are to be deprecated. */
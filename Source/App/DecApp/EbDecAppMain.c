@@ -10,6 +10,7 @@
 #include <stdlib.h>
 #include <assert.h>
 #include <inttypes.h>
+#include <string.h>
 
 #include "EbSvtAv1Dec.h"
 #include "EbDecParamParser.h"
@@ -19,8 +20,60 @@
 #ifdef _WIN32
 #include <io.h> /* _setmode() */
 #include <fcntl.h> /* _O_BINARY */
+#include <malloc.h> /* _aligned_malloc() */
 #endif
 
+/* Frame buffer pool handed to the decoder with -ext-fb.
+   Buffers are recycled once the decoder releases them. */
+#define EXT_FB_POOL_SIZE 16
+
+typedef struct ExtFrameBufPool {
+    uint8_t *buffer[EXT_FB_POOL_SIZE];
+    uint32_t size[EXT_FB_POOL_SIZE];
+    uint8_t  in_use[EXT_FB_POOL_SIZE];
+} ExtFrameBufPool;
+
+static void free_aligned_buffer(uint8_t *buf) {
+#ifdef _WIN32
+    _aligned_free(buf);
+#else
+    free(buf);
+#endif
+}
+
+static int alloc_ext_frame_buf(EbExtFrameBuf *frame_buf, uint32_t min_size, void *private_data) {
+    ExtFrameBufPool *pool = (ExtFrameBufPool *)private_data;
+    int              i;
+
+    for (i = 0; i < EXT_FB_POOL_SIZE; i++)
+        if (!pool->in_use[i]) break;
+    if (i == EXT_FB_POOL_SIZE) return -1;
+
+    if (pool->size[i] < min_size) {
+        free_aligned_buffer(pool->buffer[i]);
+        pool->size[i] = 0;
+#ifdef _WIN32
+        pool->buffer[i] = (uint8_t *)_aligned_malloc(min_size, 64);
+#else
+        if (posix_memalign((void **)&pool->buffer[i], 64, min_size)) pool->buffer[i] = NULL;
+#endif
+        if (!pool->buffer[i]) return -1;
+        pool->size[i] = min_size;
+    }
+
+    pool->in_use[i]         = 1;
+    frame_buf->buffer       = pool->buffer[i];
+    frame_buf->buffer_size  = pool->size[i];
+    frame_buf->private_data = &pool->in_use[i];
+    return 0;
+}
+
+static int release_ext_frame_buf(EbExtFrameBuf *frame_buf, void *private_data) {
+    (void)private_data;
+    *(uint8_t *)frame_buf->private_data = 0;
+    return 0;
+}
+
 int init_pic_buffer(EbSvtIOFormat *pic_buffer, CliInput *cli, EbSvtAv1DecConfiguration *config) {
     /* FilmGrain module req. even dim. for internal operation */
     pic_buffer->y_stride = cli->width & 1 ? cli->width + 1 : cli->width;
@@ -96,6 +149,8 @@ void write_frame(EbBufferHeaderType *recon_buffer, CliInput *cli) {
         }
         assert(img->color_fmt <= EB_YUV444);
 
+        // Semi-planar output: cb holds the cb/cr pairs
+        if (!img->cr) w *= 2;
         for (y = 0; y < h; ++y) {
             fwrite(buf, bytes_per_sample, w, cli->out_file);
             buf += (stride * bytes_per_sample);
@@ -103,7 +158,7 @@ void write_frame(EbBufferHeaderType *recon_buffer, CliInput *cli) {
 
         buf    = img->cr;
         stride = img->cr_stride;
-        for (y = 0; y < h; ++y) {
+        for (y = 0; buf && y < h; ++y) {
             fwrite(buf, bytes_per_sample, w, cli->out_file);
             buf += (stride * bytes_per_sample);
         }
@@ -140,6 +195,7 @@ int32_t main(int32_t argc, char *argv[]) {
     cli.fps_summary = 0;
     cli.width = 0;
     cli.height = 0;
+    cli.ext_frame_buf = 0;
 
     DecInputContext    input   = {NULL, NULL};
     ObuDecInputContext obu_ctx = {NULL, 0, 0, 0, 0};
@@ -160,6 +216,11 @@ int32_t main(int32_t argc, char *argv[]) {
     uint8_t *buf             = NULL;
     size_t   bytes_in_buffer = 0, buffer_size = 0;
 
+    ExtFrameBufPool ext_fb_pool;
+    memset(&ext_fb_pool, 0, sizeof(ext_fb_pool));
+    /* Output planes point into a frame buffer of the pool */
+    EbBool ext_frame_buf = EB_FALSE;
+
     // Initialize config
     if (!config_ptr) return EB_ErrorInsufficientResources;
     EbComponentType *p_handle;
@@ -170,7 +231,10 @@ int32_t main(int32_t argc, char *argv[]) {
 
     if (read_command_line(argc, argv, config_ptr, &cli, &obu_ctx) == 0 &&
         !svt_av1_dec_set_parameter(p_handle, config_ptr)) {
-        return_error = svt_av1_dec_init(p_handle);
+        if (cli.ext_frame_buf)
+            return_error = svt_av1_dec_set_frame_buffer_functions(
+                p_handle, alloc_ext_frame_buf, release_ext_frame_buf, &ext_fb_pool);
+        if (return_error == EB_ErrorNone) return_error = svt_av1_dec_init(p_handle);
         if (return_error != EB_ErrorNone) {
             return_error |= svt_av1_dec_deinit_handle(p_handle);
             goto fail;
@@ -187,6 +251,7 @@ int32_t main(int32_t argc, char *argv[]) {
         EbBufferHeaderType *recon_buffer = NULL;
         recon_buffer                     = (EbBufferHeaderType *)malloc(sizeof(EbBufferHeaderType));
         recon_buffer->p_buffer           = (uint8_t *)malloc(sizeof(EbSvtIOFormat));
+        recon_buffer->flags              = 0;
 
         /* FilmGrain module req. even dim. for internal operation */
         int w = (cli.width & 1) ? (cli.width + 1) : cli.width;
@@ -228,6 +293,7 @@ int32_t main(int32_t argc, char *argv[]) {
                     if (svt_av1_dec_get_picture(p_handle, recon_buffer, stream_info, frame_info) !=
                         EB_DecNoOutputPicture) {
                         if (fps_frm) show_progress(in_frame, dx_time);
+                        ext_frame_buf = frame_info->ext_frame_buf;
 
                         if (enable_md5) write_md5(recon_buffer, &md5_ctx);
                         if (cli.out_file != NULL) write_frame(recon_buffer, &cli);
@@ -251,9 +317,12 @@ int32_t main(int32_t argc, char *argv[]) {
             free(stream_info);
         }
 
-        free(((EbSvtIOFormat *)recon_buffer->p_buffer)->cr);
-        free(((EbSvtIOFormat *)recon_buffer->p_buffer)->cb);
-        free(((EbSvtIOFormat *)recon_buffer->p_buffer)->luma);
+        if (!ext_frame_buf) {
+            free(((EbSvtIOFormat *)recon_buffer->p_buffer)->cr);
+            free(((EbSvtIOFormat *)recon_buffer->p_buffer)->cb);
+            free(((EbSvtIOFormat *)recon_buffer->p_buffer)->luma);
+        }
+        for (int i = 0; i < EXT_FB_POOL_SIZE; i++) free_aligned_buffer(ext_fb_pool.buffer[i]);
 
         free(recon_buffer->p_buffer);
         free(recon_buffer);
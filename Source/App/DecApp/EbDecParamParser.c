@@ -38,6 +38,12 @@ static void set_decoder_16bit_pipeline(const char *value, EbSvtAv1DecConfigurati
         cfg->is_16bit_pipeline = 0;
     }
 };
+static void set_eight_bit_output(const char *value, EbSvtAv1DecConfiguration *cfg) {
+    cfg->eight_bit_output = (EbBool)strtoul(value, NULL, 0);
+};
+static void set_semi_planar_output(const char *value, EbSvtAv1DecConfiguration *cfg) {
+    cfg->semi_planar_output = (EbBool)strtoul(value, NULL, 0);
+};
 static void set_pic_width(const char *value, EbSvtAv1DecConfiguration *cfg) {
     cfg->max_picture_width = strtoul(value, NULL, 0);
 };
@@ -70,6 +76,8 @@ ConfigEntry config_entry[] = {
     // Picture properties
     {BIT_DEPTH_TOKEN, "InputBitDepth", 1, set_bit_depth},
     {DECODER_16BIT_PIPELINE, "Decoder16BitPipeline", 1, set_decoder_16bit_pipeline},
+    {EIGHT_BIT_OUTPUT_TOKEN, "EightBitOutput", 0, set_eight_bit_output},
+    {SEMI_PLANAR_OUTPUT_TOKEN, "SemiPlanarOutput", 0, set_semi_planar_output},
     {PIC_WIDTH_TOKEN, "PictureWidth", 1, set_pic_width},
     {PIC_HEIGHT_TOKEN, "PictureHeight", 1, set_pic_height},
     {COLOUR_SPACE_TOKEN, "InputColourSpace", 1, set_colour_space},
@@ -97,6 +105,9 @@ static void show_help() {
     H0( " -fps-summary              Show fps summary");
     H0( " -skip-film-grain          Disable Film Grain");
     H0( " -16bit-pipeline           Enable 16b pipeline. [1 - enable, 0 - disable]");
+    H0( " -ext-fb                   Decode into application allocated frame buffers");
+    H0( " -8bit-output              Output 8-bit pictures for high bit depth streams");
+    H0( " -semi-planar              Output 4:2:0 pictures as NV12 / P010");
 
     exit(1);
 }
@@ -155,6 +166,8 @@ EbErrorType read_command_line(int32_t argc, char *const argv[], EbSvtAv1DecConfi
                 cli->skip_film_grain = 1;
             else if (EB_STRCMP(cmd_copy[token_index], ANNEX_B_TOKEN) == 0)
                 obu_ctx->is_annexb = 1;
+            else if (EB_STRCMP(cmd_copy[token_index], EXT_FRAME_BUF_TOKEN) == 0)
+                cli->ext_frame_buf = 1;
             else if (EB_STRCMP(cmd_copy[token_index], HELP_TOKEN) == 0)
                 show_help();
             else {
@@ -45,6 +45,9 @@
 #define FPS_SUMMARY_TOKEN "-fps-summary"
 #define FILM_GRAIN_TOKEN "-skip-film-grain"
 #define ANNEX_B_TOKEN "-annex-b"
+#define EXT_FRAME_BUF_TOKEN "-ext-fb"
+#define EIGHT_BIT_OUTPUT_TOKEN "-8bit-output"
+#define SEMI_PLANAR_OUTPUT_TOKEN "-semi-planar"
 #define MAX_NUM_TOKENS 200
 
 #define EB_STRCMP(target, token) strcmp(target, token)
@@ -61,6 +61,7 @@ typedef struct CliInput {
     uint32_t                       fps_frm;
     uint32_t                       fps_summary;
     uint32_t                       skip_film_grain;
+    uint32_t                       ext_frame_buf;
 } CliInput;
 
 typedef struct ObuDecInputContext {
@@ -269,6 +269,9 @@ void write_md5(EbBufferHeaderType *recon_buffer, Md5Context *md5) {
 
         stride = img->cb_stride;
 
+        // Semi-planar output: cb holds the cb/cr pairs
+        if (!img->cr) w *= 2;
+
         //cb MD5 generation
         buf = img->cb;
         for (y = 0; y < h; ++y) {
@@ -279,7 +282,7 @@ void write_md5(EbBufferHeaderType *recon_buffer, Md5Context *md5) {
         //cr MD5 generation
         buf    = img->cr;
         stride = img->cr_stride;
-        for (y = 0; y < h; ++y) {
+        for (y = 0; buf && y < h; ++y) {
             md5_update(md5, buf, w * bytes_per_sample);
             buf += (stride * bytes_per_sample);
         }
@@ -11,6 +11,8 @@
 #include "EbAppString.h"
 #include "EbAppConfig.h"
 #include "EbAppInputy4m.h"
+#include "EbAppInputMmap.h"
+#include "EbAppOutputWriter.h"
 
 #ifdef _WIN32
 #include <windows.h>
@@ -42,6 +44,8 @@
 #define NUMBER_OF_PICTURES_TOKEN "-n"
 #define BUFFERED_INPUT_TOKEN "-nb"
 #define NO_PROGRESS_TOKEN "--no-progress"
+#define MMAP_INPUT_TOKEN "--mmap-input"
+#define OUTPUT_QUEUE_TOKEN "--output-queue"
 #define BASE_LAYER_SWITCH_MODE_TOKEN "-base-layer-switch-mode" // no Eval
 #define QP_TOKEN "-q"
 #define USE_QP_FILE_TOKEN "-use-q-file"
@@ -159,6 +163,7 @@
 #define SUPER_BLOCK_SIZE_TOKEN "-sb-size"
 #define TILE_ROW_TOKEN "-tile-rows"
 #define TILE_COL_TOKEN "-tile-columns"
+#define SUBFRAME_OUTPUT_TOKEN "-subframe-output"
 
 #define SQ_WEIGHT_TOKEN "-sqw"
 #define CHROMA_MODE_TOKEN "-chroma-mode"
@@ -337,6 +342,12 @@ static void set_cfg_frames_to_be_encoded(const char *value, EbConfig *cfg) {
 static void set_buffered_input(const char *value, EbConfig *cfg) {
     cfg->buffered_input = strtol(value, NULL, 0);
 };
+static void set_mmap_input(const char *value, EbConfig *cfg) {
+    cfg->mmap_input = strtoul(value, NULL, 0);
+};
+static void set_output_queue(const char *value, EbConfig *cfg) {
+    cfg->output_queue_depth = strtoul(value, NULL, 0);
+};
 static void set_no_progress(const char*value, EbConfig *cfg) {
     cfg->no_progress = (EbBool)strtoul(value, NULL, 0);
 }
@@ -517,10 +528,13 @@ static void set_enable_hme_level_0_flag(const char *value, EbConfig *cfg) {
     cfg->enable_hme_level0_flag = (EbBool)strtoul(value, NULL, 0);
 };
 static void set_tile_row(const char *value, EbConfig *cfg) {
-    cfg->tile_rows = strtoul(value, NULL, 0);
+    cfg->tile_rows = strtol(value, NULL, 0);
 };
 static void set_tile_col(const char *value, EbConfig *cfg) {
-    cfg->tile_columns = strtoul(value, NULL, 0);
+    cfg->tile_columns = strtol(value, NULL, 0);
+};
+static void set_subframe_output(const char *value, EbConfig *cfg) {
+    cfg->subframe_output = (EbBool)strtoul(value, NULL, 0);
 };
 static void set_scene_change_detection(const char *value, EbConfig *cfg) {
     cfg->scene_change_detection = strtoul(value, NULL, 0);
@@ -790,6 +804,10 @@ ConfigEntry config_entry_options[] = {
     {SINGLE_INPUT, OUTPUT_RECON_LONG_TOKEN, "Recon filename", set_cfg_recon_file},
 
     {SINGLE_INPUT, STAT_FILE_TOKEN, "Stat filename", set_cfg_stat_file},
+    {SINGLE_INPUT,
+     OUTPUT_QUEUE_TOKEN,
+     "Queue up to n output writes to a separate writer thread (0: write synchronously)",
+     set_output_queue},
     {SINGLE_INPUT, NULL, NULL, NULL}};
 
 ConfigEntry config_entry_global_options[] = {
@@ -810,6 +828,10 @@ ConfigEntry config_entry_global_options[] = {
      set_cfg_frames_to_be_encoded},
 
     {SINGLE_INPUT, BUFFERED_INPUT_TOKEN, "Buffer n input frames", set_buffered_input},
+    {SINGLE_INPUT,
+     MMAP_INPUT_TOKEN,
+     "Memory-map the input and read n frames ahead on a separate thread (0: OFF)",
+     set_mmap_input},
     {SINGLE_INPUT, NO_PROGRESS_TOKEN, "Do not print out progress", set_no_progress},
     {SINGLE_INPUT,
      ENCODER_COLOR_FORMAT,
@@ -939,8 +961,12 @@ ConfigEntry config_entry_specific[] = {
      INPUT_COMPRESSED_TEN_BIT_FORMAT,
      "Offline packing of the 2bits: requires two bits packed input (0: OFF[default], 1: ON)",
      set_compressed_ten_bit_format},
-    {SINGLE_INPUT, TILE_ROW_TOKEN, "Number of tile rows to use, log2[0-6]", set_tile_row},
-    {SINGLE_INPUT, TILE_COL_TOKEN, "Number of tile columns to use, log2[0-4]", set_tile_col},
+    {SINGLE_INPUT, TILE_ROW_TOKEN, "Number of tile rows to use, log2[0-6], -1: auto", set_tile_row},
+    {SINGLE_INPUT, TILE_COL_TOKEN, "Number of tile columns to use, log2[0-4], -1: auto", set_tile_col},
+    {SINGLE_INPUT,
+     SUBFRAME_OUTPUT_TOKEN,
+     "Output each tile as soon as it is coded (0: OFF[default], 1: ON)",
+     set_subframe_output},
     {SINGLE_INPUT, QP_TOKEN, "Constant/Constrained Quality level", set_cfg_qp},
     {SINGLE_INPUT, QP_LONG_TOKEN, "Constant/Constrained Quality level", set_cfg_qp},
 
@@ -1316,6 +1342,8 @@ ConfigEntry config_entry[] = {
     // Prediction Structure
     {SINGLE_INPUT, NUMBER_OF_PICTURES_TOKEN, "FrameToBeEncoded", set_cfg_frames_to_be_encoded},
     {SINGLE_INPUT, BUFFERED_INPUT_TOKEN, "BufferedInput", set_buffered_input},
+    {SINGLE_INPUT, MMAP_INPUT_TOKEN, "MmapInput", set_mmap_input},
+    {SINGLE_INPUT, OUTPUT_QUEUE_TOKEN, "OutputQueue", set_output_queue},
     {SINGLE_INPUT, NO_PROGRESS_TOKEN, "NoProgress", set_no_progress},
     {SINGLE_INPUT, ENCMODE_TOKEN, "EncoderMode", set_enc_mode},
     {SINGLE_INPUT, ENCMODE2P_TOKEN, "EncoderMode2p", set_snd_pass_enc_mode},
@@ -1338,6 +1366,7 @@ ConfigEntry config_entry[] = {
     {SINGLE_INPUT, PRED_STRUCT_TOKEN, "PredStructure", set_cfg_pred_structure},
     {SINGLE_INPUT, TILE_ROW_TOKEN, "TileRow", set_tile_row},
     {SINGLE_INPUT, TILE_COL_TOKEN, "TileCol", set_tile_col},
+    {SINGLE_INPUT, SUBFRAME_OUTPUT_TOKEN, "SubframeOutput", set_subframe_output},
     // Rate Control
     {SINGLE_INPUT,
      SCENE_CHANGE_DETECTION_TOKEN,
@@ -1651,6 +1680,7 @@ void eb_config_ctor(EbConfig *config_ptr) {
     config_ptr->is_16bit_pipeline = 0;
     config_ptr->encoder_color_format   = 1; //EB_YUV420
     config_ptr->buffered_input         = -1;
+    config_ptr->output_queue_depth     = 32;
 
     config_ptr->qp                  = 50;
     config_ptr->use_qp_file         = EB_FALSE;
@@ -1799,6 +1829,10 @@ void eb_config_dtor(EbConfig *config_ptr) {
         config_ptr->config_file = (FILE *)NULL;
     }
 
+    mmap_input_close(config_ptr);
+    output_writer_close(config_ptr);
+    free(config_ptr->partial_tu);
+    config_ptr->partial_tu = NULL;
     if (config_ptr->input_file) {
         if (!config_ptr->input_file_is_fifo) fclose(config_ptr->input_file);
         config_ptr->input_file = (FILE *)NULL;
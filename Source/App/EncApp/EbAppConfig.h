@@ -192,6 +192,18 @@ typedef struct EbConfig {
     int32_t   frames_encoded;
     int32_t   buffered_input;
     uint8_t **sequence_buffer;
+    // number of frames the mmap read-ahead thread prepares ahead of the encoder, 0 = off
+    uint32_t  mmap_input;
+    struct EbMmapInput *mmap_reader;
+    // number of pending writes queued to the output writer thread, 0 = write synchronously
+    uint32_t               output_queue_depth;
+    struct EbOutputWriter *output_writer;
+    // sub-frame output packets of the temporal unit being received, written out with its last packet
+    uint8_t *partial_tu;
+    uint32_t partial_tu_size;
+    uint32_t partial_tu_capacity;
+    // an output file write failed, the encoder is drained and the encode ends with an error
+    EbBool output_error;
 
     uint8_t latency_mode;
 
@@ -429,6 +441,7 @@ typedef struct EbConfig {
     int32_t enable_palette;
     int32_t tile_columns;
     int32_t tile_rows;
+    EbBool  subframe_output;
 
     /****************************************
      * Rate Control
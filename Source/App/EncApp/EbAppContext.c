@@ -12,6 +12,8 @@
 
 #include "EbAppContext.h"
 #include "EbAppConfig.h"
+#include "EbAppInputMmap.h"
+#include "EbAppOutputWriter.h"
 
 #define IS_16_BIT(bit_depth) (bit_depth == 10 ? 1 : 0)
 
@@ -92,6 +94,7 @@ EbErrorType copy_configuration_parameters(EbConfig *config, EbAppContext *callba
     callback_data->eb_enc_parameters.ext_block_flag         = config->ext_block_flag;
     callback_data->eb_enc_parameters.tile_rows              = config->tile_rows;
     callback_data->eb_enc_parameters.tile_columns           = config->tile_columns;
+    callback_data->eb_enc_parameters.subframe_output        = config->subframe_output;
     callback_data->eb_enc_parameters.scene_change_detection = config->scene_change_detection;
     callback_data->eb_enc_parameters.look_ahead_distance    = config->look_ahead_distance;
 #if 1//TPL_LA
@@ -355,8 +358,8 @@ EbErrorType allocate_input_buffers(EbConfig *config, EbAppContext *callback_data
                   EB_N_PTR,
                   EB_ErrorInsufficientResources);
 
-    // Allocate frame buffer for the p_buffer
-    if (config->buffered_input == -1)
+    // Allocate frame buffer for the p_buffer, a mapped input is read in place
+    if (config->buffered_input == -1 && !config->mmap_reader)
         allocate_frame_buffer(config, callback_data->input_buffer_pool->p_buffer);
 
     // Assign the variables
@@ -482,6 +485,11 @@ EbErrorType init_encoder(EbConfig *config, EbAppContext *callback_data, uint32_t
 
     ///********************** APPLICATION INIT [START] ******************///
 
+    // Map the input file and start its read-ahead thread
+    if (config->mmap_input && config->buffered_input == -1 &&
+        mmap_input_open(config) != EB_ErrorNone)
+        fprintf(stderr, "\nWarning: could not memory-map the input, falling back to file reads");
+
     // STEP 6: Allocate input buffers carrying the yuv frames in
     return_error = allocate_input_buffers(config, callback_data);
 
@@ -497,6 +505,9 @@ EbErrorType init_encoder(EbConfig *config, EbAppContext *callback_data, uint32_t
     } else
         config->sequence_buffer = 0;
     if (return_error != EB_ErrorNone) return return_error;
+    // Start the output writer thread
+    if (output_writer_open(config) != EB_ErrorNone)
+        fprintf(stderr, "\nWarning: could not start the output writer, writing synchronously");
     ///********************** APPLICATION INIT [END] ******************////////
 
     return return_error;
@@ -0,0 +1,311 @@
+/*
+* Copyright(c) 2019 Intel Corporation
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+/***************************************
+ * Includes
+ ***************************************/
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "EbAppInputMmap.h"
+#include "EbAppThreads.h"
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#define Y4M_FRAME_DELIMITER "FRAME"
+#define Y4M_FRAME_DELIMITER_SIZE 5
+#define Y4M_FRAME_HEADER_MAX 256
+
+typedef struct EbMmapInput {
+    const uint8_t *base;
+    uint64_t       file_size;
+    uint64_t       data_offset; // first byte after the y4m stream header
+    uint64_t       frame_size;
+    uint64_t       page_size;
+    EbBool         y4m;
+
+    // plane sizes in bytes
+    uint64_t luma_size;
+    uint64_t chroma_size;
+    uint64_t luma_ext_size;
+    uint64_t chroma_ext_size;
+
+    // ring of prepared frames, holding the offset of each frame payload
+    uint64_t *ring;
+    uint32_t  ring_size;
+    uint64_t  produced;
+    uint64_t  consumed;
+    int64_t   frame_total;
+    EbBool    held; // the consumer still references ring[consumed]
+    EbBool    done;
+    EbBool    stop;
+    EbBool    error;
+
+    AppThread thread;
+    AppMutex  lock;
+    AppCond   not_full;
+    AppCond   not_empty;
+#ifdef _WIN32
+    HANDLE mapping;
+#endif
+} EbMmapInput;
+
+/* Finds the payload of the frame starting at *next. Returns EB_FALSE when there
+ * is no complete frame left before the end of the file. */
+static EbBool mmap_input_locate_frame(EbMmapInput *reader, uint64_t *next, uint64_t *offset) {
+    uint64_t pos = *next;
+
+    if (reader->y4m) {
+        const uint64_t end = reader->file_size - pos < Y4M_FRAME_HEADER_MAX
+                                 ? reader->file_size
+                                 : pos + Y4M_FRAME_HEADER_MAX;
+        if (end - pos < Y4M_FRAME_DELIMITER_SIZE) return EB_FALSE;
+        if (memcmp(reader->base + pos, Y4M_FRAME_DELIMITER, Y4M_FRAME_DELIMITER_SIZE)) {
+            reader->error = EB_TRUE;
+            return EB_FALSE;
+        }
+        // frame parameters, if any, are skipped along with the delimiter
+        while (pos < end && reader->base[pos] != '\n') pos++;
+        if (pos == end) return EB_FALSE;
+        pos++;
+    }
+    if (reader->file_size - pos < reader->frame_size) return EB_FALSE;
+
+    *offset = pos;
+    *next   = pos + reader->frame_size;
+    return EB_TRUE;
+}
+
+/* Brings the pages of one frame into memory ahead of the encoder */
+static void mmap_input_prefault(EbMmapInput *reader, uint64_t offset) {
+    const uint64_t start = offset & ~(reader->page_size - 1);
+    const uint64_t end   = offset + reader->frame_size;
+#ifndef _WIN32
+    posix_madvise(
+        (void *)(reader->base + start), (size_t)(end - start), POSIX_MADV_WILLNEED);
+#endif
+    volatile uint8_t sink = 0;
+    for (uint64_t pos = start; pos < end; pos += reader->page_size) sink += reader->base[pos];
+    (void)sink;
+}
+
+static AppThreadRet APP_THREAD_CALL mmap_input_kernel(void *input_ptr) {
+    EbMmapInput *reader = (EbMmapInput *)input_ptr;
+    uint64_t     next   = reader->data_offset;
+
+    for (int64_t frame = 0; frame < reader->frame_total; ++frame) {
+        uint64_t offset;
+
+        app_mutex_lock(&reader->lock);
+        while (reader->produced - reader->consumed >= reader->ring_size && !reader->stop)
+            app_cond_wait(&reader->not_full, &reader->lock);
+        const EbBool stop = reader->stop;
+        app_mutex_unlock(&reader->lock);
+        if (stop) break;
+
+        // loop over the input when more frames are requested than the file holds
+        if (!mmap_input_locate_frame(reader, &next, &offset)) {
+            next = reader->data_offset;
+            if (reader->error || !mmap_input_locate_frame(reader, &next, &offset)) {
+                reader->error = EB_TRUE;
+                break;
+            }
+        }
+        mmap_input_prefault(reader, offset);
+
+        app_mutex_lock(&reader->lock);
+        reader->ring[reader->produced % reader->ring_size] = offset;
+        reader->produced++;
+        app_cond_signal(&reader->not_empty);
+        app_mutex_unlock(&reader->lock);
+    }
+
+    app_mutex_lock(&reader->lock);
+    reader->done = EB_TRUE;
+    app_cond_broadcast(&reader->not_empty);
+    app_mutex_unlock(&reader->lock);
+    return 0;
+}
+
+static EbBool mmap_input_map(EbMmapInput *reader, FILE *input_file) {
+#ifdef _WIN32
+    LARGE_INTEGER size;
+    SYSTEM_INFO   system_info;
+    HANDLE        handle = (HANDLE)_get_osfhandle(_fileno(input_file));
+
+    if (handle == INVALID_HANDLE_VALUE || !GetFileSizeEx(handle, &size) || size.QuadPart <= 0)
+        return EB_FALSE;
+    if ((uint64_t)size.QuadPart > SIZE_MAX) return EB_FALSE;
+    reader->mapping = CreateFileMapping(handle, NULL, PAGE_READONLY, 0, 0, NULL);
+    if (!reader->mapping) return EB_FALSE;
+    reader->base = (const uint8_t *)MapViewOfFile(reader->mapping, FILE_MAP_READ, 0, 0, 0);
+    if (!reader->base) {
+        CloseHandle(reader->mapping);
+        reader->mapping = NULL;
+        return EB_FALSE;
+    }
+    GetSystemInfo(&system_info);
+    reader->file_size = (uint64_t)size.QuadPart;
+    reader->page_size = system_info.dwPageSize;
+#else
+    struct stat statbuf;
+    const int   fd = fileno(input_file);
+
+    if (fstat(fd, &statbuf) || !S_ISREG(statbuf.st_mode) || statbuf.st_size <= 0)
+        return EB_FALSE;
+    if ((uint64_t)statbuf.st_size > SIZE_MAX) return EB_FALSE;
+    void *base = mmap(NULL, (size_t)statbuf.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    if (base == MAP_FAILED) return EB_FALSE;
+    posix_madvise(base, (size_t)statbuf.st_size, POSIX_MADV_SEQUENTIAL);
+    reader->base      = (const uint8_t *)base;
+    reader->file_size = (uint64_t)statbuf.st_size;
+    reader->page_size = (uint64_t)sysconf(_SC_PAGESIZE);
+#endif
+    return EB_TRUE;
+}
+
+static void mmap_input_unmap(EbMmapInput *reader) {
+    if (!reader->base) return;
+#ifdef _WIN32
+    UnmapViewOfFile(reader->base);
+    CloseHandle(reader->mapping);
+#else
+    munmap((void *)reader->base, (size_t)reader->file_size);
+#endif
+    reader->base = NULL;
+}
+
+EbErrorType mmap_input_open(EbConfig *config) {
+    if (!config->input_file || config->input_file == stdin || config->input_file_is_fifo ||
+        config->frames_to_be_encoded <= 0)
+        return EB_ErrorBadParameter;
+
+    EbMmapInput *reader = (EbMmapInput *)calloc(1, sizeof(EbMmapInput));
+    if (!reader) return EB_ErrorInsufficientResources;
+
+    if (!mmap_input_map(reader, config->input_file)) {
+        free(reader);
+        return EB_ErrorBadParameter;
+    }
+
+    const uint64_t is_16bit     = config->encoder_bit_depth > 8;
+    const uint8_t  color_format = (uint8_t)config->encoder_color_format;
+    const uint64_t luma_samples =
+        (uint64_t)config->input_padded_width * config->input_padded_height;
+    if (is_16bit && config->compressed_ten_bit_format == 1) {
+        reader->luma_size       = luma_samples;
+        reader->chroma_size     = luma_samples >> (3 - color_format);
+        reader->luma_ext_size   = luma_samples / 4;
+        reader->chroma_ext_size = reader->luma_ext_size >> (3 - color_format);
+    } else {
+        reader->luma_size   = luma_samples << is_16bit;
+        reader->chroma_size = reader->luma_size >> (3 - color_format);
+    }
+    reader->frame_size = reader->luma_size + reader->luma_ext_size +
+                         2 * (reader->chroma_size + reader->chroma_ext_size);
+
+    // the stream header has already been parsed, only its length is needed here
+    reader->y4m = config->y4m_input;
+    if (reader->y4m) {
+        const uint8_t *eol = (const uint8_t *)memchr(reader->base, '\n', (size_t)reader->file_size);
+        reader->data_offset = eol ? (uint64_t)(eol - reader->base) + 1 : reader->file_size;
+    }
+
+    reader->frame_total = config->frames_to_be_encoded;
+    reader->ring_size   = (int64_t)config->mmap_input > reader->frame_total
+                            ? (uint32_t)reader->frame_total
+                            : config->mmap_input;
+    reader->ring = (uint64_t *)malloc(sizeof(*reader->ring) * reader->ring_size);
+    if (!reader->ring || !reader->frame_size) {
+        const EbErrorType return_error =
+            reader->ring ? EB_ErrorBadParameter : EB_ErrorInsufficientResources;
+        mmap_input_unmap(reader);
+        free(reader->ring);
+        free(reader);
+        return return_error;
+    }
+
+    app_mutex_init(&reader->lock);
+    app_cond_init(&reader->not_full);
+    app_cond_init(&reader->not_empty);
+    if (!app_thread_create(&reader->thread, mmap_input_kernel, reader)) {
+        app_cond_destroy(&reader->not_empty);
+        app_cond_destroy(&reader->not_full);
+        app_mutex_destroy(&reader->lock);
+        mmap_input_unmap(reader);
+        free(reader->ring);
+        free(reader);
+        return EB_ErrorInsufficientResources;
+    }
+
+    config->mmap_reader = reader;
+    return EB_ErrorNone;
+}
+
+void mmap_input_close(EbConfig *config) {
+    EbMmapInput *reader = config->mmap_reader;
+    if (!reader) return;
+
+    app_mutex_lock(&reader->lock);
+    reader->stop = EB_TRUE;
+    app_cond_broadcast(&reader->not_full);
+    app_mutex_unlock(&reader->lock);
+    app_thread_join(reader->thread);
+    app_cond_destroy(&reader->not_empty);
+    app_cond_destroy(&reader->not_full);
+    app_mutex_destroy(&reader->lock);
+    mmap_input_unmap(reader);
+    free(reader->ring);
+    free(reader);
+    config->mmap_reader = NULL;
+}
+
+uint32_t mmap_input_read_frame(EbConfig *config, EbBufferHeaderType *header_ptr) {
+    EbMmapInput *  reader    = config->mmap_reader;
+    EbSvtIOFormat *input_ptr = (EbSvtIOFormat *)header_ptr->p_buffer;
+    uint64_t       offset;
+
+    app_mutex_lock(&reader->lock);
+    // the library copied the previous frame out in svt_av1_enc_send_picture(),
+    // so its slot can be refilled
+    if (reader->held) {
+        reader->consumed++;
+        reader->held = EB_FALSE;
+        app_cond_signal(&reader->not_full);
+    }
+    while (reader->produced == reader->consumed && !reader->done)
+        app_cond_wait(&reader->not_empty, &reader->lock);
+    if (reader->produced == reader->consumed) {
+        app_mutex_unlock(&reader->lock);
+        if (reader->error)
+            fprintf(config->error_log_file, "Error: could not locate the next input frame\n");
+        config->stop_encoder = EB_TRUE;
+        return 0;
+    }
+    offset       = reader->ring[reader->consumed % reader->ring_size];
+    reader->held = EB_TRUE;
+    app_mutex_unlock(&reader->lock);
+
+    uint8_t *frame  = (uint8_t *)reader->base + offset;
+    input_ptr->luma = frame;
+    input_ptr->cb   = input_ptr->luma + reader->luma_size;
+    input_ptr->cr   = input_ptr->cb + reader->chroma_size;
+    if (reader->luma_ext_size) {
+        input_ptr->luma_ext = input_ptr->cr + reader->chroma_size;
+        input_ptr->cb_ext   = input_ptr->luma_ext + reader->luma_ext_size;
+        input_ptr->cr_ext   = input_ptr->cb_ext + reader->chroma_ext_size;
+    } else {
+        input_ptr->luma_ext = NULL;
+        input_ptr->cb_ext   = NULL;
+        input_ptr->cr_ext   = NULL;
+    }
+
+    return (uint32_t)reader->frame_size;
+}
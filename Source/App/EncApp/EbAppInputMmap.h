@@ -0,0 +1,29 @@
+/*
+* Copyright(c) 2019 Intel Corporation
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+#ifndef EbAppInputMmap_h
+#define EbAppInputMmap_h
+
+#include "EbAppConfig.h"
+
+/* Memory-mapped input reader.
+ * The input file is mapped read-only and a read-ahead thread walks the frames
+ * in front of the encoder, locating each frame (skipping y4m delimiters) and
+ * faulting its pages in, then publishes it into a ring of config->mmap_input
+ * prepared frames. read_input_frames() takes the next prepared frame and
+ * points the input planes straight into the mapping, so neither the disk nor
+ * the page cache is touched on the feeding thread. Only regular files are
+ * supported; for stdin and pipes mmap_input_open() fails and the caller falls
+ * back to the fread() path. */
+
+EbErrorType mmap_input_open(EbConfig *config);
+
+void mmap_input_close(EbConfig *config);
+
+/* Points header_ptr's planes at the next prepared frame, returns the frame size
+ * in bytes or 0 when the reader was stopped */
+uint32_t mmap_input_read_frame(EbConfig *config, EbBufferHeaderType *header_ptr);
+
+#endif // EbAppInputMmap_h
@@ -21,6 +21,7 @@
 #include <stdint.h>
 #include "EbAppConfig.h"
 #include "EbAppContext.h"
+#include "EbAppOutputWriter.h"
 #include "EbTime.h"
 #include "EbAppString.h"
 #ifdef _WIN32
@@ -246,6 +247,16 @@ int32_t main(int32_t argc, char *argv[]) {
                     }
                 }
 
+                // Flush the pending output before the summaries are written, a write that
+                // failed on the writer thread fails the channel
+                for (inst_cnt = 0; inst_cnt < num_channels; ++inst_cnt) {
+                    if (output_writer_close(configs[inst_cnt]) != EB_ErrorNone &&
+                        exit_cond[inst_cnt] == APP_ExitConditionFinished) {
+                        fprintf(stderr, "\nError writing the output files\n");
+                        exit_cond[inst_cnt] = APP_ExitConditionError;
+                    }
+                }
+
                 for (inst_cnt = 0; inst_cnt < num_channels; ++inst_cnt) {
                     if (exit_cond[inst_cnt] == APP_ExitConditionFinished &&
                         return_errors[inst_cnt] == EB_ErrorNone) {
@@ -410,11 +421,13 @@ int32_t main(int32_t argc, char *argv[]) {
                 } else if (return_errors[inst_cnt] == EB_ErrorInsufficientResources)
                     fprintf(
                         stderr, "Could not allocate enough memory for channel %u\n", inst_cnt + 1);
-                else
+                else {
                     fprintf(stderr,
                             "Error encoding at channel %u! Check error log file for more details "
                             "... \n",
                             inst_cnt + 1);
+                    return_error = EB_ErrorUndefined;
+                }
             }
             // DeInit Encoder
             for (inst_cnt = num_channels; inst_cnt > 0; --inst_cnt) {
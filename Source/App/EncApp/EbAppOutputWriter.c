@@ -0,0 +1,218 @@
+/*
+* Copyright(c) 2019 Intel Corporation
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+/***************************************
+ * Includes
+ ***************************************/
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include "EbAppOutputWriter.h"
+#include "EbAppThreads.h"
+
+typedef struct EbOutputJob {
+    FILE *   file;
+    int64_t  offset; // -1 appends
+    uint8_t *data;
+    size_t   size;
+    size_t   capacity; // data is kept between jobs and only grows
+} EbOutputJob;
+
+typedef struct EbOutputWriter {
+    EbOutputJob *queue;
+    uint32_t     queue_size;
+    uint32_t     head; // next job to write
+    uint32_t     count; // jobs queued
+    EbBool       stop;
+    EbErrorType  status;
+    FILE *       error_file; // file of the write that set status
+
+    AppThread thread;
+    AppMutex  lock;
+    AppCond   not_full;
+    AppCond   not_empty;
+} EbOutputWriter;
+
+static EbErrorType output_write_file(FILE *file, int64_t offset, const void *data, size_t size) {
+    if (offset >= 0 && fseeko(file, offset, SEEK_SET)) return EB_ErrorUndefined;
+    return fwrite(data, 1, size, file) == size ? EB_ErrorNone : EB_ErrorUndefined;
+}
+
+static AppThreadRet APP_THREAD_CALL output_writer_kernel(void *input_ptr) {
+    EbOutputWriter *writer = (EbOutputWriter *)input_ptr;
+
+    for (;;) {
+        app_mutex_lock(&writer->lock);
+        while (!writer->count && !writer->stop) app_cond_wait(&writer->not_empty, &writer->lock);
+        if (!writer->count) {
+            app_mutex_unlock(&writer->lock);
+            break;
+        }
+        EbOutputJob *job = &writer->queue[writer->head];
+        app_mutex_unlock(&writer->lock);
+
+        const EbErrorType status = output_write_file(job->file, job->offset, job->data, job->size);
+
+        app_mutex_lock(&writer->lock);
+        if (status != EB_ErrorNone && writer->status == EB_ErrorNone) {
+            writer->status     = status;
+            writer->error_file = job->file;
+        }
+        writer->head = (writer->head + 1) % writer->queue_size;
+        writer->count--;
+        app_cond_signal(&writer->not_full);
+        app_mutex_unlock(&writer->lock);
+    }
+    return 0;
+}
+
+/* Waits for a free entry and makes room for size bytes in it */
+static EbOutputJob *output_writer_get_job(EbOutputWriter *writer, size_t size) {
+    app_mutex_lock(&writer->lock);
+    while (writer->count == writer->queue_size) app_cond_wait(&writer->not_full, &writer->lock);
+    EbOutputJob *job = &writer->queue[(writer->head + writer->count) % writer->queue_size];
+    app_mutex_unlock(&writer->lock);
+
+    if (job->capacity < size) {
+        uint8_t *data = (uint8_t *)realloc(job->data, size);
+        if (!data) return NULL;
+        job->data     = data;
+        job->capacity = size;
+    }
+    job->size = size;
+    return job;
+}
+
+static void output_writer_post_job(EbOutputWriter *writer) {
+    app_mutex_lock(&writer->lock);
+    writer->count++;
+    app_cond_signal(&writer->not_empty);
+    app_mutex_unlock(&writer->lock);
+}
+
+EbErrorType output_writer_open(EbConfig *config) {
+    if (!config->output_queue_depth) return EB_ErrorNone;
+
+    EbOutputWriter *writer = (EbOutputWriter *)calloc(1, sizeof(EbOutputWriter));
+    if (!writer) return EB_ErrorInsufficientResources;
+    writer->queue_size = config->output_queue_depth;
+    writer->queue      = (EbOutputJob *)calloc(writer->queue_size, sizeof(EbOutputJob));
+    if (!writer->queue) {
+        free(writer);
+        return EB_ErrorInsufficientResources;
+    }
+
+    app_mutex_init(&writer->lock);
+    app_cond_init(&writer->not_full);
+    app_cond_init(&writer->not_empty);
+    if (!app_thread_create(&writer->thread, output_writer_kernel, writer)) {
+        app_cond_destroy(&writer->not_empty);
+        app_cond_destroy(&writer->not_full);
+        app_mutex_destroy(&writer->lock);
+        free(writer->queue);
+        free(writer);
+        return EB_ErrorInsufficientResources;
+    }
+
+    config->output_writer = writer;
+    return EB_ErrorNone;
+}
+
+/* Writes out what stdio still buffers, a full device is only reported there */
+static EbErrorType output_flush_files(EbConfig *config) {
+    FILE *const files[] = {config->bitstream_file, config->recon_file, config->stat_file};
+    EbErrorType status  = EB_ErrorNone;
+
+    for (size_t i = 0; i < sizeof(files) / sizeof(files[0]); i++)
+        if (files[i] && fflush(files[i])) status = EB_ErrorUndefined;
+    return status;
+}
+
+EbErrorType output_writer_close(EbConfig *config) {
+    EbOutputWriter *writer = config->output_writer;
+    if (!writer) return output_flush_files(config);
+
+    app_mutex_lock(&writer->lock);
+    writer->stop = EB_TRUE;
+    app_cond_signal(&writer->not_empty);
+    app_mutex_unlock(&writer->lock);
+    app_thread_join(writer->thread);
+    const EbErrorType status = writer->status;
+    const EbErrorType flush_status = output_flush_files(config);
+
+    app_cond_destroy(&writer->not_empty);
+    app_cond_destroy(&writer->not_full);
+    app_mutex_destroy(&writer->lock);
+    for (uint32_t i = 0; i < writer->queue_size; i++) free(writer->queue[i].data);
+    free(writer->queue);
+    free(writer);
+    config->output_writer = NULL;
+    return status != EB_ErrorNone ? status : flush_status;
+}
+
+EbErrorType output_writer_write(EbConfig *config, FILE *file, int64_t offset, const void *data,
+                                size_t size) {
+    EbOutputWriter *writer = config->output_writer;
+    if (!writer) return output_write_file(file, offset, data, size);
+
+    EbOutputJob *job = output_writer_get_job(writer, size);
+    if (!job) return EB_ErrorInsufficientResources;
+    job->file   = file;
+    job->offset = offset;
+    memcpy(job->data, data, size);
+    output_writer_post_job(writer);
+
+    return output_writer_status(config);
+}
+
+EbErrorType output_writer_printf(EbConfig *config, FILE *file, const char *format, ...) {
+    EbOutputWriter *writer = config->output_writer;
+    va_list         args;
+
+    if (!writer) {
+        va_start(args, format);
+        const int len = vfprintf(file, format, args);
+        va_end(args);
+        return len < 0 ? EB_ErrorUndefined : EB_ErrorNone;
+    }
+
+    va_start(args, format);
+    const int len = vsnprintf(NULL, 0, format, args);
+    va_end(args);
+    if (len < 0) return EB_ErrorUndefined;
+
+    // room for the terminating null vsnprintf() writes, which is not output
+    EbOutputJob *job = output_writer_get_job(writer, (size_t)len + 1);
+    if (!job) return EB_ErrorInsufficientResources;
+    va_start(args, format);
+    vsnprintf((char *)job->data, (size_t)len + 1, format, args);
+    va_end(args);
+    job->file   = file;
+    job->offset = -1;
+    job->size   = (size_t)len;
+    output_writer_post_job(writer);
+
+    return output_writer_status(config);
+}
+
+EbErrorType output_writer_status(EbConfig *config) {
+    EbOutputWriter *writer = config->output_writer;
+    if (!writer) return EB_ErrorNone;
+
+    app_mutex_lock(&writer->lock);
+    const EbErrorType status = writer->status;
+    app_mutex_unlock(&writer->lock);
+    return status;
+}
+
+FILE *output_writer_error_file(EbConfig *config) {
+    EbOutputWriter *writer = config->output_writer;
+    if (!writer) return NULL;
+
+    app_mutex_lock(&writer->lock);
+    FILE *const file = writer->error_file;
+    app_mutex_unlock(&writer->lock);
+    return file;
+}
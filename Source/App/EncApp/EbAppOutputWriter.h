@@ -0,0 +1,37 @@
+/*
+* Copyright(c) 2019 Intel Corporation
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+#ifndef EbAppOutputWriter_h
+#define EbAppOutputWriter_h
+
+#include "EbAppConfig.h"
+
+/* Asynchronous output writer.
+ * Bitstream, recon and stat file writes are copied into a bounded queue of
+ * config->output_queue_depth entries and written by a separate thread, so the
+ * loop fetching packets and recon pictures only waits on the output device
+ * once the queue is full. All files share one queue, so writes to each file
+ * keep their order. Without a writer (depth 0, or the thread could not be
+ * started) the same calls write synchronously. */
+
+EbErrorType output_writer_open(EbConfig *config);
+
+/* Drains the queue, stops the writer thread and flushes the output files. Returns the first
+ * error hit by an asynchronous write or by the flush, if any */
+EbErrorType output_writer_close(EbConfig *config);
+
+/* Writes size bytes of data to file, at offset or appended when offset is -1 */
+EbErrorType output_writer_write(EbConfig *config, FILE *file, int64_t offset, const void *data,
+                                size_t size);
+
+EbErrorType output_writer_printf(EbConfig *config, FILE *file, const char *format, ...);
+
+/* Returns the first error hit by an asynchronous write, if any */
+EbErrorType output_writer_status(EbConfig *config);
+
+/* Returns the file of the first asynchronous write that failed, NULL if none did */
+FILE *output_writer_error_file(EbConfig *config);
+
+#endif // EbAppOutputWriter_h
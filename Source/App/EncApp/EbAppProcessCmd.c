@@ -14,6 +14,8 @@
 #include "EbAppConfig.h"
 #include "EbSvtAv1ErrorCodes.h"
 #include "EbAppInputy4m.h"
+#include "EbAppInputMmap.h"
+#include "EbAppOutputWriter.h"
 #include "EbTime.h"
 /***************************************
  * Macros
@@ -700,7 +702,10 @@ void read_input_frames(EbConfig *config, uint8_t is_16bit, EbBufferHeaderType *h
     input_ptr->cr_stride = input_padded_width >> subsampling_x;
     input_ptr->cb_stride = input_padded_width >> subsampling_x;
 
-    if (config->buffered_input == -1) {
+    if (config->mmap_reader) {
+        // planes point into the mapped file, the read-ahead thread already paged them in
+        header_ptr->n_filled_len = mmap_input_read_frame(config, header_ptr);
+    } else if (config->buffered_input == -1) {
         if (is_16bit == 0 || (is_16bit == 1 && config->compressed_ten_bit_format == 0)) {
             read_size = (uint64_t)SIZE_OF_ONE_FRAME_IN_BYTES(
                 input_padded_width, input_padded_height, color_format, is_16bit);
@@ -946,7 +951,8 @@ AppExitConditionType process_input_buffer(EbConfig *config, EbAppContext *app_ca
             // Configuration parameters changed on the fly
             if (config->use_qp_file && config->qp_file) send_qp_on_the_fly(config, header_ptr);
 
-            if (keep_running == 0 && !config->stop_encoder) config->stop_encoder = EB_TRUE;
+            if ((keep_running == 0 || config->output_error) && !config->stop_encoder)
+                config->stop_encoder = EB_TRUE;
             // Fill in Buffers Header control data
             header_ptr->pts      = config->processed_frame_count - 1;
             header_ptr->pic_type = EB_AV1_INVALID_PICTURE;
@@ -1001,7 +1007,7 @@ static __inline void mem_put_le16(void *vmem, int32_t val) {
     mem[1] = (uint8_t)((val >> 8) & 0xff);
 }
 
-static void write_ivf_stream_header(EbConfig *config) {
+static EbErrorType write_ivf_stream_header(EbConfig *config) {
     char header[IVF_STREAM_HEADER_SIZE];
     header[0] = 'D';
     header[1] = 'K';
@@ -1026,12 +1032,14 @@ static void write_ivf_stream_header(EbConfig *config) {
     mem_put_le32(header + 24, 0); // length
     mem_put_le32(header + 28, 0); // unused
     //config->performance_context.byte_count += 32;
-    if (config->bitstream_file) fwrite(header, 1, IVF_STREAM_HEADER_SIZE, config->bitstream_file);
+    if (config->bitstream_file)
+        return output_writer_write(
+            config, config->bitstream_file, -1, header, IVF_STREAM_HEADER_SIZE);
 
-    return;
+    return EB_ErrorNone;
 }
 
-static void write_ivf_frame_header(EbConfig *config, uint32_t byte_count) {
+static EbErrorType write_ivf_frame_header(EbConfig *config, uint32_t byte_count) {
     char    header[IVF_FRAME_HEADER_SIZE];
     int32_t write_location = 0;
 
@@ -1047,7 +1055,10 @@ static void write_ivf_frame_header(EbConfig *config, uint32_t byte_count) {
     config->ivf_count++;
     fflush(stdout);
 
-    if (config->bitstream_file) fwrite(header, 1, IVF_FRAME_HEADER_SIZE, config->bitstream_file);
+    if (config->bitstream_file)
+        return output_writer_write(
+            config, config->bitstream_file, -1, header, IVF_FRAME_HEADER_SIZE);
+    return EB_ErrorNone;
 }
 double get_psnr(double sse, double max) {
     double psnr;
@@ -1062,7 +1073,7 @@ double get_psnr(double sse, double max) {
 /***************************************
 * Process Output STATISTICS Buffer
 ***************************************/
-void process_output_statistics_buffer(EbBufferHeaderType *header_ptr, EbConfig *config) {
+EbErrorType process_output_statistics_buffer(EbBufferHeaderType *header_ptr, EbConfig *config) {
     uint32_t max_luma_value = (config->encoder_bit_depth == 8) ? 255 : 1023;
     uint64_t picture_stream_size, luma_sse, cr_sse, cb_sse, picture_number, picture_qp;
     double   luma_ssim, cr_ssim, cb_ssim;
@@ -1105,26 +1116,63 @@ void process_output_statistics_buffer(EbBufferHeaderType *header_ptr, EbConfig *
 
     // Write statistic Data to file
     if (config->stat_file)
-        fprintf(config->stat_file,
-                "Picture Number: %4d\t QP: %4d  [ "
-                "PSNR-Y: %.2f dB,\tPSNR-U: %.2f dB,\tPSNR-V: %.2f "
-                "dB,\tMSE-Y: %.2f,\tMSE-U: %.2f,\tMSE-V: %.2f,\t"
-                "SSIM-Y: %.5f,\tSSIM-U: %.5f,\tSSIM-V: %.5f"
-                " ]\t %6d bytes\n",
-                (int)picture_number,
-                (int)picture_qp,
-                luma_psnr,
-                cb_psnr,
-                cr_psnr,
-                (double)luma_sse / (config->source_width * config->source_height),
-                (double)cb_sse / (config->source_width / 2 * config->source_height / 2),
-                (double)cr_sse / (config->source_width / 2 * config->source_height / 2),
-                luma_ssim,
-                cr_ssim,
-                cb_ssim,
-                (int)picture_stream_size);
+        return output_writer_printf(config,
+                                    config->stat_file,
+                                    "Picture Number: %4d\t QP: %4d  [ "
+                                    "PSNR-Y: %.2f dB,\tPSNR-U: %.2f dB,\tPSNR-V: %.2f "
+                                    "dB,\tMSE-Y: %.2f,\tMSE-U: %.2f,\tMSE-V: %.2f,\t"
+                                    "SSIM-Y: %.5f,\tSSIM-U: %.5f,\tSSIM-V: %.5f"
+                                    " ]\t %6d bytes\n",
+                                    (int)picture_number,
+                                    (int)picture_qp,
+                                    luma_psnr,
+                                    cb_psnr,
+                                    cr_psnr,
+                                    (double)luma_sse /
+                                        (config->source_width * config->source_height),
+                                    (double)cb_sse /
+                                        (config->source_width / 2 * config->source_height / 2),
+                                    (double)cr_sse /
+                                        (config->source_width / 2 * config->source_height / 2),
+                                    luma_ssim,
+                                    cr_ssim,
+                                    cb_ssim,
+                                    (int)picture_stream_size);
+
+    return EB_ErrorNone;
+}
 
-    return;
+/* After a failed write the remaining output is not written and the input ends early. The
+ * encoder is still drained to its last packet, it cannot be closed before. */
+static void set_output_error(EbConfig *config, FILE *file) {
+    // a queued write may have failed on another file than the one written now
+    FILE *failed_file = output_writer_error_file(config);
+    if (!failed_file) failed_file = file;
+    const char *file_name = failed_file == config->bitstream_file
+                                ? "bitstream"
+                                : failed_file == config->recon_file ? "recon" : "stat";
+
+    if (!config->output_error) fprintf(stderr, "\nError writing the %s file\n", file_name);
+    config->output_error = EB_TRUE;
+}
+
+/* Keeps a sub-frame output packet until the packet completing its temporal
+ * unit arrives, an IVF frame holds a whole temporal unit */
+static EbErrorType append_partial_tu(EbConfig *config, const EbBufferHeaderType *header_ptr) {
+    if (!config->bitstream_file) return EB_ErrorNone;
+
+    const uint32_t size = config->partial_tu_size + header_ptr->n_filled_len;
+    if (size > config->partial_tu_capacity) {
+        uint8_t *partial_tu = (uint8_t *)realloc(config->partial_tu, size);
+        if (!partial_tu) return EB_ErrorInsufficientResources;
+        config->partial_tu          = partial_tu;
+        config->partial_tu_capacity = size;
+    }
+    memcpy(config->partial_tu + config->partial_tu_size,
+           header_ptr->p_buffer,
+           header_ptr->n_filled_len);
+    config->partial_tu_size = size;
+    return EB_ErrorNone;
 }
 
 AppExitConditionType process_output_stream_buffer(EbConfig *config, EbAppContext *app_call_back,
@@ -1134,6 +1182,7 @@ AppExitConditionType process_output_stream_buffer(EbConfig *config, EbAppContext
     EbComponentType *    component_handle = (EbComponentType *)app_call_back->svt_encoder_handle;
     AppExitConditionType return_value     = APP_ExitConditionNone;
     EbErrorType          stream_status    = EB_ErrorNone;
+    EbErrorType          write_status     = EB_ErrorNone;
     // Per channel variables
     FILE *stream_file = config->bitstream_file;
 
@@ -1147,8 +1196,10 @@ AppExitConditionType process_output_stream_buffer(EbConfig *config, EbAppContext
     uint64_t finish_s_time = 0;
     uint64_t finish_u_time = 0;
     uint8_t  is_alt_ref    = 1;
-    while (is_alt_ref) {
-        is_alt_ref = 0;
+    uint8_t  is_partial_tu = 0;
+    while (is_alt_ref || is_partial_tu) {
+        is_alt_ref    = 0;
+        is_partial_tu = 0;
         // non-blocking call until all input frames are sent
         stream_status = svt_av1_enc_get_packet(component_handle, &header_ptr, pic_send_done);
 
@@ -1156,6 +1207,17 @@ AppExitConditionType process_output_stream_buffer(EbConfig *config, EbAppContext
             fprintf(stderr, "\n");
             log_error_output(config->error_log_file, header_ptr->flags);
             return APP_ExitConditionError;
+        } else if (stream_status != EB_NoErrorEmptyQueue &&
+                   (header_ptr->flags & EB_BUFFERFLAG_PARTIAL_TU)) {
+            const EbErrorType append_status = append_partial_tu(config, header_ptr);
+            config->performance_context.byte_count += header_ptr->n_filled_len;
+            svt_av1_enc_release_out_buffer(&header_ptr);
+            if (append_status != EB_ErrorNone) {
+                fprintf(stderr, "\nError: could not buffer the sub-frame output\n");
+                return APP_ExitConditionError;
+            }
+            // fetch the rest of the temporal unit if it is already there
+            is_partial_tu = 1;
         } else if (stream_status != EB_NoErrorEmptyQueue) {
             is_alt_ref        = (header_ptr->flags & EB_BUFFERFLAG_IS_ALT_REF);
             if (!(header_ptr->flags & EB_BUFFERFLAG_IS_ALT_REF))
@@ -1181,24 +1243,35 @@ AppExitConditionType process_output_stream_buffer(EbConfig *config, EbAppContext
                                          &config->performance_context.total_encode_time);
 
             // Write Stream Data to file
-            if (stream_file) {
+            if (stream_file && !config->output_error) {
                 if (config->performance_context.frame_count == 1 &&
                     !(header_ptr->flags & EB_BUFFERFLAG_IS_ALT_REF)) {
-                    write_ivf_stream_header(config);
+                    write_status = write_ivf_stream_header(config);
                 }
-                write_ivf_frame_header(config, header_ptr->n_filled_len);
-                fwrite(header_ptr->p_buffer, 1, header_ptr->n_filled_len, stream_file);
+                if (write_status == EB_ErrorNone)
+                    write_status = write_ivf_frame_header(
+                        config, config->partial_tu_size + header_ptr->n_filled_len);
+                if (write_status == EB_ErrorNone && config->partial_tu_size)
+                    write_status = output_writer_write(
+                        config, stream_file, -1, config->partial_tu, config->partial_tu_size);
+                if (write_status == EB_ErrorNone)
+                    write_status = output_writer_write(
+                        config, stream_file, -1, header_ptr->p_buffer, header_ptr->n_filled_len);
+                if (write_status != EB_ErrorNone) set_output_error(config, stream_file);
             }
+            config->partial_tu_size = 0;
 
             config->performance_context.byte_count += header_ptr->n_filled_len;
 
-            if (config->stat_report && !(header_ptr->flags & EB_BUFFERFLAG_IS_ALT_REF))
-                process_output_statistics_buffer(header_ptr, config);
+            if (config->stat_report && !(header_ptr->flags & EB_BUFFERFLAG_IS_ALT_REF) &&
+                process_output_statistics_buffer(header_ptr, config) != EB_ErrorNone)
+                set_output_error(config, config->stat_file);
 
             // Update Output Port Activity State
             *port_state  = (header_ptr->flags & EB_BUFFERFLAG_EOS) ? APP_PortInactive : *port_state;
-            return_value = (header_ptr->flags & EB_BUFFERFLAG_EOS) ? APP_ExitConditionFinished
-                                                                   : APP_ExitConditionNone;
+            return_value = !(header_ptr->flags & EB_BUFFERFLAG_EOS) ? APP_ExitConditionNone
+                           : config->output_error                   ? APP_ExitConditionError
+                                                                    : APP_ExitConditionFinished;
 
             // Release the output buffer
             svt_av1_enc_release_out_buffer(&header_ptr);
@@ -1238,7 +1311,6 @@ AppExitConditionType process_output_recon_buffer(EbConfig *config, EbAppContext
     EbComponentType *    component_handle = (EbComponentType *)app_call_back->svt_encoder_handle;
     AppExitConditionType return_value     = APP_ExitConditionNone;
     EbErrorType          recon_status     = EB_ErrorNone;
-    int32_t              fseek_return_val;
     // non-blocking call until all input frames are sent
     recon_status = svt_av1_get_recon(component_handle, header_ptr);
 
@@ -1247,24 +1319,19 @@ AppExitConditionType process_output_recon_buffer(EbConfig *config, EbAppContext
         log_error_output(config->error_log_file, header_ptr->flags);
         return APP_ExitConditionError;
     } else if (recon_status != EB_NoErrorEmptyQueue) {
-        //Sets the File position to the beginning of the file.
-        rewind(config->recon_file);
-        uint64_t frame_num = header_ptr->pts;
-        while (frame_num > 0) {
-            fseek_return_val = fseeko(config->recon_file, header_ptr->n_filled_len, SEEK_CUR);
-
-            if (fseek_return_val != 0) {
-                fprintf(stderr, "Error in fseeko  returnVal %i\n", fseek_return_val);
-                return APP_ExitConditionError;
-            }
-            frame_num = frame_num - 1;
-        }
-
-        fwrite(header_ptr->p_buffer, 1, header_ptr->n_filled_len, config->recon_file);
+        // Frames come out of order, each one goes at its own position in the file
+        const int64_t offset = (int64_t)header_ptr->pts * header_ptr->n_filled_len;
+        if (!config->output_error && output_writer_write(config,
+                                                         config->recon_file,
+                                                         offset,
+                                                         header_ptr->p_buffer,
+                                                         header_ptr->n_filled_len) != EB_ErrorNone)
+            set_output_error(config, config->recon_file);
 
         // Update Output Port Activity State
-        return_value = (header_ptr->flags & EB_BUFFERFLAG_EOS) ? APP_ExitConditionFinished
-                                                               : APP_ExitConditionNone;
+        return_value = !(header_ptr->flags & EB_BUFFERFLAG_EOS) ? APP_ExitConditionNone
+                       : config->output_error                   ? APP_ExitConditionError
+                                                                : APP_ExitConditionFinished;
     }
     return return_value;
 }
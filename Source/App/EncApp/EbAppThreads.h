@@ -0,0 +1,125 @@
+/*
+* Copyright(c) 2019 Intel Corporation
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+#ifndef EbAppThreads_h
+#define EbAppThreads_h
+
+/* Minimal thread, mutex and condition variable wrappers for the app's helper
+ * threads (input read-ahead, output writer) */
+
+#include "EbSvtAv1.h"
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
+
+#ifdef _WIN32
+typedef HANDLE             AppThread;
+typedef SRWLOCK            AppMutex;
+typedef CONDITION_VARIABLE AppCond;
+typedef DWORD              AppThreadRet;
+#define APP_THREAD_CALL WINAPI
+#else
+typedef pthread_t       AppThread;
+typedef pthread_mutex_t AppMutex;
+typedef pthread_cond_t  AppCond;
+typedef void *          AppThreadRet;
+#define APP_THREAD_CALL
+#endif
+
+typedef AppThreadRet(APP_THREAD_CALL *AppThreadFunc)(void *context);
+
+static __inline EbBool app_thread_create(AppThread *thread, AppThreadFunc func, void *context) {
+#ifdef _WIN32
+    *thread = CreateThread(NULL, 0, func, context, 0, NULL);
+    return *thread != NULL;
+#else
+    return pthread_create(thread, NULL, func, context) == 0;
+#endif
+}
+
+static __inline void app_thread_join(AppThread thread) {
+#ifdef _WIN32
+    WaitForSingleObject(thread, INFINITE);
+    CloseHandle(thread);
+#else
+    pthread_join(thread, NULL);
+#endif
+}
+
+static __inline void app_mutex_init(AppMutex *mutex) {
+#ifdef _WIN32
+    InitializeSRWLock(mutex);
+#else
+    pthread_mutex_init(mutex, NULL);
+#endif
+}
+
+static __inline void app_mutex_destroy(AppMutex *mutex) {
+#ifdef _WIN32
+    (void)mutex;
+#else
+    pthread_mutex_destroy(mutex);
+#endif
+}
+
+static __inline void app_mutex_lock(AppMutex *mutex) {
+#ifdef _WIN32
+    AcquireSRWLockExclusive(mutex);
+#else
+    pthread_mutex_lock(mutex);
+#endif
+}
+
+static __inline void app_mutex_unlock(AppMutex *mutex) {
+#ifdef _WIN32
+    ReleaseSRWLockExclusive(mutex);
+#else
+    pthread_mutex_unlock(mutex);
+#endif
+}
+
+static __inline void app_cond_init(AppCond *cond) {
+#ifdef _WIN32
+    InitializeConditionVariable(cond);
+#else
+    pthread_cond_init(cond, NULL);
+#endif
+}
+
+static __inline void app_cond_destroy(AppCond *cond) {
+#ifdef _WIN32
+    (void)cond;
+#else
+    pthread_cond_destroy(cond);
+#endif
+}
+
+static __inline void app_cond_wait(AppCond *cond, AppMutex *mutex) {
+#ifdef _WIN32
+    SleepConditionVariableSRW(cond, mutex, INFINITE, 0);
+#else
+    pthread_cond_wait(cond, mutex);
+#endif
+}
+
+static __inline void app_cond_signal(AppCond *cond) {
+#ifdef _WIN32
+    WakeConditionVariable(cond);
+#else
+    pthread_cond_signal(cond);
+#endif
+}
+
+static __inline void app_cond_broadcast(AppCond *cond) {
+#ifdef _WIN32
+    WakeAllConditionVariable(cond);
+#else
+    pthread_cond_broadcast(cond);
+#endif
+}
+
+#endif // EbAppThreads_h
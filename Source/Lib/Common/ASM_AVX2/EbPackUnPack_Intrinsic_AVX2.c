@@ -280,3 +280,129 @@ void eb_enc_un_pack8_bit_data_avx2_intrin(uint16_t *in_16bit_buffer, uint32_t in
         }
     }
 }
+
+void eb_downshift_16bit_to_8bit_avx2(const uint16_t *src, uint32_t src_stride, uint8_t *dst,
+                                     uint32_t dst_stride, uint32_t width, uint32_t height,
+                                     uint32_t shift) {
+    const __m256i mask = _mm256_set1_epi16(0x00FF);
+    const __m128i sh   = _mm_cvtsi32_si128(shift);
+
+    for (uint32_t j = 0; j < height; j++) {
+        uint32_t k = 0;
+        for (; k + 32 <= width; k += 32) {
+            const __m256i s0 = _mm256_and_si256(
+                _mm256_srl_epi16(_mm256_loadu_si256((const __m256i *)(src + k)), sh), mask);
+            const __m256i s1 = _mm256_and_si256(
+                _mm256_srl_epi16(_mm256_loadu_si256((const __m256i *)(src + k + 16)), sh), mask);
+            _mm256_storeu_si256((__m256i *)(dst + k),
+                                _mm256_permute4x64_epi64(_mm256_packus_epi16(s0, s1), 0xd8));
+        }
+        if (k + 16 <= width) {
+            const __m256i s0 = _mm256_and_si256(
+                _mm256_srl_epi16(_mm256_loadu_si256((const __m256i *)(src + k)), sh), mask);
+            const __m256i d = _mm256_permute4x64_epi64(_mm256_packus_epi16(s0, s0), 0xd8);
+            _mm_storeu_si128((__m128i *)(dst + k), _mm256_castsi256_si128(d));
+            k += 16;
+        }
+        for (; k < width; k++) dst[k] = (uint8_t)(src[k] >> shift);
+        src += src_stride;
+        dst += dst_stride;
+    }
+}
+
+void eb_upshift_16bit_avx2(const uint16_t *src, uint32_t src_stride, uint16_t *dst,
+                           uint32_t dst_stride, uint32_t width, uint32_t height, uint32_t shift) {
+    const __m128i sh = _mm_cvtsi32_si128(shift);
+
+    for (uint32_t j = 0; j < height; j++) {
+        uint32_t k = 0;
+        for (; k + 16 <= width; k += 16) {
+            const __m256i s = _mm256_loadu_si256((const __m256i *)(src + k));
+            _mm256_storeu_si256((__m256i *)(dst + k), _mm256_sll_epi16(s, sh));
+        }
+        for (; k < width; k++) dst[k] = (uint16_t)(src[k] << shift);
+        src += src_stride;
+        dst += dst_stride;
+    }
+}
+
+void eb_interleave_uv_8bit_avx2(const uint8_t *u, uint32_t u_stride, const uint8_t *v,
+                                uint32_t v_stride, uint8_t *uv, uint32_t uv_stride, uint32_t width,
+                                uint32_t height) {
+    for (uint32_t j = 0; j < height; j++) {
+        uint32_t k = 0;
+        for (; k + 32 <= width; k += 32) {
+            const __m256i s_u = _mm256_loadu_si256((const __m256i *)(u + k));
+            const __m256i s_v = _mm256_loadu_si256((const __m256i *)(v + k));
+            // samples 0-7 and 16-23, then 8-15 and 24-31
+            const __m256i lo = _mm256_unpacklo_epi8(s_u, s_v);
+            const __m256i hi = _mm256_unpackhi_epi8(s_u, s_v);
+            _mm256_storeu_si256((__m256i *)(uv + 2 * k), _mm256_permute2x128_si256(lo, hi, 0x20));
+            _mm256_storeu_si256((__m256i *)(uv + 2 * k + 32),
+                                _mm256_permute2x128_si256(lo, hi, 0x31));
+        }
+        for (; k < width; k++) {
+            uv[2 * k]     = u[k];
+            uv[2 * k + 1] = v[k];
+        }
+        u += u_stride;
+        v += v_stride;
+        uv += uv_stride;
+    }
+}
+
+void eb_interleave_uv_16bit_to_8bit_avx2(const uint16_t *u, uint32_t u_stride, const uint16_t *v,
+                                         uint32_t v_stride, uint8_t *uv, uint32_t uv_stride,
+                                         uint32_t width, uint32_t height, uint32_t shift) {
+    const __m256i mask = _mm256_set1_epi16(0x00FF);
+    const __m128i sh   = _mm_cvtsi32_si128(shift);
+
+    for (uint32_t j = 0; j < height; j++) {
+        uint32_t k = 0;
+        for (; k + 16 <= width; k += 16) {
+            const __m256i s_u = _mm256_and_si256(
+                _mm256_srl_epi16(_mm256_loadu_si256((const __m256i *)(u + k)), sh), mask);
+            const __m256i s_v = _mm256_and_si256(
+                _mm256_srl_epi16(_mm256_loadu_si256((const __m256i *)(v + k)), sh), mask);
+            // each 16-bit word holds the u sample in its low byte, v in its high byte
+            _mm256_storeu_si256((__m256i *)(uv + 2 * k),
+                                _mm256_or_si256(s_u, _mm256_slli_epi16(s_v, 8)));
+        }
+        for (; k < width; k++) {
+            uv[2 * k]     = (uint8_t)(u[k] >> shift);
+            uv[2 * k + 1] = (uint8_t)(v[k] >> shift);
+        }
+        u += u_stride;
+        v += v_stride;
+        uv += uv_stride;
+    }
+}
+
+void eb_interleave_uv_16bit_avx2(const uint16_t *u, uint32_t u_stride, const uint16_t *v,
+                                 uint32_t v_stride, uint16_t *uv, uint32_t uv_stride,
+                                 uint32_t width, uint32_t height, uint32_t shift) {
+    const __m128i sh = _mm_cvtsi32_si128(shift);
+
+    for (uint32_t j = 0; j < height; j++) {
+        uint32_t k = 0;
+        for (; k + 16 <= width; k += 16) {
+            const __m256i s_u =
+                _mm256_sll_epi16(_mm256_loadu_si256((const __m256i *)(u + k)), sh);
+            const __m256i s_v =
+                _mm256_sll_epi16(_mm256_loadu_si256((const __m256i *)(v + k)), sh);
+            // samples 0-3 and 8-11, then 4-7 and 12-15
+            const __m256i lo = _mm256_unpacklo_epi16(s_u, s_v);
+            const __m256i hi = _mm256_unpackhi_epi16(s_u, s_v);
+            _mm256_storeu_si256((__m256i *)(uv + 2 * k), _mm256_permute2x128_si256(lo, hi, 0x20));
+            _mm256_storeu_si256((__m256i *)(uv + 2 * k + 16),
+                                _mm256_permute2x128_si256(lo, hi, 0x31));
+        }
+        for (; k < width; k++) {
+            uv[2 * k]     = (uint16_t)(u[k] << shift);
+            uv[2 * k + 1] = (uint16_t)(v[k] << shift);
+        }
+        u += u_stride;
+        v += v_stride;
+        uv += uv_stride;
+    }
+}
@@ -52,6 +52,10 @@ static INLINE void lowbd_write_buffer_16xn_avx2(__m256i *in, uint8_t *output_r,
         write_recon_w16_avx2(in[j], output_r + i * stride_r, output_w + i * stride_w);
 }
 
+void eb_av1_lowbd_inv_txfm2d_add_avx2(const int32_t *input, uint8_t *output_r, int32_t stride_r,
+                                      uint8_t *output_w, int32_t stride_w, TxType tx_type,
+                                      TxSize tx_size, int32_t eob);
+
 #ifdef __cplusplus
 }
 #endif
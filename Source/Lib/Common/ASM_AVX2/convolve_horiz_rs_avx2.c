@@ -0,0 +1,134 @@
+/*
+* Copyright(c) 2019 Intel Corporation
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+#include <immintrin.h>
+
+#include "common_dsp_rtcd.h"
+#include "EbInterPrediction.h"
+#include "EbSuperRes.h"
+
+#define RS_ROUND_BITS 7
+
+// Positions of 8 consecutive outputs of the super-res upscaler. Every output
+// reads its own window of UPSCALE_NORMATIVE_TAPS samples with its own filter,
+// so windows are gathered in pairs (k, k + 4) into the two 128-bit lanes.
+static INLINE void rs_filters_avx2(const int16_t *x_filters, int x_qn, int x_step_qn,
+                                   __m256i f[4]) {
+    for (int k = 0; k < 4; ++k) {
+        const int q0 = x_qn + k * x_step_qn;
+        const int q1 = q0 + 4 * x_step_qn;
+        const __m128i f0 = _mm_loadu_si128(
+            (const __m128i *)(x_filters + ((q0 & RS_SCALE_SUBPEL_MASK) >> RS_SCALE_EXTRA_BITS) *
+                                              UPSCALE_NORMATIVE_TAPS));
+        const __m128i f1 = _mm_loadu_si128(
+            (const __m128i *)(x_filters + ((q1 & RS_SCALE_SUBPEL_MASK) >> RS_SCALE_EXTRA_BITS) *
+                                              UPSCALE_NORMATIVE_TAPS));
+        f[k] = _mm256_inserti128_si256(_mm256_castsi128_si256(f0), f1, 1);
+    }
+}
+
+// Sums the 8 products of each window; returns outputs 0..3 in the low lane and
+// 4..7 in the high lane, rounded.
+static INLINE __m256i rs_reduce_avx2(const __m256i s[4]) {
+    const __m256i t0 = _mm256_add_epi32(_mm256_unpacklo_epi32(s[0], s[1]),
+                                        _mm256_unpackhi_epi32(s[0], s[1]));
+    const __m256i t1 = _mm256_add_epi32(_mm256_unpacklo_epi32(s[2], s[3]),
+                                        _mm256_unpackhi_epi32(s[2], s[3]));
+    const __m256i r = _mm256_add_epi32(_mm256_unpacklo_epi64(t0, t1),
+                                       _mm256_unpackhi_epi64(t0, t1));
+    return _mm256_srai_epi32(_mm256_add_epi32(r, _mm256_set1_epi32(1 << (RS_ROUND_BITS - 1))),
+                             RS_ROUND_BITS);
+}
+
+void eb_av1_convolve_horiz_rs_avx2(const uint8_t *src, int src_stride, uint8_t *dst,
+                                   int dst_stride, int w, int h, const int16_t *x_filters,
+                                   int x0_qn, int x_step_qn) {
+    const int w8 = w & ~7;
+    const uint8_t *const src_start = src - (UPSCALE_NORMATIVE_TAPS / 2 - 1);
+
+    for (int x = 0; x < w8; x += 8) {
+        const int x_qn = x0_qn + x * x_step_qn;
+        __m256i   f[4];
+        int       pos[8];
+
+        rs_filters_avx2(x_filters, x_qn, x_step_qn, f);
+        for (int k = 0; k < 8; ++k) pos[k] = (x_qn + k * x_step_qn) >> RS_SCALE_SUBPEL_BITS;
+
+        const uint8_t *s_row = src_start;
+        uint8_t *      d_row = dst + x;
+        for (int y = 0; y < h; ++y) {
+            __m256i s[4];
+            for (int k = 0; k < 4; ++k) {
+                const __m128i p = _mm_unpacklo_epi64(
+                    _mm_loadl_epi64((const __m128i *)(s_row + pos[k])),
+                    _mm_loadl_epi64((const __m128i *)(s_row + pos[k + 4])));
+                s[k] = _mm256_madd_epi16(_mm256_cvtepu8_epi16(p), f[k]);
+            }
+            const __m256i r   = rs_reduce_avx2(s);
+            const __m256i r16 = _mm256_packs_epi32(r, r);
+            const __m256i r8  = _mm256_packus_epi16(r16, r16);
+            _mm_storel_epi64((__m128i *)d_row,
+                             _mm_unpacklo_epi32(_mm256_castsi256_si128(r8),
+                                                _mm256_extracti128_si256(r8, 1)));
+            s_row += src_stride;
+            d_row += dst_stride;
+        }
+    }
+
+    if (w8 < w)
+        eb_av1_convolve_horiz_rs_c(
+            src, src_stride, dst + w8, dst_stride, w - w8, h, x_filters, x0_qn + w8 * x_step_qn,
+            x_step_qn);
+}
+
+void eb_av1_highbd_convolve_horiz_rs_avx2(const uint16_t *src, int src_stride, uint16_t *dst,
+                                          int dst_stride, int w, int h, const int16_t *x_filters,
+                                          int x0_qn, int x_step_qn, int bd) {
+    const int       w8        = w & ~7;
+    const uint16_t *src_start = src - (UPSCALE_NORMATIVE_TAPS / 2 - 1);
+    const __m256i   max       = _mm256_set1_epi32((1 << bd) - 1);
+
+    for (int x = 0; x < w8; x += 8) {
+        const int x_qn = x0_qn + x * x_step_qn;
+        __m256i   f[4];
+        int       pos[8];
+
+        rs_filters_avx2(x_filters, x_qn, x_step_qn, f);
+        for (int k = 0; k < 8; ++k) pos[k] = (x_qn + k * x_step_qn) >> RS_SCALE_SUBPEL_BITS;
+
+        const uint16_t *s_row = src_start;
+        uint16_t *      d_row = dst + x;
+        for (int y = 0; y < h; ++y) {
+            __m256i s[4];
+            for (int k = 0; k < 4; ++k) {
+                const __m256i p = _mm256_inserti128_si256(
+                    _mm256_castsi128_si256(_mm_loadu_si128((const __m128i *)(s_row + pos[k]))),
+                    _mm_loadu_si128((const __m128i *)(s_row + pos[k + 4])),
+                    1);
+                s[k] = _mm256_madd_epi16(p, f[k]);
+            }
+            __m256i r = rs_reduce_avx2(s);
+            r         = _mm256_min_epi32(_mm256_max_epi32(r, _mm256_setzero_si256()), max);
+            r         = _mm256_packus_epi32(r, r);
+            _mm_storeu_si128((__m128i *)d_row,
+                             _mm_unpacklo_epi64(_mm256_castsi256_si128(r),
+                                                _mm256_extracti128_si256(r, 1)));
+            s_row += src_stride;
+            d_row += dst_stride;
+        }
+    }
+
+    if (w8 < w)
+        eb_av1_highbd_convolve_horiz_rs_c(src,
+                                          src_stride,
+                                          dst + w8,
+                                          dst_stride,
+                                          w - w8,
+                                          h,
+                                          x_filters,
+                                          x0_qn + w8 * x_step_qn,
+                                          x_step_qn,
+                                          bd);
+}
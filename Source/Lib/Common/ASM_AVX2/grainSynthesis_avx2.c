@@ -0,0 +1,284 @@
+/*
+* Copyright(c) 2019 Intel Corporation
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+#include <immintrin.h>
+
+#include "EbDefinitions.h"
+#include "common_dsp_rtcd.h"
+
+/* Film grain blending, 8 samples per iteration. The scaling function is looked
+ * up with gathers, the remaining columns of a block are left to the C code. */
+
+// scale_lut() of grainSynthesis.c for 8 samples
+static INLINE __m256i scale_lut_avx2(const int32_t *scaling_lut, __m256i index,
+                                     int32_t bit_depth) {
+    if (bit_depth == 8) return _mm256_i32gather_epi32(scaling_lut, index, 4);
+
+    const __m128i shift = _mm_cvtsi32_si128(bit_depth - 8);
+    const __m256i x     = _mm256_srl_epi32(index, shift);
+    // scaling_lut[256] is not read, the interpolation is then 0 anyway
+    const __m256i x1   = _mm256_min_epi32(_mm256_add_epi32(x, _mm256_set1_epi32(1)),
+                                        _mm256_set1_epi32(255));
+    const __m256i lut0 = _mm256_i32gather_epi32(scaling_lut, x, 4);
+    const __m256i lut1 = _mm256_i32gather_epi32(scaling_lut, x1, 4);
+    const __m256i frac =
+        _mm256_and_si256(index, _mm256_set1_epi32((1 << (bit_depth - 8)) - 1));
+    __m256i delta = _mm256_mullo_epi32(_mm256_sub_epi32(lut1, lut0), frac);
+    delta = _mm256_add_epi32(delta, _mm256_set1_epi32(1 << (bit_depth - 9)));
+    return _mm256_add_epi32(lut0, _mm256_sra_epi32(delta, shift));
+}
+
+// clamp(pixel + ((scale * grain + rounding_offset) >> scaling_shift), min, max)
+static INLINE __m256i add_noise_avx2(__m256i pixel, __m256i scale, const int32_t *grain,
+                                     __m256i rounding_offset, __m128i scaling_shift,
+                                     __m256i min_val, __m256i max_val) {
+    __m256i noise = _mm256_mullo_epi32(scale, _mm256_loadu_si256((const __m256i *)grain));
+    noise         = _mm256_sra_epi32(_mm256_add_epi32(noise, rounding_offset), scaling_shift);
+    return _mm256_min_epi32(_mm256_max_epi32(_mm256_add_epi32(pixel, noise), min_val), max_val);
+}
+
+static INLINE void store_8x8bit(uint8_t *dst, __m256i val) {
+    const __m128i val16 =
+        _mm_packus_epi32(_mm256_castsi256_si128(val), _mm256_extracti128_si256(val, 1));
+    _mm_storel_epi64((__m128i *)dst, _mm_packus_epi16(val16, val16));
+}
+
+static INLINE void store_8x16bit(uint16_t *dst, __m256i val) {
+    _mm_storeu_si128(
+        (__m128i *)dst,
+        _mm_packus_epi32(_mm256_castsi256_si128(val), _mm256_extracti128_si256(val, 1)));
+}
+
+// Average of the luma samples co-located with 8 chroma samples
+static INLINE __m256i average_luma_avx2(const uint8_t *luma, int32_t chroma_subsamp_x) {
+    if (!chroma_subsamp_x) return _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i *)luma));
+    const __m256i sum = _mm256_madd_epi16(
+        _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i *)luma)), _mm256_set1_epi16(1));
+    return _mm256_srli_epi32(_mm256_add_epi32(sum, _mm256_set1_epi32(1)), 1);
+}
+
+static INLINE __m256i average_luma_hbd_avx2(const uint16_t *luma, int32_t chroma_subsamp_x) {
+    if (!chroma_subsamp_x)
+        return _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i *)luma));
+    const __m256i sum =
+        _mm256_madd_epi16(_mm256_loadu_si256((const __m256i *)luma), _mm256_set1_epi16(1));
+    return _mm256_srli_epi32(_mm256_add_epi32(sum, _mm256_set1_epi32(1)), 1);
+}
+
+// clamp(((average_luma * luma_mult + mult * chroma) >> 6) + offset, 0, max_index)
+static INLINE __m256i chroma_scale_index_avx2(__m256i average_luma, __m256i chroma,
+                                              __m256i luma_mult, __m256i mult, __m256i offset,
+                                              __m256i max_index) {
+    __m256i index = _mm256_add_epi32(_mm256_mullo_epi32(average_luma, luma_mult),
+                                     _mm256_mullo_epi32(chroma, mult));
+    index         = _mm256_add_epi32(_mm256_srai_epi32(index, 6), offset);
+    return _mm256_min_epi32(_mm256_max_epi32(index, _mm256_setzero_si256()), max_index);
+}
+
+void eb_fgn_add_luma_noise_avx2(const int32_t *scaling_lut, uint8_t *luma, int32_t luma_stride,
+                                const int32_t *grain, int32_t grain_stride, int32_t width,
+                                int32_t height, int32_t scaling_shift, int32_t min_luma,
+                                int32_t max_luma) {
+    const __m256i rounding_offset = _mm256_set1_epi32(1 << (scaling_shift - 1));
+    const __m128i shift           = _mm_cvtsi32_si128(scaling_shift);
+    const __m256i min_val         = _mm256_set1_epi32(min_luma);
+    const __m256i max_val         = _mm256_set1_epi32(max_luma);
+    const int32_t width8          = width & ~7;
+
+    for (int32_t i = 0; i < height; i++) {
+        uint8_t *      row       = luma + i * luma_stride;
+        const int32_t *grain_row = grain + i * grain_stride;
+        for (int32_t j = 0; j < width8; j += 8) {
+            const __m256i pixel =
+                _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i *)(row + j)));
+            const __m256i scale = scale_lut_avx2(scaling_lut, pixel, 8);
+            store_8x8bit(row + j,
+                         add_noise_avx2(pixel,
+                                        scale,
+                                        grain_row + j,
+                                        rounding_offset,
+                                        shift,
+                                        min_val,
+                                        max_val));
+        }
+    }
+
+    if (width8 < width)
+        eb_fgn_add_luma_noise_c(scaling_lut,
+                                luma + width8,
+                                luma_stride,
+                                grain + width8,
+                                grain_stride,
+                                width - width8,
+                                height,
+                                scaling_shift,
+                                min_luma,
+                                max_luma);
+}
+
+void eb_fgn_add_chroma_noise_avx2(const int32_t *scaling_lut, uint8_t *chroma,
+                                  int32_t chroma_stride, const uint8_t *luma, int32_t luma_stride,
+                                  const int32_t *grain, int32_t grain_stride, int32_t width,
+                                  int32_t height, int32_t chroma_subsamp_x,
+                                  int32_t chroma_subsamp_y, int32_t mult, int32_t luma_mult,
+                                  int32_t offset, int32_t scaling_shift, int32_t min_chroma,
+                                  int32_t max_chroma) {
+    const __m256i rounding_offset = _mm256_set1_epi32(1 << (scaling_shift - 1));
+    const __m128i shift           = _mm_cvtsi32_si128(scaling_shift);
+    const __m256i min_val         = _mm256_set1_epi32(min_chroma);
+    const __m256i max_val         = _mm256_set1_epi32(max_chroma);
+    const __m256i mult_val        = _mm256_set1_epi32(mult);
+    const __m256i luma_mult_val   = _mm256_set1_epi32(luma_mult);
+    const __m256i offset_val      = _mm256_set1_epi32(offset);
+    const __m256i max_index       = _mm256_set1_epi32(255);
+    const int32_t width8          = width & ~7;
+
+    for (int32_t i = 0; i < height; i++) {
+        uint8_t *      row       = chroma + i * chroma_stride;
+        const uint8_t *luma_row  = luma + (i << chroma_subsamp_y) * luma_stride;
+        const int32_t *grain_row = grain + i * grain_stride;
+        for (int32_t j = 0; j < width8; j += 8) {
+            const __m256i pixel =
+                _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i *)(row + j)));
+            const __m256i average_luma =
+                average_luma_avx2(luma_row + (j << chroma_subsamp_x), chroma_subsamp_x);
+            const __m256i index = chroma_scale_index_avx2(
+                average_luma, pixel, luma_mult_val, mult_val, offset_val, max_index);
+            const __m256i scale = scale_lut_avx2(scaling_lut, index, 8);
+            store_8x8bit(row + j,
+                         add_noise_avx2(pixel,
+                                        scale,
+                                        grain_row + j,
+                                        rounding_offset,
+                                        shift,
+                                        min_val,
+                                        max_val));
+        }
+    }
+
+    if (width8 < width)
+        eb_fgn_add_chroma_noise_c(scaling_lut,
+                                  chroma + width8,
+                                  chroma_stride,
+                                  luma + (width8 << chroma_subsamp_x),
+                                  luma_stride,
+                                  grain + width8,
+                                  grain_stride,
+                                  width - width8,
+                                  height,
+                                  chroma_subsamp_x,
+                                  chroma_subsamp_y,
+                                  mult,
+                                  luma_mult,
+                                  offset,
+                                  scaling_shift,
+                                  min_chroma,
+                                  max_chroma);
+}
+
+void eb_fgn_add_luma_noise_hbd_avx2(const int32_t *scaling_lut, uint16_t *luma,
+                                    int32_t luma_stride, const int32_t *grain,
+                                    int32_t grain_stride, int32_t width, int32_t height,
+                                    int32_t scaling_shift, int32_t min_luma, int32_t max_luma,
+                                    int32_t bit_depth) {
+    const __m256i rounding_offset = _mm256_set1_epi32(1 << (scaling_shift - 1));
+    const __m128i shift           = _mm_cvtsi32_si128(scaling_shift);
+    const __m256i min_val         = _mm256_set1_epi32(min_luma);
+    const __m256i max_val         = _mm256_set1_epi32(max_luma);
+    const int32_t width8          = width & ~7;
+
+    for (int32_t i = 0; i < height; i++) {
+        uint16_t *     row       = luma + i * luma_stride;
+        const int32_t *grain_row = grain + i * grain_stride;
+        for (int32_t j = 0; j < width8; j += 8) {
+            const __m256i pixel =
+                _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i *)(row + j)));
+            const __m256i scale = scale_lut_avx2(scaling_lut, pixel, bit_depth);
+            store_8x16bit(row + j,
+                          add_noise_avx2(pixel,
+                                         scale,
+                                         grain_row + j,
+                                         rounding_offset,
+                                         shift,
+                                         min_val,
+                                         max_val));
+        }
+    }
+
+    if (width8 < width)
+        eb_fgn_add_luma_noise_hbd_c(scaling_lut,
+                                    luma + width8,
+                                    luma_stride,
+                                    grain + width8,
+                                    grain_stride,
+                                    width - width8,
+                                    height,
+                                    scaling_shift,
+                                    min_luma,
+                                    max_luma,
+                                    bit_depth);
+}
+
+void eb_fgn_add_chroma_noise_hbd_avx2(const int32_t *scaling_lut, uint16_t *chroma,
+                                      int32_t chroma_stride, const uint16_t *luma,
+                                      int32_t luma_stride, const int32_t *grain,
+                                      int32_t grain_stride, int32_t width, int32_t height,
+                                      int32_t chroma_subsamp_x, int32_t chroma_subsamp_y,
+                                      int32_t mult, int32_t luma_mult, int32_t offset,
+                                      int32_t scaling_shift, int32_t min_chroma,
+                                      int32_t max_chroma, int32_t bit_depth) {
+    const __m256i rounding_offset = _mm256_set1_epi32(1 << (scaling_shift - 1));
+    const __m128i shift           = _mm_cvtsi32_si128(scaling_shift);
+    const __m256i min_val         = _mm256_set1_epi32(min_chroma);
+    const __m256i max_val         = _mm256_set1_epi32(max_chroma);
+    const __m256i mult_val        = _mm256_set1_epi32(mult);
+    const __m256i luma_mult_val   = _mm256_set1_epi32(luma_mult);
+    const __m256i offset_val      = _mm256_set1_epi32(offset);
+    const __m256i max_index       = _mm256_set1_epi32((256 << (bit_depth - 8)) - 1);
+    const int32_t width8          = width & ~7;
+
+    for (int32_t i = 0; i < height; i++) {
+        uint16_t *      row       = chroma + i * chroma_stride;
+        const uint16_t *luma_row  = luma + (i << chroma_subsamp_y) * luma_stride;
+        const int32_t * grain_row = grain + i * grain_stride;
+        for (int32_t j = 0; j < width8; j += 8) {
+            const __m256i pixel =
+                _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i *)(row + j)));
+            const __m256i average_luma =
+                average_luma_hbd_avx2(luma_row + (j << chroma_subsamp_x), chroma_subsamp_x);
+            const __m256i index = chroma_scale_index_avx2(
+                average_luma, pixel, luma_mult_val, mult_val, offset_val, max_index);
+            const __m256i scale = scale_lut_avx2(scaling_lut, index, bit_depth);
+            store_8x16bit(row + j,
+                          add_noise_avx2(pixel,
+                                         scale,
+                                         grain_row + j,
+                                         rounding_offset,
+                                         shift,
+                                         min_val,
+                                         max_val));
+        }
+    }
+
+    if (width8 < width)
+        eb_fgn_add_chroma_noise_hbd_c(scaling_lut,
+                                      chroma + width8,
+                                      chroma_stride,
+                                      luma + (width8 << chroma_subsamp_x),
+                                      luma_stride,
+                                      grain + width8,
+                                      grain_stride,
+                                      width - width8,
+                                      height,
+                                      chroma_subsamp_x,
+                                      chroma_subsamp_y,
+                                      mult,
+                                      luma_mult,
+                                      offset,
+                                      scaling_shift,
+                                      min_chroma,
+                                      max_chroma,
+                                      bit_depth);
+}
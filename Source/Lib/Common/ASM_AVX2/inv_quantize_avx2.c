@@ -0,0 +1,81 @@
+/*
+* Copyright(c) 2019 Intel Corporation
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+#include <immintrin.h>
+
+#include "EbDefinitions.h"
+#include "EbInvTransforms.h"
+#include "common_dsp_rtcd.h"
+
+/* Decoder dequantization, 8 levels per iteration, the AVX2 version of
+ * inv_quantize_sse4.c. */
+
+static INLINE __m256i get_dqv_qm_8(const QmVal *iqmatrix, const int16_t *scan,
+                                   const __m256i dqv) {
+    const __m256i round = _mm256_set1_epi32(1 << (AOM_QM_BITS - 1));
+    const __m256i qm    = _mm256_setr_epi32(iqmatrix[scan[0]],
+                                         iqmatrix[scan[1]],
+                                         iqmatrix[scan[2]],
+                                         iqmatrix[scan[3]],
+                                         iqmatrix[scan[4]],
+                                         iqmatrix[scan[5]],
+                                         iqmatrix[scan[6]],
+                                         iqmatrix[scan[7]]);
+    // both fit in 15 bits, pmaddwd gives the 32-bit product
+    const __m256i prod = _mm256_madd_epi16(qm, dqv);
+    return _mm256_srai_epi32(_mm256_add_epi32(prod, round), AOM_QM_BITS);
+}
+
+static INLINE void inverse_quantize_8(int32_t *qcoeffs, const int16_t *scan, const __m256i lev,
+                                      const __m256i dqv, const __m128i shift,
+                                      const __m256i min_value, const __m256i max_value,
+                                      const int32_t nz_mask) {
+    const __m256i mask_24 = _mm256_set1_epi32(0xffffff);
+    int32_t       tmp[8];
+
+    // the low 32 bits of the product are enough to keep its low 24 bits
+    __m256i q = _mm256_and_si256(_mm256_mullo_epi32(_mm256_abs_epi32(lev), dqv), mask_24);
+    q         = _mm256_srl_epi32(q, shift);
+    q         = _mm256_sign_epi32(q, lev);
+    q         = _mm256_min_epi32(_mm256_max_epi32(q, min_value), max_value);
+    _mm256_storeu_si256((__m256i *)tmp, q);
+
+    for (int32_t j = 0; j < 8; j++)
+        if (nz_mask & (1 << j)) qcoeffs[scan[j]] = tmp[j];
+}
+
+void eb_av1_inverse_quantize_avx2(const int32_t *level, int32_t *qcoeffs, const int16_t *scan,
+                                  int32_t n_coeffs, const int16_t *dequant,
+                                  const QmVal *iqmatrix, int32_t shift, int32_t bit_depth) {
+    const __m256i max_value     = _mm256_set1_epi32((1 << (7 + bit_depth)) - 1);
+    const __m256i min_value     = _mm256_set1_epi32(-(1 << (7 + bit_depth)));
+    const __m128i shift_128     = _mm_cvtsi32_si128(shift);
+    const __m256i dqv_ac        = _mm256_set1_epi32(dequant[1]);
+    const int16_t dequant_ac[2] = {dequant[1], dequant[1]};
+    int32_t       i;
+
+    for (i = 0; i + 8 <= n_coeffs; i += 8) {
+        const __m256i lev     = _mm256_loadu_si256((const __m256i *)(level + i));
+        const int32_t nz_mask = ~_mm256_movemask_ps(_mm256_castsi256_ps(
+                                    _mm256_cmpeq_epi32(lev, _mm256_setzero_si256()))) &
+                                0xff;
+        if (!nz_mask) continue;
+
+        // the first level of the block is the DC one
+        __m256i dqv = i ? dqv_ac : _mm256_insert_epi32(dqv_ac, dequant[0], 0);
+        if (iqmatrix != NULL) dqv = get_dqv_qm_8(iqmatrix, scan + i, dqv);
+        inverse_quantize_8(qcoeffs, scan + i, lev, dqv, shift_128, min_value, max_value, nz_mask);
+    }
+
+    if (i < n_coeffs)
+        eb_av1_inverse_quantize_sse4_1(level + i,
+                                       qcoeffs,
+                                       scan + i,
+                                       n_coeffs - i,
+                                       i ? dequant_ac : dequant,
+                                       iqmatrix,
+                                       shift,
+                                       bit_depth);
+}
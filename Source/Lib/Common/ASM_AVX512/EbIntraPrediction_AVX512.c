@@ -0,0 +1,306 @@
+/*
+ * Copyright(c) 2019 Intel Corporation
+ * SPDX - License - Identifier: BSD - 2 - Clause - Patent
+ */
+
+#include "EbDefinitions.h"
+
+#ifndef NON_AVX512_SUPPORT
+#include <immintrin.h>
+#include "common_dsp_rtcd.h"
+
+// Weights are quantized to 8 bits, offset by the block size (see EbIntraPrediction.c).
+static const uint8_t sm_weight_arrays[2 * 64] = {
+    // Unused, because we always offset by bs, which is at least 2.
+    0, 0,
+    // bs = 2
+    255, 128,
+    // bs = 4
+    255, 149, 85, 64,
+    // bs = 8
+    255, 197, 146, 105, 73, 50, 37, 32,
+    // bs = 16
+    255, 225, 196, 170, 145, 123, 102, 84, 68, 54, 43, 33, 26, 20, 17, 16,
+    // bs = 32
+    255, 240, 225, 210, 196, 182, 169, 157, 145, 133, 122, 111, 101, 92, 83, 74,
+    66, 59, 52, 45, 39, 34, 29, 25, 21, 17, 14, 12, 10, 9, 8, 8,
+    // bs = 64
+    255, 248, 240, 233, 225, 218, 210, 203, 196, 189, 182, 176, 169, 163, 156,
+    150, 144, 138, 133, 127, 121, 116, 111, 106, 101, 96, 91, 86, 82, 77, 73, 69,
+    65, 61, 57, 54, 50, 47, 44, 41, 38, 35, 32, 29, 27, 25, 22, 20, 18, 16, 15,
+    13, 12, 10, 9, 8, 7, 6, 6, 5, 5, 4, 4, 4,
+};
+
+// All kernels work on 32 pixels widened to 16 bits per register.
+static INLINE __m512i load_u8_to_u16_32(const uint8_t *const src) {
+    return _mm512_cvtepu8_epi16(_mm256_loadu_si256((const __m256i *)src));
+}
+
+static INLINE void store_u16_to_u8_32(uint8_t *const dst, const __m512i d) {
+    _mm256_storeu_si256((__m256i *)dst, _mm512_cvtepi16_epi8(d));
+}
+
+// -----------------------------------------------------------------------------
+// SMOOTH_PRED
+
+// pred = (w_h * above + (256 - w_h) * bottom_left + w_w * left + (256 - w_w) * top_right + 256) >> 9
+// Both halves fit in 16 bits, the sum is taken with avg_epu16 which keeps the 17th bit:
+// avg(v, h + 255) >> 8 equals (v + h + 256) >> 9.
+static INLINE void smooth_predictor_wxh(uint8_t *dst, const ptrdiff_t stride,
+                                        const uint8_t *const above, const uint8_t *const left,
+                                        const int32_t bw, const int32_t bh) {
+    const uint8_t *const sm_weights_w = sm_weight_arrays + bw;
+    const uint8_t *const sm_weights_h = sm_weight_arrays + bh;
+    const __m512i        scale        = _mm512_set1_epi16(256);
+    const __m512i        bottom_left  = _mm512_set1_epi16(left[bh - 1]);
+    const __m512i        top_right    = _mm512_set1_epi16(above[bw - 1]);
+    __m512i              ab[2], w_w[2], hor[2];
+
+    for (int32_t i = 0; i < (bw >> 5); i++) {
+        ab[i]  = load_u8_to_u16_32(above + 32 * i);
+        w_w[i] = load_u8_to_u16_32(sm_weights_w + 32 * i);
+        hor[i] = _mm512_add_epi16(_mm512_mullo_epi16(_mm512_sub_epi16(scale, w_w[i]), top_right),
+                                  _mm512_set1_epi16(255));
+    }
+
+    for (int32_t r = 0; r < bh; r++, dst += stride) {
+        const __m512i w_h  = _mm512_set1_epi16(sm_weights_h[r]);
+        const __m512i l    = _mm512_set1_epi16(left[r]);
+        const __m512i vert = _mm512_mullo_epi16(_mm512_sub_epi16(scale, w_h), bottom_left);
+        for (int32_t i = 0; i < (bw >> 5); i++) {
+            const __m512i v = _mm512_add_epi16(_mm512_mullo_epi16(w_h, ab[i]), vert);
+            const __m512i h = _mm512_add_epi16(_mm512_mullo_epi16(w_w[i], l), hor[i]);
+            store_u16_to_u8_32(dst + 32 * i, _mm512_srli_epi16(_mm512_avg_epu16(v, h), 8));
+        }
+    }
+}
+
+void eb_aom_smooth_predictor_32x8_avx512(uint8_t *dst, ptrdiff_t stride, const uint8_t *above,
+                                         const uint8_t *left) {
+    smooth_predictor_wxh(dst, stride, above, left, 32, 8);
+}
+
+void eb_aom_smooth_predictor_32x16_avx512(uint8_t *dst, ptrdiff_t stride, const uint8_t *above,
+                                          const uint8_t *left) {
+    smooth_predictor_wxh(dst, stride, above, left, 32, 16);
+}
+
+void eb_aom_smooth_predictor_32x32_avx512(uint8_t *dst, ptrdiff_t stride, const uint8_t *above,
+                                          const uint8_t *left) {
+    smooth_predictor_wxh(dst, stride, above, left, 32, 32);
+}
+
+void eb_aom_smooth_predictor_32x64_avx512(uint8_t *dst, ptrdiff_t stride, const uint8_t *above,
+                                          const uint8_t *left) {
+    smooth_predictor_wxh(dst, stride, above, left, 32, 64);
+}
+
+void eb_aom_smooth_predictor_64x16_avx512(uint8_t *dst, ptrdiff_t stride, const uint8_t *above,
+                                          const uint8_t *left) {
+    smooth_predictor_wxh(dst, stride, above, left, 64, 16);
+}
+
+void eb_aom_smooth_predictor_64x32_avx512(uint8_t *dst, ptrdiff_t stride, const uint8_t *above,
+                                          const uint8_t *left) {
+    smooth_predictor_wxh(dst, stride, above, left, 64, 32);
+}
+
+void eb_aom_smooth_predictor_64x64_avx512(uint8_t *dst, ptrdiff_t stride, const uint8_t *above,
+                                          const uint8_t *left) {
+    smooth_predictor_wxh(dst, stride, above, left, 64, 64);
+}
+
+// -----------------------------------------------------------------------------
+// SMOOTH_V_PRED
+
+// pred = (w_h * above + (256 - w_h) * bottom_left + 128) >> 8, at most 65408
+static INLINE void smooth_v_predictor_wxh(uint8_t *dst, const ptrdiff_t stride,
+                                          const uint8_t *const above, const uint8_t *const left,
+                                          const int32_t bw, const int32_t bh) {
+    const uint8_t *const sm_weights_h = sm_weight_arrays + bh;
+    const __m512i        scale        = _mm512_set1_epi16(256);
+    const __m512i        bottom_left  = _mm512_set1_epi16(left[bh - 1]);
+    const __m512i        round        = _mm512_set1_epi16(128);
+    __m512i              ab[2];
+
+    for (int32_t i = 0; i < (bw >> 5); i++) ab[i] = load_u8_to_u16_32(above + 32 * i);
+
+    for (int32_t r = 0; r < bh; r++, dst += stride) {
+        const __m512i w_h = _mm512_set1_epi16(sm_weights_h[r]);
+        const __m512i vert =
+            _mm512_add_epi16(_mm512_mullo_epi16(_mm512_sub_epi16(scale, w_h), bottom_left), round);
+        for (int32_t i = 0; i < (bw >> 5); i++) {
+            const __m512i v = _mm512_add_epi16(_mm512_mullo_epi16(w_h, ab[i]), vert);
+            store_u16_to_u8_32(dst + 32 * i, _mm512_srli_epi16(v, 8));
+        }
+    }
+}
+
+void eb_aom_smooth_v_predictor_32x8_avx512(uint8_t *dst, ptrdiff_t stride, const uint8_t *above,
+                                           const uint8_t *left) {
+    smooth_v_predictor_wxh(dst, stride, above, left, 32, 8);
+}
+
+void eb_aom_smooth_v_predictor_32x16_avx512(uint8_t *dst, ptrdiff_t stride, const uint8_t *above,
+                                            const uint8_t *left) {
+    smooth_v_predictor_wxh(dst, stride, above, left, 32, 16);
+}
+
+void eb_aom_smooth_v_predictor_32x32_avx512(uint8_t *dst, ptrdiff_t stride, const uint8_t *above,
+                                            const uint8_t *left) {
+    smooth_v_predictor_wxh(dst, stride, above, left, 32, 32);
+}
+
+void eb_aom_smooth_v_predictor_32x64_avx512(uint8_t *dst, ptrdiff_t stride, const uint8_t *above,
+                                            const uint8_t *left) {
+    smooth_v_predictor_wxh(dst, stride, above, left, 32, 64);
+}
+
+void eb_aom_smooth_v_predictor_64x16_avx512(uint8_t *dst, ptrdiff_t stride, const uint8_t *above,
+                                            const uint8_t *left) {
+    smooth_v_predictor_wxh(dst, stride, above, left, 64, 16);
+}
+
+void eb_aom_smooth_v_predictor_64x32_avx512(uint8_t *dst, ptrdiff_t stride, const uint8_t *above,
+                                            const uint8_t *left) {
+    smooth_v_predictor_wxh(dst, stride, above, left, 64, 32);
+}
+
+void eb_aom_smooth_v_predictor_64x64_avx512(uint8_t *dst, ptrdiff_t stride, const uint8_t *above,
+                                            const uint8_t *left) {
+    smooth_v_predictor_wxh(dst, stride, above, left, 64, 64);
+}
+
+// -----------------------------------------------------------------------------
+// SMOOTH_H_PRED
+
+// pred = (w_w * left + (256 - w_w) * top_right + 128) >> 8, at most 65408
+static INLINE void smooth_h_predictor_wxh(uint8_t *dst, const ptrdiff_t stride,
+                                          const uint8_t *const above, const uint8_t *const left,
+                                          const int32_t bw, const int32_t bh) {
+    const uint8_t *const sm_weights_w = sm_weight_arrays + bw;
+    const __m512i        scale        = _mm512_set1_epi16(256);
+    const __m512i        top_right    = _mm512_set1_epi16(above[bw - 1]);
+    const __m512i        round        = _mm512_set1_epi16(128);
+    __m512i              w_w[2], hor[2];
+
+    for (int32_t i = 0; i < (bw >> 5); i++) {
+        w_w[i] = load_u8_to_u16_32(sm_weights_w + 32 * i);
+        hor[i] = _mm512_add_epi16(_mm512_mullo_epi16(_mm512_sub_epi16(scale, w_w[i]), top_right),
+                                  round);
+    }
+
+    for (int32_t r = 0; r < bh; r++, dst += stride) {
+        const __m512i l = _mm512_set1_epi16(left[r]);
+        for (int32_t i = 0; i < (bw >> 5); i++) {
+            const __m512i h = _mm512_add_epi16(_mm512_mullo_epi16(w_w[i], l), hor[i]);
+            store_u16_to_u8_32(dst + 32 * i, _mm512_srli_epi16(h, 8));
+        }
+    }
+}
+
+void eb_aom_smooth_h_predictor_32x8_avx512(uint8_t *dst, ptrdiff_t stride, const uint8_t *above,
+                                           const uint8_t *left) {
+    smooth_h_predictor_wxh(dst, stride, above, left, 32, 8);
+}
+
+void eb_aom_smooth_h_predictor_32x16_avx512(uint8_t *dst, ptrdiff_t stride, const uint8_t *above,
+                                            const uint8_t *left) {
+    smooth_h_predictor_wxh(dst, stride, above, left, 32, 16);
+}
+
+void eb_aom_smooth_h_predictor_32x32_avx512(uint8_t *dst, ptrdiff_t stride, const uint8_t *above,
+                                            const uint8_t *left) {
+    smooth_h_predictor_wxh(dst, stride, above, left, 32, 32);
+}
+
+void eb_aom_smooth_h_predictor_32x64_avx512(uint8_t *dst, ptrdiff_t stride, const uint8_t *above,
+                                            const uint8_t *left) {
+    smooth_h_predictor_wxh(dst, stride, above, left, 32, 64);
+}
+
+void eb_aom_smooth_h_predictor_64x16_avx512(uint8_t *dst, ptrdiff_t stride, const uint8_t *above,
+                                            const uint8_t *left) {
+    smooth_h_predictor_wxh(dst, stride, above, left, 64, 16);
+}
+
+void eb_aom_smooth_h_predictor_64x32_avx512(uint8_t *dst, ptrdiff_t stride, const uint8_t *above,
+                                            const uint8_t *left) {
+    smooth_h_predictor_wxh(dst, stride, above, left, 64, 32);
+}
+
+void eb_aom_smooth_h_predictor_64x64_avx512(uint8_t *dst, ptrdiff_t stride, const uint8_t *above,
+                                            const uint8_t *left) {
+    smooth_h_predictor_wxh(dst, stride, above, left, 64, 64);
+}
+
+// -----------------------------------------------------------------------------
+// PAETH_PRED
+
+// With base = top + left - top_left:
+//   p_left     = |base - left|     = |top - top_left|  (per column)
+//   p_top      = |base - top|      = |left - top_left| (per row)
+//   p_top_left = |base - top_left| = |top + left - 2 * top_left|
+static INLINE void paeth_predictor_wxh(uint8_t *dst, const ptrdiff_t stride,
+                                       const uint8_t *const above, const uint8_t *const left,
+                                       const int32_t bw, const int32_t bh) {
+    const __m512i tl = _mm512_set1_epi16(above[-1]);
+    __m512i       top[2], top_tl[2], p_left[2];
+
+    for (int32_t i = 0; i < (bw >> 5); i++) {
+        top[i]    = load_u8_to_u16_32(above + 32 * i);
+        top_tl[i] = _mm512_sub_epi16(top[i], tl);
+        p_left[i] = _mm512_abs_epi16(top_tl[i]);
+    }
+
+    for (int32_t r = 0; r < bh; r++, dst += stride) {
+        const __m512i l       = _mm512_set1_epi16(left[r]);
+        const __m512i left_tl = _mm512_sub_epi16(l, tl);
+        const __m512i p_top   = _mm512_abs_epi16(left_tl);
+        for (int32_t i = 0; i < (bw >> 5); i++) {
+            const __m512i   p_top_left = _mm512_abs_epi16(_mm512_add_epi16(top_tl[i], left_tl));
+            const __mmask32 use_left   = _mm512_cmple_epi16_mask(p_left[i], p_top) &
+                _mm512_cmple_epi16_mask(p_left[i], p_top_left);
+            const __mmask32 use_top = _mm512_cmple_epi16_mask(p_top, p_top_left);
+            __m512i         d       = _mm512_mask_blend_epi16(use_top, tl, top[i]);
+            d                       = _mm512_mask_blend_epi16(use_left, d, l);
+            store_u16_to_u8_32(dst + 32 * i, d);
+        }
+    }
+}
+
+void eb_aom_paeth_predictor_32x8_avx512(uint8_t *dst, ptrdiff_t stride, const uint8_t *above,
+                                        const uint8_t *left) {
+    paeth_predictor_wxh(dst, stride, above, left, 32, 8);
+}
+
+void eb_aom_paeth_predictor_32x16_avx512(uint8_t *dst, ptrdiff_t stride, const uint8_t *above,
+                                         const uint8_t *left) {
+    paeth_predictor_wxh(dst, stride, above, left, 32, 16);
+}
+
+void eb_aom_paeth_predictor_32x32_avx512(uint8_t *dst, ptrdiff_t stride, const uint8_t *above,
+                                         const uint8_t *left) {
+    paeth_predictor_wxh(dst, stride, above, left, 32, 32);
+}
+
+void eb_aom_paeth_predictor_32x64_avx512(uint8_t *dst, ptrdiff_t stride, const uint8_t *above,
+                                         const uint8_t *left) {
+    paeth_predictor_wxh(dst, stride, above, left, 32, 64);
+}
+
+void eb_aom_paeth_predictor_64x16_avx512(uint8_t *dst, ptrdiff_t stride, const uint8_t *above,
+                                         const uint8_t *left) {
+    paeth_predictor_wxh(dst, stride, above, left, 64, 16);
+}
+
+void eb_aom_paeth_predictor_64x32_avx512(uint8_t *dst, ptrdiff_t stride, const uint8_t *above,
+                                         const uint8_t *left) {
+    paeth_predictor_wxh(dst, stride, above, left, 64, 32);
+}
+
+void eb_aom_paeth_predictor_64x64_avx512(uint8_t *dst, ptrdiff_t stride, const uint8_t *above,
+                                         const uint8_t *left) {
+    paeth_predictor_wxh(dst, stride, above, left, 64, 64);
+}
+#endif // !NON_AVX512_SUPPORT
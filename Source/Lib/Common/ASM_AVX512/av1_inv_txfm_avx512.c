@@ -0,0 +1,1331 @@
+/*
+ * Copyright(c) 2019 Intel Corporation
+ * SPDX - License - Identifier: BSD - 2 - Clause - Patent
+ */
+
+#include "EbDefinitions.h"
+
+#ifndef NON_AVX512_SUPPORT
+
+#include <assert.h>
+#include <immintrin.h>
+#include "common_dsp_rtcd.h"
+#include "av1_inv_txfm_avx2.h"
+#include "av1_inv_txfm_ssse3.h"
+#include "EbInvTransforms.h"
+
+// The 1D kernels below are the 512-bit versions of the AVX2 idct32/64,
+// each register carries 32 rows (row pass) or 32 columns (column pass).
+
+// half input is zero
+#define btf_16_w32_0_avx512(w0, w1, in, out0, out1)        \
+    {                                                      \
+        const __m512i _w0 = _mm512_set1_epi16(w0 * 8);     \
+        const __m512i _w1 = _mm512_set1_epi16(w1 * 8);     \
+        const __m512i _in = in;                            \
+        out0              = _mm512_mulhrs_epi16(_in, _w0); \
+        out1              = _mm512_mulhrs_epi16(_in, _w1); \
+    }
+
+static INLINE __m512i pair_set_w32_epi16(int16_t a, int16_t b) {
+    return _mm512_set1_epi32((int32_t)(((uint16_t)(a)) | (((uint32_t)(b)) << 16)));
+}
+
+static INLINE void btf_16_w32_avx512(const __m512i w0, const __m512i w1, __m512i *in0,
+                                     __m512i *in1, const __m512i _r, const int32_t cos_bit) {
+    __m512i t0 = _mm512_unpacklo_epi16(*in0, *in1);
+    __m512i t1 = _mm512_unpackhi_epi16(*in0, *in1);
+    __m512i u0 = _mm512_madd_epi16(t0, w0);
+    __m512i u1 = _mm512_madd_epi16(t1, w0);
+    __m512i v0 = _mm512_madd_epi16(t0, w1);
+    __m512i v1 = _mm512_madd_epi16(t1, w1);
+
+    __m512i a0 = _mm512_add_epi32(u0, _r);
+    __m512i a1 = _mm512_add_epi32(u1, _r);
+    __m512i b0 = _mm512_add_epi32(v0, _r);
+    __m512i b1 = _mm512_add_epi32(v1, _r);
+
+    __m512i c0 = _mm512_srai_epi32(a0, cos_bit);
+    __m512i c1 = _mm512_srai_epi32(a1, cos_bit);
+    __m512i d0 = _mm512_srai_epi32(b0, cos_bit);
+    __m512i d1 = _mm512_srai_epi32(b1, cos_bit);
+
+    *in0 = _mm512_packs_epi32(c0, c1);
+    *in1 = _mm512_packs_epi32(d0, d1);
+}
+
+static INLINE void btf_16_adds_subs_avx512(__m512i *in0, __m512i *in1) {
+    const __m512i _in0 = *in0;
+    const __m512i _in1 = *in1;
+    *in0               = _mm512_adds_epi16(_in0, _in1);
+    *in1               = _mm512_subs_epi16(_in0, _in1);
+}
+
+static INLINE void btf_16_adds_subs_out_avx512(__m512i *out0, __m512i *out1, __m512i in0,
+                                               __m512i in1) {
+    const __m512i _in0 = in0;
+    const __m512i _in1 = in1;
+    *out0              = _mm512_adds_epi16(_in0, _in1);
+    *out1              = _mm512_subs_epi16(_in0, _in1);
+}
+
+static INLINE void idct32_high16_stage3_avx512(__m512i *x) {
+    btf_16_adds_subs_avx512(&x[16], &x[17]);
+    btf_16_adds_subs_avx512(&x[19], &x[18]);
+    btf_16_adds_subs_avx512(&x[20], &x[21]);
+    btf_16_adds_subs_avx512(&x[23], &x[22]);
+    btf_16_adds_subs_avx512(&x[24], &x[25]);
+    btf_16_adds_subs_avx512(&x[27], &x[26]);
+    btf_16_adds_subs_avx512(&x[28], &x[29]);
+    btf_16_adds_subs_avx512(&x[31], &x[30]);
+}
+
+static INLINE void idct32_high16_stage4_avx512(__m512i *x, const int32_t *cospi, const __m512i _r,
+                                               int8_t cos_bit) {
+    const __m512i cospi_m08_p56 = pair_set_w32_epi16(-cospi[8], cospi[56]);
+    const __m512i cospi_p56_p08 = pair_set_w32_epi16(cospi[56], cospi[8]);
+    const __m512i cospi_m56_m08 = pair_set_w32_epi16(-cospi[56], -cospi[8]);
+    const __m512i cospi_m40_p24 = pair_set_w32_epi16(-cospi[40], cospi[24]);
+    const __m512i cospi_p24_p40 = pair_set_w32_epi16(cospi[24], cospi[40]);
+    const __m512i cospi_m24_m40 = pair_set_w32_epi16(-cospi[24], -cospi[40]);
+    btf_16_w32_avx512(cospi_m08_p56, cospi_p56_p08, &x[17], &x[30], _r, cos_bit);
+    btf_16_w32_avx512(cospi_m56_m08, cospi_m08_p56, &x[18], &x[29], _r, cos_bit);
+    btf_16_w32_avx512(cospi_m40_p24, cospi_p24_p40, &x[21], &x[26], _r, cos_bit);
+    btf_16_w32_avx512(cospi_m24_m40, cospi_m40_p24, &x[22], &x[25], _r, cos_bit);
+}
+
+static INLINE void idct32_high24_stage5_avx512(__m512i *x, const int32_t *cospi, const __m512i _r,
+                                               int8_t cos_bit) {
+    const __m512i cospi_m16_p48 = pair_set_w32_epi16(-cospi[16], cospi[48]);
+    const __m512i cospi_p48_p16 = pair_set_w32_epi16(cospi[48], cospi[16]);
+    const __m512i cospi_m48_m16 = pair_set_w32_epi16(-cospi[48], -cospi[16]);
+    btf_16_w32_avx512(cospi_m16_p48, cospi_p48_p16, &x[9], &x[14], _r, cos_bit);
+    btf_16_w32_avx512(cospi_m48_m16, cospi_m16_p48, &x[10], &x[13], _r, cos_bit);
+    btf_16_adds_subs_avx512(&x[16], &x[19]);
+    btf_16_adds_subs_avx512(&x[17], &x[18]);
+    btf_16_adds_subs_avx512(&x[23], &x[20]);
+    btf_16_adds_subs_avx512(&x[22], &x[21]);
+    btf_16_adds_subs_avx512(&x[24], &x[27]);
+    btf_16_adds_subs_avx512(&x[25], &x[26]);
+    btf_16_adds_subs_avx512(&x[31], &x[28]);
+    btf_16_adds_subs_avx512(&x[30], &x[29]);
+}
+
+static INLINE void idct32_high28_stage6_avx512(__m512i *x, const int32_t *cospi, const __m512i _r,
+                                               int8_t cos_bit) {
+    const __m512i cospi_m32_p32 = pair_set_w32_epi16(-cospi[32], cospi[32]);
+    const __m512i cospi_p32_p32 = pair_set_w32_epi16(cospi[32], cospi[32]);
+    const __m512i cospi_m16_p48 = pair_set_w32_epi16(-cospi[16], cospi[48]);
+    const __m512i cospi_p48_p16 = pair_set_w32_epi16(cospi[48], cospi[16]);
+    const __m512i cospi_m48_m16 = pair_set_w32_epi16(-cospi[48], -cospi[16]);
+    btf_16_w32_avx512(cospi_m32_p32, cospi_p32_p32, &x[5], &x[6], _r, cos_bit);
+    btf_16_adds_subs_avx512(&x[8], &x[11]);
+    btf_16_adds_subs_avx512(&x[9], &x[10]);
+    btf_16_adds_subs_avx512(&x[15], &x[12]);
+    btf_16_adds_subs_avx512(&x[14], &x[13]);
+    btf_16_w32_avx512(cospi_m16_p48, cospi_p48_p16, &x[18], &x[29], _r, cos_bit);
+    btf_16_w32_avx512(cospi_m16_p48, cospi_p48_p16, &x[19], &x[28], _r, cos_bit);
+    btf_16_w32_avx512(cospi_m48_m16, cospi_m16_p48, &x[20], &x[27], _r, cos_bit);
+    btf_16_w32_avx512(cospi_m48_m16, cospi_m16_p48, &x[21], &x[26], _r, cos_bit);
+}
+
+static INLINE void idct32_stage7_avx512(__m512i *x, const int32_t *cospi, const __m512i _r,
+                                        int8_t cos_bit) {
+    const __m512i cospi_m32_p32 = pair_set_w32_epi16(-cospi[32], cospi[32]);
+    const __m512i cospi_p32_p32 = pair_set_w32_epi16(cospi[32], cospi[32]);
+    btf_16_adds_subs_avx512(&x[0], &x[7]);
+    btf_16_adds_subs_avx512(&x[1], &x[6]);
+    btf_16_adds_subs_avx512(&x[2], &x[5]);
+    btf_16_adds_subs_avx512(&x[3], &x[4]);
+    btf_16_w32_avx512(cospi_m32_p32, cospi_p32_p32, &x[10], &x[13], _r, cos_bit);
+    btf_16_w32_avx512(cospi_m32_p32, cospi_p32_p32, &x[11], &x[12], _r, cos_bit);
+    btf_16_adds_subs_avx512(&x[16], &x[23]);
+    btf_16_adds_subs_avx512(&x[17], &x[22]);
+    btf_16_adds_subs_avx512(&x[18], &x[21]);
+    btf_16_adds_subs_avx512(&x[19], &x[20]);
+    btf_16_adds_subs_avx512(&x[31], &x[24]);
+    btf_16_adds_subs_avx512(&x[30], &x[25]);
+    btf_16_adds_subs_avx512(&x[29], &x[26]);
+    btf_16_adds_subs_avx512(&x[28], &x[27]);
+}
+
+static INLINE void idct32_stage8_avx512(__m512i *x, const int32_t *cospi, const __m512i _r,
+                                        int8_t cos_bit) {
+    const __m512i cospi_m32_p32 = pair_set_w32_epi16(-cospi[32], cospi[32]);
+    const __m512i cospi_p32_p32 = pair_set_w32_epi16(cospi[32], cospi[32]);
+    btf_16_adds_subs_avx512(&x[0], &x[15]);
+    btf_16_adds_subs_avx512(&x[1], &x[14]);
+    btf_16_adds_subs_avx512(&x[2], &x[13]);
+    btf_16_adds_subs_avx512(&x[3], &x[12]);
+    btf_16_adds_subs_avx512(&x[4], &x[11]);
+    btf_16_adds_subs_avx512(&x[5], &x[10]);
+    btf_16_adds_subs_avx512(&x[6], &x[9]);
+    btf_16_adds_subs_avx512(&x[7], &x[8]);
+    btf_16_w32_avx512(cospi_m32_p32, cospi_p32_p32, &x[20], &x[27], _r, cos_bit);
+    btf_16_w32_avx512(cospi_m32_p32, cospi_p32_p32, &x[21], &x[26], _r, cos_bit);
+    btf_16_w32_avx512(cospi_m32_p32, cospi_p32_p32, &x[22], &x[25], _r, cos_bit);
+    btf_16_w32_avx512(cospi_m32_p32, cospi_p32_p32, &x[23], &x[24], _r, cos_bit);
+}
+
+static INLINE void idct32_stage9_avx512(__m512i *output, __m512i *x) {
+    btf_16_adds_subs_out_avx512(&output[0], &output[31], x[0], x[31]);
+    btf_16_adds_subs_out_avx512(&output[1], &output[30], x[1], x[30]);
+    btf_16_adds_subs_out_avx512(&output[2], &output[29], x[2], x[29]);
+    btf_16_adds_subs_out_avx512(&output[3], &output[28], x[3], x[28]);
+    btf_16_adds_subs_out_avx512(&output[4], &output[27], x[4], x[27]);
+    btf_16_adds_subs_out_avx512(&output[5], &output[26], x[5], x[26]);
+    btf_16_adds_subs_out_avx512(&output[6], &output[25], x[6], x[25]);
+    btf_16_adds_subs_out_avx512(&output[7], &output[24], x[7], x[24]);
+    btf_16_adds_subs_out_avx512(&output[8], &output[23], x[8], x[23]);
+    btf_16_adds_subs_out_avx512(&output[9], &output[22], x[9], x[22]);
+    btf_16_adds_subs_out_avx512(&output[10], &output[21], x[10], x[21]);
+    btf_16_adds_subs_out_avx512(&output[11], &output[20], x[11], x[20]);
+    btf_16_adds_subs_out_avx512(&output[12], &output[19], x[12], x[19]);
+    btf_16_adds_subs_out_avx512(&output[13], &output[18], x[13], x[18]);
+    btf_16_adds_subs_out_avx512(&output[14], &output[17], x[14], x[17]);
+    btf_16_adds_subs_out_avx512(&output[15], &output[16], x[15], x[16]);
+}
+
+static void idct32_low1_new_avx512(const __m512i *input, __m512i *output, int8_t cos_bit) {
+    (void)cos_bit;
+    const int32_t *cospi = cospi_arr(INV_COS_BIT);
+
+    // stage 1
+    __m512i x[2];
+    x[0] = input[0];
+
+    // stage 2
+    // stage 3
+    // stage 4
+    // stage 5
+    btf_16_w32_0_avx512(cospi[32], cospi[32], x[0], x[0], x[1]);
+
+    // stage 6
+    // stage 7
+    // stage 8
+    // stage 9
+    output[0]  = x[0];
+    output[31] = x[0];
+    output[1]  = x[1];
+    output[30] = x[1];
+    output[2]  = x[1];
+    output[29] = x[1];
+    output[3]  = x[0];
+    output[28] = x[0];
+    output[4]  = x[0];
+    output[27] = x[0];
+    output[5]  = x[1];
+    output[26] = x[1];
+    output[6]  = x[1];
+    output[25] = x[1];
+    output[7]  = x[0];
+    output[24] = x[0];
+    output[8]  = x[0];
+    output[23] = x[0];
+    output[9]  = x[1];
+    output[22] = x[1];
+    output[10] = x[1];
+    output[21] = x[1];
+    output[11] = x[0];
+    output[20] = x[0];
+    output[12] = x[0];
+    output[19] = x[0];
+    output[13] = x[1];
+    output[18] = x[1];
+    output[14] = x[1];
+    output[17] = x[1];
+    output[15] = x[0];
+    output[16] = x[0];
+}
+
+static void idct32_low8_new_avx512(const __m512i *input, __m512i *output, int8_t cos_bit) {
+    (void)cos_bit;
+    const int32_t *cospi = cospi_arr(INV_COS_BIT);
+    const __m512i  _r    = _mm512_set1_epi32(1 << (INV_COS_BIT - 1));
+
+    // stage 1
+    __m512i x[32];
+    x[0]  = input[0];
+    x[4]  = input[4];
+    x[8]  = input[2];
+    x[12] = input[6];
+    x[16] = input[1];
+    x[20] = input[5];
+    x[24] = input[3];
+    x[28] = input[7];
+
+    // stage 2
+    btf_16_w32_0_avx512(cospi[62], cospi[2], x[16], x[16], x[31]);
+    btf_16_w32_0_avx512(-cospi[50], cospi[14], x[28], x[19], x[28]);
+    btf_16_w32_0_avx512(cospi[54], cospi[10], x[20], x[20], x[27]);
+    btf_16_w32_0_avx512(-cospi[58], cospi[6], x[24], x[23], x[24]);
+
+    // stage 3
+    btf_16_w32_0_avx512(cospi[60], cospi[4], x[8], x[8], x[15]);
+    btf_16_w32_0_avx512(-cospi[52], cospi[12], x[12], x[11], x[12]);
+    x[17] = x[16];
+    x[18] = x[19];
+    x[21] = x[20];
+    x[22] = x[23];
+    x[25] = x[24];
+    x[26] = x[27];
+    x[29] = x[28];
+    x[30] = x[31];
+
+    // stage 4
+    btf_16_w32_0_avx512(cospi[56], cospi[8], x[4], x[4], x[7]);
+    x[9]  = x[8];
+    x[10] = x[11];
+    x[13] = x[12];
+    x[14] = x[15];
+    idct32_high16_stage4_avx512(x, cospi, _r, cos_bit);
+
+    // stage 5
+    btf_16_w32_0_avx512(cospi[32], cospi[32], x[0], x[0], x[1]);
+    x[5] = x[4];
+    x[6] = x[7];
+    idct32_high24_stage5_avx512(x, cospi, _r, cos_bit);
+    // stage 6
+    x[3] = x[0];
+    x[2] = x[1];
+    idct32_high28_stage6_avx512(x, cospi, _r, cos_bit);
+
+    idct32_stage7_avx512(x, cospi, _r, cos_bit);
+    idct32_stage8_avx512(x, cospi, _r, cos_bit);
+    idct32_stage9_avx512(output, x);
+}
+
+static void idct32_low16_new_avx512(const __m512i *input, __m512i *output, int8_t cos_bit) {
+    (void)cos_bit;
+    const int32_t *cospi = cospi_arr(INV_COS_BIT);
+    const __m512i  _r    = _mm512_set1_epi32(1 << (INV_COS_BIT - 1));
+
+    // stage 1
+    __m512i x[32];
+    x[0]  = input[0];
+    x[2]  = input[8];
+    x[4]  = input[4];
+    x[6]  = input[12];
+    x[8]  = input[2];
+    x[10] = input[10];
+    x[12] = input[6];
+    x[14] = input[14];
+    x[16] = input[1];
+    x[18] = input[9];
+    x[20] = input[5];
+    x[22] = input[13];
+    x[24] = input[3];
+    x[26] = input[11];
+    x[28] = input[7];
+    x[30] = input[15];
+
+    // stage 2
+    btf_16_w32_0_avx512(cospi[62], cospi[2], x[16], x[16], x[31]);
+    btf_16_w32_0_avx512(-cospi[34], cospi[30], x[30], x[17], x[30]);
+    btf_16_w32_0_avx512(cospi[46], cospi[18], x[18], x[18], x[29]);
+    btf_16_w32_0_avx512(-cospi[50], cospi[14], x[28], x[19], x[28]);
+    btf_16_w32_0_avx512(cospi[54], cospi[10], x[20], x[20], x[27]);
+    btf_16_w32_0_avx512(-cospi[42], cospi[22], x[26], x[21], x[26]);
+    btf_16_w32_0_avx512(cospi[38], cospi[26], x[22], x[22], x[25]);
+    btf_16_w32_0_avx512(-cospi[58], cospi[6], x[24], x[23], x[24]);
+
+    // stage 3
+    btf_16_w32_0_avx512(cospi[60], cospi[4], x[8], x[8], x[15]);
+    btf_16_w32_0_avx512(-cospi[36], cospi[28], x[14], x[9], x[14]);
+    btf_16_w32_0_avx512(cospi[44], cospi[20], x[10], x[10], x[13]);
+    btf_16_w32_0_avx512(-cospi[52], cospi[12], x[12], x[11], x[12]);
+    idct32_high16_stage3_avx512(x);
+
+    // stage 4
+    btf_16_w32_0_avx512(cospi[56], cospi[8], x[4], x[4], x[7]);
+    btf_16_w32_0_avx512(-cospi[40], cospi[24], x[6], x[5], x[6]);
+    btf_16_adds_subs_avx512(&x[8], &x[9]);
+    btf_16_adds_subs_avx512(&x[11], &x[10]);
+    btf_16_adds_subs_avx512(&x[12], &x[13]);
+    btf_16_adds_subs_avx512(&x[15], &x[14]);
+    idct32_high16_stage4_avx512(x, cospi, _r, cos_bit);
+
+    // stage 5
+    btf_16_w32_0_avx512(cospi[32], cospi[32], x[0], x[0], x[1]);
+    btf_16_w32_0_avx512(cospi[48], cospi[16], x[2], x[2], x[3]);
+    btf_16_adds_subs_avx512(&x[4], &x[5]);
+    btf_16_adds_subs_avx512(&x[7], &x[6]);
+    idct32_high24_stage5_avx512(x, cospi, _r, cos_bit);
+
+    btf_16_adds_subs_avx512(&x[0], &x[3]);
+    btf_16_adds_subs_avx512(&x[1], &x[2]);
+    idct32_high28_stage6_avx512(x, cospi, _r, cos_bit);
+
+    idct32_stage7_avx512(x, cospi, _r, cos_bit);
+    idct32_stage8_avx512(x, cospi, _r, cos_bit);
+    idct32_stage9_avx512(output, x);
+}
+
+static void idct32_new_avx512(const __m512i *input, __m512i *output, int8_t cos_bit) {
+    (void)(cos_bit);
+    const int32_t *cospi = cospi_arr(INV_COS_BIT);
+    const __m512i  _r    = _mm512_set1_epi32(1 << (INV_COS_BIT - 1));
+
+    __m512i cospi_p62_m02 = pair_set_w32_epi16(cospi[62], -cospi[2]);
+    __m512i cospi_p02_p62 = pair_set_w32_epi16(cospi[2], cospi[62]);
+    __m512i cospi_p30_m34 = pair_set_w32_epi16(cospi[30], -cospi[34]);
+    __m512i cospi_p34_p30 = pair_set_w32_epi16(cospi[34], cospi[30]);
+    __m512i cospi_p46_m18 = pair_set_w32_epi16(cospi[46], -cospi[18]);
+    __m512i cospi_p18_p46 = pair_set_w32_epi16(cospi[18], cospi[46]);
+    __m512i cospi_p14_m50 = pair_set_w32_epi16(cospi[14], -cospi[50]);
+    __m512i cospi_p50_p14 = pair_set_w32_epi16(cospi[50], cospi[14]);
+    __m512i cospi_p54_m10 = pair_set_w32_epi16(cospi[54], -cospi[10]);
+    __m512i cospi_p10_p54 = pair_set_w32_epi16(cospi[10], cospi[54]);
+    __m512i cospi_p22_m42 = pair_set_w32_epi16(cospi[22], -cospi[42]);
+    __m512i cospi_p42_p22 = pair_set_w32_epi16(cospi[42], cospi[22]);
+    __m512i cospi_p38_m26 = pair_set_w32_epi16(cospi[38], -cospi[26]);
+    __m512i cospi_p26_p38 = pair_set_w32_epi16(cospi[26], cospi[38]);
+    __m512i cospi_p06_m58 = pair_set_w32_epi16(cospi[6], -cospi[58]);
+    __m512i cospi_p58_p06 = pair_set_w32_epi16(cospi[58], cospi[6]);
+    __m512i cospi_p60_m04 = pair_set_w32_epi16(cospi[60], -cospi[4]);
+    __m512i cospi_p04_p60 = pair_set_w32_epi16(cospi[4], cospi[60]);
+    __m512i cospi_p28_m36 = pair_set_w32_epi16(cospi[28], -cospi[36]);
+    __m512i cospi_p36_p28 = pair_set_w32_epi16(cospi[36], cospi[28]);
+    __m512i cospi_p44_m20 = pair_set_w32_epi16(cospi[44], -cospi[20]);
+    __m512i cospi_p20_p44 = pair_set_w32_epi16(cospi[20], cospi[44]);
+    __m512i cospi_p12_m52 = pair_set_w32_epi16(cospi[12], -cospi[52]);
+    __m512i cospi_p52_p12 = pair_set_w32_epi16(cospi[52], cospi[12]);
+    __m512i cospi_p56_m08 = pair_set_w32_epi16(cospi[56], -cospi[8]);
+    __m512i cospi_p08_p56 = pair_set_w32_epi16(cospi[8], cospi[56]);
+    __m512i cospi_p24_m40 = pair_set_w32_epi16(cospi[24], -cospi[40]);
+    __m512i cospi_p40_p24 = pair_set_w32_epi16(cospi[40], cospi[24]);
+    __m512i cospi_p32_p32 = pair_set_w32_epi16(cospi[32], cospi[32]);
+    __m512i cospi_p32_m32 = pair_set_w32_epi16(cospi[32], -cospi[32]);
+    __m512i cospi_p48_m16 = pair_set_w32_epi16(cospi[48], -cospi[16]);
+    __m512i cospi_p16_p48 = pair_set_w32_epi16(cospi[16], cospi[48]);
+
+    // stage 1
+    __m512i x1[32];
+    x1[0]  = input[0];
+    x1[1]  = input[16];
+    x1[2]  = input[8];
+    x1[3]  = input[24];
+    x1[4]  = input[4];
+    x1[5]  = input[20];
+    x1[6]  = input[12];
+    x1[7]  = input[28];
+    x1[8]  = input[2];
+    x1[9]  = input[18];
+    x1[10] = input[10];
+    x1[11] = input[26];
+    x1[12] = input[6];
+    x1[13] = input[22];
+    x1[14] = input[14];
+    x1[15] = input[30];
+    x1[16] = input[1];
+    x1[17] = input[17];
+    x1[18] = input[9];
+    x1[19] = input[25];
+    x1[20] = input[5];
+    x1[21] = input[21];
+    x1[22] = input[13];
+    x1[23] = input[29];
+    x1[24] = input[3];
+    x1[25] = input[19];
+    x1[26] = input[11];
+    x1[27] = input[27];
+    x1[28] = input[7];
+    x1[29] = input[23];
+    x1[30] = input[15];
+    x1[31] = input[31];
+
+    // stage 2
+    btf_16_w32_avx512(cospi_p62_m02, cospi_p02_p62, &x1[16], &x1[31], _r, cos_bit);
+    btf_16_w32_avx512(cospi_p30_m34, cospi_p34_p30, &x1[17], &x1[30], _r, cos_bit);
+    btf_16_w32_avx512(cospi_p46_m18, cospi_p18_p46, &x1[18], &x1[29], _r, cos_bit);
+    btf_16_w32_avx512(cospi_p14_m50, cospi_p50_p14, &x1[19], &x1[28], _r, cos_bit);
+    btf_16_w32_avx512(cospi_p54_m10, cospi_p10_p54, &x1[20], &x1[27], _r, cos_bit);
+    btf_16_w32_avx512(cospi_p22_m42, cospi_p42_p22, &x1[21], &x1[26], _r, cos_bit);
+    btf_16_w32_avx512(cospi_p38_m26, cospi_p26_p38, &x1[22], &x1[25], _r, cos_bit);
+    btf_16_w32_avx512(cospi_p06_m58, cospi_p58_p06, &x1[23], &x1[24], _r, cos_bit);
+
+    // stage 3
+    btf_16_w32_avx512(cospi_p60_m04, cospi_p04_p60, &x1[8], &x1[15], _r, cos_bit);
+    btf_16_w32_avx512(cospi_p28_m36, cospi_p36_p28, &x1[9], &x1[14], _r, cos_bit);
+    btf_16_w32_avx512(cospi_p44_m20, cospi_p20_p44, &x1[10], &x1[13], _r, cos_bit);
+    btf_16_w32_avx512(cospi_p12_m52, cospi_p52_p12, &x1[11], &x1[12], _r, cos_bit);
+    idct32_high16_stage3_avx512(x1);
+
+    // stage 4
+    btf_16_w32_avx512(cospi_p56_m08, cospi_p08_p56, &x1[4], &x1[7], _r, cos_bit);
+    btf_16_w32_avx512(cospi_p24_m40, cospi_p40_p24, &x1[5], &x1[6], _r, cos_bit);
+    btf_16_adds_subs_avx512(&x1[8], &x1[9]);
+    btf_16_adds_subs_avx512(&x1[11], &x1[10]);
+    btf_16_adds_subs_avx512(&x1[12], &x1[13]);
+    btf_16_adds_subs_avx512(&x1[15], &x1[14]);
+    idct32_high16_stage4_avx512(x1, cospi, _r, cos_bit);
+
+    // stage 5
+    btf_16_w32_avx512(cospi_p32_p32, cospi_p32_m32, &x1[0], &x1[1], _r, cos_bit);
+    btf_16_w32_avx512(cospi_p48_m16, cospi_p16_p48, &x1[2], &x1[3], _r, cos_bit);
+    btf_16_adds_subs_avx512(&x1[4], &x1[5]);
+    btf_16_adds_subs_avx512(&x1[7], &x1[6]);
+    idct32_high24_stage5_avx512(x1, cospi, _r, cos_bit);
+
+    // stage 6
+    btf_16_adds_subs_avx512(&x1[0], &x1[3]);
+    btf_16_adds_subs_avx512(&x1[1], &x1[2]);
+    idct32_high28_stage6_avx512(x1, cospi, _r, cos_bit);
+
+    idct32_stage7_avx512(x1, cospi, _r, cos_bit);
+    idct32_stage8_avx512(x1, cospi, _r, cos_bit);
+    idct32_stage9_avx512(output, x1);
+}
+
+static INLINE void idct64_stage4_high32_avx512(__m512i *x, const int32_t *cospi, const __m512i _r,
+                                               int8_t cos_bit) {
+    (void)cos_bit;
+    const __m512i cospi_m04_p60 = pair_set_w32_epi16(-cospi[4], cospi[60]);
+    const __m512i cospi_p60_p04 = pair_set_w32_epi16(cospi[60], cospi[4]);
+    const __m512i cospi_m60_m04 = pair_set_w32_epi16(-cospi[60], -cospi[4]);
+    const __m512i cospi_m36_p28 = pair_set_w32_epi16(-cospi[36], cospi[28]);
+    const __m512i cospi_p28_p36 = pair_set_w32_epi16(cospi[28], cospi[36]);
+    const __m512i cospi_m28_m36 = pair_set_w32_epi16(-cospi[28], -cospi[36]);
+    const __m512i cospi_m20_p44 = pair_set_w32_epi16(-cospi[20], cospi[44]);
+    const __m512i cospi_p44_p20 = pair_set_w32_epi16(cospi[44], cospi[20]);
+    const __m512i cospi_m44_m20 = pair_set_w32_epi16(-cospi[44], -cospi[20]);
+    const __m512i cospi_m52_p12 = pair_set_w32_epi16(-cospi[52], cospi[12]);
+    const __m512i cospi_p12_p52 = pair_set_w32_epi16(cospi[12], cospi[52]);
+    const __m512i cospi_m12_m52 = pair_set_w32_epi16(-cospi[12], -cospi[52]);
+    btf_16_w32_avx512(cospi_m04_p60, cospi_p60_p04, &x[33], &x[62], _r, cos_bit);
+    btf_16_w32_avx512(cospi_m60_m04, cospi_m04_p60, &x[34], &x[61], _r, cos_bit);
+    btf_16_w32_avx512(cospi_m36_p28, cospi_p28_p36, &x[37], &x[58], _r, cos_bit);
+    btf_16_w32_avx512(cospi_m28_m36, cospi_m36_p28, &x[38], &x[57], _r, cos_bit);
+    btf_16_w32_avx512(cospi_m20_p44, cospi_p44_p20, &x[41], &x[54], _r, cos_bit);
+    btf_16_w32_avx512(cospi_m44_m20, cospi_m20_p44, &x[42], &x[53], _r, cos_bit);
+    btf_16_w32_avx512(cospi_m52_p12, cospi_p12_p52, &x[45], &x[50], _r, cos_bit);
+    btf_16_w32_avx512(cospi_m12_m52, cospi_m52_p12, &x[46], &x[49], _r, cos_bit);
+}
+
+static INLINE void idct64_stage5_high48_avx512(__m512i *x, const int32_t *cospi, const __m512i _r,
+                                               int8_t cos_bit) {
+    (void)cos_bit;
+    const __m512i cospi_m08_p56 = pair_set_w32_epi16(-cospi[8], cospi[56]);
+    const __m512i cospi_p56_p08 = pair_set_w32_epi16(cospi[56], cospi[8]);
+    const __m512i cospi_m56_m08 = pair_set_w32_epi16(-cospi[56], -cospi[8]);
+    const __m512i cospi_m40_p24 = pair_set_w32_epi16(-cospi[40], cospi[24]);
+    const __m512i cospi_p24_p40 = pair_set_w32_epi16(cospi[24], cospi[40]);
+    const __m512i cospi_m24_m40 = pair_set_w32_epi16(-cospi[24], -cospi[40]);
+    btf_16_w32_avx512(cospi_m08_p56, cospi_p56_p08, &x[17], &x[30], _r, cos_bit);
+    btf_16_w32_avx512(cospi_m56_m08, cospi_m08_p56, &x[18], &x[29], _r, cos_bit);
+    btf_16_w32_avx512(cospi_m40_p24, cospi_p24_p40, &x[21], &x[26], _r, cos_bit);
+    btf_16_w32_avx512(cospi_m24_m40, cospi_m40_p24, &x[22], &x[25], _r, cos_bit);
+    btf_16_adds_subs_avx512(&x[32], &x[35]);
+    btf_16_adds_subs_avx512(&x[33], &x[34]);
+    btf_16_adds_subs_avx512(&x[39], &x[36]);
+    btf_16_adds_subs_avx512(&x[38], &x[37]);
+    btf_16_adds_subs_avx512(&x[40], &x[43]);
+    btf_16_adds_subs_avx512(&x[41], &x[42]);
+    btf_16_adds_subs_avx512(&x[47], &x[44]);
+    btf_16_adds_subs_avx512(&x[46], &x[45]);
+    btf_16_adds_subs_avx512(&x[48], &x[51]);
+    btf_16_adds_subs_avx512(&x[49], &x[50]);
+    btf_16_adds_subs_avx512(&x[55], &x[52]);
+    btf_16_adds_subs_avx512(&x[54], &x[53]);
+    btf_16_adds_subs_avx512(&x[56], &x[59]);
+    btf_16_adds_subs_avx512(&x[57], &x[58]);
+    btf_16_adds_subs_avx512(&x[63], &x[60]);
+    btf_16_adds_subs_avx512(&x[62], &x[61]);
+}
+
+static INLINE void idct64_stage6_high32_avx512(__m512i *x, const int32_t *cospi, const __m512i _r,
+                                               int8_t cos_bit) {
+    (void)cos_bit;
+    const __m512i cospi_m08_p56 = pair_set_w32_epi16(-cospi[8], cospi[56]);
+    const __m512i cospi_p56_p08 = pair_set_w32_epi16(cospi[56], cospi[8]);
+    const __m512i cospi_m56_m08 = pair_set_w32_epi16(-cospi[56], -cospi[8]);
+    const __m512i cospi_m40_p24 = pair_set_w32_epi16(-cospi[40], cospi[24]);
+    const __m512i cospi_p24_p40 = pair_set_w32_epi16(cospi[24], cospi[40]);
+    const __m512i cospi_m24_m40 = pair_set_w32_epi16(-cospi[24], -cospi[40]);
+    btf_16_w32_avx512(cospi_m08_p56, cospi_p56_p08, &x[34], &x[61], _r, cos_bit);
+    btf_16_w32_avx512(cospi_m08_p56, cospi_p56_p08, &x[35], &x[60], _r, cos_bit);
+    btf_16_w32_avx512(cospi_m56_m08, cospi_m08_p56, &x[36], &x[59], _r, cos_bit);
+    btf_16_w32_avx512(cospi_m56_m08, cospi_m08_p56, &x[37], &x[58], _r, cos_bit);
+    btf_16_w32_avx512(cospi_m40_p24, cospi_p24_p40, &x[42], &x[53], _r, cos_bit);
+    btf_16_w32_avx512(cospi_m40_p24, cospi_p24_p40, &x[43], &x[52], _r, cos_bit);
+    btf_16_w32_avx512(cospi_m24_m40, cospi_m40_p24, &x[44], &x[51], _r, cos_bit);
+    btf_16_w32_avx512(cospi_m24_m40, cospi_m40_p24, &x[45], &x[50], _r, cos_bit);
+}
+
+static INLINE void idct64_stage6_high48_avx512(__m512i *x, const int32_t *cospi, const __m512i _r,
+                                               int8_t cos_bit) {
+    btf_16_adds_subs_avx512(&x[16], &x[19]);
+    btf_16_adds_subs_avx512(&x[17], &x[18]);
+    btf_16_adds_subs_avx512(&x[23], &x[20]);
+    btf_16_adds_subs_avx512(&x[22], &x[21]);
+    btf_16_adds_subs_avx512(&x[24], &x[27]);
+    btf_16_adds_subs_avx512(&x[25], &x[26]);
+    btf_16_adds_subs_avx512(&x[31], &x[28]);
+    btf_16_adds_subs_avx512(&x[30], &x[29]);
+    idct64_stage6_high32_avx512(x, cospi, _r, cos_bit);
+}
+
+static INLINE void idct64_stage7_high48_avx512(__m512i *x, const int32_t *cospi, const __m512i _r,
+                                               int8_t cos_bit) {
+    (void)cos_bit;
+    const __m512i cospi_m16_p48 = pair_set_w32_epi16(-cospi[16], cospi[48]);
+    const __m512i cospi_p48_p16 = pair_set_w32_epi16(cospi[48], cospi[16]);
+    const __m512i cospi_m48_m16 = pair_set_w32_epi16(-cospi[48], -cospi[16]);
+    btf_16_w32_avx512(cospi_m16_p48, cospi_p48_p16, &x[18], &x[29], _r, cos_bit);
+    btf_16_w32_avx512(cospi_m16_p48, cospi_p48_p16, &x[19], &x[28], _r, cos_bit);
+    btf_16_w32_avx512(cospi_m48_m16, cospi_m16_p48, &x[20], &x[27], _r, cos_bit);
+    btf_16_w32_avx512(cospi_m48_m16, cospi_m16_p48, &x[21], &x[26], _r, cos_bit);
+    btf_16_adds_subs_avx512(&x[32], &x[39]);
+    btf_16_adds_subs_avx512(&x[33], &x[38]);
+    btf_16_adds_subs_avx512(&x[34], &x[37]);
+    btf_16_adds_subs_avx512(&x[35], &x[36]);
+    btf_16_adds_subs_avx512(&x[47], &x[40]);
+    btf_16_adds_subs_avx512(&x[46], &x[41]);
+    btf_16_adds_subs_avx512(&x[45], &x[42]);
+    btf_16_adds_subs_avx512(&x[44], &x[43]);
+    btf_16_adds_subs_avx512(&x[48], &x[55]);
+    btf_16_adds_subs_avx512(&x[49], &x[54]);
+    btf_16_adds_subs_avx512(&x[50], &x[53]);
+    btf_16_adds_subs_avx512(&x[51], &x[52]);
+    btf_16_adds_subs_avx512(&x[63], &x[56]);
+    btf_16_adds_subs_avx512(&x[62], &x[57]);
+    btf_16_adds_subs_avx512(&x[61], &x[58]);
+    btf_16_adds_subs_avx512(&x[60], &x[59]);
+}
+
+static INLINE void idct64_stage8_high48_avx512(__m512i *x, const int32_t *cospi, const __m512i _r,
+                                               int8_t cos_bit) {
+    (void)cos_bit;
+    const __m512i cospi_m16_p48 = pair_set_w32_epi16(-cospi[16], cospi[48]);
+    const __m512i cospi_p48_p16 = pair_set_w32_epi16(cospi[48], cospi[16]);
+    const __m512i cospi_m48_m16 = pair_set_w32_epi16(-cospi[48], -cospi[16]);
+    btf_16_adds_subs_avx512(&x[16], &x[23]);
+    btf_16_adds_subs_avx512(&x[17], &x[22]);
+    btf_16_adds_subs_avx512(&x[18], &x[21]);
+    btf_16_adds_subs_avx512(&x[19], &x[20]);
+    btf_16_adds_subs_avx512(&x[31], &x[24]);
+    btf_16_adds_subs_avx512(&x[30], &x[25]);
+    btf_16_adds_subs_avx512(&x[29], &x[26]);
+    btf_16_adds_subs_avx512(&x[28], &x[27]);
+    btf_16_w32_avx512(cospi_m16_p48, cospi_p48_p16, &x[36], &x[59], _r, cos_bit);
+    btf_16_w32_avx512(cospi_m16_p48, cospi_p48_p16, &x[37], &x[58], _r, cos_bit);
+    btf_16_w32_avx512(cospi_m16_p48, cospi_p48_p16, &x[38], &x[57], _r, cos_bit);
+    btf_16_w32_avx512(cospi_m16_p48, cospi_p48_p16, &x[39], &x[56], _r, cos_bit);
+    btf_16_w32_avx512(cospi_m48_m16, cospi_m16_p48, &x[40], &x[55], _r, cos_bit);
+    btf_16_w32_avx512(cospi_m48_m16, cospi_m16_p48, &x[41], &x[54], _r, cos_bit);
+    btf_16_w32_avx512(cospi_m48_m16, cospi_m16_p48, &x[42], &x[53], _r, cos_bit);
+    btf_16_w32_avx512(cospi_m48_m16, cospi_m16_p48, &x[43], &x[52], _r, cos_bit);
+}
+
+static INLINE void idct64_stage9_avx512(__m512i *x, const int32_t *cospi, const __m512i _r,
+                                        int8_t cos_bit) {
+    (void)cos_bit;
+    const __m512i cospi_m32_p32 = pair_set_w32_epi16(-cospi[32], cospi[32]);
+    const __m512i cospi_p32_p32 = pair_set_w32_epi16(cospi[32], cospi[32]);
+    btf_16_adds_subs_avx512(&x[0], &x[15]);
+    btf_16_adds_subs_avx512(&x[1], &x[14]);
+    btf_16_adds_subs_avx512(&x[2], &x[13]);
+    btf_16_adds_subs_avx512(&x[3], &x[12]);
+    btf_16_adds_subs_avx512(&x[4], &x[11]);
+    btf_16_adds_subs_avx512(&x[5], &x[10]);
+    btf_16_adds_subs_avx512(&x[6], &x[9]);
+    btf_16_adds_subs_avx512(&x[7], &x[8]);
+    btf_16_w32_avx512(cospi_m32_p32, cospi_p32_p32, &x[20], &x[27], _r, cos_bit);
+    btf_16_w32_avx512(cospi_m32_p32, cospi_p32_p32, &x[21], &x[26], _r, cos_bit);
+    btf_16_w32_avx512(cospi_m32_p32, cospi_p32_p32, &x[22], &x[25], _r, cos_bit);
+    btf_16_w32_avx512(cospi_m32_p32, cospi_p32_p32, &x[23], &x[24], _r, cos_bit);
+    btf_16_adds_subs_avx512(&x[32], &x[47]);
+    btf_16_adds_subs_avx512(&x[33], &x[46]);
+    btf_16_adds_subs_avx512(&x[34], &x[45]);
+    btf_16_adds_subs_avx512(&x[35], &x[44]);
+    btf_16_adds_subs_avx512(&x[36], &x[43]);
+    btf_16_adds_subs_avx512(&x[37], &x[42]);
+    btf_16_adds_subs_avx512(&x[38], &x[41]);
+    btf_16_adds_subs_avx512(&x[39], &x[40]);
+    btf_16_adds_subs_avx512(&x[63], &x[48]);
+    btf_16_adds_subs_avx512(&x[62], &x[49]);
+    btf_16_adds_subs_avx512(&x[61], &x[50]);
+    btf_16_adds_subs_avx512(&x[60], &x[51]);
+    btf_16_adds_subs_avx512(&x[59], &x[52]);
+    btf_16_adds_subs_avx512(&x[58], &x[53]);
+    btf_16_adds_subs_avx512(&x[57], &x[54]);
+    btf_16_adds_subs_avx512(&x[56], &x[55]);
+}
+
+static INLINE void idct64_stage10_avx512(__m512i *x, const int32_t *cospi, const __m512i _r,
+                                         int8_t cos_bit) {
+    (void)cos_bit;
+    const __m512i cospi_m32_p32 = pair_set_w32_epi16(-cospi[32], cospi[32]);
+    const __m512i cospi_p32_p32 = pair_set_w32_epi16(cospi[32], cospi[32]);
+    btf_16_adds_subs_avx512(&x[0], &x[31]);
+    btf_16_adds_subs_avx512(&x[1], &x[30]);
+    btf_16_adds_subs_avx512(&x[2], &x[29]);
+    btf_16_adds_subs_avx512(&x[3], &x[28]);
+    btf_16_adds_subs_avx512(&x[4], &x[27]);
+    btf_16_adds_subs_avx512(&x[5], &x[26]);
+    btf_16_adds_subs_avx512(&x[6], &x[25]);
+    btf_16_adds_subs_avx512(&x[7], &x[24]);
+    btf_16_adds_subs_avx512(&x[8], &x[23]);
+    btf_16_adds_subs_avx512(&x[9], &x[22]);
+    btf_16_adds_subs_avx512(&x[10], &x[21]);
+    btf_16_adds_subs_avx512(&x[11], &x[20]);
+    btf_16_adds_subs_avx512(&x[12], &x[19]);
+    btf_16_adds_subs_avx512(&x[13], &x[18]);
+    btf_16_adds_subs_avx512(&x[14], &x[17]);
+    btf_16_adds_subs_avx512(&x[15], &x[16]);
+    btf_16_w32_avx512(cospi_m32_p32, cospi_p32_p32, &x[40], &x[55], _r, cos_bit);
+    btf_16_w32_avx512(cospi_m32_p32, cospi_p32_p32, &x[41], &x[54], _r, cos_bit);
+    btf_16_w32_avx512(cospi_m32_p32, cospi_p32_p32, &x[42], &x[53], _r, cos_bit);
+    btf_16_w32_avx512(cospi_m32_p32, cospi_p32_p32, &x[43], &x[52], _r, cos_bit);
+    btf_16_w32_avx512(cospi_m32_p32, cospi_p32_p32, &x[44], &x[51], _r, cos_bit);
+    btf_16_w32_avx512(cospi_m32_p32, cospi_p32_p32, &x[45], &x[50], _r, cos_bit);
+    btf_16_w32_avx512(cospi_m32_p32, cospi_p32_p32, &x[46], &x[49], _r, cos_bit);
+    btf_16_w32_avx512(cospi_m32_p32, cospi_p32_p32, &x[47], &x[48], _r, cos_bit);
+}
+
+static INLINE void idct64_stage11_avx512(__m512i *output, __m512i *x) {
+    btf_16_adds_subs_out_avx512(&output[0], &output[63], x[0], x[63]);
+    btf_16_adds_subs_out_avx512(&output[1], &output[62], x[1], x[62]);
+    btf_16_adds_subs_out_avx512(&output[2], &output[61], x[2], x[61]);
+    btf_16_adds_subs_out_avx512(&output[3], &output[60], x[3], x[60]);
+    btf_16_adds_subs_out_avx512(&output[4], &output[59], x[4], x[59]);
+    btf_16_adds_subs_out_avx512(&output[5], &output[58], x[5], x[58]);
+    btf_16_adds_subs_out_avx512(&output[6], &output[57], x[6], x[57]);
+    btf_16_adds_subs_out_avx512(&output[7], &output[56], x[7], x[56]);
+    btf_16_adds_subs_out_avx512(&output[8], &output[55], x[8], x[55]);
+    btf_16_adds_subs_out_avx512(&output[9], &output[54], x[9], x[54]);
+    btf_16_adds_subs_out_avx512(&output[10], &output[53], x[10], x[53]);
+    btf_16_adds_subs_out_avx512(&output[11], &output[52], x[11], x[52]);
+    btf_16_adds_subs_out_avx512(&output[12], &output[51], x[12], x[51]);
+    btf_16_adds_subs_out_avx512(&output[13], &output[50], x[13], x[50]);
+    btf_16_adds_subs_out_avx512(&output[14], &output[49], x[14], x[49]);
+    btf_16_adds_subs_out_avx512(&output[15], &output[48], x[15], x[48]);
+    btf_16_adds_subs_out_avx512(&output[16], &output[47], x[16], x[47]);
+    btf_16_adds_subs_out_avx512(&output[17], &output[46], x[17], x[46]);
+    btf_16_adds_subs_out_avx512(&output[18], &output[45], x[18], x[45]);
+    btf_16_adds_subs_out_avx512(&output[19], &output[44], x[19], x[44]);
+    btf_16_adds_subs_out_avx512(&output[20], &output[43], x[20], x[43]);
+    btf_16_adds_subs_out_avx512(&output[21], &output[42], x[21], x[42]);
+    btf_16_adds_subs_out_avx512(&output[22], &output[41], x[22], x[41]);
+    btf_16_adds_subs_out_avx512(&output[23], &output[40], x[23], x[40]);
+    btf_16_adds_subs_out_avx512(&output[24], &output[39], x[24], x[39]);
+    btf_16_adds_subs_out_avx512(&output[25], &output[38], x[25], x[38]);
+    btf_16_adds_subs_out_avx512(&output[26], &output[37], x[26], x[37]);
+    btf_16_adds_subs_out_avx512(&output[27], &output[36], x[27], x[36]);
+    btf_16_adds_subs_out_avx512(&output[28], &output[35], x[28], x[35]);
+    btf_16_adds_subs_out_avx512(&output[29], &output[34], x[29], x[34]);
+    btf_16_adds_subs_out_avx512(&output[30], &output[33], x[30], x[33]);
+    btf_16_adds_subs_out_avx512(&output[31], &output[32], x[31], x[32]);
+}
+
+static void idct64_low1_new_avx512(const __m512i *input, __m512i *output, int8_t cos_bit) {
+    (void)cos_bit;
+    const int32_t *cospi = cospi_arr(INV_COS_BIT);
+
+    // stage 1
+    __m512i x[32];
+    x[0] = input[0];
+
+    // stage 2
+    // stage 3
+    // stage 4
+    // stage 5
+    // stage 6
+    btf_16_w32_0_avx512(cospi[32], cospi[32], x[0], x[0], x[1]);
+
+    // stage 7
+    // stage 8
+    // stage 9
+    // stage 10
+    // stage 11
+    output[0]  = x[0];
+    output[63] = x[0];
+    output[1]  = x[1];
+    output[62] = x[1];
+    output[2]  = x[1];
+    output[61] = x[1];
+    output[3]  = x[0];
+    output[60] = x[0];
+    output[4]  = x[0];
+    output[59] = x[0];
+    output[5]  = x[1];
+    output[58] = x[1];
+    output[6]  = x[1];
+    output[57] = x[1];
+    output[7]  = x[0];
+    output[56] = x[0];
+    output[8]  = x[0];
+    output[55] = x[0];
+    output[9]  = x[1];
+    output[54] = x[1];
+    output[10] = x[1];
+    output[53] = x[1];
+    output[11] = x[0];
+    output[52] = x[0];
+    output[12] = x[0];
+    output[51] = x[0];
+    output[13] = x[1];
+    output[50] = x[1];
+    output[14] = x[1];
+    output[49] = x[1];
+    output[15] = x[0];
+    output[48] = x[0];
+    output[16] = x[0];
+    output[47] = x[0];
+    output[17] = x[1];
+    output[46] = x[1];
+    output[18] = x[1];
+    output[45] = x[1];
+    output[19] = x[0];
+    output[44] = x[0];
+    output[20] = x[0];
+    output[43] = x[0];
+    output[21] = x[1];
+    output[42] = x[1];
+    output[22] = x[1];
+    output[41] = x[1];
+    output[23] = x[0];
+    output[40] = x[0];
+    output[24] = x[0];
+    output[39] = x[0];
+    output[25] = x[1];
+    output[38] = x[1];
+    output[26] = x[1];
+    output[37] = x[1];
+    output[27] = x[0];
+    output[36] = x[0];
+    output[28] = x[0];
+    output[35] = x[0];
+    output[29] = x[1];
+    output[34] = x[1];
+    output[30] = x[1];
+    output[33] = x[1];
+    output[31] = x[0];
+    output[32] = x[0];
+}
+
+static void idct64_low8_new_avx512(const __m512i *input, __m512i *output, int8_t cos_bit) {
+    (void)cos_bit;
+    const int32_t *cospi         = cospi_arr(INV_COS_BIT);
+    const __m512i  _r            = _mm512_set1_epi32(1 << (INV_COS_BIT - 1));
+    const __m512i  cospi_m04_p60 = pair_set_w32_epi16(-cospi[4], cospi[60]);
+    const __m512i  cospi_p60_p04 = pair_set_w32_epi16(cospi[60], cospi[4]);
+    const __m512i  cospi_m36_p28 = pair_set_w32_epi16(-cospi[36], cospi[28]);
+    const __m512i  cospi_m28_m36 = pair_set_w32_epi16(-cospi[28], -cospi[36]);
+    const __m512i  cospi_m20_p44 = pair_set_w32_epi16(-cospi[20], cospi[44]);
+    const __m512i  cospi_p44_p20 = pair_set_w32_epi16(cospi[44], cospi[20]);
+    const __m512i  cospi_m52_p12 = pair_set_w32_epi16(-cospi[52], cospi[12]);
+    const __m512i  cospi_m12_m52 = pair_set_w32_epi16(-cospi[12], -cospi[52]);
+    const __m512i  cospi_m08_p56 = pair_set_w32_epi16(-cospi[8], cospi[56]);
+    const __m512i  cospi_p56_p08 = pair_set_w32_epi16(cospi[56], cospi[8]);
+    const __m512i  cospi_m40_p24 = pair_set_w32_epi16(-cospi[40], cospi[24]);
+    const __m512i  cospi_m24_m40 = pair_set_w32_epi16(-cospi[24], -cospi[40]);
+    const __m512i  cospi_p32_p32 = pair_set_w32_epi16(cospi[32], cospi[32]);
+    const __m512i  cospi_m16_p48 = pair_set_w32_epi16(-cospi[16], cospi[48]);
+    const __m512i  cospi_p48_p16 = pair_set_w32_epi16(cospi[48], cospi[16]);
+    const __m512i  cospi_m32_p32 = pair_set_w32_epi16(-cospi[32], cospi[32]);
+
+    // stage 1
+    __m512i x[64];
+    x[0]  = input[0];
+    x[8]  = input[4];
+    x[16] = input[2];
+    x[24] = input[6];
+    x[32] = input[1];
+    x[40] = input[5];
+    x[48] = input[3];
+    x[56] = input[7];
+
+    // stage 2
+    btf_16_w32_0_avx512(cospi[63], cospi[1], x[32], x[32], x[63]);
+    btf_16_w32_0_avx512(-cospi[57], cospi[7], x[56], x[39], x[56]);
+    btf_16_w32_0_avx512(cospi[59], cospi[5], x[40], x[40], x[55]);
+    btf_16_w32_0_avx512(-cospi[61], cospi[3], x[48], x[47], x[48]);
+
+    // stage 3
+    btf_16_w32_0_avx512(cospi[62], cospi[2], x[16], x[16], x[31]);
+    btf_16_w32_0_avx512(-cospi[58], cospi[6], x[24], x[23], x[24]);
+    x[33] = x[32];
+    x[38] = x[39];
+    x[41] = x[40];
+    x[46] = x[47];
+    x[49] = x[48];
+    x[54] = x[55];
+    x[57] = x[56];
+    x[62] = x[63];
+
+    // stage 4
+    btf_16_w32_0_avx512(cospi[60], cospi[4], x[8], x[8], x[15]);
+    x[17] = x[16];
+    x[22] = x[23];
+    x[25] = x[24];
+    x[30] = x[31];
+    btf_16_w32_avx512(cospi_m04_p60, cospi_p60_p04, &x[33], &x[62], _r, cos_bit);
+    btf_16_w32_avx512(cospi_m28_m36, cospi_m36_p28, &x[38], &x[57], _r, cos_bit);
+    btf_16_w32_avx512(cospi_m20_p44, cospi_p44_p20, &x[41], &x[54], _r, cos_bit);
+    btf_16_w32_avx512(cospi_m12_m52, cospi_m52_p12, &x[46], &x[49], _r, cos_bit);
+
+    // stage 5
+    x[9]  = x[8];
+    x[14] = x[15];
+    btf_16_w32_avx512(cospi_m08_p56, cospi_p56_p08, &x[17], &x[30], _r, cos_bit);
+    btf_16_w32_avx512(cospi_m24_m40, cospi_m40_p24, &x[22], &x[25], _r, cos_bit);
+    x[35] = x[32];
+    x[34] = x[33];
+    x[36] = x[39];
+    x[37] = x[38];
+    x[43] = x[40];
+    x[42] = x[41];
+    x[44] = x[47];
+    x[45] = x[46];
+    x[51] = x[48];
+    x[50] = x[49];
+    x[52] = x[55];
+    x[53] = x[54];
+    x[59] = x[56];
+    x[58] = x[57];
+    x[60] = x[63];
+    x[61] = x[62];
+
+    // stage 6
+    btf_16_w32_0_avx512(cospi[32], cospi[32], x[0], x[0], x[1]);
+    btf_16_w32_avx512(cospi_m16_p48, cospi_p48_p16, &x[9], &x[14], _r, cos_bit);
+    x[19] = x[16];
+    x[18] = x[17];
+    x[20] = x[23];
+    x[21] = x[22];
+    x[27] = x[24];
+    x[26] = x[25];
+    x[28] = x[31];
+    x[29] = x[30];
+    idct64_stage6_high32_avx512(x, cospi, _r, cos_bit);
+
+    // stage 7
+    x[3]  = x[0];
+    x[2]  = x[1];
+    x[11] = x[8];
+    x[10] = x[9];
+    x[12] = x[15];
+    x[13] = x[14];
+    idct64_stage7_high48_avx512(x, cospi, _r, cos_bit);
+
+    // stage 8
+    x[7] = x[0];
+    x[6] = x[1];
+    x[5] = x[2];
+    x[4] = x[3];
+    btf_16_w32_avx512(cospi_m32_p32, cospi_p32_p32, &x[10], &x[13], _r, cos_bit);
+    btf_16_w32_avx512(cospi_m32_p32, cospi_p32_p32, &x[11], &x[12], _r, cos_bit);
+    idct64_stage8_high48_avx512(x, cospi, _r, cos_bit);
+
+    idct64_stage9_avx512(x, cospi, _r, cos_bit);
+    idct64_stage10_avx512(x, cospi, _r, cos_bit);
+    idct64_stage11_avx512(output, x);
+}
+
+static void idct64_low16_new_avx512(const __m512i *input, __m512i *output, int8_t cos_bit) {
+    (void)cos_bit;
+    const int32_t *cospi = cospi_arr(INV_COS_BIT);
+    const __m512i  _r    = _mm512_set1_epi32(1 << (INV_COS_BIT - 1));
+
+    const __m512i cospi_p32_p32 = pair_set_w32_epi16(cospi[32], cospi[32]);
+    const __m512i cospi_m16_p48 = pair_set_w32_epi16(-cospi[16], cospi[48]);
+    const __m512i cospi_p48_p16 = pair_set_w32_epi16(cospi[48], cospi[16]);
+    const __m512i cospi_m48_m16 = pair_set_w32_epi16(-cospi[48], -cospi[16]);
+    const __m512i cospi_m32_p32 = pair_set_w32_epi16(-cospi[32], cospi[32]);
+
+    // stage 1
+    __m512i x[64];
+    x[0]  = input[0];
+    x[4]  = input[8];
+    x[8]  = input[4];
+    x[12] = input[12];
+    x[16] = input[2];
+    x[20] = input[10];
+    x[24] = input[6];
+    x[28] = input[14];
+    x[32] = input[1];
+    x[36] = input[9];
+    x[40] = input[5];
+    x[44] = input[13];
+    x[48] = input[3];
+    x[52] = input[11];
+    x[56] = input[7];
+    x[60] = input[15];
+
+    // stage 2
+    btf_16_w32_0_avx512(cospi[63], cospi[1], x[32], x[32], x[63]);
+    btf_16_w32_0_avx512(-cospi[49], cospi[15], x[60], x[35], x[60]);
+    btf_16_w32_0_avx512(cospi[55], cospi[9], x[36], x[36], x[59]);
+    btf_16_w32_0_avx512(-cospi[57], cospi[7], x[56], x[39], x[56]);
+    btf_16_w32_0_avx512(cospi[59], cospi[5], x[40], x[40], x[55]);
+    btf_16_w32_0_avx512(-cospi[53], cospi[11], x[52], x[43], x[52]);
+    btf_16_w32_0_avx512(cospi[51], cospi[13], x[44], x[44], x[51]);
+    btf_16_w32_0_avx512(-cospi[61], cospi[3], x[48], x[47], x[48]);
+
+    // stage 3
+    btf_16_w32_0_avx512(cospi[62], cospi[2], x[16], x[16], x[31]);
+    btf_16_w32_0_avx512(-cospi[50], cospi[14], x[28], x[19], x[28]);
+    btf_16_w32_0_avx512(cospi[54], cospi[10], x[20], x[20], x[27]);
+    btf_16_w32_0_avx512(-cospi[58], cospi[6], x[24], x[23], x[24]);
+    x[33] = x[32];
+    x[34] = x[35];
+    x[37] = x[36];
+    x[38] = x[39];
+    x[41] = x[40];
+    x[42] = x[43];
+    x[45] = x[44];
+    x[46] = x[47];
+    x[49] = x[48];
+    x[50] = x[51];
+    x[53] = x[52];
+    x[54] = x[55];
+    x[57] = x[56];
+    x[58] = x[59];
+    x[61] = x[60];
+    x[62] = x[63];
+
+    // stage 4
+    btf_16_w32_0_avx512(cospi[60], cospi[4], x[8], x[8], x[15]);
+    btf_16_w32_0_avx512(-cospi[52], cospi[12], x[12], x[11], x[12]);
+    x[17] = x[16];
+    x[18] = x[19];
+    x[21] = x[20];
+    x[22] = x[23];
+    x[25] = x[24];
+    x[26] = x[27];
+    x[29] = x[28];
+    x[30] = x[31];
+    idct64_stage4_high32_avx512(x, cospi, _r, cos_bit);
+
+    // stage 5
+    btf_16_w32_0_avx512(cospi[56], cospi[8], x[4], x[4], x[7]);
+    x[9]  = x[8];
+    x[10] = x[11];
+    x[13] = x[12];
+    x[14] = x[15];
+    idct64_stage5_high48_avx512(x, cospi, _r, cos_bit);
+
+    // stage 6
+    btf_16_w32_0_avx512(cospi[32], cospi[32], x[0], x[0], x[1]);
+    x[5] = x[4];
+    x[6] = x[7];
+    btf_16_w32_avx512(cospi_m16_p48, cospi_p48_p16, &x[9], &x[14], _r, cos_bit);
+    btf_16_w32_avx512(cospi_m48_m16, cospi_m16_p48, &x[10], &x[13], _r, cos_bit);
+    idct64_stage6_high48_avx512(x, cospi, _r, cos_bit);
+
+    // stage 7
+    x[3] = x[0];
+    x[2] = x[1];
+    btf_16_w32_avx512(cospi_m32_p32, cospi_p32_p32, &x[5], &x[6], _r, cos_bit);
+    btf_16_adds_subs_avx512(&x[8], &x[11]);
+    btf_16_adds_subs_avx512(&x[9], &x[10]);
+    btf_16_adds_subs_avx512(&x[15], &x[12]);
+    btf_16_adds_subs_avx512(&x[14], &x[13]);
+    idct64_stage7_high48_avx512(x, cospi, _r, cos_bit);
+
+    // stage 8
+    btf_16_adds_subs_avx512(&x[0], &x[7]);
+    btf_16_adds_subs_avx512(&x[1], &x[6]);
+    btf_16_adds_subs_avx512(&x[2], &x[5]);
+    btf_16_adds_subs_avx512(&x[3], &x[4]);
+    btf_16_w32_avx512(cospi_m32_p32, cospi_p32_p32, &x[10], &x[13], _r, cos_bit);
+    btf_16_w32_avx512(cospi_m32_p32, cospi_p32_p32, &x[11], &x[12], _r, cos_bit);
+    idct64_stage8_high48_avx512(x, cospi, _r, cos_bit);
+
+    idct64_stage9_avx512(x, cospi, _r, cos_bit);
+    idct64_stage10_avx512(x, cospi, _r, cos_bit);
+    idct64_stage11_avx512(output, x);
+}
+
+static void idct64_low32_new_avx512(const __m512i *input, __m512i *output, int8_t cos_bit) {
+    (void)cos_bit;
+    const int32_t *cospi = cospi_arr(INV_COS_BIT);
+    const __m512i  _r    = _mm512_set1_epi32(1 << (INV_COS_BIT - 1));
+
+    const __m512i cospi_p32_p32 = pair_set_w32_epi16(cospi[32], cospi[32]);
+    const __m512i cospi_m16_p48 = pair_set_w32_epi16(-cospi[16], cospi[48]);
+    const __m512i cospi_p48_p16 = pair_set_w32_epi16(cospi[48], cospi[16]);
+    const __m512i cospi_m48_m16 = pair_set_w32_epi16(-cospi[48], -cospi[16]);
+    const __m512i cospi_m32_p32 = pair_set_w32_epi16(-cospi[32], cospi[32]);
+
+    // stage 1
+    __m512i x[64];
+    x[0]  = input[0];
+    x[2]  = input[16];
+    x[4]  = input[8];
+    x[6]  = input[24];
+    x[8]  = input[4];
+    x[10] = input[20];
+    x[12] = input[12];
+    x[14] = input[28];
+    x[16] = input[2];
+    x[18] = input[18];
+    x[20] = input[10];
+    x[22] = input[26];
+    x[24] = input[6];
+    x[26] = input[22];
+    x[28] = input[14];
+    x[30] = input[30];
+    x[32] = input[1];
+    x[34] = input[17];
+    x[36] = input[9];
+    x[38] = input[25];
+    x[40] = input[5];
+    x[42] = input[21];
+    x[44] = input[13];
+    x[46] = input[29];
+    x[48] = input[3];
+    x[50] = input[19];
+    x[52] = input[11];
+    x[54] = input[27];
+    x[56] = input[7];
+    x[58] = input[23];
+    x[60] = input[15];
+    x[62] = input[31];
+
+    // stage 2
+    btf_16_w32_0_avx512(cospi[63], cospi[1], x[32], x[32], x[63]);
+    btf_16_w32_0_avx512(-cospi[33], cospi[31], x[62], x[33], x[62]);
+    btf_16_w32_0_avx512(cospi[47], cospi[17], x[34], x[34], x[61]);
+    btf_16_w32_0_avx512(-cospi[49], cospi[15], x[60], x[35], x[60]);
+    btf_16_w32_0_avx512(cospi[55], cospi[9], x[36], x[36], x[59]);
+    btf_16_w32_0_avx512(-cospi[41], cospi[23], x[58], x[37], x[58]);
+    btf_16_w32_0_avx512(cospi[39], cospi[25], x[38], x[38], x[57]);
+    btf_16_w32_0_avx512(-cospi[57], cospi[7], x[56], x[39], x[56]);
+    btf_16_w32_0_avx512(cospi[59], cospi[5], x[40], x[40], x[55]);
+    btf_16_w32_0_avx512(-cospi[37], cospi[27], x[54], x[41], x[54]);
+    btf_16_w32_0_avx512(cospi[43], cospi[21], x[42], x[42], x[53]);
+    btf_16_w32_0_avx512(-cospi[53], cospi[11], x[52], x[43], x[52]);
+    btf_16_w32_0_avx512(cospi[51], cospi[13], x[44], x[44], x[51]);
+    btf_16_w32_0_avx512(-cospi[45], cospi[19], x[50], x[45], x[50]);
+    btf_16_w32_0_avx512(cospi[35], cospi[29], x[46], x[46], x[49]);
+    btf_16_w32_0_avx512(-cospi[61], cospi[3], x[48], x[47], x[48]);
+
+    // stage 3
+    btf_16_w32_0_avx512(cospi[62], cospi[2], x[16], x[16], x[31]);
+    btf_16_w32_0_avx512(-cospi[34], cospi[30], x[30], x[17], x[30]);
+    btf_16_w32_0_avx512(cospi[46], cospi[18], x[18], x[18], x[29]);
+    btf_16_w32_0_avx512(-cospi[50], cospi[14], x[28], x[19], x[28]);
+    btf_16_w32_0_avx512(cospi[54], cospi[10], x[20], x[20], x[27]);
+    btf_16_w32_0_avx512(-cospi[42], cospi[22], x[26], x[21], x[26]);
+    btf_16_w32_0_avx512(cospi[38], cospi[26], x[22], x[22], x[25]);
+    btf_16_w32_0_avx512(-cospi[58], cospi[6], x[24], x[23], x[24]);
+    btf_16_adds_subs_avx512(&x[32], &x[33]);
+    btf_16_adds_subs_avx512(&x[35], &x[34]);
+    btf_16_adds_subs_avx512(&x[36], &x[37]);
+    btf_16_adds_subs_avx512(&x[39], &x[38]);
+    btf_16_adds_subs_avx512(&x[40], &x[41]);
+    btf_16_adds_subs_avx512(&x[43], &x[42]);
+    btf_16_adds_subs_avx512(&x[44], &x[45]);
+    btf_16_adds_subs_avx512(&x[47], &x[46]);
+    btf_16_adds_subs_avx512(&x[48], &x[49]);
+    btf_16_adds_subs_avx512(&x[51], &x[50]);
+    btf_16_adds_subs_avx512(&x[52], &x[53]);
+    btf_16_adds_subs_avx512(&x[55], &x[54]);
+    btf_16_adds_subs_avx512(&x[56], &x[57]);
+    btf_16_adds_subs_avx512(&x[59], &x[58]);
+    btf_16_adds_subs_avx512(&x[60], &x[61]);
+    btf_16_adds_subs_avx512(&x[63], &x[62]);
+
+    // stage 4
+    btf_16_w32_0_avx512(cospi[60], cospi[4], x[8], x[8], x[15]);
+    btf_16_w32_0_avx512(-cospi[36], cospi[28], x[14], x[9], x[14]);
+    btf_16_w32_0_avx512(cospi[44], cospi[20], x[10], x[10], x[13]);
+    btf_16_w32_0_avx512(-cospi[52], cospi[12], x[12], x[11], x[12]);
+    btf_16_adds_subs_avx512(&x[16], &x[17]);
+    btf_16_adds_subs_avx512(&x[19], &x[18]);
+    btf_16_adds_subs_avx512(&x[20], &x[21]);
+    btf_16_adds_subs_avx512(&x[23], &x[22]);
+    btf_16_adds_subs_avx512(&x[24], &x[25]);
+    btf_16_adds_subs_avx512(&x[27], &x[26]);
+    btf_16_adds_subs_avx512(&x[28], &x[29]);
+    btf_16_adds_subs_avx512(&x[31], &x[30]);
+    idct64_stage4_high32_avx512(x, cospi, _r, cos_bit);
+
+    // stage 5
+    btf_16_w32_0_avx512(cospi[56], cospi[8], x[4], x[4], x[7]);
+    btf_16_w32_0_avx512(-cospi[40], cospi[24], x[6], x[5], x[6]);
+    btf_16_adds_subs_avx512(&x[8], &x[9]);
+    btf_16_adds_subs_avx512(&x[11], &x[10]);
+    btf_16_adds_subs_avx512(&x[12], &x[13]);
+    btf_16_adds_subs_avx512(&x[15], &x[14]);
+    idct64_stage5_high48_avx512(x, cospi, _r, cos_bit);
+
+    // stage 6
+    btf_16_w32_0_avx512(cospi[32], cospi[32], x[0], x[0], x[1]);
+    btf_16_w32_0_avx512(cospi[48], cospi[16], x[2], x[2], x[3]);
+    btf_16_adds_subs_avx512(&x[4], &x[5]);
+    btf_16_adds_subs_avx512(&x[7], &x[6]);
+    btf_16_w32_avx512(cospi_m16_p48, cospi_p48_p16, &x[9], &x[14], _r, cos_bit);
+    btf_16_w32_avx512(cospi_m48_m16, cospi_m16_p48, &x[10], &x[13], _r, cos_bit);
+    idct64_stage6_high48_avx512(x, cospi, _r, cos_bit);
+
+    // stage 7
+    btf_16_adds_subs_avx512(&x[0], &x[3]);
+    btf_16_adds_subs_avx512(&x[1], &x[2]);
+    btf_16_w32_avx512(cospi_m32_p32, cospi_p32_p32, &x[5], &x[6], _r, cos_bit);
+    btf_16_adds_subs_avx512(&x[8], &x[11]);
+    btf_16_adds_subs_avx512(&x[9], &x[10]);
+    btf_16_adds_subs_avx512(&x[15], &x[12]);
+    btf_16_adds_subs_avx512(&x[14], &x[13]);
+    idct64_stage7_high48_avx512(x, cospi, _r, cos_bit);
+
+    // stage 8
+    btf_16_adds_subs_avx512(&x[0], &x[7]);
+    btf_16_adds_subs_avx512(&x[1], &x[6]);
+    btf_16_adds_subs_avx512(&x[2], &x[5]);
+    btf_16_adds_subs_avx512(&x[3], &x[4]);
+    btf_16_w32_avx512(cospi_m32_p32, cospi_p32_p32, &x[10], &x[13], _r, cos_bit);
+    btf_16_w32_avx512(cospi_m32_p32, cospi_p32_p32, &x[11], &x[12], _r, cos_bit);
+    idct64_stage8_high48_avx512(x, cospi, _r, cos_bit);
+
+    // stage 9~11
+    idct64_stage9_avx512(x, cospi, _r, cos_bit);
+    idct64_stage10_avx512(x, cospi, _r, cos_bit);
+    idct64_stage11_avx512(output, x);
+}
+
+typedef void (*Transform1dAvx512)(const __m512i *input, __m512i *output, int8_t cos_bit);
+
+// Only DCT is needed: the sizes handled here allow no other 1D type besides identity.
+static const Transform1dAvx512 lowbd_txfm_all_1d_zeros_w32_arr[TX_SIZES][4] = {
+    {NULL, NULL, NULL, NULL},
+    {NULL, NULL, NULL, NULL},
+    {NULL, NULL, NULL, NULL},
+    {idct32_low1_new_avx512, idct32_low8_new_avx512, idct32_low16_new_avx512, idct32_new_avx512},
+    {idct64_low1_new_avx512,
+     idct64_low8_new_avx512,
+     idct64_low16_new_avx512,
+     idct64_low32_new_avx512}};
+
+static INLINE void write_recon_w32_avx512(__m512i res, const uint8_t *output_r, uint8_t *output_w) {
+    const __m256i pred = _mm256_loadu_si256((const __m256i *)output_r);
+    __m512i       u    = _mm512_adds_epi16(_mm512_cvtepu8_epi16(pred), res);
+    u                  = _mm512_max_epi16(u, _mm512_setzero_si512());
+    _mm256_storeu_si256((__m256i *)output_w, _mm512_cvtusepi16_epi8(u));
+}
+
+// DCT_DCT only, w >= 32 and h >= 32
+static void lowbd_inv_txfm2d_add_dct_dct_avx512(const int32_t *input, uint8_t *output_r,
+                                                int32_t stride_r, uint8_t *output_w,
+                                                int32_t stride_w, TxSize tx_size, int32_t eob) {
+    __m512i buf1[64 * 2];
+    int     eobx, eoby;
+    get_eobx_eoby_scan_default(&eobx, &eoby, tx_size, eob);
+    const int8_t *shift                    = eb_inv_txfm_shift_ls[tx_size];
+    const int     txw_idx                  = get_txw_idx(tx_size);
+    const int     txh_idx                  = get_txh_idx(tx_size);
+    const int     cos_bit_col              = inv_cos_bit_col[txw_idx][txh_idx];
+    const int     cos_bit_row              = inv_cos_bit_row[txw_idx][txh_idx];
+    const int     txfm_size_col            = tx_size_wide[tx_size];
+    const int     txfm_size_row            = tx_size_high[tx_size];
+    const int     buf_size_w_div32         = txfm_size_col >> 5;
+    const int     buf_size_nonzero_w_div16 = (eobx + 16) >> 4;
+    const int     buf_size_nonzero_h_div16 = (eoby + 16) >> 4;
+    const int     input_stride             = AOMMIN(32, txfm_size_col);
+    const int     rect_type                = get_rect_tx_log_ratio(txfm_size_col, txfm_size_row);
+
+    const Transform1dAvx512 row_txfm =
+        lowbd_txfm_all_1d_zeros_w32_arr[txw_idx][lowbd_txfm_all_1d_zeros_idx[eobx]];
+    const Transform1dAvx512 col_txfm =
+        lowbd_txfm_all_1d_zeros_w32_arr[txh_idx][lowbd_txfm_all_1d_zeros_idx[eoby]];
+
+    assert(col_txfm != NULL);
+    assert(row_txfm != NULL);
+    const __m512i scale0 = _mm512_set1_epi16(1 << (15 + shift[0]));
+    const __m512i rect   = _mm512_set1_epi16(new_inv_sqrt2 * 8);
+    for (int i = 0; i < buf_size_nonzero_h_div16; i += 2) {
+        // 32 rows per pass, the second 16 are zero when past eoby
+        const int      rows_div16 = AOMMIN(2, buf_size_nonzero_h_div16 - i);
+        const int32_t *input_row  = input + (i << 4) * input_stride;
+        __m512i        buf0[64];
+        for (int j = 0; j < buf_size_nonzero_w_div16; ++j) {
+            __m256i lo[16], hi[16];
+            load_buffer_32bit_to_16bit_w16_avx2(input_row + j * 16, input_stride, lo, 16);
+            transpose_16bit_16x16_avx2(lo, lo);
+            if (rows_div16 == 2) {
+                load_buffer_32bit_to_16bit_w16_avx2(
+                    input_row + 16 * input_stride + j * 16, input_stride, hi, 16);
+                transpose_16bit_16x16_avx2(hi, hi);
+            } else {
+                for (int k = 0; k < 16; ++k) hi[k] = _mm256_setzero_si256();
+            }
+            for (int k = 0; k < 16; ++k)
+                buf0[j * 16 + k] = _mm512_inserti64x4(_mm512_castsi256_si512(lo[k]), hi[k], 1);
+        }
+        if (rect_type == 1 || rect_type == -1) {
+            for (int j = 0; j < buf_size_nonzero_w_div16 * 16; ++j)
+                buf0[j] = _mm512_mulhrs_epi16(buf0[j], rect);
+        }
+        row_txfm(buf0, buf0, cos_bit_row);
+        for (int j = 0; j < txfm_size_col; ++j) buf0[j] = _mm512_mulhrs_epi16(buf0[j], scale0);
+
+        // transpose back in 16x16 quarters, buf1 holds 32 columns of a row per register
+        for (int r = 0; r < rows_div16; ++r) {
+            for (int j = 0; j < (txfm_size_col >> 4); ++j) {
+                __m256i t[16];
+                for (int k = 0; k < 16; ++k)
+                    t[k] = r ? _mm512_extracti64x4_epi64(buf0[j * 16 + k], 1)
+                             : _mm512_castsi512_si256(buf0[j * 16 + k]);
+                transpose_16bit_16x16_avx2(t, t);
+                __m512i *buf1_cur = buf1 + (j >> 1) * txfm_size_row + ((i + r) << 4);
+                for (int k = 0; k < 16; ++k)
+                    buf1_cur[k] = (j & 1) ? _mm512_inserti64x4(buf1_cur[k], t[k], 1)
+                                          : _mm512_castsi256_si512(t[k]);
+            }
+        }
+    }
+    const __m512i scale1 = _mm512_set1_epi16(1 << (15 + shift[1]));
+    for (int i = 0; i < buf_size_w_div32; i++) {
+        __m512i *buf1_cur = buf1 + i * txfm_size_row;
+        col_txfm(buf1_cur, buf1_cur, cos_bit_col);
+        for (int j = 0; j < txfm_size_row; ++j)
+            buf1_cur[j] = _mm512_mulhrs_epi16(buf1_cur[j], scale1);
+    }
+    for (int i = 0; i < buf_size_w_div32; i++) {
+        for (int j = 0; j < txfm_size_row; ++j)
+            write_recon_w32_avx512(buf1[i * txfm_size_row + j],
+                                   output_r + j * stride_r + 32 * i,
+                                   output_w + j * stride_w + 32 * i);
+    }
+}
+
+void eb_av1_lowbd_inv_txfm2d_add_avx512(const int32_t *input, uint8_t *output_r, int32_t stride_r,
+                                        uint8_t *output_w, int32_t stride_w, TxType tx_type,
+                                        TxSize tx_size, int32_t eob) {
+    // 16 wide or high sizes would leave half of each register idle, AVX2 is faster there
+    switch (tx_size) {
+    case TX_32X32:
+    case TX_64X64:
+    case TX_32X64:
+    case TX_64X32:
+        if (tx_type == DCT_DCT) {
+            lowbd_inv_txfm2d_add_dct_dct_avx512(
+                input, output_r, stride_r, output_w, stride_w, tx_size, eob);
+            break;
+        }
+        // fall through
+    default:
+        eb_av1_lowbd_inv_txfm2d_add_avx2(
+            input, output_r, stride_r, output_w, stride_w, tx_type, tx_size, eob);
+        break;
+    }
+}
+
+void eb_av1_inv_txfm_add_avx512(const TranLow *dqcoeff, uint8_t *dst_r, int32_t stride_r,
+                                uint8_t *dst_w, int32_t stride_w, const TxfmParam *txfm_param) {
+    const TxType tx_type = txfm_param->tx_type;
+    if (!txfm_param->lossless)
+        eb_av1_lowbd_inv_txfm2d_add_avx512(dqcoeff,
+                                           dst_r,
+                                           stride_r,
+                                           dst_w,
+                                           stride_w,
+                                           tx_type,
+                                           txfm_param->tx_size,
+                                           txfm_param->eob);
+    else
+        eb_av1_inv_txfm_add_c(dqcoeff, dst_r, stride_r, dst_w, stride_w, txfm_param);
+}
+#endif // !NON_AVX512_SUPPORT
@@ -0,0 +1,144 @@
+/*
+* Copyright(c) 2019 Intel Corporation
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+#include "EbDefinitions.h"
+
+#ifndef NON_AVX512_SUPPORT
+#include <immintrin.h>
+
+#include "common_dsp_rtcd.h"
+#include "EbInterPrediction.h"
+#include "EbSuperRes.h"
+
+#define RS_ROUND_BITS 7
+
+// Filters of 16 consecutive outputs; f[k] holds outputs k, k + 4, k + 8 and
+// k + 12 in its four 128-bit lanes.
+static INLINE void rs_filters_avx512(const int16_t *x_filters, int x_qn, int x_step_qn,
+                                     __m512i f[4]) {
+    for (int k = 0; k < 4; ++k) {
+        __m512i v = _mm512_setzero_si512();
+        for (int l = 0; l < 4; ++l) {
+            const int     q = x_qn + (k + 4 * l) * x_step_qn;
+            const __m128i t = _mm_loadu_si128(
+                (const __m128i *)(x_filters + ((q & RS_SCALE_SUBPEL_MASK) >> RS_SCALE_EXTRA_BITS) *
+                                                  UPSCALE_NORMATIVE_TAPS));
+            switch (l) {
+            case 0: v = _mm512_inserti32x4(v, t, 0); break;
+            case 1: v = _mm512_inserti32x4(v, t, 1); break;
+            case 2: v = _mm512_inserti32x4(v, t, 2); break;
+            default: v = _mm512_inserti32x4(v, t, 3); break;
+            }
+        }
+        f[k] = v;
+    }
+}
+
+static INLINE __m512i rs_reduce_avx512(const __m512i s[4]) {
+    const __m512i t0 = _mm512_add_epi32(_mm512_unpacklo_epi32(s[0], s[1]),
+                                        _mm512_unpackhi_epi32(s[0], s[1]));
+    const __m512i t1 = _mm512_add_epi32(_mm512_unpacklo_epi32(s[2], s[3]),
+                                        _mm512_unpackhi_epi32(s[2], s[3]));
+    const __m512i r = _mm512_add_epi32(_mm512_unpacklo_epi64(t0, t1),
+                                       _mm512_unpackhi_epi64(t0, t1));
+    return _mm512_srai_epi32(_mm512_add_epi32(r, _mm512_set1_epi32(1 << (RS_ROUND_BITS - 1))),
+                             RS_ROUND_BITS);
+}
+
+// Loads the windows of outputs pos[0] and pos[4]
+static INLINE __m128i rs_load_pair(const uint8_t *s, const int *pos) {
+    return _mm_unpacklo_epi64(_mm_loadl_epi64((const __m128i *)(s + pos[0])),
+                              _mm_loadl_epi64((const __m128i *)(s + pos[4])));
+}
+
+void eb_av1_convolve_horiz_rs_avx512(const uint8_t *src, int src_stride, uint8_t *dst,
+                                     int dst_stride, int w, int h, const int16_t *x_filters,
+                                     int x0_qn, int x_step_qn) {
+    const int w16 = w & ~15;
+    const uint8_t *const src_start = src - (UPSCALE_NORMATIVE_TAPS / 2 - 1);
+
+    for (int x = 0; x < w16; x += 16) {
+        const int x_qn = x0_qn + x * x_step_qn;
+        __m512i   f[4];
+        int       pos[16];
+
+        rs_filters_avx512(x_filters, x_qn, x_step_qn, f);
+        for (int k = 0; k < 16; ++k) pos[k] = (x_qn + k * x_step_qn) >> RS_SCALE_SUBPEL_BITS;
+
+        const uint8_t *s_row = src_start;
+        uint8_t *      d_row = dst + x;
+        for (int y = 0; y < h; ++y) {
+            __m512i s[4];
+            for (int k = 0; k < 4; ++k) {
+                const __m256i p = _mm256_inserti128_si256(
+                    _mm256_castsi128_si256(rs_load_pair(s_row, pos + k)),
+                    rs_load_pair(s_row, pos + k + 8),
+                    1);
+                s[k] = _mm512_madd_epi16(_mm512_cvtepu8_epi16(p), f[k]);
+            }
+            const __m512i r = _mm512_max_epi32(rs_reduce_avx512(s), _mm512_setzero_si512());
+            _mm_storeu_si128((__m128i *)d_row, _mm512_cvtusepi32_epi8(r));
+            s_row += src_stride;
+            d_row += dst_stride;
+        }
+    }
+
+    if (w16 < w)
+        eb_av1_convolve_horiz_rs_avx2(
+            src, src_stride, dst + w16, dst_stride, w - w16, h, x_filters,
+            x0_qn + w16 * x_step_qn, x_step_qn);
+}
+
+void eb_av1_highbd_convolve_horiz_rs_avx512(const uint16_t *src, int src_stride, uint16_t *dst,
+                                            int dst_stride, int w, int h,
+                                            const int16_t *x_filters, int x0_qn, int x_step_qn,
+                                            int bd) {
+    const int       w16       = w & ~15;
+    const uint16_t *src_start = src - (UPSCALE_NORMATIVE_TAPS / 2 - 1);
+    const __m512i   max       = _mm512_set1_epi32((1 << bd) - 1);
+
+    for (int x = 0; x < w16; x += 16) {
+        const int x_qn = x0_qn + x * x_step_qn;
+        __m512i   f[4];
+        int       pos[16];
+
+        rs_filters_avx512(x_filters, x_qn, x_step_qn, f);
+        for (int k = 0; k < 16; ++k) pos[k] = (x_qn + k * x_step_qn) >> RS_SCALE_SUBPEL_BITS;
+
+        const uint16_t *s_row = src_start;
+        uint16_t *      d_row = dst + x;
+        for (int y = 0; y < h; ++y) {
+            __m512i s[4];
+            for (int k = 0; k < 4; ++k) {
+                __m512i p = _mm512_castsi128_si512(
+                    _mm_loadu_si128((const __m128i *)(s_row + pos[k])));
+                p = _mm512_inserti32x4(p, _mm_loadu_si128((const __m128i *)(s_row + pos[k + 4])), 1);
+                p = _mm512_inserti32x4(p, _mm_loadu_si128((const __m128i *)(s_row + pos[k + 8])), 2);
+                p = _mm512_inserti32x4(
+                    p, _mm_loadu_si128((const __m128i *)(s_row + pos[k + 12])), 3);
+                s[k] = _mm512_madd_epi16(p, f[k]);
+            }
+            __m512i r = rs_reduce_avx512(s);
+            r         = _mm512_min_epi32(_mm512_max_epi32(r, _mm512_setzero_si512()), max);
+            _mm256_storeu_si256((__m256i *)d_row, _mm512_cvtepi32_epi16(r));
+            s_row += src_stride;
+            d_row += dst_stride;
+        }
+    }
+
+    if (w16 < w)
+        eb_av1_highbd_convolve_horiz_rs_avx2(src,
+                                             src_stride,
+                                             dst + w16,
+                                             dst_stride,
+                                             w - w16,
+                                             h,
+                                             x_filters,
+                                             x0_qn + w16 * x_step_qn,
+                                             x_step_qn,
+                                             bd);
+}
+
+#endif // !NON_AVX512_SUPPORT
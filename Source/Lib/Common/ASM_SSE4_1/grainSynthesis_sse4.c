@@ -0,0 +1,292 @@
+/*
+* Copyright(c) 2019 Intel Corporation
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+#include <smmintrin.h>
+
+#include "EbDefinitions.h"
+#include "common_dsp_rtcd.h"
+
+/* Film grain blending, 4 samples per iteration. Without gathers the scaling
+ * function is looked up one sample at a time, the remaining columns of a block
+ * are left to the C code. */
+
+static INLINE __m128i lookup_4(const int32_t *scaling_lut, __m128i index) {
+    return _mm_setr_epi32(scaling_lut[_mm_extract_epi32(index, 0)],
+                          scaling_lut[_mm_extract_epi32(index, 1)],
+                          scaling_lut[_mm_extract_epi32(index, 2)],
+                          scaling_lut[_mm_extract_epi32(index, 3)]);
+}
+
+// scale_lut() of grainSynthesis.c for 4 samples
+static INLINE __m128i scale_lut_sse4_1(const int32_t *scaling_lut, __m128i index,
+                                       int32_t bit_depth) {
+    if (bit_depth == 8) return lookup_4(scaling_lut, index);
+
+    const __m128i shift = _mm_cvtsi32_si128(bit_depth - 8);
+    const __m128i x     = _mm_srl_epi32(index, shift);
+    // scaling_lut[256] is not read, the interpolation is then 0 anyway
+    const __m128i x1 =
+        _mm_min_epi32(_mm_add_epi32(x, _mm_set1_epi32(1)), _mm_set1_epi32(255));
+    const __m128i lut0 = lookup_4(scaling_lut, x);
+    const __m128i lut1 = lookup_4(scaling_lut, x1);
+    const __m128i frac = _mm_and_si128(index, _mm_set1_epi32((1 << (bit_depth - 8)) - 1));
+    __m128i       delta = _mm_mullo_epi32(_mm_sub_epi32(lut1, lut0), frac);
+    delta               = _mm_add_epi32(delta, _mm_set1_epi32(1 << (bit_depth - 9)));
+    return _mm_add_epi32(lut0, _mm_sra_epi32(delta, shift));
+}
+
+// clamp(pixel + ((scale * grain + rounding_offset) >> scaling_shift), min, max)
+static INLINE __m128i add_noise_sse4_1(__m128i pixel, __m128i scale, const int32_t *grain,
+                                       __m128i rounding_offset, __m128i scaling_shift,
+                                       __m128i min_val, __m128i max_val) {
+    __m128i noise = _mm_mullo_epi32(scale, _mm_loadu_si128((const __m128i *)grain));
+    noise         = _mm_sra_epi32(_mm_add_epi32(noise, rounding_offset), scaling_shift);
+    return _mm_min_epi32(_mm_max_epi32(_mm_add_epi32(pixel, noise), min_val), max_val);
+}
+
+static INLINE __m128i load_4x8bit(const uint8_t *src) {
+    return _mm_cvtepu8_epi32(_mm_cvtsi32_si128(*(const int32_t *)src));
+}
+
+static INLINE void store_4x8bit(uint8_t *dst, __m128i val) {
+    const __m128i val16 = _mm_packus_epi32(val, val);
+    *(int32_t *)dst     = _mm_cvtsi128_si32(_mm_packus_epi16(val16, val16));
+}
+
+static INLINE __m128i load_4x16bit(const uint16_t *src) {
+    return _mm_cvtepu16_epi32(_mm_loadl_epi64((const __m128i *)src));
+}
+
+static INLINE void store_4x16bit(uint16_t *dst, __m128i val) {
+    _mm_storel_epi64((__m128i *)dst, _mm_packus_epi32(val, val));
+}
+
+// Average of the luma samples co-located with 4 chroma samples
+static INLINE __m128i average_luma_sse4_1(const uint8_t *luma, int32_t chroma_subsamp_x) {
+    if (!chroma_subsamp_x) return load_4x8bit(luma);
+    const __m128i sum = _mm_madd_epi16(_mm_cvtepu8_epi16(_mm_loadl_epi64((const __m128i *)luma)),
+                                       _mm_set1_epi16(1));
+    return _mm_srli_epi32(_mm_add_epi32(sum, _mm_set1_epi32(1)), 1);
+}
+
+static INLINE __m128i average_luma_hbd_sse4_1(const uint16_t *luma, int32_t chroma_subsamp_x) {
+    if (!chroma_subsamp_x) return load_4x16bit(luma);
+    const __m128i sum =
+        _mm_madd_epi16(_mm_loadu_si128((const __m128i *)luma), _mm_set1_epi16(1));
+    return _mm_srli_epi32(_mm_add_epi32(sum, _mm_set1_epi32(1)), 1);
+}
+
+// clamp(((average_luma * luma_mult + mult * chroma) >> 6) + offset, 0, max_index)
+static INLINE __m128i chroma_scale_index_sse4_1(__m128i average_luma, __m128i chroma,
+                                                __m128i luma_mult, __m128i mult, __m128i offset,
+                                                __m128i max_index) {
+    __m128i index = _mm_add_epi32(_mm_mullo_epi32(average_luma, luma_mult),
+                                  _mm_mullo_epi32(chroma, mult));
+    index         = _mm_add_epi32(_mm_srai_epi32(index, 6), offset);
+    return _mm_min_epi32(_mm_max_epi32(index, _mm_setzero_si128()), max_index);
+}
+
+void eb_fgn_add_luma_noise_sse4_1(const int32_t *scaling_lut, uint8_t *luma, int32_t luma_stride,
+                                  const int32_t *grain, int32_t grain_stride, int32_t width,
+                                  int32_t height, int32_t scaling_shift, int32_t min_luma,
+                                  int32_t max_luma) {
+    const __m128i rounding_offset = _mm_set1_epi32(1 << (scaling_shift - 1));
+    const __m128i shift           = _mm_cvtsi32_si128(scaling_shift);
+    const __m128i min_val         = _mm_set1_epi32(min_luma);
+    const __m128i max_val         = _mm_set1_epi32(max_luma);
+    const int32_t width4          = width & ~3;
+
+    for (int32_t i = 0; i < height; i++) {
+        uint8_t *      row       = luma + i * luma_stride;
+        const int32_t *grain_row = grain + i * grain_stride;
+        for (int32_t j = 0; j < width4; j += 4) {
+            const __m128i pixel = load_4x8bit(row + j);
+            const __m128i scale = scale_lut_sse4_1(scaling_lut, pixel, 8);
+            store_4x8bit(row + j,
+                         add_noise_sse4_1(pixel,
+                                          scale,
+                                          grain_row + j,
+                                          rounding_offset,
+                                          shift,
+                                          min_val,
+                                          max_val));
+        }
+    }
+
+    if (width4 < width)
+        eb_fgn_add_luma_noise_c(scaling_lut,
+                                luma + width4,
+                                luma_stride,
+                                grain + width4,
+                                grain_stride,
+                                width - width4,
+                                height,
+                                scaling_shift,
+                                min_luma,
+                                max_luma);
+}
+
+void eb_fgn_add_chroma_noise_sse4_1(const int32_t *scaling_lut, uint8_t *chroma,
+                                    int32_t chroma_stride, const uint8_t *luma,
+                                    int32_t luma_stride, const int32_t *grain,
+                                    int32_t grain_stride, int32_t width, int32_t height,
+                                    int32_t chroma_subsamp_x, int32_t chroma_subsamp_y,
+                                    int32_t mult, int32_t luma_mult, int32_t offset,
+                                    int32_t scaling_shift, int32_t min_chroma,
+                                    int32_t max_chroma) {
+    const __m128i rounding_offset = _mm_set1_epi32(1 << (scaling_shift - 1));
+    const __m128i shift           = _mm_cvtsi32_si128(scaling_shift);
+    const __m128i min_val         = _mm_set1_epi32(min_chroma);
+    const __m128i max_val         = _mm_set1_epi32(max_chroma);
+    const __m128i mult_val        = _mm_set1_epi32(mult);
+    const __m128i luma_mult_val   = _mm_set1_epi32(luma_mult);
+    const __m128i offset_val      = _mm_set1_epi32(offset);
+    const __m128i max_index       = _mm_set1_epi32(255);
+    const int32_t width4          = width & ~3;
+
+    for (int32_t i = 0; i < height; i++) {
+        uint8_t *      row       = chroma + i * chroma_stride;
+        const uint8_t *luma_row  = luma + (i << chroma_subsamp_y) * luma_stride;
+        const int32_t *grain_row = grain + i * grain_stride;
+        for (int32_t j = 0; j < width4; j += 4) {
+            const __m128i pixel = load_4x8bit(row + j);
+            const __m128i average_luma =
+                average_luma_sse4_1(luma_row + (j << chroma_subsamp_x), chroma_subsamp_x);
+            const __m128i index = chroma_scale_index_sse4_1(
+                average_luma, pixel, luma_mult_val, mult_val, offset_val, max_index);
+            const __m128i scale = scale_lut_sse4_1(scaling_lut, index, 8);
+            store_4x8bit(row + j,
+                         add_noise_sse4_1(pixel,
+                                          scale,
+                                          grain_row + j,
+                                          rounding_offset,
+                                          shift,
+                                          min_val,
+                                          max_val));
+        }
+    }
+
+    if (width4 < width)
+        eb_fgn_add_chroma_noise_c(scaling_lut,
+                                  chroma + width4,
+                                  chroma_stride,
+                                  luma + (width4 << chroma_subsamp_x),
+                                  luma_stride,
+                                  grain + width4,
+                                  grain_stride,
+                                  width - width4,
+                                  height,
+                                  chroma_subsamp_x,
+                                  chroma_subsamp_y,
+                                  mult,
+                                  luma_mult,
+                                  offset,
+                                  scaling_shift,
+                                  min_chroma,
+                                  max_chroma);
+}
+
+void eb_fgn_add_luma_noise_hbd_sse4_1(const int32_t *scaling_lut, uint16_t *luma,
+                                      int32_t luma_stride, const int32_t *grain,
+                                      int32_t grain_stride, int32_t width, int32_t height,
+                                      int32_t scaling_shift, int32_t min_luma, int32_t max_luma,
+                                      int32_t bit_depth) {
+    const __m128i rounding_offset = _mm_set1_epi32(1 << (scaling_shift - 1));
+    const __m128i shift           = _mm_cvtsi32_si128(scaling_shift);
+    const __m128i min_val         = _mm_set1_epi32(min_luma);
+    const __m128i max_val         = _mm_set1_epi32(max_luma);
+    const int32_t width4          = width & ~3;
+
+    for (int32_t i = 0; i < height; i++) {
+        uint16_t *     row       = luma + i * luma_stride;
+        const int32_t *grain_row = grain + i * grain_stride;
+        for (int32_t j = 0; j < width4; j += 4) {
+            const __m128i pixel = load_4x16bit(row + j);
+            const __m128i scale = scale_lut_sse4_1(scaling_lut, pixel, bit_depth);
+            store_4x16bit(row + j,
+                          add_noise_sse4_1(pixel,
+                                           scale,
+                                           grain_row + j,
+                                           rounding_offset,
+                                           shift,
+                                           min_val,
+                                           max_val));
+        }
+    }
+
+    if (width4 < width)
+        eb_fgn_add_luma_noise_hbd_c(scaling_lut,
+                                    luma + width4,
+                                    luma_stride,
+                                    grain + width4,
+                                    grain_stride,
+                                    width - width4,
+                                    height,
+                                    scaling_shift,
+                                    min_luma,
+                                    max_luma,
+                                    bit_depth);
+}
+
+void eb_fgn_add_chroma_noise_hbd_sse4_1(const int32_t *scaling_lut, uint16_t *chroma,
+                                        int32_t chroma_stride, const uint16_t *luma,
+                                        int32_t luma_stride, const int32_t *grain,
+                                        int32_t grain_stride, int32_t width, int32_t height,
+                                        int32_t chroma_subsamp_x, int32_t chroma_subsamp_y,
+                                        int32_t mult, int32_t luma_mult, int32_t offset,
+                                        int32_t scaling_shift, int32_t min_chroma,
+                                        int32_t max_chroma, int32_t bit_depth) {
+    const __m128i rounding_offset = _mm_set1_epi32(1 << (scaling_shift - 1));
+    const __m128i shift           = _mm_cvtsi32_si128(scaling_shift);
+    const __m128i min_val         = _mm_set1_epi32(min_chroma);
+    const __m128i max_val         = _mm_set1_epi32(max_chroma);
+    const __m128i mult_val        = _mm_set1_epi32(mult);
+    const __m128i luma_mult_val   = _mm_set1_epi32(luma_mult);
+    const __m128i offset_val      = _mm_set1_epi32(offset);
+    const __m128i max_index       = _mm_set1_epi32((256 << (bit_depth - 8)) - 1);
+    const int32_t width4          = width & ~3;
+
+    for (int32_t i = 0; i < height; i++) {
+        uint16_t *      row       = chroma + i * chroma_stride;
+        const uint16_t *luma_row  = luma + (i << chroma_subsamp_y) * luma_stride;
+        const int32_t * grain_row = grain + i * grain_stride;
+        for (int32_t j = 0; j < width4; j += 4) {
+            const __m128i pixel = load_4x16bit(row + j);
+            const __m128i average_luma =
+                average_luma_hbd_sse4_1(luma_row + (j << chroma_subsamp_x), chroma_subsamp_x);
+            const __m128i index = chroma_scale_index_sse4_1(
+                average_luma, pixel, luma_mult_val, mult_val, offset_val, max_index);
+            const __m128i scale = scale_lut_sse4_1(scaling_lut, index, bit_depth);
+            store_4x16bit(row + j,
+                          add_noise_sse4_1(pixel,
+                                           scale,
+                                           grain_row + j,
+                                           rounding_offset,
+                                           shift,
+                                           min_val,
+                                           max_val));
+        }
+    }
+
+    if (width4 < width)
+        eb_fgn_add_chroma_noise_hbd_c(scaling_lut,
+                                      chroma + width4,
+                                      chroma_stride,
+                                      luma + (width4 << chroma_subsamp_x),
+                                      luma_stride,
+                                      grain + width4,
+                                      grain_stride,
+                                      width - width4,
+                                      height,
+                                      chroma_subsamp_x,
+                                      chroma_subsamp_y,
+                                      mult,
+                                      luma_mult,
+                                      offset,
+                                      scaling_shift,
+                                      min_chroma,
+                                      max_chroma,
+                                      bit_depth);
+}
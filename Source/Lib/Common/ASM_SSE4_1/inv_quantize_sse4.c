@@ -0,0 +1,75 @@
+/*
+* Copyright(c) 2019 Intel Corporation
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+#include <smmintrin.h>
+
+#include "EbDefinitions.h"
+#include "EbInvTransforms.h"
+#include "common_dsp_rtcd.h"
+
+/* Decoder dequantization, 4 levels per iteration. The levels come in scan
+ * order, so the results are scattered one at a time, skipping the zero ones
+ * like the C code does. */
+
+static INLINE __m128i get_dqv_qm_4(const QmVal *iqmatrix, const int16_t *scan,
+                                   const __m128i dqv) {
+    const __m128i round = _mm_set1_epi32(1 << (AOM_QM_BITS - 1));
+    const __m128i qm    = _mm_setr_epi32(
+        iqmatrix[scan[0]], iqmatrix[scan[1]], iqmatrix[scan[2]], iqmatrix[scan[3]]);
+    // both fit in 15 bits, pmaddwd gives the 32-bit product
+    const __m128i prod = _mm_madd_epi16(qm, dqv);
+    return _mm_srai_epi32(_mm_add_epi32(prod, round), AOM_QM_BITS);
+}
+
+static INLINE void inverse_quantize_4(int32_t *qcoeffs, const int16_t *scan, const __m128i lev,
+                                      const __m128i dqv, const __m128i shift,
+                                      const __m128i min_value, const __m128i max_value,
+                                      const int32_t nz_mask) {
+    const __m128i mask_24 = _mm_set1_epi32(0xffffff);
+    int32_t       tmp[4];
+
+    // the low 32 bits of the product are enough to keep its low 24 bits
+    __m128i q = _mm_and_si128(_mm_mullo_epi32(_mm_abs_epi32(lev), dqv), mask_24);
+    q         = _mm_srl_epi32(q, shift);
+    q         = _mm_sign_epi32(q, lev);
+    q         = _mm_min_epi32(_mm_max_epi32(q, min_value), max_value);
+    _mm_storeu_si128((__m128i *)tmp, q);
+
+    for (int32_t j = 0; j < 4; j++)
+        if (nz_mask & (1 << j)) qcoeffs[scan[j]] = tmp[j];
+}
+
+void eb_av1_inverse_quantize_sse4_1(const int32_t *level, int32_t *qcoeffs, const int16_t *scan,
+                                    int32_t n_coeffs, const int16_t *dequant,
+                                    const QmVal *iqmatrix, int32_t shift, int32_t bit_depth) {
+    const __m128i max_value     = _mm_set1_epi32((1 << (7 + bit_depth)) - 1);
+    const __m128i min_value     = _mm_set1_epi32(-(1 << (7 + bit_depth)));
+    const __m128i shift_128     = _mm_cvtsi32_si128(shift);
+    const __m128i dqv_ac        = _mm_set1_epi32(dequant[1]);
+    const int16_t dequant_ac[2] = {dequant[1], dequant[1]};
+    int32_t       i;
+
+    for (i = 0; i + 4 <= n_coeffs; i += 4) {
+        const __m128i lev = _mm_loadu_si128((const __m128i *)(level + i));
+        const int32_t nz_mask =
+            ~_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(lev, _mm_setzero_si128()))) & 0xf;
+        if (!nz_mask) continue;
+
+        // the first level of the block is the DC one
+        __m128i dqv = i ? dqv_ac : _mm_insert_epi32(dqv_ac, dequant[0], 0);
+        if (iqmatrix != NULL) dqv = get_dqv_qm_4(iqmatrix, scan + i, dqv);
+        inverse_quantize_4(qcoeffs, scan + i, lev, dqv, shift_128, min_value, max_value, nz_mask);
+    }
+
+    if (i < n_coeffs)
+        eb_av1_inverse_quantize_c(level + i,
+                                  qcoeffs,
+                                  scan + i,
+                                  n_coeffs - i,
+                                  i ? dequant_ac : dequant,
+                                  iqmatrix,
+                                  shift,
+                                  bit_depth);
+}
@@ -187,3 +187,64 @@ void convert_16bit_to_8bit_c(uint16_t *src, uint32_t src_stride, uint8_t *dst, u
         }
     }
 }
+
+void eb_downshift_16bit_to_8bit_c(const uint16_t *src, uint32_t src_stride, uint8_t *dst,
+                                  uint32_t dst_stride, uint32_t width, uint32_t height,
+                                  uint32_t shift) {
+    for (uint32_t j = 0; j < height; j++) {
+        for (uint32_t k = 0; k < width; k++) dst[k] = (uint8_t)(src[k] >> shift);
+        src += src_stride;
+        dst += dst_stride;
+    }
+}
+
+void eb_upshift_16bit_c(const uint16_t *src, uint32_t src_stride, uint16_t *dst,
+                        uint32_t dst_stride, uint32_t width, uint32_t height, uint32_t shift) {
+    for (uint32_t j = 0; j < height; j++) {
+        for (uint32_t k = 0; k < width; k++) dst[k] = (uint16_t)(src[k] << shift);
+        src += src_stride;
+        dst += dst_stride;
+    }
+}
+
+void eb_interleave_uv_8bit_c(const uint8_t *u, uint32_t u_stride, const uint8_t *v,
+                             uint32_t v_stride, uint8_t *uv, uint32_t uv_stride, uint32_t width,
+                             uint32_t height) {
+    for (uint32_t j = 0; j < height; j++) {
+        for (uint32_t k = 0; k < width; k++) {
+            uv[2 * k]     = u[k];
+            uv[2 * k + 1] = v[k];
+        }
+        u += u_stride;
+        v += v_stride;
+        uv += uv_stride;
+    }
+}
+
+void eb_interleave_uv_16bit_to_8bit_c(const uint16_t *u, uint32_t u_stride, const uint16_t *v,
+                                      uint32_t v_stride, uint8_t *uv, uint32_t uv_stride,
+                                      uint32_t width, uint32_t height, uint32_t shift) {
+    for (uint32_t j = 0; j < height; j++) {
+        for (uint32_t k = 0; k < width; k++) {
+            uv[2 * k]     = (uint8_t)(u[k] >> shift);
+            uv[2 * k + 1] = (uint8_t)(v[k] >> shift);
+        }
+        u += u_stride;
+        v += v_stride;
+        uv += uv_stride;
+    }
+}
+
+void eb_interleave_uv_16bit_c(const uint16_t *u, uint32_t u_stride, const uint16_t *v,
+                              uint32_t v_stride, uint16_t *uv, uint32_t uv_stride, uint32_t width,
+                              uint32_t height, uint32_t shift) {
+    for (uint32_t j = 0; j < height; j++) {
+        for (uint32_t k = 0; k < width; k++) {
+            uv[2 * k]     = (uint16_t)(u[k] << shift);
+            uv[2 * k + 1] = (uint16_t)(v[k] << shift);
+        }
+        u += u_stride;
+        v += v_stride;
+        uv += uv_stride;
+    }
+}
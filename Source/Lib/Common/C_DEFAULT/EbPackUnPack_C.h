@@ -40,6 +40,23 @@ void convert_8bit_to_16bit_c(uint8_t *src, uint32_t src_stride, uint16_t *dst, u
 
 void convert_16bit_to_8bit_c(uint16_t *src, uint32_t src_stride, uint8_t *dst, uint32_t dst_stride,
     uint32_t width, uint32_t height);
+
+/* Decoder output conversions. Strides are in samples, width is the number of
+   samples (of each chroma plane for the interleaving) per row. */
+void eb_downshift_16bit_to_8bit_c(const uint16_t *src, uint32_t src_stride, uint8_t *dst,
+                                  uint32_t dst_stride, uint32_t width, uint32_t height,
+                                  uint32_t shift);
+void eb_upshift_16bit_c(const uint16_t *src, uint32_t src_stride, uint16_t *dst,
+                        uint32_t dst_stride, uint32_t width, uint32_t height, uint32_t shift);
+void eb_interleave_uv_8bit_c(const uint8_t *u, uint32_t u_stride, const uint8_t *v,
+                             uint32_t v_stride, uint8_t *uv, uint32_t uv_stride, uint32_t width,
+                             uint32_t height);
+void eb_interleave_uv_16bit_to_8bit_c(const uint16_t *u, uint32_t u_stride, const uint16_t *v,
+                                      uint32_t v_stride, uint8_t *uv, uint32_t uv_stride,
+                                      uint32_t width, uint32_t height, uint32_t shift);
+void eb_interleave_uv_16bit_c(const uint16_t *u, uint32_t u_stride, const uint16_t *v,
+                              uint32_t v_stride, uint16_t *uv, uint32_t uv_stride, uint32_t width,
+                              uint32_t height, uint32_t shift);
 #ifdef __cplusplus
 }
 #endif
@@ -3763,3 +3763,29 @@ void invert_quant(int16_t *quant, int16_t *shift, int32_t d) {
     *quant = (int16_t)(m - (1 << 16));
     *shift = 1 << (16 - l);
 }
+
+/* Dequantizes the n_coeffs levels of a block, given in scan order, into
+ * qcoeffs at their raster positions. The first level is the DC one and uses
+ * dequant[0], the others dequant[1], both optionally weighted by iqmatrix. */
+void eb_av1_inverse_quantize_c(const int32_t *level, int32_t *qcoeffs, const int16_t *scan,
+                               int32_t n_coeffs, const int16_t *dequant,
+                               const QmVal *iqmatrix, int32_t shift, int32_t bit_depth) {
+    const int32_t max_value = (1 << (7 + bit_depth)) - 1;
+    const int32_t min_value = -(1 << (7 + bit_depth));
+
+    for (int32_t i = 0; i < n_coeffs; i++) {
+        const int32_t lev = level[i];
+        if (lev != 0) {
+            const int32_t pos = scan[i];
+            int32_t       dqv = dequant[i != 0];
+            if (iqmatrix != NULL)
+                dqv = ((iqmatrix[pos] * dqv) + (1 << (AOM_QM_BITS - 1))) >> AOM_QM_BITS;
+
+            TranLow q_coeff = (TranLow)((int64_t)abs(lev) * dqv & 0xffffff);
+            q_coeff         = q_coeff >> shift;
+            if (lev < 0) q_coeff = -q_coeff;
+
+            qcoeffs[pos] = clamp(q_coeff, min_value, max_value);
+        }
+    }
+}
@@ -51,8 +51,8 @@ int32_t get_upscale_convolve_x0(int in_length, int out_length, int32_t x_step_qn
     return (int32_t)((uint32_t)x0 & RS_SCALE_SUBPEL_MASK);
 }
 
-static void av1_convolve_horiz_rs_c(const uint8_t *src, int src_stride, uint8_t *dst, int dst_stride,
-                                    int w, int h, const int16_t *x_filters, int x0_qn, int x_step_qn) {
+void eb_av1_convolve_horiz_rs_c(const uint8_t *src, int src_stride, uint8_t *dst, int dst_stride,
+                                int w, int h, const int16_t *x_filters, int x0_qn, int x_step_qn) {
     src -= UPSCALE_NORMATIVE_TAPS / 2 - 1;
     for (int y = 0; y < h; ++y) {
         int x_qn = x0_qn;
@@ -71,9 +71,9 @@ static void av1_convolve_horiz_rs_c(const uint8_t *src, int src_stride, uint8_t
     }
 }
 
-static void av1_highbd_convolve_horiz_rs_c(const uint16_t *src, int src_stride, uint16_t *dst,
-                                           int dst_stride, int w, int h, const int16_t *x_filters,
-                                           int x0_qn, int x_step_qn, int bd) {
+void eb_av1_highbd_convolve_horiz_rs_c(const uint16_t *src, int src_stride, uint16_t *dst,
+                                       int dst_stride, int w, int h, const int16_t *x_filters,
+                                       int x0_qn, int x_step_qn, int bd) {
     src -= UPSCALE_NORMATIVE_TAPS / 2 - 1;
     for (int y = 0; y < h; ++y) {
         int x_qn = x0_qn;
@@ -105,7 +105,7 @@ void upscale_normative_rect(const uint8_t *const input, int height, int width, i
     (either because we can't sample from other tiles, or because we're at
     a frame edge).
     Save the overwritten pixels into tmp_left and tmp_right.
-    Note: Because we pass input-1 to av1_convolve_horiz_rs, we need one extra
+    Note: Because we pass input-1 to eb_av1_convolve_horiz_rs, we need one extra
     column of border pixels compared to what we'd naively think.*/
     const int      border_cols = UPSCALE_NORMATIVE_TAPS / 2 + 1;
     uint8_t *      tmp_left    = NULL;
@@ -128,15 +128,15 @@ void upscale_normative_rect(const uint8_t *const input, int height, int width, i
         }
     }
 
-    av1_convolve_horiz_rs_c(input - 1,
-                            in_stride,
-                            output,
-                            out_stride,
-                            width2,
-                            height2,
-                            &av1_resize_filter_normative[0][0],
-                            x0_qn,
-                            x_step_qn);
+    eb_av1_convolve_horiz_rs(input - 1,
+                             in_stride,
+                             output,
+                             out_stride,
+                             width2,
+                             height2,
+                             &av1_resize_filter_normative[0][0],
+                             x0_qn,
+                             x_step_qn);
 
     /* Restore the left/right border pixels */
     if (pad_left) {
@@ -166,7 +166,7 @@ void highbd_upscale_normative_rect(const uint8_t *const input, int height, int w
     (either because we can't sample from other tiles, or because we're at
     a frame edge).
     Save the overwritten pixels into tmp_left and tmp_right.
-    Note: Because we pass input-1 to av1_convolve_horiz_rs, we need one extra
+    Note: Because we pass input-1 to eb_av1_convolve_horiz_rs, we need one extra
     column of border pixels compared to what we'd naively think.*/
     const int       border_cols = UPSCALE_NORMATIVE_TAPS / 2 + 1;
     const int       border_size = border_cols * sizeof(uint16_t);
@@ -190,16 +190,16 @@ void highbd_upscale_normative_rect(const uint8_t *const input, int height, int w
         }
     }
 
-    av1_highbd_convolve_horiz_rs_c(((uint16_t *)(input)-1),
-                                   in_stride,
-                                   (uint16_t *)(output),
-                                   out_stride,
-                                   width2,
-                                   height2,
-                                   &av1_resize_filter_normative[0][0],
-                                   x0_qn,
-                                   x_step_qn,
-                                   bd);
+    eb_av1_highbd_convolve_horiz_rs(((uint16_t *)(input)-1),
+                                    in_stride,
+                                    (uint16_t *)(output),
+                                    out_stride,
+                                    width2,
+                                    height2,
+                                    &av1_resize_filter_normative[0][0],
+                                    x0_qn,
+                                    x_step_qn,
+                                    bd);
 
     /*Restore the left/right border pixels*/
     if (pad_left) {
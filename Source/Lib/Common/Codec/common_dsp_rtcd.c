@@ -273,6 +273,8 @@ void setup_common_rtcd_internal(CPU_FLAGS flags) {
     eb_av1_build_compound_diffwtd_mask_d16 = av1_build_compound_diffwtd_mask_d16_c;
 
     eb_av1_highbd_wiener_convolve_add_src = eb_av1_highbd_wiener_convolve_add_src_c;
+    eb_av1_convolve_horiz_rs = eb_av1_convolve_horiz_rs_c;
+    eb_av1_highbd_convolve_horiz_rs = eb_av1_highbd_convolve_horiz_rs_c;
 
     eb_apply_selfguided_restoration = eb_apply_selfguided_restoration_c;
 
@@ -300,6 +302,7 @@ void setup_common_rtcd_internal(CPU_FLAGS flags) {
     eb_av1_inv_txfm2d_add_16x4 = eb_av1_inv_txfm2d_add_16x4_c;
 
     eb_av1_inv_txfm_add = eb_av1_inv_txfm_add_c;
+    eb_av1_inverse_quantize = eb_av1_inverse_quantize_c;
 
     compressed_packmsb = compressed_packmsb_c;
     c_pack = c_pack_c;
@@ -308,8 +311,17 @@ void setup_common_rtcd_internal(CPU_FLAGS flags) {
     un_pack8_bit_data = un_pack8_bit_data_c;
     cfl_luma_subsampling_420_lbd = cfl_luma_subsampling_420_lbd_c;
     cfl_luma_subsampling_420_hbd = cfl_luma_subsampling_420_hbd_c;
+    eb_fgn_add_luma_noise = eb_fgn_add_luma_noise_c;
+    eb_fgn_add_chroma_noise = eb_fgn_add_chroma_noise_c;
+    eb_fgn_add_luma_noise_hbd = eb_fgn_add_luma_noise_hbd_c;
+    eb_fgn_add_chroma_noise_hbd = eb_fgn_add_chroma_noise_hbd_c;
     convert_8bit_to_16bit = convert_8bit_to_16bit_c;
     convert_16bit_to_8bit = convert_16bit_to_8bit_c;
+    eb_downshift_16bit_to_8bit = eb_downshift_16bit_to_8bit_c;
+    eb_upshift_16bit = eb_upshift_16bit_c;
+    eb_interleave_uv_8bit = eb_interleave_uv_8bit_c;
+    eb_interleave_uv_16bit_to_8bit = eb_interleave_uv_16bit_to_8bit_c;
+    eb_interleave_uv_16bit = eb_interleave_uv_16bit_c;
     pack2d_16_bit_src_mul4 = eb_enc_msb_pack2_d;
     un_pack2d_16_bit_src_mul4 = eb_enc_msb_un_pack2_d;
 
@@ -874,6 +886,13 @@ void setup_common_rtcd_internal(CPU_FLAGS flags) {
 
         if (flags & HAS_SSSE3) eb_av1_inv_txfm_add = eb_av1_inv_txfm_add_ssse3;
         if (flags & HAS_AVX2) eb_av1_inv_txfm_add = eb_av1_inv_txfm_add_avx2;
+#ifndef NON_AVX512_SUPPORT
+        if (flags & HAS_AVX512F) eb_av1_inv_txfm_add = eb_av1_inv_txfm_add_avx512;
+#endif
+        SET_SSE41_AVX2(eb_av1_inverse_quantize,
+            eb_av1_inverse_quantize_c,
+            eb_av1_inverse_quantize_sse4_1,
+            eb_av1_inverse_quantize_avx2);
         SET_AVX2(compressed_packmsb, compressed_packmsb_c, compressed_packmsb_avx2_intrin);
         SET_AVX2(c_pack, c_pack_c, c_pack_avx2_intrin);
         SET_SSE2_AVX2(unpack_avg, unpack_avg_c, unpack_avg_sse2_intrin, unpack_avg_avx2_intrin);
@@ -881,8 +900,33 @@ void setup_common_rtcd_internal(CPU_FLAGS flags) {
         SET_AVX2(un_pack8_bit_data, un_pack8_bit_data_c, eb_enc_un_pack8_bit_data_avx2_intrin);
         SET_AVX2(cfl_luma_subsampling_420_lbd, cfl_luma_subsampling_420_lbd_c, cfl_luma_subsampling_420_lbd_avx2);
         SET_AVX2(cfl_luma_subsampling_420_hbd, cfl_luma_subsampling_420_hbd_c, cfl_luma_subsampling_420_hbd_avx2);
+        SET_SSE41_AVX2(eb_fgn_add_luma_noise,
+            eb_fgn_add_luma_noise_c,
+            eb_fgn_add_luma_noise_sse4_1,
+            eb_fgn_add_luma_noise_avx2);
+        SET_SSE41_AVX2(eb_fgn_add_chroma_noise,
+            eb_fgn_add_chroma_noise_c,
+            eb_fgn_add_chroma_noise_sse4_1,
+            eb_fgn_add_chroma_noise_avx2);
+        SET_SSE41_AVX2(eb_fgn_add_luma_noise_hbd,
+            eb_fgn_add_luma_noise_hbd_c,
+            eb_fgn_add_luma_noise_hbd_sse4_1,
+            eb_fgn_add_luma_noise_hbd_avx2);
+        SET_SSE41_AVX2(eb_fgn_add_chroma_noise_hbd,
+            eb_fgn_add_chroma_noise_hbd_c,
+            eb_fgn_add_chroma_noise_hbd_sse4_1,
+            eb_fgn_add_chroma_noise_hbd_avx2);
         SET_AVX2(convert_8bit_to_16bit, convert_8bit_to_16bit_c, convert_8bit_to_16bit_avx2);
         SET_AVX2(convert_16bit_to_8bit, convert_16bit_to_8bit_c, convert_16bit_to_8bit_avx2);
+        SET_AVX2(eb_downshift_16bit_to_8bit,
+            eb_downshift_16bit_to_8bit_c,
+            eb_downshift_16bit_to_8bit_avx2);
+        SET_AVX2(eb_upshift_16bit, eb_upshift_16bit_c, eb_upshift_16bit_avx2);
+        SET_AVX2(eb_interleave_uv_8bit, eb_interleave_uv_8bit_c, eb_interleave_uv_8bit_avx2);
+        SET_AVX2(eb_interleave_uv_16bit_to_8bit,
+            eb_interleave_uv_16bit_to_8bit_c,
+            eb_interleave_uv_16bit_to_8bit_avx2);
+        SET_AVX2(eb_interleave_uv_16bit, eb_interleave_uv_16bit_c, eb_interleave_uv_16bit_avx2);
         SET_SSE2_AVX2(pack2d_16_bit_src_mul4,
             eb_enc_msb_pack2_d,
             eb_enc_msb_pack2d_sse2_intrin,
@@ -921,6 +965,14 @@ void setup_common_rtcd_internal(CPU_FLAGS flags) {
             eb_av1_wiener_convolve_add_src_c,
             eb_av1_wiener_convolve_add_src_avx2,
             eb_av1_wiener_convolve_add_src_avx512);
+        SET_AVX2_AVX512(eb_av1_convolve_horiz_rs,
+            eb_av1_convolve_horiz_rs_c,
+            eb_av1_convolve_horiz_rs_avx2,
+            eb_av1_convolve_horiz_rs_avx512);
+        SET_AVX2_AVX512(eb_av1_highbd_convolve_horiz_rs,
+            eb_av1_highbd_convolve_horiz_rs_c,
+            eb_av1_highbd_convolve_horiz_rs_avx2,
+            eb_av1_highbd_convolve_horiz_rs_avx512);
 
         if (flags & HAS_AVX2) eb_av1_convolve_2d_copy_sr = eb_av1_convolve_2d_copy_sr_avx2;
         if (flags & HAS_AVX2) eb_av1_highbd_convolve_2d_copy_sr = eb_av1_highbd_convolve_2d_copy_sr_avx2;
@@ -1040,6 +1092,19 @@ void setup_common_rtcd_internal(CPU_FLAGS flags) {
         if (flags & HAS_SSSE3) eb_aom_paeth_predictor_8x32 = eb_aom_paeth_predictor_8x32_ssse3;
         if (flags & HAS_SSSE3) eb_aom_paeth_predictor_8x4 = eb_aom_paeth_predictor_8x4_ssse3;
         if (flags & HAS_SSSE3) eb_aom_paeth_predictor_8x8 = eb_aom_paeth_predictor_8x8_ssse3;
+
+#ifndef NON_AVX512_SUPPORT
+        if (flags & HAS_AVX512F) {
+            eb_aom_paeth_predictor_32x8 = eb_aom_paeth_predictor_32x8_avx512;
+            eb_aom_paeth_predictor_32x16 = eb_aom_paeth_predictor_32x16_avx512;
+            eb_aom_paeth_predictor_32x32 = eb_aom_paeth_predictor_32x32_avx512;
+            eb_aom_paeth_predictor_32x64 = eb_aom_paeth_predictor_32x64_avx512;
+            eb_aom_paeth_predictor_64x16 = eb_aom_paeth_predictor_64x16_avx512;
+            eb_aom_paeth_predictor_64x32 = eb_aom_paeth_predictor_64x32_avx512;
+            eb_aom_paeth_predictor_64x64 = eb_aom_paeth_predictor_64x64_avx512;
+        }
+#endif // !NON_AVX512_SUPPORT
+
         if (flags & HAS_AVX2) eb_aom_highbd_paeth_predictor_16x16 = eb_aom_highbd_paeth_predictor_16x16_avx2;
         if (flags & HAS_AVX2) eb_aom_highbd_paeth_predictor_16x32 = eb_aom_highbd_paeth_predictor_16x32_avx2;
         if (flags & HAS_AVX2) eb_aom_highbd_paeth_predictor_16x4 = eb_aom_highbd_paeth_predictor_16x4_avx2;
@@ -1156,6 +1221,19 @@ void setup_common_rtcd_internal(CPU_FLAGS flags) {
         if (flags & HAS_SSSE3) eb_aom_smooth_h_predictor_16x16 = eb_aom_smooth_h_predictor_16x16_ssse3;
         if (flags & HAS_SSSE3) eb_aom_smooth_h_predictor_8x8 = eb_aom_smooth_h_predictor_8x8_ssse3;
         if (flags & HAS_SSSE3) eb_aom_smooth_h_predictor_4x4 = eb_aom_smooth_h_predictor_4x4_ssse3;
+
+#ifndef NON_AVX512_SUPPORT
+        if (flags & HAS_AVX512F) {
+            eb_aom_smooth_h_predictor_32x8 = eb_aom_smooth_h_predictor_32x8_avx512;
+            eb_aom_smooth_h_predictor_32x16 = eb_aom_smooth_h_predictor_32x16_avx512;
+            eb_aom_smooth_h_predictor_32x32 = eb_aom_smooth_h_predictor_32x32_avx512;
+            eb_aom_smooth_h_predictor_32x64 = eb_aom_smooth_h_predictor_32x64_avx512;
+            eb_aom_smooth_h_predictor_64x16 = eb_aom_smooth_h_predictor_64x16_avx512;
+            eb_aom_smooth_h_predictor_64x32 = eb_aom_smooth_h_predictor_64x32_avx512;
+            eb_aom_smooth_h_predictor_64x64 = eb_aom_smooth_h_predictor_64x64_avx512;
+        }
+#endif // !NON_AVX512_SUPPORT
+
         if (flags & HAS_SSSE3) eb_aom_smooth_v_predictor_16x32 = eb_aom_smooth_v_predictor_16x32_ssse3;
         if (flags & HAS_SSSE3) eb_aom_smooth_v_predictor_16x4 = eb_aom_smooth_v_predictor_16x4_ssse3;
         if (flags & HAS_SSSE3) eb_aom_smooth_v_predictor_16x64 = eb_aom_smooth_v_predictor_16x64_ssse3;
@@ -1175,6 +1253,19 @@ void setup_common_rtcd_internal(CPU_FLAGS flags) {
         if (flags & HAS_SSSE3) eb_aom_smooth_v_predictor_16x16 = eb_aom_smooth_v_predictor_16x16_ssse3;
         if (flags & HAS_SSSE3) eb_aom_smooth_v_predictor_8x8 = eb_aom_smooth_v_predictor_8x8_ssse3;
         if (flags & HAS_SSSE3) eb_aom_smooth_v_predictor_4x4 = eb_aom_smooth_v_predictor_4x4_ssse3;
+
+#ifndef NON_AVX512_SUPPORT
+        if (flags & HAS_AVX512F) {
+            eb_aom_smooth_v_predictor_32x8 = eb_aom_smooth_v_predictor_32x8_avx512;
+            eb_aom_smooth_v_predictor_32x16 = eb_aom_smooth_v_predictor_32x16_avx512;
+            eb_aom_smooth_v_predictor_32x32 = eb_aom_smooth_v_predictor_32x32_avx512;
+            eb_aom_smooth_v_predictor_32x64 = eb_aom_smooth_v_predictor_32x64_avx512;
+            eb_aom_smooth_v_predictor_64x16 = eb_aom_smooth_v_predictor_64x16_avx512;
+            eb_aom_smooth_v_predictor_64x32 = eb_aom_smooth_v_predictor_64x32_avx512;
+            eb_aom_smooth_v_predictor_64x64 = eb_aom_smooth_v_predictor_64x64_avx512;
+        }
+#endif // !NON_AVX512_SUPPORT
+
         if (flags & HAS_SSSE3) eb_aom_smooth_predictor_16x32 = eb_aom_smooth_predictor_16x32_ssse3;
         if (flags & HAS_SSSE3) eb_aom_smooth_predictor_16x4 = eb_aom_smooth_predictor_16x4_ssse3;
         if (flags & HAS_SSSE3) eb_aom_smooth_predictor_16x64 = eb_aom_smooth_predictor_16x64_ssse3;
@@ -1194,6 +1285,19 @@ void setup_common_rtcd_internal(CPU_FLAGS flags) {
         if (flags & HAS_SSSE3) eb_aom_smooth_predictor_16x16 = eb_aom_smooth_predictor_16x16_ssse3;
         if (flags & HAS_SSSE3) eb_aom_smooth_predictor_8x8 = eb_aom_smooth_predictor_8x8_ssse3;
         if (flags & HAS_SSSE3) eb_aom_smooth_predictor_4x4 = eb_aom_smooth_predictor_4x4_ssse3;
+
+#ifndef NON_AVX512_SUPPORT
+        if (flags & HAS_AVX512F) {
+            eb_aom_smooth_predictor_32x8 = eb_aom_smooth_predictor_32x8_avx512;
+            eb_aom_smooth_predictor_32x16 = eb_aom_smooth_predictor_32x16_avx512;
+            eb_aom_smooth_predictor_32x32 = eb_aom_smooth_predictor_32x32_avx512;
+            eb_aom_smooth_predictor_32x64 = eb_aom_smooth_predictor_32x64_avx512;
+            eb_aom_smooth_predictor_64x16 = eb_aom_smooth_predictor_64x16_avx512;
+            eb_aom_smooth_predictor_64x32 = eb_aom_smooth_predictor_64x32_avx512;
+            eb_aom_smooth_predictor_64x64 = eb_aom_smooth_predictor_64x64_avx512;
+        }
+#endif // !NON_AVX512_SUPPORT
+
         if (flags & HAS_SSE2) eb_aom_v_predictor_4x4 = eb_aom_v_predictor_4x4_sse2;
         if (flags & HAS_SSE2) eb_aom_v_predictor_8x8 = eb_aom_v_predictor_8x8_sse2;
         if (flags & HAS_SSE2) eb_aom_v_predictor_16x16 = eb_aom_v_predictor_16x16_sse2;
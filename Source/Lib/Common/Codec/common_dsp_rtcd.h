@@ -116,6 +116,23 @@ extern "C" {
     void cfl_luma_subsampling_420_hbd_avx2(const uint16_t *input, int32_t input_stride, int16_t *output_q3, int32_t width, int32_t height);
     RTCD_EXTERN void(*cfl_luma_subsampling_420_hbd)(const uint16_t *input, int32_t input_stride, int16_t *output_q3, int32_t width, int32_t height);
 
+    void eb_fgn_add_luma_noise_c(const int32_t *scaling_lut, uint8_t *luma, int32_t luma_stride, const int32_t *grain, int32_t grain_stride, int32_t width, int32_t height, int32_t scaling_shift, int32_t min_luma, int32_t max_luma);
+    void eb_fgn_add_luma_noise_sse4_1(const int32_t *scaling_lut, uint8_t *luma, int32_t luma_stride, const int32_t *grain, int32_t grain_stride, int32_t width, int32_t height, int32_t scaling_shift, int32_t min_luma, int32_t max_luma);
+    void eb_fgn_add_luma_noise_avx2(const int32_t *scaling_lut, uint8_t *luma, int32_t luma_stride, const int32_t *grain, int32_t grain_stride, int32_t width, int32_t height, int32_t scaling_shift, int32_t min_luma, int32_t max_luma);
+    RTCD_EXTERN void(*eb_fgn_add_luma_noise)(const int32_t *scaling_lut, uint8_t *luma, int32_t luma_stride, const int32_t *grain, int32_t grain_stride, int32_t width, int32_t height, int32_t scaling_shift, int32_t min_luma, int32_t max_luma);
+    void eb_fgn_add_chroma_noise_c(const int32_t *scaling_lut, uint8_t *chroma, int32_t chroma_stride, const uint8_t *luma, int32_t luma_stride, const int32_t *grain, int32_t grain_stride, int32_t width, int32_t height, int32_t chroma_subsamp_x, int32_t chroma_subsamp_y, int32_t mult, int32_t luma_mult, int32_t offset, int32_t scaling_shift, int32_t min_chroma, int32_t max_chroma);
+    void eb_fgn_add_chroma_noise_sse4_1(const int32_t *scaling_lut, uint8_t *chroma, int32_t chroma_stride, const uint8_t *luma, int32_t luma_stride, const int32_t *grain, int32_t grain_stride, int32_t width, int32_t height, int32_t chroma_subsamp_x, int32_t chroma_subsamp_y, int32_t mult, int32_t luma_mult, int32_t offset, int32_t scaling_shift, int32_t min_chroma, int32_t max_chroma);
+    void eb_fgn_add_chroma_noise_avx2(const int32_t *scaling_lut, uint8_t *chroma, int32_t chroma_stride, const uint8_t *luma, int32_t luma_stride, const int32_t *grain, int32_t grain_stride, int32_t width, int32_t height, int32_t chroma_subsamp_x, int32_t chroma_subsamp_y, int32_t mult, int32_t luma_mult, int32_t offset, int32_t scaling_shift, int32_t min_chroma, int32_t max_chroma);
+    RTCD_EXTERN void(*eb_fgn_add_chroma_noise)(const int32_t *scaling_lut, uint8_t *chroma, int32_t chroma_stride, const uint8_t *luma, int32_t luma_stride, const int32_t *grain, int32_t grain_stride, int32_t width, int32_t height, int32_t chroma_subsamp_x, int32_t chroma_subsamp_y, int32_t mult, int32_t luma_mult, int32_t offset, int32_t scaling_shift, int32_t min_chroma, int32_t max_chroma);
+    void eb_fgn_add_luma_noise_hbd_c(const int32_t *scaling_lut, uint16_t *luma, int32_t luma_stride, const int32_t *grain, int32_t grain_stride, int32_t width, int32_t height, int32_t scaling_shift, int32_t min_luma, int32_t max_luma, int32_t bit_depth);
+    void eb_fgn_add_luma_noise_hbd_sse4_1(const int32_t *scaling_lut, uint16_t *luma, int32_t luma_stride, const int32_t *grain, int32_t grain_stride, int32_t width, int32_t height, int32_t scaling_shift, int32_t min_luma, int32_t max_luma, int32_t bit_depth);
+    void eb_fgn_add_luma_noise_hbd_avx2(const int32_t *scaling_lut, uint16_t *luma, int32_t luma_stride, const int32_t *grain, int32_t grain_stride, int32_t width, int32_t height, int32_t scaling_shift, int32_t min_luma, int32_t max_luma, int32_t bit_depth);
+    RTCD_EXTERN void(*eb_fgn_add_luma_noise_hbd)(const int32_t *scaling_lut, uint16_t *luma, int32_t luma_stride, const int32_t *grain, int32_t grain_stride, int32_t width, int32_t height, int32_t scaling_shift, int32_t min_luma, int32_t max_luma, int32_t bit_depth);
+    void eb_fgn_add_chroma_noise_hbd_c(const int32_t *scaling_lut, uint16_t *chroma, int32_t chroma_stride, const uint16_t *luma, int32_t luma_stride, const int32_t *grain, int32_t grain_stride, int32_t width, int32_t height, int32_t chroma_subsamp_x, int32_t chroma_subsamp_y, int32_t mult, int32_t luma_mult, int32_t offset, int32_t scaling_shift, int32_t min_chroma, int32_t max_chroma, int32_t bit_depth);
+    void eb_fgn_add_chroma_noise_hbd_sse4_1(const int32_t *scaling_lut, uint16_t *chroma, int32_t chroma_stride, const uint16_t *luma, int32_t luma_stride, const int32_t *grain, int32_t grain_stride, int32_t width, int32_t height, int32_t chroma_subsamp_x, int32_t chroma_subsamp_y, int32_t mult, int32_t luma_mult, int32_t offset, int32_t scaling_shift, int32_t min_chroma, int32_t max_chroma, int32_t bit_depth);
+    void eb_fgn_add_chroma_noise_hbd_avx2(const int32_t *scaling_lut, uint16_t *chroma, int32_t chroma_stride, const uint16_t *luma, int32_t luma_stride, const int32_t *grain, int32_t grain_stride, int32_t width, int32_t height, int32_t chroma_subsamp_x, int32_t chroma_subsamp_y, int32_t mult, int32_t luma_mult, int32_t offset, int32_t scaling_shift, int32_t min_chroma, int32_t max_chroma, int32_t bit_depth);
+    RTCD_EXTERN void(*eb_fgn_add_chroma_noise_hbd)(const int32_t *scaling_lut, uint16_t *chroma, int32_t chroma_stride, const uint16_t *luma, int32_t luma_stride, const int32_t *grain, int32_t grain_stride, int32_t width, int32_t height, int32_t chroma_subsamp_x, int32_t chroma_subsamp_y, int32_t mult, int32_t luma_mult, int32_t offset, int32_t scaling_shift, int32_t min_chroma, int32_t max_chroma, int32_t bit_depth);
+
     void eb_av1_filter_intra_predictor_c(uint8_t *dst, ptrdiff_t stride, TxSize tx_size, const uint8_t *above, const uint8_t *left, int32_t mode);
     RTCD_EXTERN void(*eb_av1_filter_intra_predictor) (uint8_t *dst, ptrdiff_t stride, TxSize tx_size, const uint8_t *above, const uint8_t *left, int32_t mode);
     void eb_av1_filter_intra_edge_high_c_old(uint8_t *p, int32_t sz, int32_t strength);
@@ -170,6 +187,10 @@ extern "C" {
     RTCD_EXTERN void(*eb_av1_inv_txfm2d_add_16x4)(const int32_t *input, uint16_t *output_r, int32_t stride_r, uint16_t *output_w, int32_t stride_w, TxType tx_type, TxSize tx_size, int32_t bd);
     void eb_av1_inv_txfm_add_c(const TranLow *dqcoeff, uint8_t *dst_r, int32_t stride_r, uint8_t *dst_w, int32_t stride_w, const TxfmParam *txfm_param);
     RTCD_EXTERN void(*eb_av1_inv_txfm_add)(const TranLow *dqcoeff, uint8_t *dst_r, int32_t stride_r, uint8_t *dst_w, int32_t stride_w, const TxfmParam *txfm_param);
+    void eb_av1_inverse_quantize_c(const int32_t *level, int32_t *qcoeffs, const int16_t *scan, int32_t n_coeffs, const int16_t *dequant, const QmVal *iqmatrix, int32_t shift, int32_t bit_depth);
+    void eb_av1_inverse_quantize_sse4_1(const int32_t *level, int32_t *qcoeffs, const int16_t *scan, int32_t n_coeffs, const int16_t *dequant, const QmVal *iqmatrix, int32_t shift, int32_t bit_depth);
+    void eb_av1_inverse_quantize_avx2(const int32_t *level, int32_t *qcoeffs, const int16_t *scan, int32_t n_coeffs, const int16_t *dequant, const QmVal *iqmatrix, int32_t shift, int32_t bit_depth);
+    RTCD_EXTERN void(*eb_av1_inverse_quantize)(const int32_t *level, int32_t *qcoeffs, const int16_t *scan, int32_t n_coeffs, const int16_t *dequant, const QmVal *iqmatrix, int32_t shift, int32_t bit_depth);
     RTCD_EXTERN void(*compressed_packmsb)(uint8_t *in8_bit_buffer, uint32_t in8_stride, uint8_t *inn_bit_buffer, uint16_t *out16_bit_buffer, uint32_t inn_stride, uint32_t out_stride, uint32_t width, uint32_t height);
     RTCD_EXTERN void(*c_pack)(const uint8_t *inn_bit_buffer, uint32_t inn_stride, uint8_t *in_compn_bit_buffer, uint32_t out_stride, uint8_t *local_cache, uint32_t width, uint32_t height);
     RTCD_EXTERN void(*unpack_avg)(uint16_t *ref16_l0, uint32_t ref_l0_stride, uint16_t *ref16_l1, uint32_t ref_l1_stride, uint8_t *dst_ptr, uint32_t dst_stride, uint32_t width, uint32_t height);
@@ -179,6 +200,16 @@ extern "C" {
     void convert_8bit_to_16bit_avx2(uint8_t* src, uint32_t src_stride, uint16_t* dst,uint32_t dst_stride, uint32_t width, uint32_t height);
     RTCD_EXTERN void(*convert_16bit_to_8bit)(uint16_t *src, uint32_t src_stride, uint8_t *dst, uint32_t dst_stride, uint32_t width, uint32_t height);
     void convert_16bit_to_8bit_avx2(uint16_t *src, uint32_t src_stride, uint8_t *dst, uint32_t dst_stride, uint32_t width, uint32_t height);
+    RTCD_EXTERN void(*eb_downshift_16bit_to_8bit)(const uint16_t *src, uint32_t src_stride, uint8_t *dst, uint32_t dst_stride, uint32_t width, uint32_t height, uint32_t shift);
+    void eb_downshift_16bit_to_8bit_avx2(const uint16_t *src, uint32_t src_stride, uint8_t *dst, uint32_t dst_stride, uint32_t width, uint32_t height, uint32_t shift);
+    RTCD_EXTERN void(*eb_upshift_16bit)(const uint16_t *src, uint32_t src_stride, uint16_t *dst, uint32_t dst_stride, uint32_t width, uint32_t height, uint32_t shift);
+    void eb_upshift_16bit_avx2(const uint16_t *src, uint32_t src_stride, uint16_t *dst, uint32_t dst_stride, uint32_t width, uint32_t height, uint32_t shift);
+    RTCD_EXTERN void(*eb_interleave_uv_8bit)(const uint8_t *u, uint32_t u_stride, const uint8_t *v, uint32_t v_stride, uint8_t *uv, uint32_t uv_stride, uint32_t width, uint32_t height);
+    void eb_interleave_uv_8bit_avx2(const uint8_t *u, uint32_t u_stride, const uint8_t *v, uint32_t v_stride, uint8_t *uv, uint32_t uv_stride, uint32_t width, uint32_t height);
+    RTCD_EXTERN void(*eb_interleave_uv_16bit_to_8bit)(const uint16_t *u, uint32_t u_stride, const uint16_t *v, uint32_t v_stride, uint8_t *uv, uint32_t uv_stride, uint32_t width, uint32_t height, uint32_t shift);
+    void eb_interleave_uv_16bit_to_8bit_avx2(const uint16_t *u, uint32_t u_stride, const uint16_t *v, uint32_t v_stride, uint8_t *uv, uint32_t uv_stride, uint32_t width, uint32_t height, uint32_t shift);
+    RTCD_EXTERN void(*eb_interleave_uv_16bit)(const uint16_t *u, uint32_t u_stride, const uint16_t *v, uint32_t v_stride, uint16_t *uv, uint32_t uv_stride, uint32_t width, uint32_t height, uint32_t shift);
+    void eb_interleave_uv_16bit_avx2(const uint16_t *u, uint32_t u_stride, const uint16_t *v, uint32_t v_stride, uint16_t *uv, uint32_t uv_stride, uint32_t width, uint32_t height, uint32_t shift);
     RTCD_EXTERN void(*pack2d_16_bit_src_mul4)(uint8_t *in8_bit_buffer, uint32_t in8_stride, uint8_t *inn_bit_buffer, uint16_t *out16_bit_buffer, uint32_t inn_stride, uint32_t out_stride, uint32_t width, uint32_t height);
     RTCD_EXTERN void(*un_pack2d_16_bit_src_mul4)(uint16_t *in16_bit_buffer, uint32_t in_stride, uint8_t *out8_bit_buffer, uint8_t *outn_bit_buffer, uint32_t out8_stride, uint32_t outn_stride, uint32_t width, uint32_t height);
     void residual_kernel8bit_c(uint8_t *input, uint32_t input_stride, uint8_t *pred, uint32_t pred_stride, int16_t *residual, uint32_t residual_stride, uint32_t area_width, uint32_t area_height);
@@ -199,6 +230,10 @@ extern "C" {
     RTCD_EXTERN void(*eb_av1_wiener_convolve_add_src)(const uint8_t *const src, const ptrdiff_t src_stride, uint8_t *const dst, const ptrdiff_t dst_stride, const int16_t *const filter_x, const int16_t *const filter_y, const int32_t w, const int32_t h, const ConvolveParams *const conv_params);
     void eb_av1_highbd_wiener_convolve_add_src_c(const uint8_t *const src, const ptrdiff_t src_stride, uint8_t *const dst, const ptrdiff_t dst_stride, const int16_t *const filter_x, const int16_t *const filter_y, const int32_t w, const int32_t h, const ConvolveParams *const conv_params, const int32_t bd);
     RTCD_EXTERN void(*eb_av1_highbd_wiener_convolve_add_src)(const uint8_t *const src, const ptrdiff_t src_stride, uint8_t *const dst, const ptrdiff_t dst_stride, const int16_t *const filter_x, const int16_t *const filter_y, const int32_t w, const int32_t h, const ConvolveParams *const conv_params, const int32_t bd);
+    void eb_av1_convolve_horiz_rs_c(const uint8_t *src, int src_stride, uint8_t *dst, int dst_stride, int w, int h, const int16_t *x_filters, int x0_qn, int x_step_qn);
+    RTCD_EXTERN void(*eb_av1_convolve_horiz_rs)(const uint8_t *src, int src_stride, uint8_t *dst, int dst_stride, int w, int h, const int16_t *x_filters, int x0_qn, int x_step_qn);
+    void eb_av1_highbd_convolve_horiz_rs_c(const uint16_t *src, int src_stride, uint16_t *dst, int dst_stride, int w, int h, const int16_t *x_filters, int x0_qn, int x_step_qn, int bd);
+    RTCD_EXTERN void(*eb_av1_highbd_convolve_horiz_rs)(const uint16_t *src, int src_stride, uint16_t *dst, int dst_stride, int w, int h, const int16_t *x_filters, int x0_qn, int x_step_qn, int bd);
     void eb_apply_selfguided_restoration_c(const uint8_t *dat, int32_t width, int32_t height, int32_t stride, int32_t eps, const int32_t *xqd, uint8_t *dst, int32_t dst_stride, int32_t *tmpbuf, int32_t bit_depth, int32_t highbd);
     RTCD_EXTERN void(*eb_apply_selfguided_restoration)(const uint8_t *dat, int32_t width, int32_t height, int32_t stride, int32_t eps, const int32_t *xqd, uint8_t *dst, int32_t dst_stride, int32_t *tmpbuf, int32_t bit_depth, int32_t highbd);
     void eb_av1_selfguided_restoration_c(const uint8_t *dgd8, int32_t width, int32_t height,
@@ -1175,6 +1210,7 @@ extern "C" {
 
     void eb_av1_inv_txfm_add_ssse3(const TranLow *dqcoeff, uint8_t *dst_r, int32_t stride_r, uint8_t *dst_w, int32_t stride_w, const TxfmParam *txfm_param);
     void eb_av1_inv_txfm_add_avx2(const TranLow *dqcoeff, uint8_t *dst_r, int32_t stride_r, uint8_t *dst_w, int32_t stride_w, const TxfmParam *txfm_param);
+    void eb_av1_inv_txfm_add_avx512(const TranLow *dqcoeff, uint8_t *dst_r, int32_t stride_r, uint8_t *dst_w, int32_t stride_w, const TxfmParam *txfm_param);
 
     void compressed_packmsb_avx2_intrin(uint8_t *in8_bit_buffer, uint32_t in8_stride,
         uint8_t *inn_bit_buffer, uint16_t *out16_bit_buffer,
@@ -1241,6 +1277,11 @@ extern "C" {
 
     void eb_av1_highbd_wiener_convolve_add_src_avx2(const uint8_t *const src, const ptrdiff_t src_stride, uint8_t *const dst, const ptrdiff_t dst_stride, const int16_t *const filter_x, const int16_t *const filter_y, const int32_t w, const int32_t h, const ConvolveParams *const conv_params, const int32_t bd);
 
+    void eb_av1_convolve_horiz_rs_avx2(const uint8_t *src, int src_stride, uint8_t *dst, int dst_stride, int w, int h, const int16_t *x_filters, int x0_qn, int x_step_qn);
+    void eb_av1_convolve_horiz_rs_avx512(const uint8_t *src, int src_stride, uint8_t *dst, int dst_stride, int w, int h, const int16_t *x_filters, int x0_qn, int x_step_qn);
+    void eb_av1_highbd_convolve_horiz_rs_avx2(const uint16_t *src, int src_stride, uint16_t *dst, int dst_stride, int w, int h, const int16_t *x_filters, int x0_qn, int x_step_qn, int bd);
+    void eb_av1_highbd_convolve_horiz_rs_avx512(const uint16_t *src, int src_stride, uint16_t *dst, int dst_stride, int w, int h, const int16_t *x_filters, int x0_qn, int x_step_qn, int bd);
+
     void eb_apply_selfguided_restoration_avx2(const uint8_t *dat, int32_t width, int32_t height, int32_t stride, int32_t eps, const int32_t *xqd, uint8_t *dst, int32_t dst_stride, int32_t *tmpbuf, int32_t bit_depth, int32_t highbd);
 
         void eb_av1_selfguided_restoration_avx2(const uint8_t *dgd8, int32_t width, int32_t height,
@@ -1882,8 +1923,10 @@ extern "C" {
 
             /* SMOOTH_H_PRED */
             void eb_aom_smooth_h_predictor_64x64_ssse3(uint8_t *dst, ptrdiff_t y_stride, const uint8_t *above, const uint8_t *left);
+            void eb_aom_smooth_h_predictor_64x64_avx512(uint8_t *dst, ptrdiff_t y_stride, const uint8_t *above, const uint8_t *left);
 
             void eb_aom_smooth_h_predictor_32x32_ssse3(uint8_t *dst, ptrdiff_t y_stride, const uint8_t *above, const uint8_t *left);
+            void eb_aom_smooth_h_predictor_32x32_avx512(uint8_t *dst, ptrdiff_t y_stride, const uint8_t *above, const uint8_t *left);
 
             void eb_aom_smooth_h_predictor_16x16_ssse3(uint8_t *dst, ptrdiff_t y_stride, const uint8_t *above, const uint8_t *left);
 
@@ -1900,18 +1943,23 @@ extern "C" {
             void eb_aom_smooth_h_predictor_16x8_ssse3(uint8_t *dst, ptrdiff_t y_stride, const uint8_t *above, const uint8_t *left);
 
             void eb_aom_smooth_h_predictor_32x16_ssse3(uint8_t *dst, ptrdiff_t y_stride, const uint8_t *above, const uint8_t *left);
+            void eb_aom_smooth_h_predictor_32x16_avx512(uint8_t *dst, ptrdiff_t y_stride, const uint8_t *above, const uint8_t *left);
 
             void eb_aom_smooth_h_predictor_32x64_ssse3(uint8_t *dst, ptrdiff_t y_stride, const uint8_t *above, const uint8_t *left);
+            void eb_aom_smooth_h_predictor_32x64_avx512(uint8_t *dst, ptrdiff_t y_stride, const uint8_t *above, const uint8_t *left);
 
             void eb_aom_smooth_h_predictor_32x8_ssse3(uint8_t *dst, ptrdiff_t y_stride, const uint8_t *above, const uint8_t *left);
+            void eb_aom_smooth_h_predictor_32x8_avx512(uint8_t *dst, ptrdiff_t y_stride, const uint8_t *above, const uint8_t *left);
 
             void eb_aom_smooth_h_predictor_4x16_ssse3(uint8_t *dst, ptrdiff_t y_stride, const uint8_t *above, const uint8_t *left);
 
             void eb_aom_smooth_h_predictor_4x8_ssse3(uint8_t *dst, ptrdiff_t y_stride, const uint8_t *above, const uint8_t *left);
 
             void eb_aom_smooth_h_predictor_64x16_ssse3(uint8_t *dst, ptrdiff_t y_stride, const uint8_t *above, const uint8_t *left);
+            void eb_aom_smooth_h_predictor_64x16_avx512(uint8_t *dst, ptrdiff_t y_stride, const uint8_t *above, const uint8_t *left);
 
             void eb_aom_smooth_h_predictor_64x32_ssse3(uint8_t *dst, ptrdiff_t y_stride, const uint8_t *above, const uint8_t *left);
+            void eb_aom_smooth_h_predictor_64x32_avx512(uint8_t *dst, ptrdiff_t y_stride, const uint8_t *above, const uint8_t *left);
 
             void eb_aom_smooth_h_predictor_8x16_ssse3(uint8_t *dst, ptrdiff_t y_stride, const uint8_t *above, const uint8_t *left);
 
@@ -1922,8 +1970,10 @@ extern "C" {
             /* SMOOTH_V_PRED */
 
             void eb_aom_smooth_v_predictor_64x64_ssse3(uint8_t *dst, ptrdiff_t y_stride, const uint8_t *above, const uint8_t *left);
+            void eb_aom_smooth_v_predictor_64x64_avx512(uint8_t *dst, ptrdiff_t y_stride, const uint8_t *above, const uint8_t *left);
 
             void eb_aom_smooth_v_predictor_32x32_ssse3(uint8_t *dst, ptrdiff_t y_stride, const uint8_t *above, const uint8_t *left);
+            void eb_aom_smooth_v_predictor_32x32_avx512(uint8_t *dst, ptrdiff_t y_stride, const uint8_t *above, const uint8_t *left);
 
             void eb_aom_smooth_v_predictor_16x16_ssse3(uint8_t *dst, ptrdiff_t y_stride, const uint8_t *above, const uint8_t *left);
 
@@ -1940,18 +1990,23 @@ extern "C" {
             void eb_aom_smooth_v_predictor_16x8_ssse3(uint8_t *dst, ptrdiff_t y_stride, const uint8_t *above, const uint8_t *left);
 
             void eb_aom_smooth_v_predictor_32x16_ssse3(uint8_t *dst, ptrdiff_t y_stride, const uint8_t *above, const uint8_t *left);
+            void eb_aom_smooth_v_predictor_32x16_avx512(uint8_t *dst, ptrdiff_t y_stride, const uint8_t *above, const uint8_t *left);
 
             void eb_aom_smooth_v_predictor_32x64_ssse3(uint8_t *dst, ptrdiff_t y_stride, const uint8_t *above, const uint8_t *left);
+            void eb_aom_smooth_v_predictor_32x64_avx512(uint8_t *dst, ptrdiff_t y_stride, const uint8_t *above, const uint8_t *left);
 
             void eb_aom_smooth_v_predictor_32x8_ssse3(uint8_t *dst, ptrdiff_t y_stride, const uint8_t *above, const uint8_t *left);
+            void eb_aom_smooth_v_predictor_32x8_avx512(uint8_t *dst, ptrdiff_t y_stride, const uint8_t *above, const uint8_t *left);
 
             void eb_aom_smooth_v_predictor_4x16_ssse3(uint8_t *dst, ptrdiff_t y_stride, const uint8_t *above, const uint8_t *left);
 
             void eb_aom_smooth_v_predictor_4x8_ssse3(uint8_t *dst, ptrdiff_t y_stride, const uint8_t *above, const uint8_t *left);
 
             void eb_aom_smooth_v_predictor_64x16_ssse3(uint8_t *dst, ptrdiff_t y_stride, const uint8_t *above, const uint8_t *left);
+            void eb_aom_smooth_v_predictor_64x16_avx512(uint8_t *dst, ptrdiff_t y_stride, const uint8_t *above, const uint8_t *left);
 
             void eb_aom_smooth_v_predictor_64x32_ssse3(uint8_t *dst, ptrdiff_t y_stride, const uint8_t *above, const uint8_t *left);
+            void eb_aom_smooth_v_predictor_64x32_avx512(uint8_t *dst, ptrdiff_t y_stride, const uint8_t *above, const uint8_t *left);
 
             void eb_aom_smooth_v_predictor_8x16_ssse3(uint8_t *dst, ptrdiff_t y_stride, const uint8_t *above, const uint8_t *left);
 
@@ -1962,8 +2017,10 @@ extern "C" {
             /* SMOOTH_PRED */
 
             void eb_aom_smooth_predictor_64x64_ssse3(uint8_t *dst, ptrdiff_t y_stride, const uint8_t *above, const uint8_t *left);
+            void eb_aom_smooth_predictor_64x64_avx512(uint8_t *dst, ptrdiff_t y_stride, const uint8_t *above, const uint8_t *left);
 
             void eb_aom_smooth_predictor_32x32_ssse3(uint8_t *dst, ptrdiff_t y_stride, const uint8_t *above, const uint8_t *left);
+            void eb_aom_smooth_predictor_32x32_avx512(uint8_t *dst, ptrdiff_t y_stride, const uint8_t *above, const uint8_t *left);
 
             void eb_aom_smooth_predictor_16x16_ssse3(uint8_t *dst, ptrdiff_t y_stride, const uint8_t *above, const uint8_t *left);
 
@@ -1980,18 +2037,23 @@ extern "C" {
             void eb_aom_smooth_predictor_16x8_ssse3(uint8_t *dst, ptrdiff_t y_stride, const uint8_t *above, const uint8_t *left);
 
             void eb_aom_smooth_predictor_32x16_ssse3(uint8_t *dst, ptrdiff_t y_stride, const uint8_t *above, const uint8_t *left);
+            void eb_aom_smooth_predictor_32x16_avx512(uint8_t *dst, ptrdiff_t y_stride, const uint8_t *above, const uint8_t *left);
 
             void eb_aom_smooth_predictor_32x64_ssse3(uint8_t *dst, ptrdiff_t y_stride, const uint8_t *above, const uint8_t *left);
+            void eb_aom_smooth_predictor_32x64_avx512(uint8_t *dst, ptrdiff_t y_stride, const uint8_t *above, const uint8_t *left);
 
             void eb_aom_smooth_predictor_32x8_ssse3(uint8_t *dst, ptrdiff_t y_stride, const uint8_t *above, const uint8_t *left);
+            void eb_aom_smooth_predictor_32x8_avx512(uint8_t *dst, ptrdiff_t y_stride, const uint8_t *above, const uint8_t *left);
 
             void eb_aom_smooth_predictor_4x16_ssse3(uint8_t *dst, ptrdiff_t y_stride, const uint8_t *above, const uint8_t *left);
 
             void eb_aom_smooth_predictor_4x8_ssse3(uint8_t *dst, ptrdiff_t y_stride, const uint8_t *above, const uint8_t *left);
 
             void eb_aom_smooth_predictor_64x16_ssse3(uint8_t *dst, ptrdiff_t y_stride, const uint8_t *above, const uint8_t *left);
+            void eb_aom_smooth_predictor_64x16_avx512(uint8_t *dst, ptrdiff_t y_stride, const uint8_t *above, const uint8_t *left);
 
             void eb_aom_smooth_predictor_64x32_ssse3(uint8_t *dst, ptrdiff_t y_stride, const uint8_t *above, const uint8_t *left);
+            void eb_aom_smooth_predictor_64x32_avx512(uint8_t *dst, ptrdiff_t y_stride, const uint8_t *above, const uint8_t *left);
 
             void eb_aom_smooth_predictor_8x16_ssse3(uint8_t *dst, ptrdiff_t y_stride, const uint8_t *above, const uint8_t *left);
 
@@ -2093,14 +2155,18 @@ extern "C" {
 
             void eb_aom_paeth_predictor_32x16_ssse3(uint8_t *dst, ptrdiff_t y_stride, const uint8_t *above, const uint8_t *left);
             void eb_aom_paeth_predictor_32x16_avx2(uint8_t *dst, ptrdiff_t y_stride, const uint8_t *above, const uint8_t *left);
+            void eb_aom_paeth_predictor_32x16_avx512(uint8_t *dst, ptrdiff_t y_stride, const uint8_t *above, const uint8_t *left);
 
             void eb_aom_paeth_predictor_32x32_ssse3(uint8_t *dst, ptrdiff_t y_stride, const uint8_t *above, const uint8_t *left);
             void eb_aom_paeth_predictor_32x32_avx2(uint8_t *dst, ptrdiff_t y_stride, const uint8_t *above, const uint8_t *left);
+            void eb_aom_paeth_predictor_32x32_avx512(uint8_t *dst, ptrdiff_t y_stride, const uint8_t *above, const uint8_t *left);
 
             void eb_aom_paeth_predictor_32x64_ssse3(uint8_t *dst, ptrdiff_t y_stride, const uint8_t *above, const uint8_t *left);
             void eb_aom_paeth_predictor_32x64_avx2(uint8_t *dst, ptrdiff_t y_stride, const uint8_t *above, const uint8_t *left);
+            void eb_aom_paeth_predictor_32x64_avx512(uint8_t *dst, ptrdiff_t y_stride, const uint8_t *above, const uint8_t *left);
 
             void eb_aom_paeth_predictor_32x8_ssse3(uint8_t *dst, ptrdiff_t y_stride, const uint8_t *above, const uint8_t *left);
+            void eb_aom_paeth_predictor_32x8_avx512(uint8_t *dst, ptrdiff_t y_stride, const uint8_t *above, const uint8_t *left);
 
             void eb_aom_paeth_predictor_4x16_ssse3(uint8_t *dst, ptrdiff_t y_stride, const uint8_t *above, const uint8_t *left);
 
@@ -2110,12 +2176,15 @@ extern "C" {
 
             void eb_aom_paeth_predictor_64x16_ssse3(uint8_t *dst, ptrdiff_t y_stride, const uint8_t *above, const uint8_t *left);
             void eb_aom_paeth_predictor_64x16_avx2(uint8_t *dst, ptrdiff_t y_stride, const uint8_t *above, const uint8_t *left);
+            void eb_aom_paeth_predictor_64x16_avx512(uint8_t *dst, ptrdiff_t y_stride, const uint8_t *above, const uint8_t *left);
 
             void eb_aom_paeth_predictor_64x32_ssse3(uint8_t *dst, ptrdiff_t y_stride, const uint8_t *above, const uint8_t *left);
             void eb_aom_paeth_predictor_64x32_avx2(uint8_t *dst, ptrdiff_t y_stride, const uint8_t *above, const uint8_t *left);
+            void eb_aom_paeth_predictor_64x32_avx512(uint8_t *dst, ptrdiff_t y_stride, const uint8_t *above, const uint8_t *left);
 
             void eb_aom_paeth_predictor_64x64_ssse3(uint8_t *dst, ptrdiff_t y_stride, const uint8_t *above, const uint8_t *left);
             void eb_aom_paeth_predictor_64x64_avx2(uint8_t *dst, ptrdiff_t y_stride, const uint8_t *above, const uint8_t *left);
+            void eb_aom_paeth_predictor_64x64_avx512(uint8_t *dst, ptrdiff_t y_stride, const uint8_t *above, const uint8_t *left);
 
             void eb_aom_paeth_predictor_8x16_ssse3(uint8_t *dst, ptrdiff_t y_stride, const uint8_t *above, const uint8_t *left);
 
@@ -584,11 +584,128 @@ static int32_t scale_lut(int32_t *scaling_lut, int32_t index, int32_t bit_depth)
                 (bit_depth - 8));
 }
 
+void eb_fgn_add_luma_noise_c(const int32_t *scaling_lut, uint8_t *luma, int32_t luma_stride,
+                             const int32_t *grain, int32_t grain_stride, int32_t width,
+                             int32_t height, int32_t scaling_shift, int32_t min_luma,
+                             int32_t max_luma) {
+    const int32_t rounding_offset = (1 << (scaling_shift - 1));
+
+    for (int32_t i = 0; i < height; i++) {
+        for (int32_t j = 0; j < width; j++) {
+            luma[i * luma_stride + j] =
+                clamp(luma[i * luma_stride + j] +
+                          ((scale_lut((int32_t *)scaling_lut, luma[i * luma_stride + j], 8) *
+                                grain[i * grain_stride + j] +
+                            rounding_offset) >>
+                           scaling_shift),
+                      min_luma,
+                      max_luma);
+        }
+    }
+}
+
+void eb_fgn_add_chroma_noise_c(const int32_t *scaling_lut, uint8_t *chroma, int32_t chroma_stride,
+                               const uint8_t *luma, int32_t luma_stride, const int32_t *grain,
+                               int32_t grain_stride, int32_t width, int32_t height,
+                               int32_t chroma_subsamp_x, int32_t chroma_subsamp_y, int32_t mult,
+                               int32_t luma_mult, int32_t offset, int32_t scaling_shift,
+                               int32_t min_chroma, int32_t max_chroma) {
+    const int32_t rounding_offset = (1 << (scaling_shift - 1));
+
+    for (int32_t i = 0; i < height; i++) {
+        for (int32_t j = 0; j < width; j++) {
+            int32_t average_luma = 0;
+            if (chroma_subsamp_x) {
+                average_luma =
+                    (luma[(i << chroma_subsamp_y) * luma_stride + (j << chroma_subsamp_x)] +
+                     luma[(i << chroma_subsamp_y) * luma_stride + (j << chroma_subsamp_x) + 1] +
+                     1) >>
+                    1;
+            } else
+                average_luma = luma[(i << chroma_subsamp_y) * luma_stride + j];
+            chroma[i * chroma_stride + j] =
+                clamp(chroma[i * chroma_stride + j] +
+                          ((scale_lut((int32_t *)scaling_lut,
+                                      clamp(((average_luma * luma_mult +
+                                              mult * chroma[i * chroma_stride + j]) >>
+                                             6) +
+                                                offset,
+                                            0,
+                                            255),
+                                      8) *
+                                grain[i * grain_stride + j] +
+                            rounding_offset) >>
+                           scaling_shift),
+                      min_chroma,
+                      max_chroma);
+        }
+    }
+}
+
+void eb_fgn_add_luma_noise_hbd_c(const int32_t *scaling_lut, uint16_t *luma, int32_t luma_stride,
+                                 const int32_t *grain, int32_t grain_stride, int32_t width,
+                                 int32_t height, int32_t scaling_shift, int32_t min_luma,
+                                 int32_t max_luma, int32_t bit_depth) {
+    const int32_t rounding_offset = (1 << (scaling_shift - 1));
+
+    for (int32_t i = 0; i < height; i++) {
+        for (int32_t j = 0; j < width; j++) {
+            luma[i * luma_stride + j] = clamp(
+                luma[i * luma_stride + j] +
+                    ((scale_lut((int32_t *)scaling_lut, luma[i * luma_stride + j], bit_depth) *
+                          grain[i * grain_stride + j] +
+                      rounding_offset) >>
+                     scaling_shift),
+                min_luma,
+                max_luma);
+        }
+    }
+}
+
+void eb_fgn_add_chroma_noise_hbd_c(const int32_t *scaling_lut, uint16_t *chroma,
+                                   int32_t chroma_stride, const uint16_t *luma,
+                                   int32_t luma_stride, const int32_t *grain, int32_t grain_stride,
+                                   int32_t width, int32_t height, int32_t chroma_subsamp_x,
+                                   int32_t chroma_subsamp_y, int32_t mult, int32_t luma_mult,
+                                   int32_t offset, int32_t scaling_shift, int32_t min_chroma,
+                                   int32_t max_chroma, int32_t bit_depth) {
+    const int32_t rounding_offset = (1 << (scaling_shift - 1));
+
+    for (int32_t i = 0; i < height; i++) {
+        for (int32_t j = 0; j < width; j++) {
+            int32_t average_luma = 0;
+            if (chroma_subsamp_x) {
+                average_luma =
+                    (luma[(i << chroma_subsamp_y) * luma_stride + (j << chroma_subsamp_x)] +
+                     luma[(i << chroma_subsamp_y) * luma_stride + (j << chroma_subsamp_x) + 1] +
+                     1) >>
+                    1;
+            } else
+                average_luma = luma[(i << chroma_subsamp_y) * luma_stride + j];
+            chroma[i * chroma_stride + j] =
+                clamp(chroma[i * chroma_stride + j] +
+                          ((scale_lut((int32_t *)scaling_lut,
+                                      clamp(((average_luma * luma_mult +
+                                              mult * chroma[i * chroma_stride + j]) >>
+                                             6) +
+                                                offset,
+                                            0,
+                                            (256 << (bit_depth - 8)) - 1),
+                                      bit_depth) *
+                                grain[i * grain_stride + j] +
+                            rounding_offset) >>
+                           scaling_shift),
+                      min_chroma,
+                      max_chroma);
+        }
+    }
+}
+
 static void add_noise_to_block(AomFilmGrain *params, uint8_t *luma, uint8_t *cb, uint8_t *cr,
                                int32_t luma_stride, int32_t chroma_stride, int32_t *luma_grain,
                                int32_t *cb_grain, int32_t *cr_grain, int32_t luma_grain_stride,
                                int32_t chroma_grain_stride, int32_t half_luma_height,
-                               int32_t half_luma_width, int32_t bit_depth, int32_t chroma_subsamp_y,
+                               int32_t half_luma_width, int32_t chroma_subsamp_y,
                                int32_t chroma_subsamp_x) {
     int32_t cb_mult      = params->cb_mult - 128; // fixed scale
     int32_t cb_luma_mult = params->cb_luma_mult - 128; // fixed scale
@@ -598,8 +715,6 @@ static void add_noise_to_block(AomFilmGrain *params, uint8_t *luma, uint8_t *cb,
     int32_t cr_luma_mult = params->cr_luma_mult - 128; // fixed scale
     int32_t cr_offset    = params->cr_offset - 256;
 
-    int32_t rounding_offset = (1 << (params->scaling_shift - 1));
-
     int32_t apply_y  = params->num_y_points > 0 ? 1 : 0;
     int32_t apply_cb = (params->num_cb_points > 0 ||
                         params->chroma_scaling_from_luma) ? 1 : 0;
@@ -629,69 +744,54 @@ static void add_noise_to_block(AomFilmGrain *params, uint8_t *luma, uint8_t *cb,
         max_luma = max_chroma = 255;
     }
 
-    for (int32_t i = 0; i < (half_luma_height << (1 - chroma_subsamp_y)); i++) {
-        for (int32_t j = 0; j < (half_luma_width << (1 - chroma_subsamp_x)); j++) {
-            int32_t average_luma = 0;
-            if (chroma_subsamp_x) {
-                average_luma =
-                    (luma[(i << chroma_subsamp_y) * luma_stride + (j << chroma_subsamp_x)] +
-                     luma[(i << chroma_subsamp_y) * luma_stride + (j << chroma_subsamp_x) + 1] +
-                     1) >>
-                    1;
-            } else
-                average_luma = luma[(i << chroma_subsamp_y) * luma_stride + j];
-            if (apply_cb) {
-                cb[i * chroma_stride + j] =
-                    clamp(cb[i * chroma_stride + j] +
-                              ((scale_lut(scaling_lut_cb,
-                                          clamp(((average_luma * cb_luma_mult +
-                                                  cb_mult * cb[i * chroma_stride + j]) >>
-                                                 6) +
-                                                    cb_offset,
-                                                0,
-                                                (256 << (bit_depth - 8)) - 1),
-                                          8) *
-                                    cb_grain[i * chroma_grain_stride + j] +
-                                rounding_offset) >>
-                               params->scaling_shift),
-                          min_chroma,
-                          max_chroma);
-            }
-
-            if (apply_cr) {
-                cr[i * chroma_stride + j] =
-                    clamp(cr[i * chroma_stride + j] +
-                              ((scale_lut(scaling_lut_cr,
-                                          clamp(((average_luma * cr_luma_mult +
-                                                  cr_mult * cr[i * chroma_stride + j]) >>
-                                                 6) +
-                                                    cr_offset,
-                                                0,
-                                                (256 << (bit_depth - 8)) - 1),
-                                          8) *
-                                    cr_grain[i * chroma_grain_stride + j] +
-                                rounding_offset) >>
-                               params->scaling_shift),
-                          min_chroma,
-                          max_chroma);
-            }
-        }
-    }
-
-    if (apply_y) {
-        for (int32_t i = 0; i < (half_luma_height << 1); i++) {
-            for (int32_t j = 0; j < (half_luma_width << 1); j++) {
-                luma[i * luma_stride + j] =
-                    clamp(luma[i * luma_stride + j] +
-                              ((scale_lut(scaling_lut_y, luma[i * luma_stride + j], 8) *
-                                    luma_grain[i * luma_grain_stride + j] +
-                                rounding_offset) >>
-                               params->scaling_shift),
-                          min_luma,
-                          max_luma);
-            }
-        }
-    }
+    // chroma noise depends on the luma samples without noise
+    if (apply_cb)
+        eb_fgn_add_chroma_noise(scaling_lut_cb,
+                                cb,
+                                chroma_stride,
+                                luma,
+                                luma_stride,
+                                cb_grain,
+                                chroma_grain_stride,
+                                half_luma_width << (1 - chroma_subsamp_x),
+                                half_luma_height << (1 - chroma_subsamp_y),
+                                chroma_subsamp_x,
+                                chroma_subsamp_y,
+                                cb_mult,
+                                cb_luma_mult,
+                                cb_offset,
+                                params->scaling_shift,
+                                min_chroma,
+                                max_chroma);
+    if (apply_cr)
+        eb_fgn_add_chroma_noise(scaling_lut_cr,
+                                cr,
+                                chroma_stride,
+                                luma,
+                                luma_stride,
+                                cr_grain,
+                                chroma_grain_stride,
+                                half_luma_width << (1 - chroma_subsamp_x),
+                                half_luma_height << (1 - chroma_subsamp_y),
+                                chroma_subsamp_x,
+                                chroma_subsamp_y,
+                                cr_mult,
+                                cr_luma_mult,
+                                cr_offset,
+                                params->scaling_shift,
+                                min_chroma,
+                                max_chroma);
+    if (apply_y)
+        eb_fgn_add_luma_noise(scaling_lut_y,
+                              luma,
+                              luma_stride,
+                              luma_grain,
+                              luma_grain_stride,
+                              half_luma_width << 1,
+                              half_luma_height << 1,
+                              params->scaling_shift,
+                              min_luma,
+                              max_luma);
 }
 
 static void add_noise_to_block_hbd(AomFilmGrain *params, uint16_t *luma, uint16_t *cb, uint16_t *cr,
@@ -710,8 +810,6 @@ static void add_noise_to_block_hbd(AomFilmGrain *params, uint16_t *luma, uint16_
     // offset value depends on the bit depth
     int32_t cr_offset = (params->cr_offset << (bit_depth - 8)) - (1 << bit_depth);
 
-    int32_t rounding_offset = (1 << (params->scaling_shift - 1));
-
     int32_t apply_y  = params->num_y_points > 0 ? 1 : 0;
     int32_t apply_cb = params->num_cb_points > 0 ? 1 : 0;
     int32_t apply_cr = params->num_cr_points > 0 ? 1 : 0;
@@ -739,68 +837,57 @@ static void add_noise_to_block_hbd(AomFilmGrain *params, uint16_t *luma, uint16_
         max_luma = max_chroma = (256 << (bit_depth - 8)) - 1;
     }
 
-    for (int32_t i = 0; i < (half_luma_height << (1 - chroma_subsamp_y)); i++) {
-        for (int32_t j = 0; j < (half_luma_width << (1 - chroma_subsamp_x)); j++) {
-            int32_t average_luma = 0;
-            if (chroma_subsamp_x) {
-                average_luma =
-                    (luma[(i << chroma_subsamp_y) * luma_stride + (j << chroma_subsamp_x)] +
-                     luma[(i << chroma_subsamp_y) * luma_stride + (j << chroma_subsamp_x) + 1] +
-                     1) >>
-                    1;
-            } else
-                average_luma = luma[(i << chroma_subsamp_y) * luma_stride + j];
-            if (apply_cb) {
-                cb[i * chroma_stride + j] =
-                    clamp(cb[i * chroma_stride + j] +
-                              ((scale_lut(scaling_lut_cb,
-                                          clamp(((average_luma * cb_luma_mult +
-                                                  cb_mult * cb[i * chroma_stride + j]) >>
-                                                 6) +
-                                                    cb_offset,
-                                                0,
-                                                (256 << (bit_depth - 8)) - 1),
-                                          bit_depth) *
-                                    cb_grain[i * chroma_grain_stride + j] +
-                                rounding_offset) >>
-                               params->scaling_shift),
-                          min_chroma,
-                          max_chroma);
-            }
-            if (apply_cr) {
-                cr[i * chroma_stride + j] =
-                    clamp(cr[i * chroma_stride + j] +
-                              ((scale_lut(scaling_lut_cr,
-                                          clamp(((average_luma * cr_luma_mult +
-                                                  cr_mult * cr[i * chroma_stride + j]) >>
-                                                 6) +
-                                                    cr_offset,
-                                                0,
-                                                (256 << (bit_depth - 8)) - 1),
-                                          bit_depth) *
-                                    cr_grain[i * chroma_grain_stride + j] +
-                                rounding_offset) >>
-                               params->scaling_shift),
-                          min_chroma,
-                          max_chroma);
-            }
-        }
-    }
-
-    if (apply_y) {
-        for (int32_t i = 0; i < (half_luma_height << 1); i++) {
-            for (int32_t j = 0; j < (half_luma_width << 1); j++) {
-                luma[i * luma_stride + j] =
-                    clamp(luma[i * luma_stride + j] +
-                              ((scale_lut(scaling_lut_y, luma[i * luma_stride + j], bit_depth) *
-                                    luma_grain[i * luma_grain_stride + j] +
-                                rounding_offset) >>
-                               params->scaling_shift),
-                          min_luma,
-                          max_luma);
-            }
-        }
-    }
+    // chroma noise depends on the luma samples without noise
+    if (apply_cb)
+        eb_fgn_add_chroma_noise_hbd(scaling_lut_cb,
+                                    cb,
+                                    chroma_stride,
+                                    luma,
+                                    luma_stride,
+                                    cb_grain,
+                                    chroma_grain_stride,
+                                    half_luma_width << (1 - chroma_subsamp_x),
+                                    half_luma_height << (1 - chroma_subsamp_y),
+                                    chroma_subsamp_x,
+                                    chroma_subsamp_y,
+                                    cb_mult,
+                                    cb_luma_mult,
+                                    cb_offset,
+                                    params->scaling_shift,
+                                    min_chroma,
+                                    max_chroma,
+                                    bit_depth);
+    if (apply_cr)
+        eb_fgn_add_chroma_noise_hbd(scaling_lut_cr,
+                                    cr,
+                                    chroma_stride,
+                                    luma,
+                                    luma_stride,
+                                    cr_grain,
+                                    chroma_grain_stride,
+                                    half_luma_width << (1 - chroma_subsamp_x),
+                                    half_luma_height << (1 - chroma_subsamp_y),
+                                    chroma_subsamp_x,
+                                    chroma_subsamp_y,
+                                    cr_mult,
+                                    cr_luma_mult,
+                                    cr_offset,
+                                    params->scaling_shift,
+                                    min_chroma,
+                                    max_chroma,
+                                    bit_depth);
+    if (apply_y)
+        eb_fgn_add_luma_noise_hbd(scaling_lut_y,
+                                  luma,
+                                  luma_stride,
+                                  luma_grain,
+                                  luma_grain_stride,
+                                  half_luma_width << 1,
+                                  half_luma_height << 1,
+                                  params->scaling_shift,
+                                  min_luma,
+                                  max_luma,
+                                  bit_depth);
 }
 
 int32_t film_grain_params_equal(AomFilmGrain *pars_a, AomFilmGrain *pars_b) {
@@ -1135,7 +1222,6 @@ void eb_av1_add_film_grain_run(AomFilmGrain *params, uint8_t *luma, uint8_t *cb,
                         (2 - chroma_subsamp_x),
                         AOMMIN(luma_subblock_size_y >> 1, height / 2 - y) - i,
                         1,
-                        bit_depth,
                         chroma_subsamp_y,
                         chroma_subsamp_x);
                 }
@@ -1243,7 +1329,6 @@ void eb_av1_add_film_grain_run(AomFilmGrain *params, uint8_t *luma, uint8_t *cb,
                                        chroma_stride,
                                        1,
                                        AOMMIN(luma_subblock_size_x >> 1, width / 2 - x),
-                                       bit_depth,
                                        chroma_subsamp_y,
                                        chroma_subsamp_x);
                 }
@@ -1299,7 +1384,6 @@ void eb_av1_add_film_grain_run(AomFilmGrain *params, uint8_t *luma, uint8_t *cb,
                     chroma_grain_stride,
                     AOMMIN(luma_subblock_size_y >> 1, height / 2 - y) - i,
                     AOMMIN(luma_subblock_size_x >> 1, width / 2 - x) - j,
-                    bit_depth,
                     chroma_subsamp_y,
                     chroma_subsamp_x);
             }
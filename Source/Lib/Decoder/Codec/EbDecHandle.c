@@ -19,6 +19,8 @@
 #include "EbDecHandle.h"
 #include "EbDecMemInit.h"
 #include "EbDecPicMgr.h"
+#include "EbDecBitReader.h"
+#include "EbDecParseFrame.h"
 #include "grainSynthesis.h"
 
 #ifndef _WIN32
@@ -75,6 +77,10 @@ void        dec_sync_all_threads(EbDecHandle *dec_handle_ptr);
 
 EbErrorType decode_multiple_obu(EbDecHandle *dec_handle_ptr, uint8_t **data, size_t data_size,
                                 uint32_t is_annexb);
+EbErrorType decode_obu(EbDecHandle *dec_handle_ptr, uint8_t **data, size_t *data_size,
+                       uint32_t is_annexb, int *frame_decoding_finished);
+EbErrorType peek_obu_size(const uint8_t *data, size_t data_size, uint32_t is_annexb,
+                          size_t *obu_size);
 
 static void dec_switch_to_real_time() {
 #ifndef _WIN32
@@ -110,6 +116,17 @@ static EbErrorType eb_dec_handle_ctor(EbDecHandle **decHandleDblPtr, EbComponent
     svt_dec_lib_malloc_count = 0;
 
     dec_handle_ptr->start_thread_process = EB_FALSE;
+    dec_handle_ptr->pv_pic_mgr           = NULL;
+    dec_handle_ptr->alloc_ext_fb         = NULL;
+    dec_handle_ptr->release_ext_fb       = NULL;
+    dec_handle_ptr->ext_fb_priv          = NULL;
+    dec_handle_ptr->out_pic_buf          = NULL;
+    dec_handle_ptr->ext_fb_out_img       = NULL;
+    dec_handle_ptr->feed_buf             = NULL;
+    dec_handle_ptr->feed_size            = 0;
+    dec_handle_ptr->feed_pos             = 0;
+    dec_handle_ptr->feed_capacity        = 0;
+    dec_handle_ptr->feed_pic_ready       = EB_FALSE;
     memory_map_start_address = NULL;
     memory_map_end_address = NULL;
 
@@ -132,6 +149,118 @@ static void copy_even(uint8_t *luma, uint32_t wd,
             sizeof(*luma) * (wd << use_hbd));
     }
 }
+/* Copy a plane of the recon picture to the output buffer. Strides are in
+   samples. 16-bit samples are down-shifted to 8-bit output and shifted left by
+   up_shift for 16-bit output. */
+static void copy_out_plane(const uint8_t *src, uint32_t src_stride, int32_t src_hbd,
+                           uint8_t *dst, uint32_t dst_stride, int32_t dst_hbd,
+                           uint32_t width, uint32_t height, uint32_t down_shift,
+                           uint32_t up_shift) {
+    if (!src_hbd || (dst_hbd && !up_shift)) {
+        for (uint32_t i = 0; i < height; i++) {
+            eb_memcpy(dst, src, width << src_hbd);
+            dst += dst_stride << dst_hbd;
+            src += src_stride << src_hbd;
+        }
+    } else if (!dst_hbd) {
+        eb_downshift_16bit_to_8bit(
+            (const uint16_t *)src, src_stride, dst, dst_stride, width, height, down_shift);
+    } else {
+        eb_upshift_16bit(
+            (const uint16_t *)src, src_stride, (uint16_t *)dst, dst_stride, width, height, up_shift);
+    }
+}
+
+/* Interleave the chroma planes of the recon picture into the cb/cr pairs of a
+   semi-planar output */
+static void copy_out_uv(const uint8_t *u, const uint8_t *v, uint32_t src_stride, int32_t src_hbd,
+                        uint8_t *uv, uint32_t uv_stride, int32_t dst_hbd, uint32_t width,
+                        uint32_t height, uint32_t down_shift, uint32_t up_shift) {
+    if (!src_hbd)
+        eb_interleave_uv_8bit(u, src_stride, v, src_stride, uv, uv_stride, width, height);
+    else if (!dst_hbd)
+        eb_interleave_uv_16bit_to_8bit((const uint16_t *)u, src_stride,
+                                       (const uint16_t *)v, src_stride,
+                                       uv, uv_stride, width, height, down_shift);
+    else
+        eb_interleave_uv_16bit((const uint16_t *)u, src_stride,
+                               (const uint16_t *)v, src_stride,
+                               (uint16_t *)uv, uv_stride, width, height, up_shift);
+}
+
+/* Return the recon picture held in an external frame buffer without a copy.
+   Only possible when neither film grain nor a bit depth or layout conversion
+   has to be applied on the output. */
+static int svt_dec_out_ext_buf(EbDecHandle *dec_handle_ptr, EbBufferHeaderType *p_buffer) {
+    EbDecPicBuf *        out_pic_buf       = dec_handle_ptr->out_pic_buf;
+    EbPictureBufferDesc *recon_picture_buf = out_pic_buf->ps_pic_buf;
+    EbSvtIOFormat *      out_img           = (EbSvtIOFormat *)p_buffer->p_buffer;
+
+    if (recon_picture_buf->bit_depth == EB_8BIT && recon_picture_buf->is_16bit_pipeline)
+        return 0;
+    if (!dec_handle_ptr->dec_config.skip_film_grain &&
+        out_pic_buf->film_grain_params.apply_grain)
+        return 0;
+    if (dec_handle_ptr->dec_config.eight_bit_output && recon_picture_buf->bit_depth != EB_8BIT)
+        return 0;
+    if (dec_handle_ptr->dec_config.semi_planar_output &&
+        recon_picture_buf->color_format == EB_YUV420)
+        return 0;
+
+    uint32_t sx = 0, sy = 0;
+    switch (recon_picture_buf->color_format) {
+    case EB_YUV400: break;
+    case EB_YUV420: sx = 1; sy = 1; break;
+    case EB_YUV422: sx = 1; sy = 0; break;
+    case EB_YUV444: sx = 0; sy = 0; break;
+    default: return 0;
+    }
+
+    /* Planes allocated for the copy path are owned by the out buffer */
+    if (out_img != dec_handle_ptr->ext_fb_out_img) {
+        free(out_img->luma);
+        free(out_img->cb);
+        free(out_img->cr);
+    }
+
+    int32_t use_high_bit_depth = recon_picture_buf->bit_depth == EB_8BIT ? 0 : 1;
+
+    out_img->luma = recon_picture_buf->buffer_y +
+                    ((recon_picture_buf->origin_y * recon_picture_buf->stride_y +
+                      recon_picture_buf->origin_x)
+                     << use_high_bit_depth);
+    out_img->y_stride = recon_picture_buf->stride_y;
+    if (recon_picture_buf->color_format != EB_YUV400) {
+        out_img->cb = recon_picture_buf->buffer_cb +
+                      (((recon_picture_buf->origin_y >> sy) * recon_picture_buf->stride_cb +
+                        (recon_picture_buf->origin_x >> sx))
+                       << use_high_bit_depth);
+        out_img->cr = recon_picture_buf->buffer_cr +
+                      (((recon_picture_buf->origin_y >> sy) * recon_picture_buf->stride_cr +
+                        (recon_picture_buf->origin_x >> sx))
+                       << use_high_bit_depth);
+        out_img->cb_stride = recon_picture_buf->stride_cb;
+        out_img->cr_stride = recon_picture_buf->stride_cr;
+    } else {
+        out_img->cb        = NULL;
+        out_img->cr        = NULL;
+        out_img->cb_stride = INT32_MAX;
+        out_img->cr_stride = INT32_MAX;
+    }
+
+    out_img->width     = dec_handle_ptr->frame_header.frame_size.superres_upscaled_width;
+    out_img->height    = dec_handle_ptr->frame_header.frame_size.frame_height;
+    out_img->origin_x  = 0;
+    out_img->origin_y  = 0;
+    out_img->color_fmt = recon_picture_buf->color_format;
+    out_img->bit_depth = (EbBitDepth)recon_picture_buf->bit_depth;
+
+    dec_handle_ptr->ext_fb_out_img = out_img;
+    p_buffer->p_app_private        = out_pic_buf->ext_fb.private_data;
+
+    return 1;
+}
+
 /* Copy from recon buffer to out buffer! */
 int svt_dec_out_buf(EbDecHandle *dec_handle_ptr, EbBufferHeaderType *p_buffer) {
     EbPictureBufferDesc *recon_picture_buf = dec_handle_ptr->cur_pic_buf[0]->ps_pic_buf;
@@ -147,19 +276,40 @@ int svt_dec_out_buf(EbDecHandle *dec_handle_ptr, EbBufferHeaderType *p_buffer) {
         return 0;
     }
 
+    if (dec_handle_ptr->out_pic_buf != NULL) {
+        if (svt_dec_out_ext_buf(dec_handle_ptr, p_buffer)) return 1;
+        recon_picture_buf = dec_handle_ptr->out_pic_buf->ps_pic_buf;
+    }
+
+    /* Planes pointing into a frame buffer can not be written to, the
+       copy below needs buffers of its own */
+    if (out_img == dec_handle_ptr->ext_fb_out_img) {
+        out_img->luma                  = NULL;
+        out_img->cb                    = NULL;
+        out_img->cr                    = NULL;
+        out_img->width                 = 0;
+        out_img->height                = 0;
+        dec_handle_ptr->ext_fb_out_img = NULL;
+    }
+
     uint32_t wd = dec_handle_ptr->frame_header.frame_size.superres_upscaled_width;
     uint32_t ht = dec_handle_ptr->frame_header.frame_size.frame_height;
-    uint32_t i, sx = 0, sy = 0;
+    uint32_t sx = 0, sy = 0;
     /* FilmGrain module req. even dim. for internal operation */
     int even_w = (wd & 1) ? (wd + 1) : wd;
     int even_h = (ht & 1) ? (ht + 1) : ht;
 
+    const EbBitDepth out_bit_depth = dec_handle_ptr->dec_config.eight_bit_output
+                                         ? EB_EIGHT_BIT
+                                         : (EbBitDepth)recon_picture_buf->bit_depth;
+    const int semi_planar = dec_handle_ptr->dec_config.semi_planar_output &&
+                            recon_picture_buf->color_format == EB_YUV420;
+
     if (out_img->height != ht || out_img->width != wd ||
         out_img->color_fmt != recon_picture_buf->color_format ||
-        out_img->bit_depth != (EbBitDepth)recon_picture_buf->bit_depth) {
-        int size = (dec_handle_ptr->seq_header.color_config.bit_depth == EB_EIGHT_BIT)
-                       ? sizeof(uint8_t)
-                       : sizeof(uint16_t);
+        out_img->bit_depth != out_bit_depth ||
+        (recon_picture_buf->color_format != EB_YUV400 && semi_planar != (out_img->cr == NULL))) {
+        int size = (out_bit_depth == EB_EIGHT_BIT) ? sizeof(uint8_t) : sizeof(uint16_t);
 
         int luma_size = size * even_w * even_h;
         int chroma_size = -1;
@@ -173,6 +323,12 @@ int svt_dec_out_buf(EbDecHandle *dec_handle_ptr, EbBufferHeaderType *p_buffer) {
             out_img->cb_stride = (wd + 1) >> 1;
             out_img->cr_stride = (wd + 1) >> 1;
             chroma_size        = size * (((wd + 1) >> 1) * ((ht + 1) >> 1));
+            if (semi_planar) {
+                /* cb holds the interleaved cb/cr samples */
+                out_img->cb_stride = 2 * ((wd + 1) >> 1);
+                out_img->cr_stride = INT32_MAX;
+                chroma_size *= 2;
+            }
             break;
         case EB_YUV422:
             out_img->cb_stride = (wd + 1) >> 1;
@@ -191,12 +347,12 @@ int svt_dec_out_buf(EbDecHandle *dec_handle_ptr, EbBufferHeaderType *p_buffer) {
         out_img->y_stride = even_w;
         out_img->width    = wd;
         out_img->height   = ht;
-        if (out_img->bit_depth != (EbBitDepth)recon_picture_buf->bit_depth) {
+        if (out_img->bit_depth != out_bit_depth) {
             SVT_LOG(
                 "Warning : Output bit depth conversion not supported."
                 " Output depth set to %d. ",
-                recon_picture_buf->bit_depth);
-            out_img->bit_depth = (EbBitDepth)recon_picture_buf->bit_depth;
+                out_bit_depth);
+            out_img->bit_depth = out_bit_depth;
         }
 
         free(out_img->luma);
@@ -207,7 +363,7 @@ int svt_dec_out_buf(EbDecHandle *dec_handle_ptr, EbBufferHeaderType *p_buffer) {
         out_img->luma = (uint8_t *)malloc(luma_size);
         if (recon_picture_buf->color_format != EB_YUV400) {
             out_img->cb = (uint8_t *)malloc(chroma_size);
-            out_img->cr = (uint8_t *)malloc(chroma_size);
+            out_img->cr = semi_planar ? NULL : (uint8_t *)malloc(chroma_size);
         }
     }
 
@@ -231,7 +387,20 @@ int svt_dec_out_buf(EbDecHandle *dec_handle_ptr, EbBufferHeaderType *p_buffer) {
     default: assert(0);
     }
 
-    int32_t use_high_bit_depth = recon_picture_buf->bit_depth == EB_8BIT ? 0 : 1;
+    /* 8-bit recon of the 16-bit pipeline and high bit depth recon are stored on 16 bits */
+    const int32_t  src_hbd = recon_picture_buf->bit_depth != EB_8BIT ||
+                            recon_picture_buf->is_16bit_pipeline;
+    const uint32_t down_shift = recon_picture_buf->bit_depth - EB_8BIT;
+    /* P010 keeps the samples in the most significant bits */
+    const uint32_t up_shift = semi_planar ? 16 - recon_picture_buf->bit_depth : 0;
+    int32_t        use_high_bit_depth = out_bit_depth == EB_EIGHT_BIT ? 0 : 1;
+    AomFilmGrain * film_grain_ptr     = &dec_handle_ptr->cur_pic_buf[0]->film_grain_params;
+    const int      apply_grain =
+        !dec_handle_ptr->dec_config.skip_film_grain && film_grain_ptr->apply_grain;
+    const uint32_t chroma_w =
+        recon_picture_buf->color_format != EB_YUV400 ? (wd + sx) >> sx : 0;
+    const uint32_t chroma_h =
+        recon_picture_buf->color_format != EB_YUV400 ? (ht + sy) >> sy : 0;
 
     luma = out_img->luma +
            ((out_img->origin_y * out_img->y_stride + out_img->origin_x) << use_high_bit_depth);
@@ -239,162 +408,99 @@ int svt_dec_out_buf(EbDecHandle *dec_handle_ptr, EbBufferHeaderType *p_buffer) {
         cb = out_img->cb +
              ((out_img->cb_stride * (out_img->origin_y >> sy) + (out_img->origin_x >> sx))
               << use_high_bit_depth);
-        cr = out_img->cr +
-             ((out_img->cr_stride * (out_img->origin_y >> sy) + (out_img->origin_x >> sx))
-              << use_high_bit_depth);
+        if (!semi_planar)
+            cr = out_img->cr +
+                 ((out_img->cr_stride * (out_img->origin_y >> sy) + (out_img->origin_x >> sx))
+                  << use_high_bit_depth);
     }
 
-    /* Memcpy to dst buffer */
-    {
-        if (recon_picture_buf->bit_depth == EB_8BIT) {
-
-            if (dec_handle_ptr->is_16bit_pipeline) {
-                uint8_t *dst;
-                uint16_t *pu2_src;
-                uint32_t  j;
-                ASSERT(recon_picture_buf->is_16bit_pipeline);
-
-                /* Luma */
-                dst = luma;
-                pu2_src = (uint16_t *)recon_picture_buf->buffer_y + recon_picture_buf->origin_x +
-                    (recon_picture_buf->origin_y * recon_picture_buf->stride_y);
-
-                for (i = 0; i < ht; i++) {
-                    for (j = 0; j < wd; j++)
-                        dst[j] = (uint8_t)pu2_src[j];
-                    dst += out_img->y_stride;
-                    pu2_src += recon_picture_buf->stride_y;
-                }
-
-                if (recon_picture_buf->color_format != EB_YUV400) {
-                    /* Cb */
-                    dst = cb;
-                    pu2_src = (uint16_t *)recon_picture_buf->buffer_cb +
-                        (recon_picture_buf->origin_x >> sx) +
-                        ((recon_picture_buf->origin_y >> sy) * recon_picture_buf->stride_cb);
-
-                    for (i = 0; i < ((ht + sy) >> sy); i++) {
-                        for (j = 0; j < ((wd + sx) >> sx); j++)
-                            dst[j] = (uint8_t)pu2_src[j];
-                        dst += out_img->cb_stride;
-                        pu2_src += recon_picture_buf->stride_cb;
-                    }
+    const uint8_t *src_y = recon_picture_buf->buffer_y +
+                           ((recon_picture_buf->origin_x +
+                             recon_picture_buf->origin_y * recon_picture_buf->stride_y)
+                            << src_hbd);
+    const uint8_t *src_cb = NULL, *src_cr = NULL;
+    if (recon_picture_buf->color_format != EB_YUV400) {
+        src_cb = recon_picture_buf->buffer_cb +
+                 (((recon_picture_buf->origin_x >> sx) +
+                   (recon_picture_buf->origin_y >> sy) * recon_picture_buf->stride_cb)
+                  << src_hbd);
+        src_cr = recon_picture_buf->buffer_cr +
+                 (((recon_picture_buf->origin_x >> sx) +
+                   (recon_picture_buf->origin_y >> sy) * recon_picture_buf->stride_cr)
+                  << src_hbd);
+    }
 
-                    /* Cr */
-                    dst = cr;
-                    pu2_src = (uint16_t *)recon_picture_buf->buffer_cr +
-                        (recon_picture_buf->origin_x >> sx) +
-                        ((recon_picture_buf->origin_y >> sy) * recon_picture_buf->stride_cr);
-
-                    for (i = 0; i < ((ht + sy) >> sy); i++) {
-                        for (j = 0; j < ((wd + sx) >> sx); j++)
-                            dst[j] = (uint8_t)pu2_src[j];
-                        dst += out_img->cr_stride;
-                        pu2_src += recon_picture_buf->stride_cr;
-                    }
-                }
-            }
-            else {
-            uint8_t *src, *dst;
-            dst = luma;
-            src = recon_picture_buf->buffer_y + recon_picture_buf->origin_x +
-                (recon_picture_buf->origin_y * recon_picture_buf->stride_y);
-
-            for (i = 0; i < ht; i++) {
-                eb_memcpy(dst, src, wd);
-                dst += out_img->y_stride;
-                src += recon_picture_buf->stride_y;
+    if (apply_grain) {
+        /* Grain is synthesized on planar pictures at the output bit depth, the
+           semi-planar layout is made afterwards */
+        uint8_t *grain_cb = cb, *grain_cr = cr;
+        uint32_t grain_chroma_stride = out_img->cb_stride;
+        if (semi_planar) {
+            grain_chroma_stride = chroma_w;
+            grain_cb = (uint8_t *)malloc((chroma_w * chroma_h) << use_high_bit_depth);
+            grain_cr = (uint8_t *)malloc((chroma_w * chroma_h) << use_high_bit_depth);
+            if (!grain_cb || !grain_cr) {
+                free(grain_cb);
+                free(grain_cr);
+                return 0;
             }
+        }
 
-            if (recon_picture_buf->color_format != EB_YUV400) {
-                /* Cb */
-                dst = cb;
-                src = recon_picture_buf->buffer_cb + (recon_picture_buf->origin_x >> sx) +
-                    ((recon_picture_buf->origin_y >> sy) * recon_picture_buf->stride_cb);
-
-                for (i = 0; i < ((ht + sy) >> sy); i++) {
-                    eb_memcpy(dst, src, ((wd + sx) >> sx));
-                    dst += out_img->cb_stride;
-                    src += recon_picture_buf->stride_cb;
-                }
-
-                /* Cr */
-                dst = cr;
-                src = recon_picture_buf->buffer_cr + (recon_picture_buf->origin_x >> sx) +
-                    ((recon_picture_buf->origin_y >> sy) * recon_picture_buf->stride_cr);
-
-                for (i = 0; i < ((ht + sy) >> sy); i++) {
-                    eb_memcpy(dst, src, ((wd + sx) >> sx));
-                    dst += out_img->cr_stride;
-                    src += recon_picture_buf->stride_cr;
-                }
-            }
+        copy_out_plane(src_y, recon_picture_buf->stride_y, src_hbd,
+                       luma, out_img->y_stride, use_high_bit_depth,
+                       wd, ht, down_shift, 0);
+        if (recon_picture_buf->color_format != EB_YUV400) {
+            copy_out_plane(src_cb, recon_picture_buf->stride_cb, src_hbd,
+                           grain_cb, grain_chroma_stride, use_high_bit_depth,
+                           chroma_w, chroma_h, down_shift, 0);
+            copy_out_plane(src_cr, recon_picture_buf->stride_cr, src_hbd,
+                           grain_cr, grain_chroma_stride, use_high_bit_depth,
+                           chroma_w, chroma_h, down_shift, 0);
         }
-        } else {
-            uint16_t *pu2_dst;
-            uint16_t *pu2_src;
-
-            /* Luma */
-            pu2_dst = (uint16_t *)luma;
-            pu2_src = (uint16_t *)recon_picture_buf->buffer_y + recon_picture_buf->origin_x +
-                      (recon_picture_buf->origin_y * recon_picture_buf->stride_y);
-
-            for (i = 0; i < ht; i++) {
-                eb_memcpy(pu2_dst, pu2_src, sizeof(uint16_t) * wd);
-                pu2_dst += out_img->y_stride;
-                pu2_src += recon_picture_buf->stride_y;
-            }
 
-            if (recon_picture_buf->color_format != EB_YUV400) {
-                /* Cb */
-                pu2_dst = (uint16_t *)cb;
-                pu2_src = (uint16_t *)recon_picture_buf->buffer_cb +
-                          (recon_picture_buf->origin_x >> sx) +
-                          ((recon_picture_buf->origin_y >> sy) * recon_picture_buf->stride_cb);
-
-                for (i = 0; i < ((ht + sy) >> sy); i++) {
-                    eb_memcpy(pu2_dst, pu2_src, sizeof(uint16_t) * ((wd + sx) >> sx));
-                    pu2_dst += out_img->cb_stride;
-                    pu2_src += recon_picture_buf->stride_cb;
-                }
-
-                /* Cr */
-                pu2_dst = (uint16_t *)cr;
-                pu2_src = (uint16_t *)recon_picture_buf->buffer_cr +
-                          (recon_picture_buf->origin_x >> sx) +
-                          ((recon_picture_buf->origin_y >> sy) * recon_picture_buf->stride_cr);
-
-                for (i = 0; i < ((ht + sy) >> sy); i++) {
-                    eb_memcpy(pu2_dst, pu2_src, sizeof(uint16_t) * ((wd + sx) >> sx));
-                    pu2_dst += out_img->cr_stride;
-                    pu2_src += recon_picture_buf->stride_cr;
-                }
-            }
+        film_grain_ptr->bit_depth = (int)out_bit_depth;
+        copy_even(luma, wd, ht, out_img->y_stride, use_high_bit_depth);
+        eb_av1_add_film_grain_run(film_grain_ptr,
+                                  luma,
+                                  grain_cb,
+                                  grain_cr,
+                                  even_h,/*(ht & 1 ? ht + 1 : ht),*/
+                                  even_w,/*(wd & 1 ? wd + 1 : ht),*/
+                                  out_img->y_stride,
+                                  grain_chroma_stride,
+                                  use_high_bit_depth,
+                                  sy,
+                                  sx);
+
+        if (semi_planar) {
+            if (use_high_bit_depth)
+                eb_upshift_16bit((uint16_t *)luma, out_img->y_stride,
+                                 (uint16_t *)luma, out_img->y_stride, wd, ht, up_shift);
+            copy_out_uv(grain_cb, grain_cr, chroma_w, use_high_bit_depth,
+                        cb, out_img->cb_stride, use_high_bit_depth,
+                        chroma_w, chroma_h, 0, up_shift);
+            free(grain_cb);
+            free(grain_cr);
         }
+        return 1;
     }
 
-    if (!dec_handle_ptr->dec_config.skip_film_grain) {
-        /* Need to fill the dst buf with recon data before calling film_grain */
-        AomFilmGrain *film_grain_ptr = &dec_handle_ptr->cur_pic_buf[0]->film_grain_params;
-        if (film_grain_ptr->apply_grain) {
-            switch (recon_picture_buf->bit_depth) {
-            case EB_8BIT: film_grain_ptr->bit_depth = 8; break;
-            case EB_10BIT: film_grain_ptr->bit_depth = 10; break;
-            default: assert(0);
-            }
-            copy_even(luma, wd, ht, out_img->y_stride, use_high_bit_depth);
-            eb_av1_add_film_grain_run(film_grain_ptr,
-                                      luma,
-                                      cb,
-                                      cr,
-                                      even_h,/*(ht & 1 ? ht + 1 : ht),*/
-                                      even_w,/*(wd & 1 ? wd + 1 : ht),*/
-                                      out_img->y_stride,
-                                      out_img->cb_stride,
-                                      use_high_bit_depth,
-                                      sy,
-                                      sx);
-        }
+    copy_out_plane(src_y, recon_picture_buf->stride_y, src_hbd,
+                   luma, out_img->y_stride, use_high_bit_depth,
+                   wd, ht, down_shift, up_shift);
+    if (semi_planar) {
+        /* The planes come from the recon picture with equal strides */
+        ASSERT(recon_picture_buf->stride_cb == recon_picture_buf->stride_cr);
+        copy_out_uv(src_cb, src_cr, recon_picture_buf->stride_cb, src_hbd,
+                    cb, out_img->cb_stride, use_high_bit_depth,
+                    chroma_w, chroma_h, down_shift, up_shift);
+    } else if (recon_picture_buf->color_format != EB_YUV400) {
+        copy_out_plane(src_cb, recon_picture_buf->stride_cb, src_hbd,
+                       cb, out_img->cb_stride, use_high_bit_depth,
+                       chroma_w, chroma_h, down_shift, 0);
+        copy_out_plane(src_cr, recon_picture_buf->stride_cr, src_hbd,
+                       cr, out_img->cr_stride, use_high_bit_depth,
+                       chroma_w, chroma_h, down_shift, 0);
     }
 
     return 1;
@@ -415,6 +521,7 @@ EbErrorType eb_svt_dec_set_default_parameter(EbSvtAv1DecConfiguration *config_pt
     config_ptr->frames_to_be_decoded      = 0;
     config_ptr->compressed_ten_bit_format = 0;
     config_ptr->eight_bit_output          = 0;
+    config_ptr->semi_planar_output        = 0;
 
     /* Picture parameters */
     config_ptr->max_picture_width  = 0;
@@ -564,6 +671,25 @@ svt_av1_dec_init(EbComponentType *svt_dec_component) {
     return return_error;
 }
 
+EB_API EbErrorType
+svt_av1_dec_set_frame_buffer_functions(EbComponentType *svt_dec_component,
+                                       EbAllocateFrameBuffer alloc_fb,
+                                       EbReleaseFrameBuffer release_fb, void *fb_priv) {
+    if (svt_dec_component == NULL || alloc_fb == NULL || release_fb == NULL)
+        return EB_ErrorBadParameter;
+
+    EbDecHandle *dec_handle_ptr = (EbDecHandle *)svt_dec_component->p_component_private;
+
+    /* Picture buffers already allocated by the decoder can not be swapped */
+    if (dec_handle_ptr->mem_init_done) return EB_ErrorBadParameter;
+
+    dec_handle_ptr->alloc_ext_fb   = alloc_fb;
+    dec_handle_ptr->release_ext_fb = release_fb;
+    dec_handle_ptr->ext_fb_priv    = fb_priv;
+
+    return EB_ErrorNone;
+}
+
 EB_API EbErrorType
 svt_av1_dec_frame(EbComponentType *svt_dec_component, const uint8_t *data, const size_t data_size,
                     uint32_t is_annexb) {
@@ -575,6 +701,9 @@ svt_av1_dec_frame(EbComponentType *svt_dec_component, const uint8_t *data, const
     uint8_t *    data_end             = (uint8_t *)data + data_size;
     dec_handle_ptr->seen_frame_header = 0;
 
+    /* The previous output picture is no longer accessible */
+    if (dec_handle_ptr->alloc_ext_fb) dec_pic_mgr_release_output_pic(dec_handle_ptr);
+
     while (data_start < data_end) {
         /*TODO : Remove or move. For Test purpose only */
         dec_handle_ptr->dec_cnt++;
@@ -584,8 +713,12 @@ svt_av1_dec_frame(EbComponentType *svt_dec_component, const uint8_t *data, const
         frame_size          = data_end - data_start;
         return_error = decode_multiple_obu(dec_handle_ptr, &data_start, frame_size, is_annexb);
 
+        /* Out of frame buffers: the frame is dropped, the references are kept */
+        if (return_error == EB_ErrorInsufficientResources) return return_error;
         if (return_error != EB_ErrorNone) assert(0);
 
+        if (dec_handle_ptr->alloc_ext_fb) dec_pic_mgr_hold_output_pic(dec_handle_ptr);
+
         dec_pic_mgr_update_ref_pic(dec_handle_ptr,
                                    (EB_ErrorNone == return_error) ? 1 : 0,
                                    dec_handle_ptr->frame_header.refresh_frame_flags);
@@ -607,18 +740,129 @@ svt_av1_dec_frame(EbComponentType *svt_dec_component, const uint8_t *data, const
     return return_error;
 }
 
+/* Appends data_size bytes to the feed buffer. Tile data of a frame in
+   progress is referenced in place, so the buffer is only compacted between
+   frames and those references follow it when it moves */
+static EbErrorType dec_feed_append(EbDecHandle *dec_handle_ptr, const uint8_t *data,
+                                   size_t data_size) {
+    const int frame_in_progress = dec_handle_ptr->seen_frame_header;
+
+    if (!frame_in_progress && dec_handle_ptr->feed_pos) {
+        dec_handle_ptr->feed_size -= dec_handle_ptr->feed_pos;
+        memmove(dec_handle_ptr->feed_buf,
+                dec_handle_ptr->feed_buf + dec_handle_ptr->feed_pos,
+                dec_handle_ptr->feed_size);
+        dec_handle_ptr->feed_pos = 0;
+    }
+    if (dec_handle_ptr->feed_size + data_size > dec_handle_ptr->feed_capacity) {
+        size_t capacity = dec_handle_ptr->feed_capacity ? dec_handle_ptr->feed_capacity : 4096;
+        while (capacity < dec_handle_ptr->feed_size + data_size) capacity *= 2;
+        uint8_t *buf = (uint8_t *)malloc(capacity);
+        if (buf == NULL) return EB_ErrorInsufficientResources;
+        if (dec_handle_ptr->feed_size)
+            memcpy(buf, dec_handle_ptr->feed_buf, dec_handle_ptr->feed_size);
+
+        MasterParseCtxt *master_parse_ctxt =
+            (MasterParseCtxt *)dec_handle_ptr->pv_master_parse_ctxt;
+        if (frame_in_progress && master_parse_ctxt && master_parse_ctxt->parse_tile_data) {
+            const uintptr_t old_start = (uintptr_t)dec_handle_ptr->feed_buf;
+            const uintptr_t old_end   = old_start + dec_handle_ptr->feed_size;
+            TilesInfo *     tiles_info = &dec_handle_ptr->frame_header.tiles_info;
+            const int       num_tiles  = tiles_info->tile_cols * tiles_info->tile_rows;
+            for (int i = 0; i < num_tiles; i++) {
+                ParseTileData *tile_data = &master_parse_ctxt->parse_tile_data[i];
+                if ((uintptr_t)tile_data->data < old_start ||
+                    (uintptr_t)tile_data->data >= old_end)
+                    continue;
+                tile_data->data     = buf + ((uintptr_t)tile_data->data - old_start);
+                tile_data->data_end = buf + ((uintptr_t)tile_data->data_end - old_start);
+            }
+        }
+        free(dec_handle_ptr->feed_buf);
+        dec_handle_ptr->feed_buf      = buf;
+        dec_handle_ptr->feed_capacity = capacity;
+    }
+    if (data_size) memcpy(dec_handle_ptr->feed_buf + dec_handle_ptr->feed_size, data, data_size);
+    dec_handle_ptr->feed_size += data_size;
+    return EB_ErrorNone;
+}
+
+EB_API EbErrorType
+svt_av1_dec_feed(EbComponentType *svt_dec_component, const uint8_t *data, const size_t data_size,
+                 uint32_t is_annexb) {
+    if (svt_dec_component == NULL || (data == NULL && data_size)) return EB_ErrorBadParameter;
+
+    EbDecHandle *dec_handle_ptr = (EbDecHandle *)svt_dec_component->p_component_private;
+    EbErrorType  return_error;
+
+    /* The previous output picture is no longer accessible */
+    if (dec_handle_ptr->alloc_ext_fb) dec_pic_mgr_release_output_pic(dec_handle_ptr);
+    dec_handle_ptr->feed_pic_ready = EB_FALSE;
+
+    return_error = dec_feed_append(dec_handle_ptr, data, data_size);
+    if (return_error != EB_ErrorNone) return return_error;
+
+    for (;;) {
+        uint8_t *obu       = dec_handle_ptr->feed_buf + dec_handle_ptr->feed_pos;
+        size_t   available = dec_handle_ptr->feed_size - dec_handle_ptr->feed_pos;
+        size_t   obu_size;
+        int      frame_decoding_finished = 0;
+
+        // Allow extra zero bytes between frames
+        if (available && !obu[0]) {
+            dec_handle_ptr->feed_pos++;
+            continue;
+        }
+
+        return_error = peek_obu_size(obu, available, is_annexb, &obu_size);
+        if (return_error != EB_ErrorNone) return return_error;
+        if (!obu_size) return EB_DecNoOutputPicture; // wait for the rest of the OBU
+
+        const uint8_t seen_frame_header = dec_handle_ptr->seen_frame_header;
+        return_error =
+            decode_obu(dec_handle_ptr, &obu, &obu_size, is_annexb, &frame_decoding_finished);
+        if (return_error != EB_ErrorNone) return return_error;
+        dec_handle_ptr->feed_pos = obu - dec_handle_ptr->feed_buf;
+
+        /* A shown existing frame is complete with its frame header */
+        if (!seen_frame_header && dec_handle_ptr->seen_frame_header &&
+            dec_handle_ptr->show_existing_frame) {
+            dec_handle_ptr->seen_frame_header = 0;
+            frame_decoding_finished           = 1;
+        }
+        if (!frame_decoding_finished) continue;
+
+        if (dec_handle_ptr->alloc_ext_fb) dec_pic_mgr_hold_output_pic(dec_handle_ptr);
+
+        dec_pic_mgr_update_ref_pic(
+            dec_handle_ptr, 1, dec_handle_ptr->frame_header.refresh_frame_flags);
+
+        if (dec_handle_ptr->show_frame) {
+            dec_handle_ptr->feed_pic_ready = EB_TRUE;
+            return EB_ErrorNone;
+        }
+    }
+}
+
 EB_API EbErrorType
 svt_av1_dec_get_picture(EbComponentType *svt_dec_component, EbBufferHeaderType *p_buffer,
                        EbAV1StreamInfo *stream_info, EbAV1FrameInfo *frame_info) {
     (void)stream_info;
-    (void)frame_info;
 
     EbErrorType return_error = EB_ErrorNone;
     if (svt_dec_component == NULL) return EB_ErrorBadParameter;
 
     EbDecHandle *dec_handle_ptr = (EbDecHandle *)svt_dec_component->p_component_private;
+    /* Only a frame completed by the last svt_av1_dec_feed() call is output */
+    if (dec_handle_ptr->feed_buf && !dec_handle_ptr->feed_pic_ready)
+        return EB_DecNoOutputPicture;
     /* Copy from recon pointer and return! TODO: Should remove the eb_memcpy! */
     if (0 == svt_dec_out_buf(dec_handle_ptr, p_buffer)) return_error = EB_DecNoOutputPicture;
+    if (frame_info)
+        frame_info->ext_frame_buf = (EbSvtIOFormat *)p_buffer->p_buffer ==
+                                            dec_handle_ptr->ext_fb_out_img
+                                        ? EB_TRUE
+                                        : EB_FALSE;
     return return_error;
 }
 
@@ -630,6 +874,8 @@ svt_av1_dec_deinit(EbComponentType *svt_dec_component) {
 
     if (dec_handle_ptr) {
         if (dec_handle_ptr->dec_config.threads > 1) dec_sync_all_threads(dec_handle_ptr);
+        if (dec_handle_ptr->alloc_ext_fb) dec_pic_mgr_release_ext_frame_bufs(dec_handle_ptr);
+        free(dec_handle_ptr->feed_buf);
         if (svt_dec_memory_map) {
             // Loop through the ptr table and free all malloc'd pointers per channel
             EbMemoryMapEntry *memory_entry = svt_dec_memory_map;
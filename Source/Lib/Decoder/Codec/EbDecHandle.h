@@ -65,6 +65,10 @@ typedef struct EbDecPicBuf {
 
     EbPictureBufferDesc *ps_pic_buf;
 
+    /* Application owned backing memory of ps_pic_buf,
+       when external frame buffers are in use */
+    EbExtFrameBuf ext_fb;
+
     FRAME_CONTEXT final_frm_ctx;
 
     GlobalMotionParams global_motion[REF_FRAMES];
@@ -226,6 +230,25 @@ typedef struct EbDecHandle {
     EbDecPicBuf *cur_pic_buf[DEC_MAX_NUM_FRM_PRLL];
 
     // Callbacks
+    EbAllocateFrameBuffer alloc_ext_fb;
+    EbReleaseFrameBuffer  release_ext_fb;
+    void *                ext_fb_priv;
+
+    /* Picture held for output until the next decode or get_picture call,
+       when external frame buffers are in use */
+    EbDecPicBuf *out_pic_buf;
+    /* Output image whose planes point into the external frame buffer of
+       out_pic_buf, NULL when the planes are owned by the application */
+    EbSvtIOFormat *ext_fb_out_img;
+
+    /* Data received by svt_av1_dec_feed(), feed_pos bytes of it decoded.
+       Tiles of a frame still in progress may point into feed_buf */
+    uint8_t *feed_buf;
+    size_t   feed_size;
+    size_t   feed_pos;
+    size_t   feed_capacity;
+    /* A shown frame was completed by the last svt_av1_dec_feed() call */
+    EbBool feed_pic_ready;
 
     //DPB + MV, ... buf
 
@@ -1773,8 +1773,8 @@ static void check_mt_support(EbDecHandle *dec_handle_ptr) {
     }
 }
 
-void read_uncompressed_header(Bitstrm *bs, EbDecHandle *dec_handle_ptr, ObuHeader *obu_header,
-                              int num_planes) {
+EbErrorType read_uncompressed_header(Bitstrm *bs, EbDecHandle *dec_handle_ptr,
+                                     ObuHeader *obu_header, int num_planes) {
     SeqHeader *  seq_header = &dec_handle_ptr->seq_header;
     FrameHeader *frame_info = &dec_handle_ptr->frame_header;
     int          id_len = 0, all_frames, frame_is_intra = 0, i, frame_size_override_flag = 0;
@@ -1813,7 +1813,7 @@ void read_uncompressed_header(Bitstrm *bs, EbDecHandle *dec_handle_ptr, ObuHeade
                 PRINT_FRAME("display_frame_id", display_frame_id);
                 if (display_frame_id != frame_info->ref_frame_idx[frame_to_show_map_idx] &&
                     frame_info->ref_valid[frame_to_show_map_idx] == 1)
-                    return; // EB_Corrupt_Frame;
+                    return EB_ErrorNone; // EB_Corrupt_Frame;
             }
 
             dec_handle_ptr->cur_pic_buf[0] = dec_handle_ptr->ref_frame_map[frame_to_show_map_idx];
@@ -1836,7 +1836,7 @@ void read_uncompressed_header(Bitstrm *bs, EbDecHandle *dec_handle_ptr, ObuHeade
             dec_handle_ptr->show_existing_frame = frame_info->show_existing_frame;
             dec_handle_ptr->show_frame          = frame_info->show_frame;
             dec_handle_ptr->showable_frame      = frame_info->showable_frame;
-            return;
+            return EB_ErrorNone;
         }
 
         frame_info->frame_type = dec_get_bits(bs, 2);
@@ -1903,7 +1903,7 @@ void read_uncompressed_header(Bitstrm *bs, EbDecHandle *dec_handle_ptr, ObuHeade
             }
             // Bitstream conformance
             if (frame_info->current_frame_id == prev_frame_id || diff_frame_id >= 1 << (id_len - 1))
-                return; // EB_Corrupt_Frame;
+                return EB_ErrorNone; // EB_Corrupt_Frame;
         }
 
         //mark_ref_frames( id_len )
@@ -2033,7 +2033,7 @@ void read_uncompressed_header(Bitstrm *bs, EbDecHandle *dec_handle_ptr, ObuHeade
                     (1 << id_len));
                 if (expected_frame_id != frame_info->ref_frame_id[ref_frm_id]) {
                     assert(0);
-                    return; // EB_Corrupt_Frame;
+                    return EB_ErrorNone; // EB_Corrupt_Frame;
                 }
             }
         }
@@ -2095,6 +2095,8 @@ void read_uncompressed_header(Bitstrm *bs, EbDecHandle *dec_handle_ptr, ObuHeade
 
     dec_handle_ptr->cur_pic_buf[0] =
         dec_pic_mgr_get_cur_pic(dec_handle_ptr);
+    /* No frame buffer left, or the application refused an external one */
+    if (dec_handle_ptr->cur_pic_buf[0] == NULL) return EB_ErrorInsufficientResources;
 
     svt_setup_frame_buf_refs(dec_handle_ptr);
     /*Temporal MVs allocation */
@@ -2219,6 +2221,7 @@ void read_uncompressed_header(Bitstrm *bs, EbDecHandle *dec_handle_ptr, ObuHeade
         if (!frame_info->show_existing_frame)
             svt_setup_motion_field(dec_handle_ptr, NULL);
     }
+    return EB_ErrorNone;
 }
 
 EbErrorType read_frame_header_obu(Bitstrm *bs, EbDecHandle *dec_handle_ptr, ObuHeader *obu_header,
@@ -2229,7 +2232,8 @@ EbErrorType read_frame_header_obu(Bitstrm *bs, EbDecHandle *dec_handle_ptr, ObuH
     uint32_t start_position, end_position, header_bytes;
 
     start_position = get_position(bs);
-    read_uncompressed_header(bs, dec_handle_ptr, obu_header, num_planes);
+    status         = read_uncompressed_header(bs, dec_handle_ptr, obu_header, num_planes);
+    if (status != EB_ErrorNone) return status;
 
     if (allow_intrabc(dec_handle_ptr)) {
         eb_av1_setup_scale_factors_for_frame(&dec_handle_ptr->sf_identity,
@@ -2518,19 +2522,156 @@ EbErrorType read_tile_group_obu(Bitstrm *bs, EbDecHandle *dec_handle_ptr, TilesI
     return status;
 }
 
-EbErrorType decode_obu(EbDecHandle *dec_handle_ptr, unsigned char *data, unsigned int data_size) {
-    (void)dec_handle_ptr;
-    (void)data;
-    (void)data_size;
-    return 0;
+/* Decodes the OBU at *data and moves *data past it. *frame_decoding_finished
+ * is set when it is the last tile group of a frame. */
+EbErrorType decode_obu(EbDecHandle *dec_handle_ptr, uint8_t **data, size_t *data_size,
+                       uint32_t is_annexb, int *frame_decoding_finished) {
+    Bitstrm     bs;
+    EbErrorType status = EB_ErrorNone;
+    ObuHeader   obu_header;
+
+    size_t payload_size = 0, length_size = 0;
+
+    /* Decoder memory init if not done */
+    if (0 == dec_handle_ptr->mem_init_done && 1 == dec_handle_ptr->seq_header_done)
+        status = dec_mem_init(dec_handle_ptr);
+    if (status != EB_ErrorNone) return status;
+
+    dec_bits_init(&bs, *data, *data_size);
+
+    if (is_annexb) {
+        // read the size of OBU
+        status = read_obu_size(&bs, *data_size, &obu_header.payload_size, &length_size);
+        if (status != EB_ErrorNone) return status;
+
+        *data += length_size;
+        *data_size -= length_size;
+        length_size = 0;
+    }
+
+    status = read_obu_header_size(&bs, &obu_header, *data_size, &length_size);
+    if (status != EB_ErrorNone) return status;
+
+    if (is_annexb) obu_header.payload_size -= obu_header.size;
+
+    payload_size = obu_header.payload_size;
+
+    *data += (obu_header.size + length_size);
+    *data_size -= (obu_header.size + length_size);
+
+    if (*data_size < payload_size) return EB_Corrupt_Frame;
+
+    dec_bits_init(&bs, *data, payload_size);
+
+    switch (obu_header.obu_type) {
+    case OBU_TEMPORAL_DELIMITER:
+        PRINT_NAME("**************OBU_TEMPORAL_DELIMITER*******************");
+        read_temporal_delimitor_obu(&dec_handle_ptr->seen_frame_header);
+        break;
+
+    case OBU_SEQUENCE_HEADER: {
+        PRINT_NAME("**************OBU_SEQUENCE_HEADER*******************")
+        BlockSize prev_sb_size          = dec_handle_ptr->seq_header.sb_size;
+        uint16_t  prev_max_frame_width  = dec_handle_ptr->seq_header.max_frame_width;
+        uint16_t  prev_max_frame_height = dec_handle_ptr->seq_header.max_frame_height;
+
+        status = read_sequence_header_obu(&bs, &dec_handle_ptr->seq_header);
+        if (status != EB_ErrorNone) return status;
+        if (dec_handle_ptr->seq_header.color_config.bit_depth == EB_TWELVE_BIT)
+            dec_init_intra_predictors_12b_internal();
+        dec_handle_ptr->seq_header_done = 1;
+        if (prev_sb_size != dec_handle_ptr->seq_header.sb_size ||
+            prev_max_frame_width != dec_handle_ptr->seq_header.max_frame_width ||
+            prev_max_frame_height != dec_handle_ptr->seq_header.max_frame_height) {
+            dec_handle_ptr->mem_init_done = 0;
+        }
+        break;
+    }
+    case OBU_FRAME_HEADER:
+    case OBU_REDUNDANT_FRAME_HEADER:
+    case OBU_FRAME:
+        if (obu_header.obu_type == OBU_FRAME) {
+            PRINT_NAME("**************OBU_FRAME*******************");
+            dec_handle_ptr->show_existing_frame = 0;
+        } else if (obu_header.obu_type == OBU_FRAME_HEADER) {
+            PRINT_NAME("**************OBU_FRAME_HEADER*******************");
+            assert(dec_handle_ptr->seen_frame_header == 0);
+        } else {
+            PRINT_NAME("**************OBU_REDUNDANT_FRAME_HEADER*******************");
+            assert(dec_handle_ptr->seen_frame_header == 1);
+        }
+
+        if (!dec_handle_ptr->seen_frame_header) {
+            dec_handle_ptr->seen_frame_header = 1;
+            status                            = read_frame_header_obu(
+                &bs, dec_handle_ptr, &obu_header, obu_header.obu_type != OBU_FRAME);
+            if (status != EB_ErrorNone) {
+                dec_handle_ptr->seen_frame_header = 0;
+                return status;
+            }
+        }
+        /*else {
+             For OBU_REDUNDANT_FRAME_HEADER, previous frame_header is taken from dec_handle_ptr->frame_header
+            //frame_header_copy(); TODO()
+        }*/
+
+        if (obu_header.obu_type != OBU_FRAME) break; // For OBU_TILE_GROUP comes under OBU_FRAME
+        goto TITLE_GROUP;
+
+    case OBU_TILE_GROUP:
+    TITLE_GROUP:
+        PRINT_NAME("**************OBU_TILE_GROUP*******************");
+        if (!dec_handle_ptr->seen_frame_header) return EB_Corrupt_Frame;
+        status = read_tile_group_obu(&bs,
+                                     dec_handle_ptr,
+                                     &dec_handle_ptr->frame_header.tiles_info,
+                                     &obu_header,
+                                     frame_decoding_finished);
+        if (status != EB_ErrorNone) return status;
+        if (*frame_decoding_finished) dec_handle_ptr->seen_frame_header = 0;
+        break;
+
+    default: PRINT_NAME("**************UNKNOWN OBU*******************"); break;
+    }
+
+    *data += payload_size;
+    *data_size -= payload_size;
+    return status;
+}
+
+/* Size of the OBU at data, including the OBU header and size fields (or the
+ * obu_length field with Annex B), 0 while data does not hold all of it yet */
+EbErrorType peek_obu_size(const uint8_t *data, size_t data_size, uint32_t is_annexb,
+                          size_t *obu_size) {
+    size_t pos = 0, value = 0;
+
+    *obu_size = 0;
+    if (!is_annexb) {
+        if (!data_size) return EB_ErrorNone;
+        // obu_extension_flag, obu_has_size_field
+        const uint8_t extension_flag = (data[0] >> 2) & 1;
+        const uint8_t has_size_field = (data[0] >> 1) & 1;
+        // without a size field the OBU ends with the data, which can not be told apart
+        // from a partial OBU when data comes in pieces
+        if (!has_size_field) return EB_DecUnsupportedBitstream;
+        pos = 1 + extension_flag;
+    }
+    for (int i = 0; i < 8; i++) {
+        if (pos >= data_size) return EB_ErrorNone;
+        const uint8_t leb128_byte = data[pos++];
+        value |= ((size_t)(leb128_byte & 0x7f)) << (i * 7);
+        if (!(leb128_byte & 0x80)) break;
+        if (i == 7) return EB_Corrupt_Frame;
+    }
+    if (value > UINT32_MAX) return EB_Corrupt_Frame;
+    if (data_size - pos >= value) *obu_size = pos + value;
+    return EB_ErrorNone;
 }
 
 // Decode all OBUs in a Frame
 EbErrorType decode_multiple_obu(EbDecHandle *dec_handle_ptr, uint8_t **data, size_t data_size,
                                 uint32_t is_annexb) {
-    Bitstrm   bs;
     EbErrorType status = EB_ErrorNone;
-    ObuHeader   obu_header;
     int         frame_decoding_finished = 0;
 
 #if ENABLE_ENTROPY_TRACE
@@ -2547,108 +2688,8 @@ EbErrorType decode_multiple_obu(EbDecHandle *dec_handle_ptr, uint8_t **data, siz
 #endif
 
     while (!frame_decoding_finished) {
-        size_t payload_size = 0, length_size = 0;
-
-        /* Decoder memory init if not done */
-        if (0 == dec_handle_ptr->mem_init_done && 1 == dec_handle_ptr->seq_header_done)
-            status = dec_mem_init(dec_handle_ptr);
+        status = decode_obu(dec_handle_ptr, data, &data_size, is_annexb, &frame_decoding_finished);
         if (status != EB_ErrorNone) return status;
-
-        dec_bits_init(&bs, *data, data_size);
-
-        if (is_annexb) {
-            // read the size of OBU
-            status = read_obu_size(&bs, data_size, &obu_header.payload_size, &length_size);
-            if (status != EB_ErrorNone) return status;
-
-            *data += length_size;
-            data_size -= length_size;
-            length_size = 0;
-        }
-
-        status = read_obu_header_size(&bs, &obu_header, data_size, &length_size);
-        if (status != EB_ErrorNone) return status;
-
-        if (is_annexb) obu_header.payload_size -= obu_header.size;
-
-        payload_size = obu_header.payload_size;
-
-        *data += (obu_header.size + length_size);
-        data_size -= (obu_header.size + length_size);
-
-        if (data_size < payload_size) return EB_Corrupt_Frame;
-
-        dec_bits_init(&bs, *data, payload_size);
-
-        switch (obu_header.obu_type) {
-        case OBU_TEMPORAL_DELIMITER:
-            PRINT_NAME("**************OBU_TEMPORAL_DELIMITER*******************");
-            read_temporal_delimitor_obu(&dec_handle_ptr->seen_frame_header);
-            break;
-
-        case OBU_SEQUENCE_HEADER: {
-            PRINT_NAME("**************OBU_SEQUENCE_HEADER*******************")
-            BlockSize prev_sb_size          = dec_handle_ptr->seq_header.sb_size;
-            uint16_t  prev_max_frame_width  = dec_handle_ptr->seq_header.max_frame_width;
-            uint16_t  prev_max_frame_height = dec_handle_ptr->seq_header.max_frame_height;
-
-            status = read_sequence_header_obu(&bs, &dec_handle_ptr->seq_header);
-            if (status != EB_ErrorNone) return status;
-            if (dec_handle_ptr->seq_header.color_config.bit_depth == EB_TWELVE_BIT)
-                dec_init_intra_predictors_12b_internal();
-            dec_handle_ptr->seq_header_done = 1;
-            if (prev_sb_size != dec_handle_ptr->seq_header.sb_size ||
-                prev_max_frame_width != dec_handle_ptr->seq_header.max_frame_width ||
-                prev_max_frame_height != dec_handle_ptr->seq_header.max_frame_height) {
-                dec_handle_ptr->mem_init_done = 0;
-            }
-            break;
-        }
-        case OBU_FRAME_HEADER:
-        case OBU_REDUNDANT_FRAME_HEADER:
-        case OBU_FRAME:
-            if (obu_header.obu_type == OBU_FRAME) {
-                PRINT_NAME("**************OBU_FRAME*******************");
-                dec_handle_ptr->show_existing_frame = 0;
-            } else if (obu_header.obu_type == OBU_FRAME_HEADER) {
-                PRINT_NAME("**************OBU_FRAME_HEADER*******************");
-                assert(dec_handle_ptr->seen_frame_header == 0);
-            } else {
-                PRINT_NAME("**************OBU_REDUNDANT_FRAME_HEADER*******************");
-                assert(dec_handle_ptr->seen_frame_header == 1);
-            }
-
-            if (!dec_handle_ptr->seen_frame_header) {
-                dec_handle_ptr->seen_frame_header = 1;
-                status                            = read_frame_header_obu(
-                    &bs, dec_handle_ptr, &obu_header, obu_header.obu_type != OBU_FRAME);
-            }
-            /*else {
-                 For OBU_REDUNDANT_FRAME_HEADER, previous frame_header is taken from dec_handle_ptr->frame_header
-                //frame_header_copy(); TODO()
-            }*/
-
-            if (obu_header.obu_type != OBU_FRAME) break; // For OBU_TILE_GROUP comes under OBU_FRAME
-            goto TITLE_GROUP;
-
-        case OBU_TILE_GROUP:
-        TITLE_GROUP:
-            PRINT_NAME("**************OBU_TILE_GROUP*******************");
-            if (!dec_handle_ptr->seen_frame_header) return EB_Corrupt_Frame;
-            status = read_tile_group_obu(&bs,
-                                         dec_handle_ptr,
-                                         &dec_handle_ptr->frame_header.tiles_info,
-                                         &obu_header,
-                                         &frame_decoding_finished);
-            if (status != EB_ErrorNone) return status;
-            if (frame_decoding_finished) dec_handle_ptr->seen_frame_header = 0;
-            break;
-
-        default: PRINT_NAME("**************UNKNOWN OBU*******************"); break;
-        }
-
-        *data += payload_size;
-        data_size -= payload_size;
         if (!data_size) frame_decoding_finished = 1;
     }
 
@@ -62,6 +62,9 @@ EbErrorType dec_pic_mgr_init(EbDecHandle *dec_handle_ptr) {
     EbErrorType return_error = EB_ErrorNone;
     int32_t     i;
 
+    /* Buffers of the previous sequence are not used anymore */
+    dec_pic_mgr_release_ext_frame_bufs(dec_handle_ptr);
+
     EB_MALLOC_DEC(void *, *pps_pic_mgr, sizeof(EbDecPicMgr), EB_N_PTR);
 
     EbDecPicMgr *ps_pic_mgr = *pps_pic_mgr;
@@ -72,6 +75,9 @@ EbErrorType dec_pic_mgr_init(EbDecHandle *dec_handle_ptr) {
         ps_pic_mgr->as_dec_pic[i].size       = 0;
         ps_pic_mgr->as_dec_pic[i].ref_count  = 0;
         ps_pic_mgr->as_dec_pic[i].mvs        = NULL;
+        ps_pic_mgr->as_dec_pic[i].ext_fb.buffer       = NULL;
+        ps_pic_mgr->as_dec_pic[i].ext_fb.buffer_size  = 0;
+        ps_pic_mgr->as_dec_pic[i].ext_fb.private_data = NULL;
         EB_MALLOC_DEC(
             uint8_t *, ps_pic_mgr->as_dec_pic[i].segment_maps, size * sizeof(uint8_t), EB_N_PTR);
         memset(ps_pic_mgr->as_dec_pic[i].segment_maps, 0, size);
@@ -92,6 +98,50 @@ static INLINE EbErrorType mvs_8x8_memory_alloc(TemporalMvRef **mvs, FrameHeader
     return EB_ErrorNone;
 }
 
+/* Offset of a plane inside an external frame buffer, kept 64 byte aligned */
+#define EXT_FB_PLANE_ALIGN(size) (((size) + 63) & ~(size_t)63)
+
+/* Gets a frame buffer from the application and points the
+   picture descriptor planes into it */
+static EbErrorType dec_pic_mgr_get_ext_frame_buf(EbDecHandle *dec_handle_ptr,
+                                                 EbDecPicBuf *pic_buf) {
+    EbPictureBufferDesc *ps_pic_buf = pic_buf->ps_pic_buf;
+    EbExtFrameBuf *      ext_fb     = &pic_buf->ext_fb;
+    const uint32_t       bytes_per_pixel =
+        (ps_pic_buf->bit_depth > EB_8BIT || ps_pic_buf->is_16bit_pipeline) ? 2 : 1;
+    const size_t luma_size   = EXT_FB_PLANE_ALIGN(ps_pic_buf->luma_size * bytes_per_pixel);
+    const size_t chroma_size = (ps_pic_buf->color_format == EB_YUV400)
+        ? 0
+        : EXT_FB_PLANE_ALIGN(ps_pic_buf->chroma_size * bytes_per_pixel);
+    const size_t min_size = luma_size + 2 * chroma_size;
+
+    assert(ext_fb->buffer == NULL);
+    if (dec_handle_ptr->alloc_ext_fb(ext_fb, (uint32_t)min_size, dec_handle_ptr->ext_fb_priv) ||
+        ext_fb->buffer == NULL || ext_fb->buffer_size < min_size) {
+        ext_fb->buffer = NULL;
+        return EB_ErrorInsufficientResources;
+    }
+
+    ps_pic_buf->buffer_y = ext_fb->buffer;
+    if (chroma_size) {
+        ps_pic_buf->buffer_cb = ext_fb->buffer + luma_size;
+        ps_pic_buf->buffer_cr = ext_fb->buffer + luma_size + chroma_size;
+    }
+    return EB_ErrorNone;
+}
+
+/* Returns the frame buffer backing the picture to the application */
+static void dec_pic_mgr_release_ext_frame_buf(EbDecHandle *dec_handle_ptr,
+                                              EbDecPicBuf *pic_buf) {
+    if (pic_buf->ext_fb.buffer == NULL) return;
+
+    dec_handle_ptr->release_ext_fb(&pic_buf->ext_fb, dec_handle_ptr->ext_fb_priv);
+    pic_buf->ext_fb.buffer       = NULL;
+    pic_buf->ps_pic_buf->buffer_y  = NULL;
+    pic_buf->ps_pic_buf->buffer_cb = NULL;
+    pic_buf->ps_pic_buf->buffer_cr = NULL;
+}
+
 /**
 *******************************************************************************
 *
@@ -137,6 +187,8 @@ EbDecPicBuf *dec_pic_mgr_get_cur_pic(EbDecHandle *dec_handle_ptr) {
                       ((frame_height + 2 * DEC_PAD_VALUE) >> cc->subsampling_y));
     size_t frame_size = y_size + uv_size;
 
+    EbBool use_ext_fb = dec_handle_ptr->alloc_ext_fb != NULL;
+
     if (ps_pic_mgr->as_dec_pic[i].size < frame_size) {
         /* allocate the buffer. TODO: Should add free and allocate logic */
 
@@ -147,8 +199,11 @@ EbDecPicBuf *dec_pic_mgr_get_cur_pic(EbDecHandle *dec_handle_ptr) {
         input_pic_buf_desc_init_data.bit_depth  = (EbBitDepthEnum)cc->bit_depth;
         assert(IMPLIES(cc->mono_chrome, color_format == EB_YUV400));
         input_pic_buf_desc_init_data.color_format = cc->mono_chrome ? EB_YUV400 : color_format;
-        input_pic_buf_desc_init_data.buffer_enable_mask =
-            cc->mono_chrome ? PICTURE_BUFFER_DESC_LUMA_MASK : PICTURE_BUFFER_DESC_FULL_MASK;
+        /* With external frame buffers only the descriptor is created here,
+           the planes are attached for every new frame below */
+        input_pic_buf_desc_init_data.buffer_enable_mask = use_ext_fb
+            ? 0
+            : cc->mono_chrome ? PICTURE_BUFFER_DESC_LUMA_MASK : PICTURE_BUFFER_DESC_FULL_MASK;
 
         input_pic_buf_desc_init_data.left_padding  = DEC_PAD_VALUE;
         input_pic_buf_desc_init_data.right_padding = DEC_PAD_VALUE;
@@ -174,6 +229,10 @@ EbDecPicBuf *dec_pic_mgr_get_cur_pic(EbDecHandle *dec_handle_ptr) {
     } else
         assert(ps_pic_mgr->as_dec_pic[i].ps_pic_buf != NULL);
 
+    if (use_ext_fb &&
+        dec_pic_mgr_get_ext_frame_buf(dec_handle_ptr, &ps_pic_mgr->as_dec_pic[i]) != EB_ErrorNone)
+        return NULL;
+
     ps_pic_mgr->as_dec_pic[i].is_free   = 0;
     ps_pic_mgr->as_dec_pic[i].ref_count = 1;
 
@@ -182,12 +241,65 @@ EbDecPicBuf *dec_pic_mgr_get_cur_pic(EbDecHandle *dec_handle_ptr) {
     return pic_buf;
 }
 
-static INLINE void dec_ref_count_and_rel(EbDecPicBuf *ps_pic_buf) {
+static INLINE void dec_ref_count_and_rel(EbDecHandle *dec_handle_ptr, EbDecPicBuf *ps_pic_buf) {
     if (ps_pic_buf != NULL) {
         ps_pic_buf->ref_count--;
         assert(ps_pic_buf->ref_count >= 0);
 
-        if (ps_pic_buf->ref_count == 0) ps_pic_buf->is_free = 1;
+        if (ps_pic_buf->ref_count == 0) {
+            ps_pic_buf->is_free = 1;
+            dec_pic_mgr_release_ext_frame_buf(dec_handle_ptr, ps_pic_buf);
+        }
+    }
+}
+
+/**
+*******************************************************************************
+*
+* @brief
+*  Hold Output Picture
+*
+* @par Description:
+*  Keeps a reference on the current picture, when it is shown, until the next
+*  call so that it can be returned from an external frame buffer without a
+*  copy. The previously held picture is released.
+*
+* @param[in] dec_handle_ptr
+*  Pointer to the decoder handle
+*
+* @returns
+*
+* @remarks
+*  Only used with external frame buffers
+*
+*******************************************************************************
+*/
+void dec_pic_mgr_hold_output_pic(EbDecHandle *dec_handle_ptr) {
+    dec_pic_mgr_release_output_pic(dec_handle_ptr);
+
+    if (dec_handle_ptr->show_frame && dec_handle_ptr->cur_pic_buf[0] != NULL) {
+        dec_handle_ptr->out_pic_buf = dec_handle_ptr->cur_pic_buf[0];
+        dec_handle_ptr->out_pic_buf->ref_count++;
+    }
+}
+
+void dec_pic_mgr_release_output_pic(EbDecHandle *dec_handle_ptr) {
+    dec_ref_count_and_rel(dec_handle_ptr, dec_handle_ptr->out_pic_buf);
+    dec_handle_ptr->out_pic_buf = NULL;
+}
+
+/* Returns all external frame buffers still held by the decoder */
+void dec_pic_mgr_release_ext_frame_bufs(EbDecHandle *dec_handle_ptr) {
+    EbDecPicMgr *ps_pic_mgr = (EbDecPicMgr *)dec_handle_ptr->pv_pic_mgr;
+
+    dec_handle_ptr->out_pic_buf = NULL;
+    if (ps_pic_mgr == NULL || dec_handle_ptr->release_ext_fb == NULL) return;
+
+    for (int32_t i = 0; i < MAX_PIC_BUFS; i++) {
+        if (ps_pic_mgr->as_dec_pic[i].ps_pic_buf != NULL)
+            dec_pic_mgr_release_ext_frame_buf(dec_handle_ptr, &ps_pic_mgr->as_dec_pic[i]);
+        ps_pic_mgr->as_dec_pic[i].ref_count = 0;
+        ps_pic_mgr->as_dec_pic[i].is_free   = 1;
     }
 }
 
@@ -217,7 +329,7 @@ void dec_pic_mgr_update_ref_pic(EbDecHandle *dec_handle_ptr, int32_t frame_decod
     /* TODO: Add lock and unlock for MT */
     if (frame_decoded) {
         for (mask = refresh_frame_flags; mask; mask >>= 1) {
-            dec_ref_count_and_rel(dec_handle_ptr->ref_frame_map[ref_index]);
+            dec_ref_count_and_rel(dec_handle_ptr, dec_handle_ptr->ref_frame_map[ref_index]);
             dec_handle_ptr->ref_frame_map[ref_index] =
                 dec_handle_ptr->next_ref_frame_map[ref_index];
             dec_handle_ptr->next_ref_frame_map[ref_index] = NULL;
@@ -225,7 +337,7 @@ void dec_pic_mgr_update_ref_pic(EbDecHandle *dec_handle_ptr, int32_t frame_decod
         }
 
         for (; ref_index < REF_FRAMES; ++ref_index) {
-            dec_ref_count_and_rel(dec_handle_ptr->ref_frame_map[ref_index]);
+            dec_ref_count_and_rel(dec_handle_ptr, dec_handle_ptr->ref_frame_map[ref_index]);
             dec_handle_ptr->ref_frame_map[ref_index] =
                 dec_handle_ptr->next_ref_frame_map[ref_index];
             dec_handle_ptr->next_ref_frame_map[ref_index] = NULL;
@@ -235,10 +347,10 @@ void dec_pic_mgr_update_ref_pic(EbDecHandle *dec_handle_ptr, int32_t frame_decod
             //TODO: Add output Q logic
             //assert(0);
         } else
-            dec_ref_count_and_rel(dec_handle_ptr->cur_pic_buf[0]);
+            dec_ref_count_and_rel(dec_handle_ptr, dec_handle_ptr->cur_pic_buf[0]);
     } else {
         // Nothing was decoded, so just drop this frame buffer
-        dec_ref_count_and_rel(dec_handle_ptr->cur_pic_buf[0]);
+        dec_ref_count_and_rel(dec_handle_ptr, dec_handle_ptr->cur_pic_buf[0]);
     }
 
     /* Invalidate these references until the next frame starts. */
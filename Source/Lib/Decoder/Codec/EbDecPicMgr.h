@@ -34,6 +34,12 @@ EbDecPicBuf *dec_pic_mgr_get_cur_pic(EbDecHandle *dec_handle_ptr);
 void dec_pic_mgr_update_ref_pic(EbDecHandle *dec_handle_ptr, int32_t frame_decoded,
                                 int32_t refresh_frame_flags);
 
+void dec_pic_mgr_hold_output_pic(EbDecHandle *dec_handle_ptr);
+
+void dec_pic_mgr_release_output_pic(EbDecHandle *dec_handle_ptr);
+
+void dec_pic_mgr_release_ext_frame_bufs(EbDecHandle *dec_handle_ptr);
+
 void generate_next_ref_frame_map(EbDecHandle *dec_handle_ptr);
 
 EbDecPicBuf *get_ref_frame_buf(EbDecHandle *dec_handle_ptr, const MvReferenceFrame ref_frame);
@@ -0,0 +1,93 @@
+/*
+* Copyright(c) 2019 Intel Corporation
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+#include <immintrin.h>
+
+#include "EbDefinitions.h"
+#include "aom_dsp_rtcd.h"
+
+// Returns 0xff for the pixels that have no 9 contiguous circle pixels set in
+// the "not brighter" (or "not darker") masks n[].
+static INLINE __m256i fast9_no_arc_avx2(const __m256i n[16]) {
+    __m256i r2[16], r4[16], r8[16];
+    __m256i no_arc = _mm256_set1_epi8(-1);
+    int     i;
+
+    for (i = 0; i < 16; i++) r2[i] = _mm256_or_si256(n[i], n[(i + 1) & 15]);
+    for (i = 0; i < 16; i++) r4[i] = _mm256_or_si256(r2[i], r2[(i + 2) & 15]);
+    for (i = 0; i < 16; i++) r8[i] = _mm256_or_si256(r4[i], r4[(i + 4) & 15]);
+    for (i = 0; i < 16; i++)
+        no_arc = _mm256_and_si256(no_arc, _mm256_or_si256(r8[i], n[(i + 8) & 15]));
+    return no_arc;
+}
+
+int av1_fast9_detect_row_avx2(const uint8_t *src, int stride, int width, int b, int *xs) {
+    const int offsets[16] = {3 * stride,
+                             1 + 3 * stride,
+                             2 + 2 * stride,
+                             3 + stride,
+                             3,
+                             3 - stride,
+                             2 - 2 * stride,
+                             1 - 3 * stride,
+                             -3 * stride,
+                             -1 - 3 * stride,
+                             -2 - 2 * stride,
+                             -3 - stride,
+                             -3,
+                             -3 + stride,
+                             -2 + 2 * stride,
+                             -1 + 3 * stride};
+    const __m256i zero        = _mm256_setzero_si256();
+    const __m256i vb          = _mm256_set1_epi8((char)b);
+    int           num_corners = 0;
+    int           x           = 3;
+
+    if (b < 0 || b > 255) return av1_fast9_detect_row_c(src, stride, width, b, xs);
+
+    for (; x + 32 <= width - 3; x += 32) {
+        const uint8_t *p  = src + x;
+        const __m256i  c  = _mm256_loadu_si256((const __m256i *)p);
+        const __m256i  hi = _mm256_adds_epu8(c, vb);
+        const __m256i  lo = _mm256_subs_epu8(c, vb);
+        __m256i        not_bright[16], not_dark[16];
+        int            k;
+
+        // v > c + b and v < c - b, with the saturated bounds never passed
+        for (k = 0; k < 16; k += 4) {
+            const __m256i v = _mm256_loadu_si256((const __m256i *)(p + offsets[k]));
+            not_bright[k]   = _mm256_cmpeq_epi8(_mm256_subs_epu8(v, hi), zero);
+            not_dark[k]     = _mm256_cmpeq_epi8(_mm256_subs_epu8(lo, v), zero);
+        }
+        // A 9-pixel arc covers one of the pixels 0 and 8, and one of 4 and 12.
+        const __m256i no_bright =
+            _mm256_or_si256(_mm256_and_si256(not_bright[0], not_bright[8]),
+                            _mm256_and_si256(not_bright[4], not_bright[12]));
+        const __m256i no_dark = _mm256_or_si256(_mm256_and_si256(not_dark[0], not_dark[8]),
+                                                _mm256_and_si256(not_dark[4], not_dark[12]));
+        if (_mm256_movemask_epi8(_mm256_and_si256(no_bright, no_dark)) == -1) continue;
+
+        for (k = 0; k < 16; k++) {
+            if (!(k & 3)) continue;
+            const __m256i v = _mm256_loadu_si256((const __m256i *)(p + offsets[k]));
+            not_bright[k]   = _mm256_cmpeq_epi8(_mm256_subs_epu8(v, hi), zero);
+            not_dark[k]     = _mm256_cmpeq_epi8(_mm256_subs_epu8(lo, v), zero);
+        }
+        const uint32_t corners = ~(uint32_t)_mm256_movemask_epi8(
+            _mm256_and_si256(fast9_no_arc_avx2(not_bright), fast9_no_arc_avx2(not_dark)));
+        if (corners) {
+            for (k = 0; k < 32; k++)
+                if (corners & (1u << k)) xs[num_corners++] = x + k;
+        }
+    }
+
+    // The remaining pixels are done by the C version, starting 3 pixels to the left.
+    if (x < width - 3) {
+        const int n = av1_fast9_detect_row_c(src + x - 3, stride, width - x + 3, b, xs + num_corners);
+        for (int i = 0; i < n; i++) xs[num_corners + i] += x - 3;
+        num_corners += n;
+    }
+    return num_corners;
+}
@@ -0,0 +1,63 @@
+/*
+* Copyright(c) 2019 Intel Corporation
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+#include <immintrin.h>
+
+#include "EbDefinitions.h"
+#include "aom_dsp_rtcd.h"
+
+void av1_get_2x2_same_value_row_avx2(const uint8_t *src, int stride, int width, int8_t *row_same,
+                                     int8_t *col_same) {
+    const uint8_t *a   = src;
+    const uint8_t *b   = src + stride;
+    const __m256i  one = _mm256_set1_epi8(1);
+    int            x   = 0;
+
+    // each step reads 33 samples of both rows
+    for (; x + 32 <= width; x += 32) {
+        const __m256i a0 = _mm256_loadu_si256((const __m256i *)(a + x));
+        const __m256i a1 = _mm256_loadu_si256((const __m256i *)(a + x + 1));
+        const __m256i b0 = _mm256_loadu_si256((const __m256i *)(b + x));
+        const __m256i b1 = _mm256_loadu_si256((const __m256i *)(b + x + 1));
+        const __m256i row =
+            _mm256_and_si256(_mm256_cmpeq_epi8(a0, a1), _mm256_cmpeq_epi8(b0, b1));
+        const __m256i col =
+            _mm256_and_si256(_mm256_cmpeq_epi8(a0, b0), _mm256_cmpeq_epi8(a1, b1));
+        _mm256_storeu_si256((__m256i *)(row_same + x), _mm256_and_si256(row, one));
+        _mm256_storeu_si256((__m256i *)(col_same + x), _mm256_and_si256(col, one));
+    }
+
+    if (x < width)
+        av1_get_2x2_same_value_row_c(src + x, stride, width - x, row_same + x, col_same + x);
+}
+
+void av1_highbd_get_2x2_same_value_row_avx2(const uint16_t *src, int stride, int width,
+                                            int8_t *row_same, int8_t *col_same) {
+    const uint16_t *a   = src;
+    const uint16_t *b   = src + stride;
+    const __m128i   one = _mm_set1_epi8(1);
+    int             x   = 0;
+
+    for (; x + 16 <= width; x += 16) {
+        const __m256i a0 = _mm256_loadu_si256((const __m256i *)(a + x));
+        const __m256i a1 = _mm256_loadu_si256((const __m256i *)(a + x + 1));
+        const __m256i b0 = _mm256_loadu_si256((const __m256i *)(b + x));
+        const __m256i b1 = _mm256_loadu_si256((const __m256i *)(b + x + 1));
+        const __m256i row =
+            _mm256_and_si256(_mm256_cmpeq_epi16(a0, a1), _mm256_cmpeq_epi16(b0, b1));
+        const __m256i col =
+            _mm256_and_si256(_mm256_cmpeq_epi16(a0, b0), _mm256_cmpeq_epi16(a1, b1));
+        // 0 / -1 words to 0 / 1 bytes, in order
+        const __m256i packed = _mm256_permute4x64_epi64(_mm256_packs_epi16(row, col), 0xd8);
+        _mm_storeu_si128((__m128i *)(row_same + x),
+                         _mm_and_si128(_mm256_castsi256_si128(packed), one));
+        _mm_storeu_si128((__m128i *)(col_same + x),
+                         _mm_and_si128(_mm256_extracti128_si256(packed, 1), one));
+    }
+
+    if (x < width)
+        av1_highbd_get_2x2_same_value_row_c(
+            src + x, stride, width - x, row_same + x, col_same + x);
+}
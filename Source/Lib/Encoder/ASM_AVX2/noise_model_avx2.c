@@ -0,0 +1,112 @@
+/*
+* Copyright(c) 2019 Intel Corporation
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+#include <immintrin.h>
+
+#include "EbDefinitions.h"
+#include "aom_dsp_rtcd.h"
+
+// Lane i is enabled for the first n lanes.
+static INLINE __m256i tail_mask_avx2(const int32_t n) {
+    return _mm256_cmpgt_epi64(_mm256_set1_epi64x(n), _mm256_setr_epi64x(0, 1, 2, 3));
+}
+
+// Sums the lanes as (v0 + v2) + (v1 + v3), the order used by the C version.
+static INLINE double hsum_pd_avx2(const __m256d v) {
+    const __m128d s = _mm_add_pd(_mm256_castpd256_pd128(v), _mm256_extractf128_pd(v, 1));
+    return _mm_cvtsd_f64(_mm_add_sd(s, _mm_unpackhi_pd(s, s)));
+}
+
+static INLINE void gradient_stats_accumulate_avx2(const __m256d l, const __m256d r,
+                                                  const __m256d u, const __m256d d,
+                                                  const __m256d c, __m256d *xx, __m256d *xy,
+                                                  __m256d *yy, __m256d *s, __m256d *s2) {
+    const __m256d half = _mm256_set1_pd(0.5);
+    const __m256d gx   = _mm256_mul_pd(_mm256_sub_pd(r, l), half);
+    const __m256d gy   = _mm256_mul_pd(_mm256_sub_pd(d, u), half);
+    *xx                = _mm256_add_pd(*xx, _mm256_mul_pd(gx, gx));
+    *xy                = _mm256_add_pd(*xy, _mm256_mul_pd(gx, gy));
+    *yy                = _mm256_add_pd(*yy, _mm256_mul_pd(gy, gy));
+    *s                 = _mm256_add_pd(*s, c);
+    *s2                = _mm256_add_pd(*s2, _mm256_mul_pd(c, c));
+}
+
+void eb_aom_flat_block_gradient_stats_avx2(const double *block, int32_t block_size, double *g_xx,
+                                           double *g_xy, double *g_yy, double *sum,
+                                           double *sum_sq) {
+    const int32_t w    = block_size - 2;
+    const __m256i mask = tail_mask_avx2(w & 3);
+    __m256d       xx   = _mm256_setzero_pd();
+    __m256d       xy   = _mm256_setzero_pd();
+    __m256d       yy   = _mm256_setzero_pd();
+    __m256d       s    = _mm256_setzero_pd();
+    __m256d       s2   = _mm256_setzero_pd();
+
+    for (int32_t yi = 1; yi < block_size - 1; ++yi) {
+        const double *row = block + yi * block_size + 1;
+        int32_t       x   = 0;
+
+        // Lane k accumulates the columns x with x % 4 == k, as the C version does.
+        for (; x + 4 <= w; x += 4) {
+            gradient_stats_accumulate_avx2(_mm256_loadu_pd(row + x - 1),
+                                           _mm256_loadu_pd(row + x + 1),
+                                           _mm256_loadu_pd(row + x - block_size),
+                                           _mm256_loadu_pd(row + x + block_size),
+                                           _mm256_loadu_pd(row + x),
+                                           &xx,
+                                           &xy,
+                                           &yy,
+                                           &s,
+                                           &s2);
+        }
+        // Disabled lanes load zeros and add +0, which leaves the sums unchanged.
+        if (x < w) {
+            gradient_stats_accumulate_avx2(_mm256_maskload_pd(row + x - 1, mask),
+                                           _mm256_maskload_pd(row + x + 1, mask),
+                                           _mm256_maskload_pd(row + x - block_size, mask),
+                                           _mm256_maskload_pd(row + x + block_size, mask),
+                                           _mm256_maskload_pd(row + x, mask),
+                                           &xx,
+                                           &xy,
+                                           &yy,
+                                           &s,
+                                           &s2);
+        }
+    }
+    *g_xx   = hsum_pd_avx2(xx);
+    *g_xy   = hsum_pd_avx2(xy);
+    *g_yy   = hsum_pd_avx2(yy);
+    *sum    = hsum_pd_avx2(s);
+    *sum_sq = hsum_pd_avx2(s2);
+}
+
+void eb_aom_noise_eqns_add_observation_avx2(double *A, double *b, const double *buffer,
+                                            double val, int32_t n) {
+    int32_t i = 0;
+
+    // Only the upper triangle of A is accumulated, as in the C version.
+    for (i = 0; i < n; ++i) {
+        const __m256d bi = _mm256_set1_pd(buffer[i]);
+        double *      a  = A + i * n;
+        int32_t       j  = i;
+
+        for (; j + 4 <= n; j += 4) {
+            const __m256d p = _mm256_mul_pd(bi, _mm256_loadu_pd(buffer + j));
+            _mm256_storeu_pd(a + j, _mm256_add_pd(_mm256_loadu_pd(a + j), p));
+        }
+        if (j < n) {
+            const __m256i mask = tail_mask_avx2(n - j);
+            const __m256d p    = _mm256_mul_pd(bi, _mm256_maskload_pd(buffer + j, mask));
+            _mm256_maskstore_pd(a + j, mask, _mm256_add_pd(_mm256_maskload_pd(a + j, mask), p));
+        }
+    }
+
+    const __m256d v = _mm256_set1_pd(val);
+    for (i = 0; i + 4 <= n; i += 4) {
+        const __m256d p = _mm256_mul_pd(_mm256_loadu_pd(buffer + i), v);
+        _mm256_storeu_pd(b + i, _mm256_add_pd(_mm256_loadu_pd(b + i), p));
+    }
+    for (; i < n; ++i) b[i] += buffer[i] * val;
+}
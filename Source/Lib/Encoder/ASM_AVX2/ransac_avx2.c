@@ -0,0 +1,53 @@
+/*
+* Copyright(c) 2019 Intel Corporation
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+#include <immintrin.h>
+
+#include "EbDefinitions.h"
+#include "aom_dsp_rtcd.h"
+
+int av1_ransac_find_inliers_avx2(const double *proj, const double *corners, int npoints,
+                                 double threshold, int *inlier_indices, double *distances) {
+    const __m256d th          = _mm256_set1_pd(threshold);
+    int           num_inliers = 0;
+    int           i           = 0;
+
+    for (; i + 4 <= npoints; i += 4) {
+        // (x0, y0, x1, y1) and (x2, y2, x3, y3)
+        const __m256d d01 =
+            _mm256_sub_pd(_mm256_loadu_pd(proj + i * 2), _mm256_loadu_pd(corners + i * 2));
+        const __m256d d23 = _mm256_sub_pd(_mm256_loadu_pd(proj + i * 2 + 4),
+                                          _mm256_loadu_pd(corners + i * 2 + 4));
+        // dx * dx + dy * dy of the points 0, 2, 1, 3, then put back in order
+        const __m256d sq =
+            _mm256_hadd_pd(_mm256_mul_pd(d01, d01), _mm256_mul_pd(d23, d23));
+        const __m256d dist = _mm256_sqrt_pd(_mm256_permute4x64_pd(sq, 0xD8));
+        const int     mask = _mm256_movemask_pd(_mm256_cmp_pd(dist, th, _CMP_LT_OQ));
+
+        if (mask) {
+            double d[4];
+            _mm256_storeu_pd(d, dist);
+            for (int k = 0; k < 4; k++) {
+                if (mask & (1 << k)) {
+                    inlier_indices[num_inliers] = i + k;
+                    distances[num_inliers]      = d[k];
+                    num_inliers++;
+                }
+            }
+        }
+    }
+
+    if (i < npoints) {
+        const int n = av1_ransac_find_inliers_c(proj + i * 2,
+                                                corners + i * 2,
+                                                npoints - i,
+                                                threshold,
+                                                inlier_indices + num_inliers,
+                                                distances + num_inliers);
+        for (int k = 0; k < n; k++) inlier_indices[num_inliers + k] += i;
+        num_inliers += n;
+    }
+    return num_inliers;
+}
@@ -0,0 +1,92 @@
+/*
+* Copyright(c) 2019 Intel Corporation
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+#include <immintrin.h>
+
+#include "EbDefinitions.h"
+#include "aom_dsp_rtcd.h"
+
+static INLINE uint32_t hsum_epi32_avx2(const __m256i v) {
+    __m128i s = _mm_add_epi32(_mm256_castsi256_si128(v), _mm256_extracti128_si256(v, 1));
+    s         = _mm_add_epi32(s, _mm_srli_si128(s, 8));
+    s         = _mm_add_epi32(s, _mm_srli_si128(s, 4));
+    return (uint32_t)_mm_cvtsi128_si32(s);
+}
+
+// Accumulates the SSIM statistics of two rows of 16-bit samples. The sums of
+// samples are kept in 16 bits, which holds 4 rows of up to 12-bit samples.
+static INLINE void ssim_accumulate_avx2(const __m256i s, const __m256i r, __m256i *sum_s,
+                                        __m256i *sum_r, __m256i *sum_sq_s, __m256i *sum_sq_r,
+                                        __m256i *sum_sxr) {
+    *sum_s    = _mm256_add_epi16(*sum_s, s);
+    *sum_r    = _mm256_add_epi16(*sum_r, r);
+    *sum_sq_s = _mm256_add_epi32(*sum_sq_s, _mm256_madd_epi16(s, s));
+    *sum_sq_r = _mm256_add_epi32(*sum_sq_r, _mm256_madd_epi16(r, r));
+    *sum_sxr  = _mm256_add_epi32(*sum_sxr, _mm256_madd_epi16(s, r));
+}
+
+static INLINE void ssim_store_avx2(const __m256i s, const __m256i r, const __m256i sq_s,
+                                   const __m256i sq_r, const __m256i sxr, uint32_t *sum_s,
+                                   uint32_t *sum_r, uint32_t *sum_sq_s, uint32_t *sum_sq_r,
+                                   uint32_t *sum_sxr) {
+    const __m256i one = _mm256_set1_epi16(1);
+    *sum_s += hsum_epi32_avx2(_mm256_madd_epi16(s, one));
+    *sum_r += hsum_epi32_avx2(_mm256_madd_epi16(r, one));
+    *sum_sq_s += hsum_epi32_avx2(sq_s);
+    *sum_sq_r += hsum_epi32_avx2(sq_r);
+    *sum_sxr += hsum_epi32_avx2(sxr);
+}
+
+static INLINE __m256i load_u8_8x2_avx2(const uint8_t *p, const int stride) {
+    return _mm256_cvtepu8_epi16(_mm_unpacklo_epi64(_mm_loadl_epi64((const __m128i *)p),
+                                                   _mm_loadl_epi64((const __m128i *)(p + stride))));
+}
+
+void aom_ssim_parms_8x8_avx2(const uint8_t *s, int sp, const uint8_t *r, int rp, uint32_t *sum_s,
+                             uint32_t *sum_r, uint32_t *sum_sq_s, uint32_t *sum_sq_r,
+                             uint32_t *sum_sxr) {
+    __m256i s_acc    = _mm256_setzero_si256();
+    __m256i r_acc    = _mm256_setzero_si256();
+    __m256i sq_s_acc = _mm256_setzero_si256();
+    __m256i sq_r_acc = _mm256_setzero_si256();
+    __m256i sxr_acc  = _mm256_setzero_si256();
+
+    for (int i = 0; i < 8; i += 2, s += 2 * sp, r += 2 * rp)
+        ssim_accumulate_avx2(load_u8_8x2_avx2(s, sp),
+                             load_u8_8x2_avx2(r, rp),
+                             &s_acc,
+                             &r_acc,
+                             &sq_s_acc,
+                             &sq_r_acc,
+                             &sxr_acc);
+
+    ssim_store_avx2(
+        s_acc, r_acc, sq_s_acc, sq_r_acc, sxr_acc, sum_s, sum_r, sum_sq_s, sum_sq_r, sum_sxr);
+}
+
+void aom_highbd_ssim_parms_8x8_avx2(const uint8_t *s, int sp, const uint8_t *sinc, int spinc,
+                                    const uint16_t *r, int rp, uint32_t *sum_s, uint32_t *sum_r,
+                                    uint32_t *sum_sq_s, uint32_t *sum_sq_r, uint32_t *sum_sxr) {
+    __m256i s_acc    = _mm256_setzero_si256();
+    __m256i r_acc    = _mm256_setzero_si256();
+    __m256i sq_s_acc = _mm256_setzero_si256();
+    __m256i sq_r_acc = _mm256_setzero_si256();
+    __m256i sxr_acc  = _mm256_setzero_si256();
+
+    for (int i = 0; i < 8; i += 2, s += 2 * sp, sinc += 2 * spinc, r += 2 * rp) {
+        // Rebuild the 10-bit source from its 8 msb and the 2 lsb kept in the
+        // top bits of the inc plane
+        const __m256i ss = _mm256_or_si256(_mm256_slli_epi16(load_u8_8x2_avx2(s, sp), 2),
+                                           _mm256_srli_epi16(load_u8_8x2_avx2(sinc, spinc), 6));
+        const __m256i rr = _mm256_inserti128_si256(
+            _mm256_castsi128_si256(_mm_loadu_si128((const __m128i *)r)),
+            _mm_loadu_si128((const __m128i *)(r + rp)),
+            1);
+        ssim_accumulate_avx2(ss, rr, &s_acc, &r_acc, &sq_s_acc, &sq_r_acc, &sxr_acc);
+    }
+
+    ssim_store_avx2(
+        s_acc, r_acc, sq_s_acc, sq_r_acc, sxr_acc, sum_s, sum_r, sum_sq_s, sum_sq_r, sum_sxr);
+}
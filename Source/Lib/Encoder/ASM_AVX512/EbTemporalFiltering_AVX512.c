@@ -0,0 +1,508 @@
+/*
+* Copyright(c) 2019 Intel Corporation
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+#include "EbDefinitions.h"
+
+#ifndef NON_AVX512_SUPPORT
+#include <assert.h>
+#include <immintrin.h>
+#include <math.h>
+
+#include "EbTemporalFiltering.h"
+
+#define SSE_STRIDE BW
+
+static AOM_FORCE_INLINE void get_squared_error_avx512(const uint8_t *frame1,
+                                                      const unsigned int stride,
+                                                      const uint8_t *frame2,
+                                                      const unsigned int stride2,
+                                                      const int block_width,
+                                                      const int block_height, uint16_t *frame_sse) {
+    for (int i = 0; i < block_height; i++) {
+        if (block_width == 32) {
+            const __m512i vf1 = _mm512_cvtepu8_epi16(_mm256_loadu_si256((const __m256i *)frame1));
+            const __m512i vf2 = _mm512_cvtepu8_epi16(_mm256_loadu_si256((const __m256i *)frame2));
+            const __m512i vdiff = _mm512_sub_epi16(vf1, vf2);
+            _mm512_storeu_si512((__m512i *)frame_sse, _mm512_mullo_epi16(vdiff, vdiff));
+        } else {
+            const __m256i vf1 = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i *)frame1));
+            const __m256i vf2 = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i *)frame2));
+            const __m256i vdiff = _mm256_sub_epi16(vf1, vf2);
+            _mm256_storeu_si256((__m256i *)frame_sse, _mm256_mullo_epi16(vdiff, vdiff));
+        }
+        frame1 += stride;
+        frame2 += stride2;
+        frame_sse += SSE_STRIDE;
+    }
+}
+
+static AOM_FORCE_INLINE void get_squared_error_hbd_avx512(const uint16_t *frame1,
+                                                          const unsigned int stride,
+                                                          const uint16_t *frame2,
+                                                          const unsigned int stride2,
+                                                          const int block_width,
+                                                          const int block_height,
+                                                          uint32_t *frame_sse) {
+    for (int i = 0; i < block_height; i++) {
+        for (int j = 0; j < block_width; j += 16) {
+            const __m512i vf1 =
+                _mm512_cvtepu16_epi32(_mm256_loadu_si256((const __m256i *)(frame1 + j)));
+            const __m512i vf2 =
+                _mm512_cvtepu16_epi32(_mm256_loadu_si256((const __m256i *)(frame2 + j)));
+            const __m512i vdiff = _mm512_sub_epi32(vf1, vf2);
+            _mm512_storeu_si512((__m512i *)(frame_sse + j), _mm512_mullo_epi32(vdiff, vdiff));
+        }
+        frame1 += stride;
+        frame2 += stride2;
+        frame_sse += SSE_STRIDE;
+    }
+}
+
+// Builds the permute indices picking, for each column, its neighbour at offset k - 2,
+// clamped to the block so that the first and last columns are replicated
+static AOM_FORCE_INLINE void get_window_index(const int block_width, __m512i vindex[2][5]) {
+    const __m512i vcol  = _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+    const __m512i vlast = _mm512_set1_epi32(block_width - 1);
+    for (int i = 0; i < 2; i++) {
+        for (int k = 0; k < 5; k++) {
+            const __m512i vidx = _mm512_add_epi32(vcol, _mm512_set1_epi32(16 * i + k - 2));
+            vindex[i][k] =
+                _mm512_min_epi32(_mm512_max_epi32(vidx, _mm512_setzero_si512()), vlast);
+        }
+    }
+}
+
+// Sums 5 horizontally neighbouring values of a row held in vrow[0] (columns 0-15) and
+// vrow[1] (columns 16-31)
+static AOM_FORCE_INLINE void sum_row_5_avx512(const __m512i vrow[2], const __m512i vindex[2][5],
+                                              const int block_width, uint32_t *dst) {
+    for (int i = 0; i < (block_width >> 4); i++) {
+        __m512i vsum = _mm512_permutex2var_epi32(vrow[0], vindex[i][0], vrow[1]);
+        for (int k = 1; k < 5; k++)
+            vsum =
+                _mm512_add_epi32(vsum, _mm512_permutex2var_epi32(vrow[0], vindex[i][k], vrow[1]));
+        _mm512_storeu_si512((__m512i *)(dst + 16 * i), vsum);
+    }
+}
+
+// Sums 5 vertically neighbouring rows of the horizontal sums, replicating the first and
+// last row
+static AOM_FORCE_INLINE __m512i sum_col_5_avx512(uint32_t row_sum[BH][BW], const int row,
+                                                 const int col, const int block_height) {
+    __m512i vsum = _mm512_setzero_si512();
+    for (int k = -2; k <= 2; k++) {
+        const int r = AOMMIN(AOMMAX(row + k, 0), block_height - 1);
+        vsum        = _mm512_add_epi32(vsum, _mm512_loadu_si512((const __m512i *)&row_sum[r][col]));
+    }
+    return vsum;
+}
+
+// Selects per lane the value of the left or right 16x16 (or 8x8) sub-block
+static AOM_FORCE_INLINE __m512 blend_subblock_ps(const float *value, const int col,
+                                                 const int block_width) {
+    const int       left = AOMMIN(AOMMAX((block_width >> 1) - col, 0), 16);
+    const __mmask16 mask = (__mmask16)(0xFFFF << left);
+    return _mm512_mask_blend_ps(mask, _mm512_set1_ps(value[0]), _mm512_set1_ps(value[1]));
+}
+
+#if TF_IMP
+static AOM_FORCE_INLINE __m512i get_weight_avx512(const __m512i vdiff_sse,
+                                                  const int num_ref_pixels,
+                                                  const __m512 vblock_error,
+                                                  const __m512 vd_factor,
+                                                  const float  block_balance_inv,
+                                                  const float  n_decay_qr_inv) {
+    DECLARE_ALIGNED(64, float, scaled_diff[16]);
+    DECLARE_ALIGNED(64, int32_t, weight[16]);
+
+    // Combine window error and block error, and normalize it.
+    const __m512 window_error =
+        _mm512_div_ps(_mm512_cvtepi32_ps(vdiff_sse), _mm512_set1_ps((float)num_ref_pixels));
+    __m512 vscaled = _mm512_mul_ps(_mm512_set1_ps(TF_WINDOW_BLOCK_BALANCE_WEIGHT), window_error);
+    vscaled        = _mm512_add_ps(vscaled, vblock_error);
+    vscaled        = _mm512_mul_ps(vscaled, _mm512_set1_ps(block_balance_inv));
+    vscaled        = _mm512_mul_ps(vscaled, vd_factor);
+    vscaled        = _mm512_mul_ps(vscaled, _mm512_set1_ps(n_decay_qr_inv));
+    vscaled        = _mm512_min_ps(vscaled, _mm512_set1_ps(7.0f));
+    _mm512_store_ps(scaled_diff, vscaled);
+
+    // expf() is kept scalar so the weights match the C and AVX2 kernels
+    for (int k = 0; k < 16; k++) weight[k] = (int)(expf(-scaled_diff[k]) * TF_WEIGHT_SCALE);
+    return _mm512_load_si512((const __m512i *)weight);
+}
+#else
+static AOM_FORCE_INLINE __m512i get_weight_avx512(const __m512i vdiff_sse,
+                                                  const int num_ref_pixels, const double h) {
+    DECLARE_ALIGNED(64, int32_t, diff_sse[16]);
+    DECLARE_ALIGNED(64, int32_t, weight[16]);
+
+    _mm512_store_si512((__m512i *)diff_sse, vdiff_sse);
+    for (int k = 0; k < 16; k++) {
+        const double scaled_diff =
+            AOMMAX(-(double)(diff_sse[k] / num_ref_pixels) / (2 * h * h), -15.0);
+        weight[k] = (int)(exp(scaled_diff) * TF_PLANEWISE_FILTER_WEIGHT_SCALE);
+    }
+    return _mm512_load_si512((const __m512i *)weight);
+}
+#endif
+
+#if TF_IMP
+// Block error and motion vector distance factor of the 4 sub-blocks of the 32x32 block
+static void get_subblock_factors(struct MeContext *context_ptr, const int shift,
+                                 float block_error[4], float d_factor[4]) {
+    const float distance_threshold_inv =
+        1.0f / (float)AOMMAX(context_ptr->min_frame_size * TF_SEARCH_DISTANCE_THRESHOLD, 1);
+    const int idx_32x32 = context_ptr->tf_block_col + context_ptr->tf_block_row * 2;
+
+    for (int subblock_idx = 0; subblock_idx < 4; subblock_idx++) {
+        MV mv;
+        if (context_ptr->tf_32x32_block_split_flag[idx_32x32]) {
+            // 16x16
+            block_error[subblock_idx] =
+                (float)(context_ptr->tf_16x16_block_error[idx_32x32 * 4 + subblock_idx] >>
+                        shift) /
+                256.0f;
+            mv.col = context_ptr->tf_16x16_mv_x[idx_32x32 * 4 + subblock_idx];
+            mv.row = context_ptr->tf_16x16_mv_y[idx_32x32 * 4 + subblock_idx];
+        } else {
+            //32x32
+            block_error[subblock_idx] =
+                (float)(context_ptr->tf_32x32_block_error[idx_32x32] >> shift) / 1024.0f;
+            mv.col = context_ptr->tf_32x32_mv_x[idx_32x32];
+            mv.row = context_ptr->tf_32x32_mv_y[idx_32x32];
+        }
+        const float distance   = sqrtf(powf(mv.row, 2) + powf(mv.col, 2));
+        d_factor[subblock_idx] = AOMMAX(distance * distance_threshold_inv, 1);
+    }
+}
+#endif
+
+static void apply_temporal_filter_planewise(
+#if TF_IMP
+    struct MeContext *context_ptr, const uint8_t *frame1, const unsigned int stride,
+    const uint8_t *frame2, const unsigned int stride2, const int block_width,
+    const int block_height, const double sigma, const int decay_control, unsigned int *accumulator,
+    uint16_t *count, uint16_t *luma_sq_error, uint16_t *chroma_sq_error, int plane, int ss_x_shift,
+    int ss_y_shift) {
+#else
+    const uint8_t *frame1, const unsigned int stride, const uint8_t *frame2,
+    const unsigned int stride2, const int block_width, const int block_height, const double sigma,
+    const int decay_control, unsigned int *accumulator, uint16_t *count, uint16_t *luma_sq_error,
+    uint16_t *chroma_sq_error, int plane, int ss_x_shift, int ss_y_shift) {
+#endif
+    assert(TF_PLANEWISE_FILTER_WINDOW_LENGTH == 5);
+    assert(((block_width == 32) && (block_height == 32)) ||
+           ((block_width == 16) && (block_height == 16)));
+    if (plane > PLANE_TYPE_Y) assert(chroma_sq_error != NULL);
+
+    DECLARE_ALIGNED(64, uint32_t, row_sum[BH][BW]);
+#if TF_IMP
+    // Larger noise -> larger filtering weight.
+    const float n_decay           = (float)decay_control * (0.7f + logf((float)sigma + 1.0f));
+    const float n_decay_qr_inv    = 1.0f / (2 * n_decay * n_decay);
+    const float block_balacne_inv = 1.0f / (TF_WINDOW_BLOCK_BALANCE_WEIGHT + 1);
+    float       block_error[4], d_factor[4];
+    get_subblock_factors(context_ptr, 0, block_error, d_factor);
+#else
+    const double h = decay_control * (0.7 + log(sigma + 1.0));
+#endif
+    uint16_t *frame_sse = (plane == PLANE_TYPE_Y) ? luma_sq_error : chroma_sq_error;
+    __m512i   vindex[2][5];
+
+    get_squared_error_avx512(frame1, stride, frame2, stride2, block_width, block_height, frame_sse);
+    get_window_index(block_width, vindex);
+
+    for (int i = 0; i < block_height; i++) {
+        const uint16_t *src = frame_sse + i * SSE_STRIDE;
+        __m512i         vrow[2];
+        vrow[0] = _mm512_cvtepu16_epi32(_mm256_loadu_si256((const __m256i *)src));
+        vrow[1] = block_width == 32
+                      ? _mm512_cvtepu16_epi32(_mm256_loadu_si256((const __m256i *)(src + 16)))
+                      : vrow[0];
+        sum_row_5_avx512(vrow, vindex, block_width, row_sum[i]);
+    }
+
+    const int num_ref_pixels = TF_PLANEWISE_FILTER_WINDOW_LENGTH *
+            TF_PLANEWISE_FILTER_WINDOW_LENGTH +
+        (plane != PLANE_TYPE_Y ? 1 << (ss_x_shift + ss_y_shift) : 0);
+
+    for (int i = 0; i < block_height; i++) {
+        for (int j = 0; j < block_width; j += 16) {
+            __m512i vdiff_sse = sum_col_5_avx512(row_sum, i, j, block_height);
+
+            //Filter U-plane and V-plane using Y-plane. This is because motion
+            //search is only done on Y-plane, so the information from Y-plane will
+            //be more accurate.
+            if (plane != PLANE_TYPE_Y) {
+                for (int ii = 0; ii < (1 << ss_y_shift); ++ii) {
+                    const uint16_t *luma =
+                        luma_sq_error + ((i << ss_y_shift) + ii) * SSE_STRIDE + (j << ss_x_shift);
+                    if (ss_x_shift) {
+                        // Each 32-bit lane holds the two horizontally subsampled values
+                        const __m512i vluma = _mm512_loadu_si512((const __m512i *)luma);
+                        vdiff_sse           = _mm512_add_epi32(
+                            vdiff_sse, _mm512_and_si512(vluma, _mm512_set1_epi32(0xFFFF)));
+                        vdiff_sse = _mm512_add_epi32(vdiff_sse, _mm512_srli_epi32(vluma, 16));
+                    } else {
+                        vdiff_sse = _mm512_add_epi32(
+                            vdiff_sse,
+                            _mm512_cvtepu16_epi32(_mm256_loadu_si256((const __m256i *)luma)));
+                    }
+                }
+            }
+#if TF_IMP
+            const int     top     = (i >= block_height / 2) * 2;
+            const __m512i vweight = get_weight_avx512(
+                vdiff_sse,
+                num_ref_pixels,
+                blend_subblock_ps(block_error + top, j, block_width),
+                blend_subblock_ps(d_factor + top, j, block_width),
+                block_balacne_inv,
+                n_decay_qr_inv);
+#else
+            const __m512i vweight = get_weight_avx512(vdiff_sse, num_ref_pixels, h);
+#endif
+            const __m512i vpixel =
+                _mm512_cvtepu8_epi32(_mm_loadu_si128((const __m128i *)(frame2 + i * stride2 + j)));
+            uint16_t *    cnt = count + i * stride2 + j;
+            unsigned int *acc = accumulator + i * stride2 + j;
+
+            _mm256_storeu_si256(
+                (__m256i *)cnt,
+                _mm256_add_epi16(_mm256_loadu_si256((const __m256i *)cnt),
+                                 _mm512_cvtepi32_epi16(vweight)));
+            _mm512_storeu_si512((__m512i *)acc,
+                                _mm512_add_epi32(_mm512_loadu_si512((const __m512i *)acc),
+                                                 _mm512_mullo_epi32(vweight, vpixel)));
+        }
+    }
+}
+
+void svt_av1_apply_temporal_filter_planewise_avx512(
+#if TF_IMP
+    struct MeContext *context_ptr, const uint8_t *y_src, int y_src_stride, const uint8_t *y_pre,
+    int y_pre_stride, const uint8_t *u_src, const uint8_t *v_src, int uv_src_stride,
+    const uint8_t *u_pre, const uint8_t *v_pre, int uv_pre_stride, unsigned int block_width,
+    unsigned int block_height, int ss_x, int ss_y, const double *noise_levels,
+    const int decay_control, uint32_t *y_accum, uint16_t *y_count, uint32_t *u_accum,
+    uint16_t *u_count, uint32_t *v_accum, uint16_t *v_count) {
+#else
+    const uint8_t *y_src, int y_src_stride, const uint8_t *y_pre, int y_pre_stride,
+    const uint8_t *u_src, const uint8_t *v_src, int uv_src_stride, const uint8_t *u_pre,
+    const uint8_t *v_pre, int uv_pre_stride, unsigned int block_width, unsigned int block_height,
+    int ss_x, int ss_y, const double *noise_levels, const int decay_control, uint32_t *y_accum,
+    uint16_t *y_count, uint32_t *u_accum, uint16_t *u_count, uint32_t *v_accum, uint16_t *v_count) {
+#endif
+    assert(block_width <= BW && "block width too large");
+    assert(block_height <= BH && "block height too large");
+    assert(block_width % 16 == 0 && "block width must be multiple of 16");
+    assert(block_height % 2 == 0 && "block height must be even");
+    assert((ss_x == 0 || ss_x == 1) && (ss_y == 0 || ss_y == 1) && "invalid chroma subsampling");
+
+    const int num_planes = 3;
+    DECLARE_ALIGNED(64, uint16_t, luma_sq_error[SSE_STRIDE * BH]);
+    DECLARE_ALIGNED(64, uint16_t, chroma_sq_error[SSE_STRIDE * BH]);
+
+    for (int plane = 0; plane < num_planes; ++plane) {
+        const uint32_t plane_h    = plane ? (block_height >> ss_y) : block_height;
+        const uint32_t plane_w    = plane ? (block_width >> ss_x) : block_width;
+        const uint32_t src_stride = plane ? uv_src_stride : y_src_stride;
+        const uint32_t pre_stride = plane ? uv_pre_stride : y_pre_stride;
+        const int      ss_x_shift = plane ? ss_x : 0;
+        const int      ss_y_shift = plane ? ss_y : 0;
+
+        const uint8_t *ref  = plane == 0 ? y_src : plane == 1 ? u_src : v_src;
+        const uint8_t *pred = plane == 0 ? y_pre : plane == 1 ? u_pre : v_pre;
+
+        uint32_t *accum = plane == 0 ? y_accum : plane == 1 ? u_accum : v_accum;
+        uint16_t *count = plane == 0 ? y_count : plane == 1 ? u_count : v_count;
+
+        apply_temporal_filter_planewise(
+#if TF_IMP
+            context_ptr,
+#endif
+            ref,
+            src_stride,
+            pred,
+            pre_stride,
+            plane_w,
+            plane_h,
+            noise_levels[plane],
+            decay_control,
+            accum,
+            count,
+            luma_sq_error,
+            chroma_sq_error,
+            plane,
+            ss_x_shift,
+            ss_y_shift);
+    }
+}
+
+static void apply_temporal_filter_planewise_hbd(
+#if TF_IMP
+    struct MeContext *context_ptr, const uint16_t *frame1, const unsigned int stride,
+    const uint16_t *frame2, const unsigned int stride2, const int block_width,
+    const int block_height, const double sigma, const int decay_control, unsigned int *accumulator,
+    uint16_t *count, uint32_t *luma_sq_error, uint32_t *chroma_sq_error, int plane, int ss_x_shift,
+    int ss_y_shift) {
+#else
+    const uint16_t *frame1, const unsigned int stride, const uint16_t *frame2,
+    const unsigned int stride2, const int block_width, const int block_height, const double sigma,
+    const int decay_control, unsigned int *accumulator, uint16_t *count, uint32_t *luma_sq_error,
+    uint32_t *chroma_sq_error, int plane, int ss_x_shift, int ss_y_shift) {
+#endif
+    assert(TF_PLANEWISE_FILTER_WINDOW_LENGTH == 5);
+    assert(((block_width == 32) && (block_height == 32)) ||
+           ((block_width == 16) && (block_height == 16)));
+    if (plane > PLANE_TYPE_Y) assert(chroma_sq_error != NULL);
+
+    DECLARE_ALIGNED(64, uint32_t, row_sum[BH][BW]);
+#if TF_IMP
+    // Larger noise -> larger filtering weight.
+    const float n_decay           = (float)decay_control * (0.7f + logf((float)sigma + 1.0f));
+    const float n_decay_qr_inv    = 1.0f / (2 * n_decay * n_decay);
+    const float block_balacne_inv = 1.0f / (TF_WINDOW_BLOCK_BALANCE_WEIGHT + 1);
+    float       block_error[4], d_factor[4];
+    get_subblock_factors(context_ptr, 4, block_error, d_factor);
+#else
+    const double h = decay_control * (0.7 + log(sigma + 1.0));
+#endif
+    uint32_t *frame_sse = (plane == PLANE_TYPE_Y) ? luma_sq_error : chroma_sq_error;
+    __m512i   vindex[2][5];
+
+    get_squared_error_hbd_avx512(
+        frame1, stride, frame2, stride2, block_width, block_height, frame_sse);
+    get_window_index(block_width, vindex);
+
+    for (int i = 0; i < block_height; i++) {
+        const uint32_t *src = frame_sse + i * SSE_STRIDE;
+        __m512i         vrow[2];
+        vrow[0] = _mm512_loadu_si512((const __m512i *)src);
+        vrow[1] = block_width == 32 ? _mm512_loadu_si512((const __m512i *)(src + 16)) : vrow[0];
+        sum_row_5_avx512(vrow, vindex, block_width, row_sum[i]);
+    }
+
+    const int num_ref_pixels = TF_PLANEWISE_FILTER_WINDOW_LENGTH *
+            TF_PLANEWISE_FILTER_WINDOW_LENGTH +
+        (plane != PLANE_TYPE_Y ? 1 << (ss_x_shift + ss_y_shift) : 0);
+    const __m512i vindex_even =
+        _mm512_setr_epi32(0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30);
+    const __m512i vindex_odd =
+        _mm512_setr_epi32(1, 3, 5, 7, 9, 11, 13, 15, 17, 19, 21, 23, 25, 27, 29, 31);
+
+    for (int i = 0; i < block_height; i++) {
+        for (int j = 0; j < block_width; j += 16) {
+            __m512i vdiff_sse = sum_col_5_avx512(row_sum, i, j, block_height);
+
+            //Filter U-plane and V-plane using Y-plane. This is because motion
+            //search is only done on Y-plane, so the information from Y-plane will
+            //be more accurate.
+            if (plane != PLANE_TYPE_Y) {
+                for (int ii = 0; ii < (1 << ss_y_shift); ++ii) {
+                    const uint32_t *luma =
+                        luma_sq_error + ((i << ss_y_shift) + ii) * SSE_STRIDE + (j << ss_x_shift);
+                    const __m512i vluma0 = _mm512_loadu_si512((const __m512i *)luma);
+                    if (ss_x_shift) {
+                        const __m512i vluma1 = _mm512_loadu_si512((const __m512i *)(luma + 16));
+                        vdiff_sse            = _mm512_add_epi32(
+                            vdiff_sse, _mm512_permutex2var_epi32(vluma0, vindex_even, vluma1));
+                        vdiff_sse = _mm512_add_epi32(
+                            vdiff_sse, _mm512_permutex2var_epi32(vluma0, vindex_odd, vluma1));
+                    } else {
+                        vdiff_sse = _mm512_add_epi32(vdiff_sse, vluma0);
+                    }
+                }
+            }
+            vdiff_sse = _mm512_srli_epi32(vdiff_sse, 4);
+#if TF_IMP
+            const int     top     = (i >= block_height / 2) * 2;
+            const __m512i vweight = get_weight_avx512(
+                vdiff_sse,
+                num_ref_pixels,
+                blend_subblock_ps(block_error + top, j, block_width),
+                blend_subblock_ps(d_factor + top, j, block_width),
+                block_balacne_inv,
+                n_decay_qr_inv);
+#else
+            const __m512i vweight = get_weight_avx512(vdiff_sse, num_ref_pixels, h);
+#endif
+            const __m512i vpixel = _mm512_cvtepu16_epi32(
+                _mm256_loadu_si256((const __m256i *)(frame2 + i * stride2 + j)));
+            uint16_t *    cnt = count + i * stride2 + j;
+            unsigned int *acc = accumulator + i * stride2 + j;
+
+            _mm256_storeu_si256(
+                (__m256i *)cnt,
+                _mm256_add_epi16(_mm256_loadu_si256((const __m256i *)cnt),
+                                 _mm512_cvtepi32_epi16(vweight)));
+            _mm512_storeu_si512((__m512i *)acc,
+                                _mm512_add_epi32(_mm512_loadu_si512((const __m512i *)acc),
+                                                 _mm512_mullo_epi32(vweight, vpixel)));
+        }
+    }
+}
+
+void svt_av1_apply_temporal_filter_planewise_hbd_avx512(
+#if TF_IMP
+    struct MeContext *context_ptr, const uint16_t *y_src, int y_src_stride, const uint16_t *y_pre,
+    int y_pre_stride, const uint16_t *u_src, const uint16_t *v_src, int uv_src_stride,
+    const uint16_t *u_pre, const uint16_t *v_pre, int uv_pre_stride, unsigned int block_width,
+    unsigned int block_height, int ss_x, int ss_y, const double *noise_levels,
+    const int decay_control, uint32_t *y_accum, uint16_t *y_count, uint32_t *u_accum,
+    uint16_t *u_count, uint32_t *v_accum, uint16_t *v_count) {
+#else
+    const uint16_t *y_src, int y_src_stride, const uint16_t *y_pre, int y_pre_stride,
+    const uint16_t *u_src, const uint16_t *v_src, int uv_src_stride, const uint16_t *u_pre,
+    const uint16_t *v_pre, int uv_pre_stride, unsigned int block_width, unsigned int block_height,
+    int ss_x, int ss_y, const double *noise_levels, const int decay_control, uint32_t *y_accum,
+    uint16_t *y_count, uint32_t *u_accum, uint16_t *u_count, uint32_t *v_accum, uint16_t *v_count) {
+#endif
+    assert(block_width <= BW && "block width too large");
+    assert(block_height <= BH && "block height too large");
+    assert(block_width % 16 == 0 && "block width must be multiple of 16");
+    assert(block_height % 2 == 0 && "block height must be even");
+    assert((ss_x == 0 || ss_x == 1) && (ss_y == 0 || ss_y == 1) && "invalid chroma subsampling");
+
+    const int num_planes = 3;
+    DECLARE_ALIGNED(64, uint32_t, luma_sq_error[SSE_STRIDE * BH]);
+    DECLARE_ALIGNED(64, uint32_t, chroma_sq_error[SSE_STRIDE * BH]);
+
+    for (int plane = 0; plane < num_planes; ++plane) {
+        const uint32_t plane_h    = plane ? (block_height >> ss_y) : block_height;
+        const uint32_t plane_w    = plane ? (block_width >> ss_x) : block_width;
+        const uint32_t src_stride = plane ? uv_src_stride : y_src_stride;
+        const uint32_t pre_stride = plane ? uv_pre_stride : y_pre_stride;
+        const int      ss_x_shift = plane ? ss_x : 0;
+        const int      ss_y_shift = plane ? ss_y : 0;
+
+        const uint16_t *ref  = plane == 0 ? y_src : plane == 1 ? u_src : v_src;
+        const uint16_t *pred = plane == 0 ? y_pre : plane == 1 ? u_pre : v_pre;
+
+        uint32_t *accum = plane == 0 ? y_accum : plane == 1 ? u_accum : v_accum;
+        uint16_t *count = plane == 0 ? y_count : plane == 1 ? u_count : v_count;
+
+        apply_temporal_filter_planewise_hbd(
+#if TF_IMP
+            context_ptr,
+#endif
+            ref,
+            src_stride,
+            pred,
+            pre_stride,
+            plane_w,
+            plane_h,
+            noise_levels[plane],
+            decay_control,
+            accum,
+            count,
+            luma_sq_error,
+            chroma_sq_error,
+            plane,
+            ss_x_shift,
+            ss_y_shift);
+    }
+}
+#endif // !NON_AVX512_SUPPORT
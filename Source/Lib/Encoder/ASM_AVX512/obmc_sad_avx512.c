@@ -0,0 +1,72 @@
+/*
+* Copyright(c) 2019 Intel Corporation
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+#include "EbDefinitions.h"
+
+#ifndef NON_AVX512_SUPPORT
+#include <assert.h>
+#include <immintrin.h>
+
+#include "aom_dsp_rtcd.h"
+
+static INLINE int32_t hsum_epi32_avx512(const __m512i v_d) {
+    const __m256i v_256 =
+        _mm256_add_epi32(_mm512_castsi512_si256(v_d), _mm512_extracti64x4_epi64(v_d, 1));
+    __m128i v_128 =
+        _mm_add_epi32(_mm256_castsi256_si128(v_256), _mm256_extracti128_si256(v_256, 1));
+    v_128 = _mm_hadd_epi32(v_128, v_128);
+    v_128 = _mm_hadd_epi32(v_128, v_128);
+    return _mm_cvtsi128_si32(v_128);
+}
+
+static INLINE unsigned int obmc_sad_w64n_avx512(const uint8_t *pre, const int pre_stride,
+                                                const int32_t *wsrc, const int32_t *mask,
+                                                const int width, const int height) {
+    __m512i       v_sad_d  = _mm512_setzero_si512();
+    const __m512i v_bias_d = _mm512_set1_epi32((1 << 12) >> 1);
+    assert(width >= 64);
+    assert(IS_POWER_OF_TWO(width));
+
+    for (int i = 0; i < height; i++) {
+        for (int j = 0; j < width; j += 16) {
+            const __m128i v_p_b = _mm_loadu_si128((__m128i const *)(pre + j));
+            const __m512i v_m_d = _mm512_loadu_si512((__m512i const *)(mask + j));
+            const __m512i v_w_d = _mm512_loadu_si512((__m512i const *)(wsrc + j));
+            const __m512i v_p_d = _mm512_cvtepu8_epi32(v_p_b);
+
+            // Values in both pre and mask fit in 15 bits, and are packed at 32 bit
+            // boundaries, so pmaddwd gives the same result as pmulld.
+            const __m512i v_pm_d      = _mm512_madd_epi16(v_p_d, v_m_d);
+            const __m512i v_diff_d    = _mm512_sub_epi32(v_w_d, v_pm_d);
+            const __m512i v_absdiff_d = _mm512_abs_epi32(v_diff_d);
+
+            // Rounded absolute difference
+            const __m512i v_tmp_d = _mm512_add_epi32(v_absdiff_d, v_bias_d);
+            const __m512i v_rad_d = _mm512_srli_epi32(v_tmp_d, 12);
+
+            v_sad_d = _mm512_add_epi32(v_sad_d, v_rad_d);
+        }
+        pre += pre_stride;
+        wsrc += width;
+        mask += width;
+    }
+
+    return hsum_epi32_avx512(v_sad_d);
+}
+
+#define OBMCSADWXH(w, h)                                                               \
+    unsigned int aom_obmc_sad##w##x##h##_avx512(                                       \
+        const uint8_t *pre, int pre_stride, const int32_t *wsrc, const int32_t *msk) { \
+        return obmc_sad_w64n_avx512(pre, pre_stride, wsrc, msk, w, h);                 \
+    }
+
+OBMCSADWXH(128, 128)
+OBMCSADWXH(128, 64)
+OBMCSADWXH(64, 128)
+OBMCSADWXH(64, 64)
+OBMCSADWXH(64, 32)
+OBMCSADWXH(64, 16)
+
+#endif // !NON_AVX512_SUPPORT
@@ -0,0 +1,88 @@
+/*
+* Copyright(c) 2019 Intel Corporation
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+#include "EbDefinitions.h"
+
+#ifndef NON_AVX512_SUPPORT
+#include <assert.h>
+#include <immintrin.h>
+
+#include "aom_dsp_rtcd.h"
+
+static INLINE __m128i mm512_add_hi_lo_epi32(const __m512i val) {
+    const __m256i val_256 =
+        _mm256_add_epi32(_mm512_castsi512_si256(val), _mm512_extracti64x4_epi64(val, 1));
+    return _mm_add_epi32(_mm256_castsi256_si128(val_256), _mm256_extracti128_si256(val_256, 1));
+}
+
+// Rounded (wsrc - pre * mask) >> 12 of 16 pixels
+static INLINE __m512i obmc_rdiff_avx512(const uint8_t *const pre, const int32_t *const wsrc,
+                                        const int32_t *const mask) {
+    const __m512i v_bias_d = _mm512_set1_epi32((1 << 12) >> 1);
+    const __m128i v_p_b    = _mm_loadu_si128((__m128i const *)pre);
+    const __m512i v_m_d    = _mm512_loadu_si512((__m512i const *)mask);
+    const __m512i v_w_d    = _mm512_loadu_si512((__m512i const *)wsrc);
+    const __m512i v_p_d    = _mm512_cvtepu8_epi32(v_p_b);
+    const __m512i v_pm_d   = _mm512_madd_epi16(v_p_d, v_m_d);
+    const __m512i v_diff_d = _mm512_sub_epi32(v_w_d, v_pm_d);
+    const __m512i v_sign_d = _mm512_srai_epi32(v_diff_d, 31);
+    const __m512i v_tmp_d  = _mm512_add_epi32(_mm512_add_epi32(v_diff_d, v_bias_d), v_sign_d);
+    return _mm512_srai_epi32(v_tmp_d, 12);
+}
+
+static INLINE void obmc_variance_w64n(const uint8_t *pre, const int pre_stride,
+                                      const int32_t *wsrc, const int32_t *mask,
+                                      unsigned int *const sse, int *const sum, const int w,
+                                      const int h) {
+    __m512i v_sum_d = _mm512_setzero_si512();
+    __m512i v_sse_d = _mm512_setzero_si512();
+
+    assert(w >= 64);
+    assert(IS_POWER_OF_TWO(w));
+    assert(IS_POWER_OF_TWO(h));
+    for (int i = 0; i < h; i++) {
+        for (int j = 0; j < w; j += 32) {
+            const __m512i v_rdiff0_d = obmc_rdiff_avx512(pre + j, wsrc + j, mask + j);
+            const __m512i v_rdiff1_d =
+                obmc_rdiff_avx512(pre + j + 16, wsrc + j + 16, mask + j + 16);
+
+            // The rounded differences fit in 16 bits, square and pair them up
+            // with pmaddwd, the lane order does not matter for the sum
+            const __m512i v_rdiff01_w = _mm512_packs_epi32(v_rdiff0_d, v_rdiff1_d);
+            const __m512i v_sqrdiff_d = _mm512_madd_epi16(v_rdiff01_w, v_rdiff01_w);
+
+            v_sum_d = _mm512_add_epi32(v_sum_d, _mm512_add_epi32(v_rdiff0_d, v_rdiff1_d));
+            v_sse_d = _mm512_add_epi32(v_sse_d, v_sqrdiff_d);
+        }
+        pre += pre_stride;
+        wsrc += w;
+        mask += w;
+    }
+
+    __m128i v_d = _mm_hadd_epi32(mm512_add_hi_lo_epi32(v_sum_d), mm512_add_hi_lo_epi32(v_sse_d));
+    v_d         = _mm_hadd_epi32(v_d, v_d);
+    *sum        = _mm_cvtsi128_si32(v_d);
+    *sse        = _mm_cvtsi128_si32(_mm_srli_si128(v_d, 4));
+}
+
+#define OBMCVARWXH(W, H)                                                          \
+    unsigned int aom_obmc_variance##W##x##H##_avx512(const uint8_t *pre,          \
+                                                     int            pre_stride,   \
+                                                     const int32_t *wsrc,         \
+                                                     const int32_t *mask,         \
+                                                     unsigned int * sse) {         \
+        int sum;                                                                  \
+        obmc_variance_w64n(pre, pre_stride, wsrc, mask, sse, &sum, W, H);         \
+        return *sse - (unsigned int)(((int64_t)sum * sum) / (W * H));             \
+    }
+
+OBMCVARWXH(128, 128)
+OBMCVARWXH(128, 64)
+OBMCVARWXH(64, 128)
+OBMCVARWXH(64, 64)
+OBMCVARWXH(64, 32)
+OBMCVARWXH(64, 16)
+
+#endif // !NON_AVX512_SUPPORT
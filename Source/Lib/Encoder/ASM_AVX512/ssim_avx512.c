@@ -0,0 +1,100 @@
+/*
+* Copyright(c) 2019 Intel Corporation
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+#include "EbDefinitions.h"
+
+#ifndef NON_AVX512_SUPPORT
+#include <immintrin.h>
+
+#include "aom_dsp_rtcd.h"
+
+// Accumulates the SSIM statistics of four rows of 16-bit samples, see
+// ssim_accumulate_avx2()
+static INLINE void ssim_accumulate_avx512(const __m512i s, const __m512i r, __m512i *sum_s,
+                                          __m512i *sum_r, __m512i *sum_sq_s, __m512i *sum_sq_r,
+                                          __m512i *sum_sxr) {
+    *sum_s    = _mm512_add_epi16(*sum_s, s);
+    *sum_r    = _mm512_add_epi16(*sum_r, r);
+    *sum_sq_s = _mm512_add_epi32(*sum_sq_s, _mm512_madd_epi16(s, s));
+    *sum_sq_r = _mm512_add_epi32(*sum_sq_r, _mm512_madd_epi16(r, r));
+    *sum_sxr  = _mm512_add_epi32(*sum_sxr, _mm512_madd_epi16(s, r));
+}
+
+static INLINE void ssim_store_avx512(const __m512i s, const __m512i r, const __m512i sq_s,
+                                     const __m512i sq_r, const __m512i sxr, uint32_t *sum_s,
+                                     uint32_t *sum_r, uint32_t *sum_sq_s, uint32_t *sum_sq_r,
+                                     uint32_t *sum_sxr) {
+    const __m512i one = _mm512_set1_epi16(1);
+    *sum_s += (uint32_t)_mm512_reduce_add_epi32(_mm512_madd_epi16(s, one));
+    *sum_r += (uint32_t)_mm512_reduce_add_epi32(_mm512_madd_epi16(r, one));
+    *sum_sq_s += (uint32_t)_mm512_reduce_add_epi32(sq_s);
+    *sum_sq_r += (uint32_t)_mm512_reduce_add_epi32(sq_r);
+    *sum_sxr += (uint32_t)_mm512_reduce_add_epi32(sxr);
+}
+
+static INLINE __m512i load_u8_8x4_avx512(const uint8_t *p, const int stride) {
+    const __m128i r01 = _mm_unpacklo_epi64(_mm_loadl_epi64((const __m128i *)p),
+                                           _mm_loadl_epi64((const __m128i *)(p + stride)));
+    const __m128i r23 = _mm_unpacklo_epi64(_mm_loadl_epi64((const __m128i *)(p + 2 * stride)),
+                                           _mm_loadl_epi64((const __m128i *)(p + 3 * stride)));
+    return _mm512_cvtepu8_epi16(_mm256_inserti128_si256(_mm256_castsi128_si256(r01), r23, 1));
+}
+
+static INLINE __m512i load_u16_8x4_avx512(const uint16_t *p, const int stride) {
+    __m512i v = _mm512_castsi128_si512(_mm_loadu_si128((const __m128i *)p));
+    v = _mm512_inserti32x4(v, _mm_loadu_si128((const __m128i *)(p + stride)), 1);
+    v = _mm512_inserti32x4(v, _mm_loadu_si128((const __m128i *)(p + 2 * stride)), 2);
+    return _mm512_inserti32x4(v, _mm_loadu_si128((const __m128i *)(p + 3 * stride)), 3);
+}
+
+void aom_ssim_parms_8x8_avx512(const uint8_t *s, int sp, const uint8_t *r, int rp,
+                               uint32_t *sum_s, uint32_t *sum_r, uint32_t *sum_sq_s,
+                               uint32_t *sum_sq_r, uint32_t *sum_sxr) {
+    __m512i s_acc    = _mm512_setzero_si512();
+    __m512i r_acc    = _mm512_setzero_si512();
+    __m512i sq_s_acc = _mm512_setzero_si512();
+    __m512i sq_r_acc = _mm512_setzero_si512();
+    __m512i sxr_acc  = _mm512_setzero_si512();
+
+    for (int i = 0; i < 8; i += 4, s += 4 * sp, r += 4 * rp)
+        ssim_accumulate_avx512(load_u8_8x4_avx512(s, sp),
+                               load_u8_8x4_avx512(r, rp),
+                               &s_acc,
+                               &r_acc,
+                               &sq_s_acc,
+                               &sq_r_acc,
+                               &sxr_acc);
+
+    ssim_store_avx512(
+        s_acc, r_acc, sq_s_acc, sq_r_acc, sxr_acc, sum_s, sum_r, sum_sq_s, sum_sq_r, sum_sxr);
+}
+
+void aom_highbd_ssim_parms_8x8_avx512(const uint8_t *s, int sp, const uint8_t *sinc, int spinc,
+                                      const uint16_t *r, int rp, uint32_t *sum_s,
+                                      uint32_t *sum_r, uint32_t *sum_sq_s, uint32_t *sum_sq_r,
+                                      uint32_t *sum_sxr) {
+    __m512i s_acc    = _mm512_setzero_si512();
+    __m512i r_acc    = _mm512_setzero_si512();
+    __m512i sq_s_acc = _mm512_setzero_si512();
+    __m512i sq_r_acc = _mm512_setzero_si512();
+    __m512i sxr_acc  = _mm512_setzero_si512();
+
+    for (int i = 0; i < 8; i += 4, s += 4 * sp, sinc += 4 * spinc, r += 4 * rp) {
+        const __m512i ss = _mm512_or_si512(_mm512_slli_epi16(load_u8_8x4_avx512(s, sp), 2),
+                                           _mm512_srli_epi16(load_u8_8x4_avx512(sinc, spinc), 6));
+        ssim_accumulate_avx512(ss,
+                               load_u16_8x4_avx512(r, rp),
+                               &s_acc,
+                               &r_acc,
+                               &sq_s_acc,
+                               &sq_r_acc,
+                               &sxr_acc);
+    }
+
+    ssim_store_avx512(
+        s_acc, r_acc, sq_s_acc, sq_r_acc, sxr_acc, sum_s, sum_r, sum_sq_s, sum_sq_r, sum_sxr);
+}
+
+#endif // !NON_AVX512_SUPPORT
@@ -0,0 +1,118 @@
+/*
+* Copyright(c) 2019 Intel Corporation
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+#include "EbDefinitions.h"
+
+#ifndef NON_AVX512_SUPPORT
+#include <immintrin.h>
+
+#include "aom_dsp_rtcd.h"
+
+static INLINE __m128i mm512_add_hi_lo_epi32(const __m512i val) {
+    const __m256i val_256 =
+        _mm256_add_epi32(_mm512_castsi512_si256(val), _mm512_extracti64x4_epi64(val, 1));
+    return _mm_add_epi32(_mm256_castsi256_si128(val_256), _mm256_extracti128_si256(val_256, 1));
+}
+
+static INLINE __m512i sum_to_32bit_avx512(const __m512i sum) {
+    return _mm512_madd_epi16(sum, _mm512_set1_epi16(1));
+}
+
+static INLINE int variance_final_avx512(const __m512i vsse, const __m512i vsum,
+                                        unsigned int *const sse) {
+    const __m128i sse_128 = mm512_add_hi_lo_epi32(vsse);
+    const __m128i sum_128 = mm512_add_hi_lo_epi32(vsum);
+
+    // unpack sse and sum registers and add
+    const __m128i sse_sum_lo = _mm_unpacklo_epi32(sse_128, sum_128);
+    const __m128i sse_sum_hi = _mm_unpackhi_epi32(sse_128, sum_128);
+    const __m128i sse_sum    = _mm_add_epi32(sse_sum_lo, sse_sum_hi);
+
+    // perform the final summation and extract the results
+    const __m128i res = _mm_add_epi32(sse_sum, _mm_srli_si128(sse_sum, 8));
+    *((int *)sse)     = _mm_cvtsi128_si32(res);
+    return _mm_extract_epi32(res, 1);
+}
+
+static INLINE void variance_kernel_avx512(const __m512i src, const __m512i ref,
+                                          __m512i *const sse, __m512i *const sum) {
+    const __m512i adj_sub = _mm512_set1_epi16((short)0xff01); // (1,-1)
+
+    // unpack into pairs of source and reference values
+    const __m512i src_ref0 = _mm512_unpacklo_epi8(src, ref);
+    const __m512i src_ref1 = _mm512_unpackhi_epi8(src, ref);
+
+    // subtract adjacent elements using src*1 + ref*-1
+    const __m512i diff0 = _mm512_maddubs_epi16(src_ref0, adj_sub);
+    const __m512i diff1 = _mm512_maddubs_epi16(src_ref1, adj_sub);
+    const __m512i madd0 = _mm512_madd_epi16(diff0, diff0);
+    const __m512i madd1 = _mm512_madd_epi16(diff1, diff1);
+
+    // add to the running totals
+    *sum = _mm512_add_epi16(*sum, _mm512_add_epi16(diff0, diff1));
+    *sse = _mm512_add_epi32(*sse, _mm512_add_epi32(madd0, madd1));
+}
+
+static INLINE void variance64_kernel_avx512(const uint8_t *const src, const uint8_t *const ref,
+                                            __m512i *const sse, __m512i *const sum) {
+    const __m512i s = _mm512_loadu_si512((__m512i const *)(src));
+    const __m512i r = _mm512_loadu_si512((__m512i const *)(ref));
+    variance_kernel_avx512(s, r, sse, sum);
+}
+
+static INLINE void variance64_avx512(const uint8_t *src, const int src_stride, const uint8_t *ref,
+                                     const int ref_stride, const int h, __m512i *const vsse,
+                                     __m512i *const vsum) {
+    *vsum = _mm512_setzero_si512();
+
+    for (int i = 0; i < h; i++) {
+        variance64_kernel_avx512(src, ref, vsse, vsum);
+        src += src_stride;
+        ref += ref_stride;
+    }
+}
+
+static INLINE void variance128_avx512(const uint8_t *src, const int src_stride,
+                                      const uint8_t *ref, const int ref_stride, const int h,
+                                      __m512i *const vsse, __m512i *const vsum) {
+    *vsum = _mm512_setzero_si512();
+
+    for (int i = 0; i < h; i++) {
+        variance64_kernel_avx512(src + 0, ref + 0, vsse, vsum);
+        variance64_kernel_avx512(src + 64, ref + 64, vsse, vsum);
+        src += src_stride;
+        ref += ref_stride;
+    }
+}
+
+// Each 16-bit sum lane gains at most 2 * 255 per 64 pixels of a row, so the
+// sums are widened to 32 bits every uh rows, before they can overflow.
+#define AOM_VAR_LOOP_AVX512(bw, bh, bits, uh)                                              \
+    unsigned int eb_aom_variance##bw##x##bh##_avx512(const uint8_t *src,                   \
+                                                     int            src_stride,            \
+                                                     const uint8_t *ref,                   \
+                                                     int            ref_stride,            \
+                                                     unsigned int * sse) {                  \
+        __m512i vsse = _mm512_setzero_si512();                                             \
+        __m512i vsum = _mm512_setzero_si512();                                             \
+        for (int i = 0; i < (bh / uh); i++) {                                              \
+            __m512i vsum16;                                                                \
+            variance##bw##_avx512(src, src_stride, ref, ref_stride, uh, &vsse, &vsum16);   \
+            vsum = _mm512_add_epi32(vsum, sum_to_32bit_avx512(vsum16));                    \
+            src += uh * src_stride;                                                        \
+            ref += uh * ref_stride;                                                        \
+        }                                                                                  \
+        const int sum = variance_final_avx512(vsse, vsum, sse);                            \
+        return *sse - (unsigned int)(((int64_t)sum * sum) >> bits);                        \
+    }
+
+AOM_VAR_LOOP_AVX512(64, 16, 10, 16); // 64x16
+AOM_VAR_LOOP_AVX512(64, 32, 11, 32); // 64x32
+AOM_VAR_LOOP_AVX512(64, 64, 12, 64); // 64x64
+AOM_VAR_LOOP_AVX512(64, 128, 13, 64); // 64x64 * (128/64)
+AOM_VAR_LOOP_AVX512(128, 64, 13, 32); // 128x32 * ( 64/32)
+AOM_VAR_LOOP_AVX512(128, 128, 14, 32); // 128x32 * (128/32)
+
+#endif // !NON_AVX512_SUPPORT
@@ -0,0 +1,36 @@
+/*
+* Copyright(c) 2019 Intel Corporation
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+#include <string.h>
+#include <nmmintrin.h>
+
+#include "EbDefinitions.h"
+#include "aom_dsp_rtcd.h"
+
+// CRC-32C with the crc32 instruction; the result matches
+// av1_get_crc32c_value_c().
+uint32_t av1_get_crc32c_value_sse4_2(void *crc_calculator, uint8_t *p, size_t length) {
+    (void)crc_calculator;
+    const uint8_t *buf = p;
+    uint32_t       crc = 0xffffffff;
+
+#if defined(__x86_64__) || defined(_M_X64)
+    uint64_t crc64 = crc;
+    for (; length >= 8; length -= 8, buf += 8) {
+        uint64_t data;
+        memcpy(&data, buf, sizeof(data));
+        crc64 = _mm_crc32_u64(crc64, data);
+    }
+    crc = (uint32_t)crc64;
+#endif
+    for (; length >= 4; length -= 4, buf += 4) {
+        uint32_t data;
+        memcpy(&data, buf, sizeof(data));
+        crc = _mm_crc32_u32(crc, data);
+    }
+    for (; length > 0; length--, buf++) crc = _mm_crc32_u8(crc, *buf);
+
+    return crc ^ 0xffffffff;
+}
@@ -319,8 +319,6 @@ typedef struct IntraBcContext {
     // [two buffers used ping-pong]
     uint32_t *     hash_value_buffer[2][2];
     uint8_t        is_exhaustive_allowed;
-    CRC_CALCULATOR crc_calculator1;
-    CRC_CALCULATOR crc_calculator2;
 } IntraBcContext;
 
 #if BLK_MEM_CLEAN_UP
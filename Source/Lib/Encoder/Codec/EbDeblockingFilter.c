@@ -681,8 +681,27 @@ void loop_filter_sb(EbPictureBufferDesc *frame_buffer, //reconpicture,
     }
 }
 
+// Frame level state of the SB row tasks filtering a frame
+typedef struct LfFrameJob {
+    EbPictureBufferDesc *frame_buffer;
+    PictureControlSet *  pcs_ptr;
+    int32_t              plane_start;
+    int32_t              plane_end;
+    EbWavefront *        wavefront_ptr;
+} LfFrameJob;
+
+static void loop_filter_frame_row(void *job_ptr, uint32_t y_sb_index) {
+    LfFrameJob *job = (LfFrameJob *)job_ptr;
+    eb_av1_loop_filter_sb_row(job->frame_buffer,
+                              job->pcs_ptr,
+                              y_sb_index,
+                              job->plane_start,
+                              job->plane_end,
+                              job->wavefront_ptr);
+}
+
 void eb_av1_loop_filter_frame(EbPictureBufferDesc *frame_buffer, PictureControlSet *pcs_ptr,
-                              int32_t plane_start, int32_t plane_end) {
+                              int32_t plane_start, int32_t plane_end, DlfContext *context_ptr) {
     SequenceControlSet *scs_ptr =
         (SequenceControlSet *)pcs_ptr->parent_pcs_ptr->scs_wrapper_ptr->object_ptr;
     //SuperBlock                     *sb_ptr;
@@ -704,6 +723,15 @@ void eb_av1_loop_filter_frame(EbPictureBufferDesc *frame_buffer, PictureControlS
                                   plane_start,
                                   plane_end);
 
+    EbTaskPool *task_pool = scs_ptr->encode_context_ptr->task_pool;
+    if (context_ptr && task_pool->thread_count) {
+        // Rows are started in order, a row only waits for the row above it
+        LfFrameJob job = {frame_buffer, pcs_ptr, plane_start, plane_end, context_ptr->lf_wavefront};
+        eb_wavefront_reset(job.wavefront_ptr);
+        eb_task_pool_run(task_pool, loop_filter_frame_row, &job, picture_height_in_sb);
+        return;
+    }
+
     for (y_sb_index = 0; y_sb_index < picture_height_in_sb; ++y_sb_index) {
         for (x_sb_index = 0; x_sb_index < pic_width_in_sb; ++x_sb_index) {
             //sb_index        = (uint16_t)(y_sb_index * pic_width_in_sb + x_sb_index);
@@ -723,6 +751,29 @@ void eb_av1_loop_filter_frame(EbPictureBufferDesc *frame_buffer, PictureControlS
         }
     }
 }
+void eb_av1_loop_filter_sb_row(EbPictureBufferDesc *frame_buffer, PictureControlSet *pcs_ptr,
+                               uint32_t y_sb_index, int32_t plane_start, int32_t plane_end,
+                               EbWavefront *wavefront_ptr) {
+    SequenceControlSet *scs_ptr      = pcs_ptr->parent_pcs_ptr->scs_ptr;
+    uint8_t             sb_size_log2 = (uint8_t)eb_log2f(scs_ptr->sb_size_pix);
+    uint32_t            pic_width_in_sb =
+        (pcs_ptr->parent_pcs_ptr->aligned_width + scs_ptr->sb_size_pix - 1) / scs_ptr->sb_size_pix;
+
+    for (uint32_t x_sb_index = 0; x_sb_index < pic_width_in_sb; ++x_sb_index) {
+        // The horizontal edges of the SB on the left, filtered with this SB, read the bottom
+        // lines of the row above, final once its vertical edges up to this SB are filtered
+        if (y_sb_index) eb_wavefront_wait(wavefront_ptr, y_sb_index - 1, x_sb_index + 1);
+        loop_filter_sb(frame_buffer,
+                       pcs_ptr,
+                       NULL,
+                       (y_sb_index << sb_size_log2) >> 2,
+                       (x_sb_index << sb_size_log2) >> 2,
+                       plane_start,
+                       plane_end,
+                       x_sb_index == pic_width_in_sb - 1);
+        eb_wavefront_post(wavefront_ptr, y_sb_index, x_sb_index + 1);
+    }
+}
 extern int16_t eb_av1_ac_quant_q3(int32_t qindex, int32_t delta, AomBitDepth bit_depth);
 
 void eb_copy_buffer(EbPictureBufferDesc *srcBuffer, EbPictureBufferDesc *dstBuffer,
@@ -987,9 +1038,9 @@ uint64_t picture_sse_calculations(PictureControlSet *pcs_ptr, EbPictureBufferDes
 static int64_t try_filter_frame(
     //const Yv12BufferConfig *sd,
     //Av1Comp *const cpi,
-    const EbPictureBufferDesc *sd, EbPictureBufferDesc *temp_lf_recon_buffer,
-    PictureControlSet *pcs_ptr, int32_t filt_level, int32_t partial_frame, int32_t plane,
-    int32_t dir) {
+    DlfContext *context_ptr, const EbPictureBufferDesc *sd,
+    EbPictureBufferDesc *temp_lf_recon_buffer, PictureControlSet *pcs_ptr, int32_t filt_level,
+    int32_t partial_frame, int32_t plane, int32_t dir) {
     (void)sd;
     (void)partial_frame;
     (void)sd;
@@ -1033,7 +1084,7 @@ static int64_t try_filter_frame(
         break;
     }
 
-    eb_av1_loop_filter_frame(recon_buffer, pcs_ptr, plane, plane + 1);
+    eb_av1_loop_filter_frame(recon_buffer, pcs_ptr, plane, plane + 1, context_ptr);
 
     filt_err = picture_sse_calculations(pcs_ptr, recon_buffer, plane);
 
@@ -1047,7 +1098,7 @@ static int64_t try_filter_frame(
 }
 static int32_t search_filter_level(
     //const Yv12BufferConfig *sd, Av1Comp *cpi,
-    EbPictureBufferDesc *sd, // source
+    DlfContext *context_ptr, EbPictureBufferDesc *sd, // source
     EbPictureBufferDesc *temp_lf_recon_buffer, PictureControlSet *pcs_ptr, int32_t partial_frame,
     const int32_t *last_frame_filter_level, double *best_cost_ret, int32_t plane, int32_t dir) {
     const int32_t min_filter_level = 0;
@@ -1107,8 +1158,8 @@ static int32_t search_filter_level(
                    pcs_ptr,
                    (uint8_t)plane);
 
-    best_err =
-        try_filter_frame(sd, temp_lf_recon_buffer, pcs_ptr, filt_mid, partial_frame, plane, dir);
+    best_err = try_filter_frame(
+        context_ptr, sd, temp_lf_recon_buffer, pcs_ptr, filt_mid, partial_frame, plane, dir);
     filt_best        = filt_mid;
     ss_err[filt_mid] = best_err;
 
@@ -1130,7 +1181,7 @@ static int32_t search_filter_level(
             // Get Low filter error score
             if (ss_err[filt_low] < 0) {
                 ss_err[filt_low] = try_filter_frame(
-                    sd, temp_lf_recon_buffer, pcs_ptr, filt_low, partial_frame, plane, dir);
+                    context_ptr, sd, temp_lf_recon_buffer, pcs_ptr, filt_low, partial_frame, plane, dir);
             }
             // If value is close to the best so far then bias towards a lower loop
             // filter value.
@@ -1146,7 +1197,7 @@ static int32_t search_filter_level(
         if (filt_direction >= 0 && filt_high != filt_mid) {
             if (ss_err[filt_high] < 0) {
                 ss_err[filt_high] = try_filter_frame(
-                    sd, temp_lf_recon_buffer, pcs_ptr, filt_high, partial_frame, plane, dir);
+                    context_ptr, sd, temp_lf_recon_buffer, pcs_ptr, filt_high, partial_frame, plane, dir);
             }
             // If value is significantly better than previous best, bias added against
             // raising filter value
@@ -1174,7 +1225,7 @@ static int32_t search_filter_level(
                 // Get Low filter error score
                 if (ss_err[filt_low] < 0) {
                     ss_err[filt_low] = try_filter_frame(
-                        sd, temp_lf_recon_buffer, pcs_ptr, filt_low, partial_frame, plane, dir);
+                        context_ptr, sd, temp_lf_recon_buffer, pcs_ptr, filt_low, partial_frame, plane, dir);
                 }
                 // If value is close to the best so far then bias towards a lower loop
                 // filter value.
@@ -1190,7 +1241,7 @@ static int32_t search_filter_level(
             if (filt_direction >= 0 && filt_high != filt_mid) {
                 if (ss_err[filt_high] < 0) {
                     ss_err[filt_high] = try_filter_frame(
-                        sd, temp_lf_recon_buffer, pcs_ptr, filt_high, partial_frame, plane, dir);
+                        context_ptr, sd, temp_lf_recon_buffer, pcs_ptr, filt_high, partial_frame, plane, dir);
                 }
                 // If value is significantly better than previous best, bias added against
                 // raising filter value
@@ -1284,7 +1335,8 @@ void eb_av1_pick_filter_level(DlfContext *         context_ptr,
                 : context_ptr->temp_lf_recon_picture_ptr;
 
         lf->filter_level[0] = lf->filter_level[1] =
-            search_filter_level(srcBuffer,
+            search_filter_level(context_ptr,
+                                srcBuffer,
                                 temp_lf_recon_buffer,
                                 pcs_ptr,
                                 method == LPF_PICK_FROM_SUBIMAGE,
@@ -1294,7 +1346,8 @@ void eb_av1_pick_filter_level(DlfContext *         context_ptr,
                                 2);
 
         if (num_planes > 1) {
-            lf->filter_level_u = search_filter_level(srcBuffer,
+            lf->filter_level_u = search_filter_level(context_ptr,
+                                                     srcBuffer,
                                                      temp_lf_recon_buffer,
                                                      pcs_ptr,
                                                      method == LPF_PICK_FROM_SUBIMAGE,
@@ -1302,7 +1355,8 @@ void eb_av1_pick_filter_level(DlfContext *         context_ptr,
                                                      NULL,
                                                      1,
                                                      0);
-            lf->filter_level_v = search_filter_level(srcBuffer,
+            lf->filter_level_v = search_filter_level(context_ptr,
+                                                     srcBuffer,
                                                      temp_lf_recon_buffer,
                                                      pcs_ptr,
                                                      method == LPF_PICK_FROM_SUBIMAGE,
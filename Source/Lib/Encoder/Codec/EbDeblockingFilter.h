@@ -20,6 +20,7 @@
 #include "EbNeighborArrays.h"
 #include "EbEncDecProcess.h"
 #include "EbDlfProcess.h"
+#include "EbWavefront.h"
 #include "EbDeblockingCommon.h"
 #include "common_dsp_rtcd.h"
 #ifndef EbDeblockingFilter_h
@@ -56,7 +57,13 @@ void eb_av1_loop_filter_frame(
         //Yv12BufferConfig *frame_buffer,
         PictureControlSet *pcs_ptr,
         /*MacroBlockD *xd,*/ int32_t plane_start, int32_t plane_end/*,
-        int32_t partial_frame*/);
+        int32_t partial_frame*/, DlfContext *context_ptr);
+
+// Filters SB row y_sb_index once eb_av1_loop_filter_frame_init is done for the picture. The
+// progress of the row is posted to wavefront_ptr after each SB, the SBs wait for the row above.
+void eb_av1_loop_filter_sb_row(EbPictureBufferDesc *frame_buffer, PictureControlSet *pcs_ptr,
+                               uint32_t y_sb_index, int32_t plane_start, int32_t plane_end,
+                               EbWavefront *wavefront_ptr);
 
 void eb_av1_pick_filter_level(DlfContext *         context_ptr,
                               EbPictureBufferDesc *srcBuffer, // source input
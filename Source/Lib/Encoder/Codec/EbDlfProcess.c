@@ -33,13 +33,14 @@ static void dlf_context_dctor(EbPtr p) {
     DlfContext *     obj                = (DlfContext *)thread_context_ptr->priv;
     EB_DELETE(obj->temp_lf_recon_picture_ptr);
     EB_DELETE(obj->temp_lf_recon_picture16bit_ptr);
+    EB_DELETE(obj->lf_wavefront);
     EB_FREE_ARRAY(obj);
 }
 /******************************************************
  * Dlf Context Constructor
  ******************************************************/
 EbErrorType dlf_context_ctor(EbThreadContext *thread_context_ptr, const EbEncHandle *enc_handle_ptr,
-                             int index) {
+                             int index, int feedback_index) {
     const SequenceControlSet *scs_ptr = enc_handle_ptr->scs_instance_array[0]->scs_ptr;
     EbBool        is_16bit     = (EbBool)(scs_ptr->static_config.encoder_bit_depth > EB_8BIT);
     EbColorFormat color_format = scs_ptr->static_config.encoder_color_format;
@@ -54,6 +55,8 @@ EbErrorType dlf_context_ctor(EbThreadContext *thread_context_ptr, const EbEncHan
         eb_system_resource_get_consumer_fifo(enc_handle_ptr->enc_dec_results_resource_ptr, index);
     context_ptr->dlf_output_fifo_ptr =
         eb_system_resource_get_producer_fifo(enc_handle_ptr->dlf_results_resource_ptr, index);
+    context_ptr->dlf_feedback_fifo_ptr = eb_system_resource_get_producer_fifo(
+        enc_handle_ptr->enc_dec_results_resource_ptr, feedback_index);
 
     context_ptr->temp_lf_recon_picture16bit_ptr = (EbPictureBufferDesc *)NULL;
     context_ptr->temp_lf_recon_picture_ptr      = (EbPictureBufferDesc *)NULL;
@@ -83,10 +86,128 @@ EbErrorType dlf_context_ctor(EbThreadContext *thread_context_ptr, const EbEncHan
                eb_recon_picture_buffer_desc_ctor,
                (EbPtr)&temp_lf_recon_desc_init_data);
     }
+    EB_NEW(context_ptr->lf_wavefront,
+           eb_wavefront_ctor,
+           (scs_ptr->max_input_luma_height + BLOCK_SIZE_64 - 1) / BLOCK_SIZE_64);
 
     return EB_ErrorNone;
 }
 
+// Whether the DLF processes filter the picture. EncDec filters the SBs of loop_filter_mode 1 as it
+// codes them when the picture has a single tile.
+static EbBool dlf_filters_picture(PictureControlSet *pcs_ptr) {
+    const uint8_t  loop_filter_mode = pcs_ptr->parent_pcs_ptr->loop_filter_mode;
+    const uint16_t total_tile_cnt   = pcs_ptr->parent_pcs_ptr->av1_cm->tiles_info.tile_cols *
+                                    pcs_ptr->parent_pcs_ptr->av1_cm->tiles_info.tile_rows;
+    return (EbBool)(loop_filter_mode >= 2 || (loop_filter_mode == 1 && total_tile_cnt > 1));
+}
+
+// Posts the CDEF segments of the segment rows [seg_row_start, seg_row_end). Called without the
+// DLF mutex of the picture, getting an empty DLF result may wait for the CDEF processes.
+static void post_cdef_segments(DlfContext *context_ptr, EbObjectWrapper *pcs_wrapper_ptr,
+                               uint32_t seg_row_start, uint32_t seg_row_end) {
+    PictureControlSet *pcs_ptr = (PictureControlSet *)pcs_wrapper_ptr->object_ptr;
+    EbObjectWrapper *  dlf_results_wrapper_ptr;
+    struct DlfResults *dlf_results_ptr;
+
+    for (uint32_t y_seg_idx = seg_row_start; y_seg_idx < seg_row_end; ++y_seg_idx) {
+        for (uint32_t x_seg_idx = 0; x_seg_idx < pcs_ptr->cdef_segments_column_count;
+             ++x_seg_idx) {
+            // Get Empty DLF Results to Cdef
+            eb_get_empty_object(context_ptr->dlf_output_fifo_ptr, &dlf_results_wrapper_ptr);
+            dlf_results_ptr = (struct DlfResults *)dlf_results_wrapper_ptr->object_ptr;
+            dlf_results_ptr->pcs_wrapper_ptr = pcs_wrapper_ptr;
+            dlf_results_ptr->segment_index =
+                y_seg_idx * pcs_ptr->cdef_segments_column_count + x_seg_idx;
+            // Post DLF Results
+            eb_post_full_object(dlf_results_wrapper_ptr);
+        }
+    }
+}
+
+// Hands out the CDEF segment rows that can be searched once SB row sb_row and the rows above it
+// are filtered. A segment reads CDEF_VBORDER lines below its last 64x64 row, or below the
+// 128x128 block holding that row. The last segment row is left to dlf_picture_done. Called with
+// the DLF mutex of the picture held: the rows handed out only grow, so the rows returned to
+// concurrent SB row tasks never overlap, whatever the order the tasks finish their rows in.
+static void claim_cdef_segment_rows(PictureControlSet *pcs_ptr, uint32_t sb_row,
+                                    uint32_t *seg_row_start, uint32_t *seg_row_end) {
+    const uint32_t sb_size_log2 =
+        (uint32_t)eb_log2f(pcs_ptr->parent_pcs_ptr->scs_ptr->sb_size_pix);
+    const uint32_t picture_height_in_b64 = (pcs_ptr->parent_pcs_ptr->aligned_height + 64 - 1) / 64;
+    uint32_t       seg_row               = pcs_ptr->cdef_segment_rows_posted;
+
+    while (seg_row + 1 < pcs_ptr->cdef_segments_row_count) {
+        const uint32_t y_b64_end_idx = SEGMENT_END_IDX(
+            seg_row, picture_height_in_b64, pcs_ptr->cdef_segments_row_count);
+        const uint32_t last_line =
+            ALIGN_POWER_OF_TWO(y_b64_end_idx << 6, sb_size_log2) + CDEF_VBORDER - 1;
+        if ((last_line >> sb_size_log2) > sb_row) break;
+        ++seg_row;
+    }
+    *seg_row_start                    = pcs_ptr->cdef_segment_rows_posted;
+    *seg_row_end                      = seg_row;
+    pcs_ptr->cdef_segment_rows_posted = seg_row;
+}
+
+// Called once the picture is filtered. Saves the deblocked lines for the restoration before the
+// last CDEF segments let CDEF filter the frame.
+static void dlf_picture_done(DlfContext *context_ptr, EbObjectWrapper *pcs_wrapper_ptr) {
+    PictureControlSet * pcs_ptr  = (PictureControlSet *)pcs_wrapper_ptr->object_ptr;
+    SequenceControlSet *scs_ptr  = (SequenceControlSet *)pcs_ptr->scs_wrapper_ptr->object_ptr;
+    EbBool              is_16bit = (EbBool)(scs_ptr->static_config.encoder_bit_depth > EB_8BIT);
+    Av1Common *         cm       = pcs_ptr->parent_pcs_ptr->av1_cm;
+    uint32_t            seg_row_start;
+
+    link_eb_to_aom_buffer_desc(pcs_ptr->dlf_recon_picture_ptr,
+                               cm->frame_to_show,
+                               scs_ptr->max_input_pad_right,
+                               scs_ptr->max_input_pad_bottom,
+                               is_16bit || scs_ptr->static_config.is_16bit_pipeline);
+    if (scs_ptr->seq_header.enable_restoration)
+        eb_av1_loop_restoration_save_boundary_lines(cm->frame_to_show, cm, 0);
+
+    eb_block_on_mutex(pcs_ptr->dlf_mutex);
+    seg_row_start                     = pcs_ptr->cdef_segment_rows_posted;
+    pcs_ptr->cdef_segment_rows_posted = pcs_ptr->cdef_segments_row_count;
+    eb_release_mutex(pcs_ptr->dlf_mutex);
+    post_cdef_segments(
+        context_ptr, pcs_wrapper_ptr, seg_row_start, pcs_ptr->cdef_segments_row_count);
+}
+
+// SB row task. Filters the SB rows of the picture handed out in order. The task filtering the
+// last row finishes the picture.
+static void dlf_filter_sb_rows(DlfContext *context_ptr, EbObjectWrapper *pcs_wrapper_ptr) {
+    PictureControlSet * pcs_ptr = (PictureControlSet *)pcs_wrapper_ptr->object_ptr;
+    SequenceControlSet *scs_ptr = (SequenceControlSet *)pcs_ptr->scs_wrapper_ptr->object_ptr;
+    const uint32_t      picture_height_in_sb =
+        (pcs_ptr->parent_pcs_ptr->aligned_height + scs_ptr->sb_size_pix - 1) /
+        scs_ptr->sb_size_pix;
+    uint32_t seg_row_start, seg_row_end;
+
+    for (;;) {
+        eb_block_on_mutex(pcs_ptr->dlf_mutex);
+        const uint32_t sb_row = pcs_ptr->dlf_next_sb_row;
+        if (sb_row < picture_height_in_sb) pcs_ptr->dlf_next_sb_row++;
+        eb_release_mutex(pcs_ptr->dlf_mutex);
+        if (sb_row == picture_height_in_sb) break;
+
+        if (sb_row) eb_wavefront_wait(pcs_ptr->dlf_wavefront, sb_row - 1, 1);
+        eb_av1_loop_filter_sb_row(
+            pcs_ptr->dlf_recon_picture_ptr, pcs_ptr, sb_row, 0, 3, pcs_ptr->dlf_wavefront);
+
+        // The last SB of the row waited for the whole row above, the rows above are filtered
+        eb_block_on_mutex(pcs_ptr->dlf_mutex);
+        claim_cdef_segment_rows(pcs_ptr, sb_row, &seg_row_start, &seg_row_end);
+        const EbBool picture_done =
+            (EbBool)(++pcs_ptr->dlf_filtered_sb_row_count == picture_height_in_sb);
+        eb_release_mutex(pcs_ptr->dlf_mutex);
+
+        post_cdef_segments(context_ptr, pcs_wrapper_ptr, seg_row_start, seg_row_end);
+        if (picture_done) dlf_picture_done(context_ptr, pcs_wrapper_ptr);
+    }
+}
+
 /******************************************************
  * Dlf Kernel
  ******************************************************/
@@ -101,10 +222,6 @@ void *dlf_kernel(void *input_ptr) {
     EbObjectWrapper *enc_dec_results_wrapper_ptr;
     EncDecResults *  enc_dec_results_ptr;
 
-    //// Output
-    EbObjectWrapper *  dlf_results_wrapper_ptr;
-    struct DlfResults *dlf_results_ptr;
-
     // SB Loop variables
     for (;;) {
         // Get EncDec Results
@@ -114,6 +231,12 @@ void *dlf_kernel(void *input_ptr) {
         pcs_ptr             = (PictureControlSet *)enc_dec_results_ptr->pcs_wrapper_ptr->object_ptr;
         scs_ptr             = (SequenceControlSet *)pcs_ptr->scs_wrapper_ptr->object_ptr;
 
+        if (enc_dec_results_ptr->input_type == DLF_TASKS_DLF_INPUT) {
+            dlf_filter_sb_rows(context_ptr, enc_dec_results_ptr->pcs_wrapper_ptr);
+            eb_release_object(enc_dec_results_wrapper_ptr);
+            continue;
+        }
+
         EbBool is_16bit = (EbBool)(scs_ptr->static_config.encoder_bit_depth > EB_8BIT);
 
         if (scs_ptr->static_config.is_16bit_pipeline &&
@@ -180,58 +303,9 @@ void *dlf_kernel(void *input_ptr) {
         }
 
 
-        EbBool dlf_enable_flag = (EbBool)pcs_ptr->parent_pcs_ptr->loop_filter_mode;
-        uint16_t total_tile_cnt = pcs_ptr->parent_pcs_ptr->av1_cm->tiles_info.tile_cols *
-                                  pcs_ptr->parent_pcs_ptr->av1_cm->tiles_info.tile_rows;
-        // Jing: Move sb level lf to here if tile_parallel
-        if ((dlf_enable_flag && pcs_ptr->parent_pcs_ptr->loop_filter_mode >= 2) ||
-            (dlf_enable_flag && pcs_ptr->parent_pcs_ptr->loop_filter_mode == 1 &&
-             total_tile_cnt > 1)) {
-            EbPictureBufferDesc *recon_buffer;
-
-            if (pcs_ptr->parent_pcs_ptr->is_used_as_reference_flag == EB_TRUE)
-                recon_buffer = (scs_ptr->static_config.is_16bit_pipeline || is_16bit)
-                    ? ((EbReferenceObject *)
-                           pcs_ptr->parent_pcs_ptr->reference_picture_wrapper_ptr->object_ptr)
-                          ->reference_picture16bit
-                    : ((EbReferenceObject *)
-                           pcs_ptr->parent_pcs_ptr->reference_picture_wrapper_ptr->object_ptr)
-                          ->reference_picture;
-            else
-                recon_buffer = scs_ptr->static_config.is_16bit_pipeline || is_16bit
-                    ? pcs_ptr->recon_picture16bit_ptr
-                    : pcs_ptr->recon_picture_ptr;
-
-            eb_av1_loop_filter_init(pcs_ptr);
-
-            if (pcs_ptr->parent_pcs_ptr->loop_filter_mode == 2) {
-                eb_av1_pick_filter_level(
-                    context_ptr,
-                    (EbPictureBufferDesc *)pcs_ptr->parent_pcs_ptr->enhanced_picture_ptr,
-                    pcs_ptr,
-                    LPF_PICK_FROM_Q);
-            }
-
-            eb_av1_pick_filter_level(
-                context_ptr,
-                (EbPictureBufferDesc *)pcs_ptr->parent_pcs_ptr->enhanced_picture_ptr,
-                pcs_ptr,
-                LPF_PICK_FROM_FULL_IMAGE);
-
-#if NO_ENCDEC
-            //NO DLF
-            pcs_ptr->parent_pcs_ptr->lf.filter_level[0] = 0;
-            pcs_ptr->parent_pcs_ptr->lf.filter_level[1] = 0;
-            pcs_ptr->parent_pcs_ptr->lf.filter_level_u  = 0;
-            pcs_ptr->parent_pcs_ptr->lf.filter_level_v  = 0;
-#endif
-            eb_av1_loop_filter_frame(recon_buffer, pcs_ptr, 0, 3);
-        }
-
-        //pre-cdef prep
+        //pre-cdef prep, the CDEF search of the top segments may start while deblocking
+        EbPictureBufferDesc *recon_picture_ptr;
         {
-            Av1Common *          cm = pcs_ptr->parent_pcs_ptr->av1_cm;
-            EbPictureBufferDesc *recon_picture_ptr;
             if (is_16bit) {
                 if (pcs_ptr->parent_pcs_ptr->is_used_as_reference_flag == EB_TRUE)
                     recon_picture_ptr =
@@ -258,9 +332,6 @@ void *dlf_kernel(void *input_ptr) {
                     recon_picture_ptr = pcs_ptr->recon_picture16bit_ptr;
                 }
             }
-            link_eb_to_aom_buffer_desc(recon_picture_ptr, cm->frame_to_show, scs_ptr->max_input_pad_right, scs_ptr->max_input_pad_bottom, is_16bit || scs_ptr->static_config.is_16bit_pipeline);
-            if (scs_ptr->seq_header.enable_restoration)
-                eb_av1_loop_restoration_save_boundary_lines(cm->frame_to_show, cm, 0);
             if (scs_ptr->seq_header.enable_cdef && pcs_ptr->parent_pcs_ptr->cdef_filter_mode) {
                 if (scs_ptr->static_config.is_16bit_pipeline || is_16bit) {
                     pcs_ptr->src[0] = (uint16_t *)recon_picture_ptr->buffer_y +
@@ -333,18 +404,57 @@ void *dlf_kernel(void *input_ptr) {
         pcs_ptr->cdef_segments_total_count =
             (uint16_t)(pcs_ptr->cdef_segments_column_count * pcs_ptr->cdef_segments_row_count);
         pcs_ptr->tot_seg_searched_cdef = 0;
-        uint32_t segment_index;
+        pcs_ptr->dlf_recon_picture_ptr     = recon_picture_ptr;
+        pcs_ptr->dlf_next_sb_row           = 0;
+        pcs_ptr->dlf_filtered_sb_row_count = 0;
+        pcs_ptr->cdef_segment_rows_posted  = 0;
 
-        for (segment_index = 0; segment_index < pcs_ptr->cdef_segments_total_count;
-             ++segment_index) {
-            // Get Empty DLF Results to Cdef
-            eb_get_empty_object(context_ptr->dlf_output_fifo_ptr, &dlf_results_wrapper_ptr);
-            dlf_results_ptr = (struct DlfResults *)dlf_results_wrapper_ptr->object_ptr;
-            dlf_results_ptr->pcs_wrapper_ptr = enc_dec_results_ptr->pcs_wrapper_ptr;
-            dlf_results_ptr->segment_index   = segment_index;
-            // Post DLF Results
-            eb_post_full_object(dlf_results_wrapper_ptr);
-        }
+        // Jing: Move sb level lf to here if tile_parallel
+        if (dlf_filters_picture(pcs_ptr)) {
+            eb_av1_loop_filter_init(pcs_ptr);
+
+            if (pcs_ptr->parent_pcs_ptr->loop_filter_mode == 2) {
+                eb_av1_pick_filter_level(
+                    context_ptr,
+                    (EbPictureBufferDesc *)pcs_ptr->parent_pcs_ptr->enhanced_picture_ptr,
+                    pcs_ptr,
+                    LPF_PICK_FROM_Q);
+            }
+
+            eb_av1_pick_filter_level(
+                context_ptr,
+                (EbPictureBufferDesc *)pcs_ptr->parent_pcs_ptr->enhanced_picture_ptr,
+                pcs_ptr,
+                LPF_PICK_FROM_FULL_IMAGE);
+
+#if NO_ENCDEC
+            //NO DLF
+            pcs_ptr->parent_pcs_ptr->lf.filter_level[0] = 0;
+            pcs_ptr->parent_pcs_ptr->lf.filter_level[1] = 0;
+            pcs_ptr->parent_pcs_ptr->lf.filter_level_u  = 0;
+            pcs_ptr->parent_pcs_ptr->lf.filter_level_v  = 0;
+#endif
+            eb_av1_loop_filter_frame_init(&pcs_ptr->parent_pcs_ptr->frm_hdr,
+                                          &pcs_ptr->parent_pcs_ptr->lf_info,
+                                          0,
+                                          3);
+
+            // Filter the SB rows on the DLF processes, the rows are handed out in order
+            const uint32_t picture_height_in_sb =
+                (pcs_ptr->parent_pcs_ptr->aligned_height + scs_ptr->sb_size_pix - 1) /
+                scs_ptr->sb_size_pix;
+            const uint32_t task_count =
+                MIN(picture_height_in_sb, scs_ptr->dlf_process_init_count);
+            for (uint32_t task_index = 0; task_index < task_count; ++task_index) {
+                EbObjectWrapper *dlf_task_wrapper_ptr;
+                eb_get_empty_object(context_ptr->dlf_feedback_fifo_ptr, &dlf_task_wrapper_ptr);
+                EncDecResults *dlf_task_ptr = (EncDecResults *)dlf_task_wrapper_ptr->object_ptr;
+                dlf_task_ptr->pcs_wrapper_ptr = enc_dec_results_ptr->pcs_wrapper_ptr;
+                dlf_task_ptr->input_type      = DLF_TASKS_DLF_INPUT;
+                eb_post_full_object(dlf_task_wrapper_ptr);
+            }
+        } else
+            dlf_picture_done(context_ptr, enc_dec_results_ptr->pcs_wrapper_ptr);
 
         // Release EncDec Results
         eb_release_object(enc_dec_results_wrapper_ptr);
@@ -10,6 +10,9 @@
 #include "EbObject.h"
 #include "EbPictureBufferDesc.h"
 #include "EbSvtAv1Formats.h"
+#include "EbWavefront.h"
+
+struct PictureControlSet;
 
 /**************************************
  * Dlf Context
@@ -17,15 +20,20 @@
 typedef struct DlfContext {
     EbFifo *             dlf_input_fifo_ptr;
     EbFifo *             dlf_output_fifo_ptr;
+    // Posts the SB row tasks of a picture to the DLF processes
+    EbFifo *             dlf_feedback_fifo_ptr;
     EbPictureBufferDesc *temp_lf_recon_picture_ptr;
     EbPictureBufferDesc *temp_lf_recon_picture16bit_ptr;
+    // SBs filtered in each SB row by the filter level search, the rows run on the task pool
+    EbWavefront *        lf_wavefront;
 } DlfContext;
 
 /**************************************
  * Extern Function Declarations
  **************************************/
 extern EbErrorType dlf_context_ctor(EbThreadContext *  thread_context_ptr,
-                                    const EbEncHandle *enc_handle_ptr, int index);
+                                    const EbEncHandle *enc_handle_ptr, int index,
+                                    int feedback_index);
 
 extern void *dlf_kernel(void *input_ptr);
 
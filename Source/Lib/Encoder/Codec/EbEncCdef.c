@@ -17,6 +17,7 @@
 #include <stdint.h>
 #include "aom_dsp_rtcd.h"
 #include "EbLog.h"
+#include "EbTaskPool.h"
 
 extern int16_t eb_av1_ac_quant_q3(int32_t qindex, int32_t delta, AomBitDepth bit_depth);
 
@@ -1171,6 +1172,31 @@ static uint64_t joint_strength_search_dual(int32_t *best_lev0, int32_t *best_lev
     return best_tot_mse;
 }
 
+// Strength set search for one number of signalling bits
+typedef struct CdefStrengthSearch {
+    uint64_t (**mse)[TOTAL_STRENGTHS];
+    int32_t  sb_count;
+    int32_t  start_gi;
+    int32_t  end_gi;
+    int32_t  nb_strength_bits;
+    int32_t  best_lev0[CDEF_MAX_STRENGTHS];
+    int32_t  best_lev1[CDEF_MAX_STRENGTHS];
+    uint64_t tot_mse;
+} CdefStrengthSearch;
+
+// One task per number of signalling bits, the search for 3 bits makes 40 of the 75 search passes
+// and starts first
+static void cdef_strength_search(void *job_ptr, uint32_t task_index) {
+    CdefStrengthSearch *search = (CdefStrengthSearch *)job_ptr + (3 - task_index);
+    search->tot_mse            = joint_strength_search_dual(search->best_lev0,
+                                                 search->best_lev1,
+                                                 1 << search->nb_strength_bits,
+                                                 search->mse,
+                                                 search->sb_count,
+                                                 search->start_gi,
+                                                 search->end_gi);
+}
+
 void finish_cdef_search(EncDecContext *context_ptr, PictureControlSet *pcs_ptr,
                         int32_t selected_strength_cnt[64]) {
     (void)context_ptr;
@@ -1269,15 +1295,25 @@ void finish_cdef_search(EncDecContext *context_ptr, PictureControlSet *pcs_ptr,
         }
     }
 
+    CdefStrengthSearch search[4];
+    memset(search, 0, sizeof(search));
+    for (i = 0; i <= 3; i++) {
+        search[i].mse              = mse;
+        search[i].sb_count         = sb_count;
+        search[i].start_gi         = start_gi;
+        search[i].end_gi           = end_gi;
+        search[i].nb_strength_bits = i;
+    }
+    eb_task_pool_run(ppcs->scs_ptr->encode_context_ptr->task_pool, cdef_strength_search, search, 4);
+    (void)joint_strength_search;
+
     nb_strength_bits = 0;
     /* Search for different number of signalling bits. */
     for (i = 0; i <= 3; i++) {
-        int32_t best_lev0[CDEF_MAX_STRENGTHS];
-        int32_t best_lev1[CDEF_MAX_STRENGTHS] = {0};
-        nb_strengths                          = 1 << i;
-        uint64_t tot_mse                      = joint_strength_search_dual(
-            best_lev0, best_lev1, nb_strengths, mse, sb_count, start_gi, end_gi);
-        (void)joint_strength_search;
+        const int32_t *best_lev0 = search[i].best_lev0;
+        const int32_t *best_lev1 = search[i].best_lev1;
+        nb_strengths             = 1 << i;
+        uint64_t tot_mse         = search[i].tot_mse;
         /* Count superblock signalling cost. */
         const int total_bits =
             sb_count * i + nb_strengths * CDEF_STRENGTH_BITS * 2;
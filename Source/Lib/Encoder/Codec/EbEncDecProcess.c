@@ -25,6 +25,7 @@
 #include "grainSynthesis.h"
 //To fix warning C4013: 'convert_16bit_to_8bit' undefined; assuming extern returning int
 #include "common_dsp_rtcd.h"
+#include "aom_dsp_rtcd.h"
 #include "EbRateDistortionCost.h"
 #include "EbPictureDecisionProcess.h"
 
@@ -407,7 +408,7 @@ static void enc_dec_configure_sb(EncDecContext *context_ptr, SuperBlock *sb_ptr,
  *   of the segment-row (b) as this would block other
  *   threads from performing an update (A).
  ******************************************************/
-EbBool assign_enc_dec_segments(EncDecSegments *segmentPtr, uint16_t *segmentInOutIndex,
+EbBool assign_enc_dec_segments(EncDecSegments *segmentPtr, uint32_t *segmentInOutIndex,
                                EncDecTasks *taskPtr, EbFifo *srmFifoPtr) {
     EbBool           continue_processing_flag = EB_FALSE;
     uint32_t row_segment_index = 0;
@@ -578,8 +579,45 @@ void recon_output(PictureControlSet *pcs_ptr, SequenceControlSet *scs_ptr) {
                 else {
                     if (is_16bit)
                         recon_ptr = pcs_ptr->recon_picture16bit_ptr;
-                    else
+                    else {
                         recon_ptr = pcs_ptr->recon_picture_ptr;
+                        // The 16 bit pipeline filters the non reference pictures in 16 bit only
+                        if (scs_ptr->static_config.is_16bit_pipeline) {
+                            EbPictureBufferDesc *recon_16bit_ptr = pcs_ptr->recon_picture16bit_ptr;
+                            convert_16bit_to_8bit(
+                                (uint16_t *)recon_16bit_ptr->buffer_y +
+                                    recon_16bit_ptr->origin_y * recon_16bit_ptr->stride_y +
+                                    recon_16bit_ptr->origin_x,
+                                recon_16bit_ptr->stride_y,
+                                recon_ptr->buffer_y + recon_ptr->origin_y * recon_ptr->stride_y +
+                                    recon_ptr->origin_x,
+                                recon_ptr->stride_y,
+                                recon_ptr->width,
+                                recon_ptr->height);
+                            convert_16bit_to_8bit(
+                                (uint16_t *)recon_16bit_ptr->buffer_cb +
+                                    (recon_16bit_ptr->origin_y >> 1) * recon_16bit_ptr->stride_cb +
+                                    (recon_16bit_ptr->origin_x >> 1),
+                                recon_16bit_ptr->stride_cb,
+                                recon_ptr->buffer_cb +
+                                    (recon_ptr->origin_y >> 1) * recon_ptr->stride_cb +
+                                    (recon_ptr->origin_x >> 1),
+                                recon_ptr->stride_cb,
+                                recon_ptr->width >> 1,
+                                recon_ptr->height >> 1);
+                            convert_16bit_to_8bit(
+                                (uint16_t *)recon_16bit_ptr->buffer_cr +
+                                    (recon_16bit_ptr->origin_y >> 1) * recon_16bit_ptr->stride_cr +
+                                    (recon_16bit_ptr->origin_x >> 1),
+                                recon_16bit_ptr->stride_cr,
+                                recon_ptr->buffer_cr +
+                                    (recon_ptr->origin_y >> 1) * recon_ptr->stride_cr +
+                                    (recon_ptr->origin_x >> 1),
+                                recon_ptr->stride_cr,
+                                recon_ptr->width >> 1,
+                                recon_ptr->height >> 1);
+                        }
+                    }
                 }
             }
 
@@ -774,14 +812,14 @@ static double similarity(uint32_t sum_s, uint32_t sum_r, uint32_t sum_sq_s,
 
 static double ssim_8x8(const uint8_t *s, int sp, const uint8_t *r, int rp) {
   uint32_t sum_s = 0, sum_r = 0, sum_sq_s = 0, sum_sq_r = 0, sum_sxr = 0;
-  aom_ssim_parms_8x8_c(s, sp, r, rp, &sum_s, &sum_r, &sum_sq_s, &sum_sq_r, &sum_sxr);
+  aom_ssim_parms_8x8(s, sp, r, rp, &sum_s, &sum_r, &sum_sq_s, &sum_sq_r, &sum_sxr);
   return similarity(sum_s, sum_r, sum_sq_s, sum_sq_r, sum_sxr, 64, 8);
 }
 
 static double highbd_ssim_8x8(const uint8_t *s, int sp, const uint8_t *sinc, int spinc, const uint16_t *r,
                               int rp, uint32_t bd, uint32_t shift) {
   uint32_t sum_s = 0, sum_r = 0, sum_sq_s = 0, sum_sq_r = 0, sum_sxr = 0;
-  aom_highbd_ssim_parms_8x8_c(s, sp, sinc, spinc, r, rp, &sum_s, &sum_r, &sum_sq_s, &sum_sq_r, &sum_sxr);
+  aom_highbd_ssim_parms_8x8(s, sp, sinc, spinc, r, rp, &sum_s, &sum_r, &sum_sq_s, &sum_sq_r, &sum_sxr);
   return similarity(sum_s >> shift, sum_r >> shift, sum_sq_s >> (2 * shift),
                     sum_sq_r >> (2 * shift), sum_sxr >> (2 * shift), 64, bd);
 }
@@ -10304,6 +10342,24 @@ void build_starting_cand_block_array(SequenceControlSet *scs_ptr, PictureControl
 #endif
 #endif
 
+// Hands the picture to the DLF processes
+static void post_enc_dec_results(EncDecContext *context_ptr, EbObjectWrapper *pcs_wrapper_ptr,
+                                 uint32_t picture_height_in_sb) {
+    EbObjectWrapper *enc_dec_results_wrapper_ptr;
+    EncDecResults *  enc_dec_results_ptr;
+
+    // Get Empty EncDec Results
+    eb_get_empty_object(context_ptr->enc_dec_output_fifo_ptr, &enc_dec_results_wrapper_ptr);
+    enc_dec_results_ptr = (EncDecResults *)enc_dec_results_wrapper_ptr->object_ptr;
+    enc_dec_results_ptr->pcs_wrapper_ptr = pcs_wrapper_ptr;
+    enc_dec_results_ptr->input_type      = DLF_TASKS_ENCDEC_INPUT;
+    //CHKN these are not needed for DLF
+    enc_dec_results_ptr->completed_sb_row_index_start = 0;
+    enc_dec_results_ptr->completed_sb_row_count       = picture_height_in_sb;
+    // Post EncDec Results
+    eb_post_full_object(enc_dec_results_wrapper_ptr);
+}
+
 /* EncDec (Encode Decode) Kernel */
 /*********************************************************************************
 *
@@ -10353,9 +10409,6 @@ void *enc_dec_kernel(void *input_ptr) {
     EbObjectWrapper *enc_dec_tasks_wrapper_ptr;
     EncDecTasks *    enc_dec_tasks_ptr;
 
-    // Output
-    EbObjectWrapper *enc_dec_results_wrapper_ptr;
-    EncDecResults *  enc_dec_results_ptr;
     // SB Loop variables
     SuperBlock *sb_ptr;
     uint16_t    sb_index;
@@ -10366,7 +10419,7 @@ void *enc_dec_kernel(void *input_ptr) {
     MdcSbData * mdc_ptr;
 
     // Segments
-    uint16_t        segment_index;
+    uint32_t        segment_index;
     uint32_t        x_sb_start_index;
     uint32_t        y_sb_start_index;
     uint32_t        sb_start_index;
@@ -10396,6 +10449,8 @@ void *enc_dec_kernel(void *input_ptr) {
         context_ptr->sb_sz = sb_sz;
         uint32_t pic_width_in_sb = (pcs_ptr->parent_pcs_ptr->aligned_width + sb_sz - 1) >>
             sb_size_log2;
+        uint32_t picture_height_in_sb =
+            (pcs_ptr->parent_pcs_ptr->aligned_height + sb_sz - 1) >> sb_size_log2;
         uint16_t tile_group_width_in_sb = pcs_ptr->parent_pcs_ptr
                                               ->tile_group_info[context_ptr->tile_group_index]
                                               .tile_group_width_in_sb;
@@ -10971,18 +11026,9 @@ void *enc_dec_kernel(void *input_ptr) {
 #endif
         }
 
-        if (last_sb_flag) {
-            // Get Empty EncDec Results
-            eb_get_empty_object(context_ptr->enc_dec_output_fifo_ptr, &enc_dec_results_wrapper_ptr);
-            enc_dec_results_ptr = (EncDecResults *)enc_dec_results_wrapper_ptr->object_ptr;
-            enc_dec_results_ptr->pcs_wrapper_ptr = enc_dec_tasks_ptr->pcs_wrapper_ptr;
-            //CHKN these are not needed for DLF
-            enc_dec_results_ptr->completed_sb_row_index_start = 0;
-            enc_dec_results_ptr->completed_sb_row_count =
-                ((pcs_ptr->parent_pcs_ptr->aligned_height + scs_ptr->sb_size_pix - 1) >> sb_size_log2);
-            // Post EncDec Results
-            eb_post_full_object(enc_dec_results_wrapper_ptr);
-        }
+        if (last_sb_flag)
+            post_enc_dec_results(
+                context_ptr, enc_dec_tasks_ptr->pcs_wrapper_ptr, picture_height_in_sb);
         // Release Mode Decision Results
         eb_release_object(enc_dec_tasks_wrapper_ptr);
     }
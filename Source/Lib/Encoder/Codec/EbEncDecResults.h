@@ -12,12 +12,16 @@
 #ifdef __cplusplus
 extern "C" {
 #endif
+#define DLF_TASKS_ENCDEC_INPUT 0
+#define DLF_TASKS_DLF_INPUT 1
+
 /**************************************
      * Process Results
      **************************************/
 typedef struct EncDecResults {
     EbDctor          dctor;
     EbObjectWrapper *pcs_wrapper_ptr;
+    uint32_t         input_type;
     uint32_t         completed_sb_row_index_start;
     uint32_t         completed_sb_row_count;
 } EncDecResults;
@@ -7,6 +7,7 @@
 #include <string.h>
 
 #include "EbEncDecSegments.h"
+#include "EbUtility.h"
 
 static void enc_dec_segments_dctor(EbPtr p) {
     EncDecSegments *obj = (EncDecSegments *)p;
@@ -70,6 +71,10 @@ void enc_dec_segments_init(EncDecSegments *segments_ptr, uint32_t segColCount, u
     segRowCount = (segRowCount < segments_ptr->segment_max_row_count)
                       ? segRowCount
                       : segments_ptr->segment_max_row_count;
+    segColCount = (segColCount < segments_ptr->segment_max_band_count -
+                                     segments_ptr->segment_max_row_count)
+                      ? segColCount
+                      : segments_ptr->segment_max_band_count - segments_ptr->segment_max_row_count;
 
     segments_ptr->sb_row_count       = pic_height_sb;
     segments_ptr->sb_band_count      = BAND_TOTAL_COUNT(pic_height_sb, pic_width_sb);
@@ -120,13 +125,13 @@ void enc_dec_segments_init(EncDecSegments *segments_ptr, uint32_t segColCount, u
             0, y, segments_ptr->segment_band_count, segments_ptr->sb_band_count);
 
         segments_ptr->row_array[row_index].starting_seg_index =
-            (uint16_t)SEGMENT_INDEX(row_index, band_index, segments_ptr->segment_band_count);
+            SEGMENT_INDEX(row_index, band_index, segments_ptr->segment_band_count);
         band_index = BAND_INDEX(pic_width_sb - 1,
                                 y_last,
                                 segments_ptr->segment_band_count,
                                 segments_ptr->sb_band_count);
         segments_ptr->row_array[row_index].ending_seg_index =
-            (uint16_t)SEGMENT_INDEX(row_index, band_index, segments_ptr->segment_band_count);
+            SEGMENT_INDEX(row_index, band_index, segments_ptr->segment_band_count);
         segments_ptr->row_array[row_index].current_seg_index =
             segments_ptr->row_array[row_index].starting_seg_index;
     }
@@ -155,3 +160,26 @@ void enc_dec_segments_init(EncDecSegments *segments_ptr, uint32_t segColCount, u
 
     return;
 }
+
+/*
+* The grid from the sequence settings has one segment per SB, which gives the most
+* parallelism but pays the scheduling cost (task, mutexes, MD reset) for every SB.
+* Pictures of higher temporal layers are cheaper to encode per SB (fewer candidates,
+* smaller residuals), so each layer above the base merges one more SB per dimension,
+* up to ENCDEC_SEGMENT_MAX_MERGE. Merging stops short of leaving fewer than
+* ENCDEC_SEGMENT_MIN_PER_PROCESS segments per EncDec process, and the row count is
+* kept at process_count or more so that every EncDec process can still work on its
+* own segment row. The grid only depends on the picture and the settings, never on
+* timing, so the same input always gets the same grid.
+*/
+void enc_dec_segments_adapt(uint32_t *col_count, uint32_t *row_count, uint32_t sb_count,
+                            uint8_t temporal_layer, uint32_t process_count) {
+    uint32_t merge = MIN(1 + temporal_layer, ENCDEC_SEGMENT_MAX_MERGE);
+
+    while (merge > 1 &&
+           sb_count / (merge * merge) < ENCDEC_SEGMENT_MIN_PER_PROCESS * process_count)
+        merge--;
+
+    *col_count = MAX(1, *col_count / merge);
+    *row_count = MAX(MIN(*row_count, process_count), *row_count / merge);
+}
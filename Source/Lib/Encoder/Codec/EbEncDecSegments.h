@@ -15,11 +15,11 @@ extern "C" {
 /**************************************
      * Defines
      **************************************/
-#define ENCDEC_SEGMENTS_MAX_COL_COUNT 60
-#define ENCDEC_SEGMENTS_MAX_ROW_COUNT 37
-#define ENCDEC_SEGMENTS_MAX_BAND_COUNT ENCDEC_SEGMENTS_MAX_COL_COUNT + ENCDEC_SEGMENTS_MAX_ROW_COUNT
-#define ENCDEC_SEGMENTS_MAX_COUNT ENCDEC_SEGMENTS_MAX_BAND_COUNT *ENCDEC_SEGMENTS_MAX_ROW_COUNT
-#define ENCDEC_SEGMENT_INVALID 0xFFFF
+#define ENCDEC_SEGMENT_INVALID 0xFFFFFFFF
+// Segments per EncDec process a picture keeps when its SBs are merged
+#define ENCDEC_SEGMENT_MIN_PER_PROCESS 4
+// Maximum number of SBs merged per segment dimension
+#define ENCDEC_SEGMENT_MAX_MERGE 8
 
 /**************************************
       * Macros
@@ -42,9 +42,9 @@ typedef struct EncDecSegDependencyMap {
 } EncDecSegDependencyMap;
 
 typedef struct EncDecSegSegmentRow {
-    uint16_t starting_seg_index;
-    uint16_t ending_seg_index;
-    uint16_t current_seg_index;
+    uint32_t starting_seg_index;
+    uint32_t ending_seg_index;
+    uint32_t current_seg_index;
     EbHandle assignment_mutex;
 } EncDecSegSegmentRow;
 
@@ -80,6 +80,10 @@ extern EbErrorType enc_dec_segments_ctor(EncDecSegments *segments_ptr,
 extern void enc_dec_segments_init(EncDecSegments *segments_ptr, uint32_t col_count,
                                   uint32_t row_count, uint32_t pic_width_sb,
                                   uint32_t pic_height_sb);
+
+// Coarsens the segment grid of a picture from its temporal layer and SB count
+extern void enc_dec_segments_adapt(uint32_t *col_count, uint32_t *row_count, uint32_t sb_count,
+                                   uint8_t temporal_layer, uint32_t process_count);
 #ifdef __cplusplus
 }
 #endif
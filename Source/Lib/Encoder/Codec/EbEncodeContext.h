@@ -21,6 +21,7 @@
 #include "EbPredictionStructure.h"
 #include "EbRateControlTables.h"
 #include "EbObject.h"
+#include "EbTaskPool.h"
 
 // *Note - the queues are small for testing purposes.  They should be increased when they are done.
 #define PRE_ASSIGNMENT_MAX_DEPTH 128 // should be large enough to hold an entire prediction period
@@ -169,6 +170,8 @@ typedef struct EncodeContext {
     EbHandle         shared_reference_mutex;
     uint64_t picture_number_alt; // The picture number overlay includes all the overlay frames
     EbHandle stat_file_mutex;
+    // Threads shared by the processes to split the serial parts of a picture
+    EbTaskPool *task_pool;
     //DPB list management
     DPBInfo dpb_list[REF_FRAMES];
     uint64_t display_picture_number;
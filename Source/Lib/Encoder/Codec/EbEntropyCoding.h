@@ -215,6 +215,10 @@ extern int32_t eb_av1_get_pred_context_single_ref_p6(const MacroBlockD *xd);
 
 extern EbErrorType write_frame_header_av1(Bitstream *bitstream_ptr, SequenceControlSet *scs_ptr,
                                           PictureControlSet *pcs_ptr, uint8_t show_existing);
+extern EbErrorType write_frame_header_obu_av1(Bitstream *bitstream_ptr, SequenceControlSet *scs_ptr,
+                                              PictureControlSet *pcs_ptr);
+extern EbErrorType write_tile_group_obu_av1(Bitstream *bitstream_ptr, PictureControlSet *pcs_ptr,
+                                            uint16_t tile_idx);
 extern EbErrorType encode_td_av1(uint8_t *bitstream_ptr);
 extern EbErrorType encode_sps_av1(Bitstream *bitstream_ptr, SequenceControlSet *scs_ptr);
 
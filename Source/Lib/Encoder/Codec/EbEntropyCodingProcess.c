@@ -167,27 +167,24 @@ void eb_av1_build_nmv_cost_table(int32_t *mvjoint, int32_t *mvcost[2], const Nmv
 /**************************************************
  * Reset Entropy Coding Picture
  **************************************************/
-static void reset_entropy_coding_picture(EntropyCodingContext *context_ptr,
-                                         PictureControlSet *pcs_ptr, SequenceControlSet *scs_ptr) {
-    uint16_t tile_cnt = pcs_ptr->parent_pcs_ptr->av1_cm->tiles_info.tile_rows *
+static void reset_entropy_coding_picture(PictureControlSet *pcs_ptr, SequenceControlSet *scs_ptr) {
+    uint16_t     tile_cnt = pcs_ptr->parent_pcs_ptr->av1_cm->tiles_info.tile_rows *
                         pcs_ptr->parent_pcs_ptr->av1_cm->tiles_info.tile_cols;
-    uint16_t tile_idx = 0;
-#if !EC_MEM_OPT
-    for (tile_idx = 0; tile_idx < tile_cnt; tile_idx++) {
-        output_bitstream_reset(entropy_coder_get_bitstream_ptr(
-            pcs_ptr->entropy_coding_info[tile_idx]->entropy_coder_ptr));
-    }
-#endif
-    uint32_t entropy_coding_qp;
-
-    context_ptr->is_16bit = (EbBool)(scs_ptr->static_config.encoder_bit_depth > EB_8BIT);
+    uint16_t     tile_idx = 0;
     FrameHeader *frm_hdr  = &pcs_ptr->parent_pcs_ptr->frm_hdr;
-    // Asuming cb and cr offset to be the same for chroma QP in both slice and pps for lambda computation
-    entropy_coding_qp = pcs_ptr->parent_pcs_ptr->frm_hdr.quantization_params.base_q_idx;
 
+    // Sub-frame output: the header is complete once restoration is done, so write it
+    // now and let packetization append the tiles as they finish
+    if (scs_ptr->static_config.subframe_output) {
+        bitstream_reset(pcs_ptr->bitstream_ptr);
+        if (frm_hdr->frame_type == KEY_FRAME) encode_sps_av1(pcs_ptr->bitstream_ptr, scs_ptr);
+        write_frame_header_obu_av1(pcs_ptr->bitstream_ptr, scs_ptr, pcs_ptr);
+    }
     for (tile_idx = 0; tile_idx < tile_cnt; tile_idx++) {
         pcs_ptr->parent_pcs_ptr->prev_qindex[tile_idx] =
             pcs_ptr->parent_pcs_ptr->frm_hdr.quantization_params.base_q_idx;
+        // cleared for all tiles before any can finish, packetization polls it with sub-frame output
+        pcs_ptr->entropy_coding_info[tile_idx]->entropy_coding_tile_done = EB_FALSE;
     }
     if (pcs_ptr->parent_pcs_ptr->frm_hdr.allow_intrabc)
         assert(pcs_ptr->parent_pcs_ptr->frm_hdr.delta_lf_params.delta_lf_present == 0);
@@ -198,39 +195,53 @@ static void reset_entropy_coding_picture(EntropyCodingContext *context_ptr,
         for (int32_t lf_id = 0; lf_id < frame_lf_count; ++lf_id)
             pcs_ptr->parent_pcs_ptr->prev_delta_lf[lf_id] = 0;
     }
-
-    // pass the ent
-    for (tile_idx = 0; tile_idx < tile_cnt; tile_idx++) {
-        OutputBitstreamUnit *output_bitstream_ptr =
-            (OutputBitstreamUnit *)(pcs_ptr->entropy_coding_info[tile_idx]
-                                        ->entropy_coder_ptr->ec_output_bitstream_ptr);
-        //****************************************************************//
-        uint8_t *data = output_bitstream_ptr->buffer_av1;
-        pcs_ptr->entropy_coding_info[tile_idx]->entropy_coder_ptr->ec_writer.allow_update_cdf =
-            !pcs_ptr->parent_pcs_ptr->large_scale_tile;
-        pcs_ptr->entropy_coding_info[tile_idx]->entropy_coder_ptr->ec_writer.allow_update_cdf =
-            pcs_ptr->entropy_coding_info[tile_idx]->entropy_coder_ptr->ec_writer.allow_update_cdf &&
-            !frm_hdr->disable_cdf_update;
-
-        aom_start_encode(&pcs_ptr->entropy_coding_info[tile_idx]->entropy_coder_ptr->ec_writer,
-                         data);
-
-        // ADD Reset here
-        if (pcs_ptr->parent_pcs_ptr->frm_hdr.primary_ref_frame != PRIMARY_REF_NONE)
-            eb_memcpy(pcs_ptr->entropy_coding_info[tile_idx]->entropy_coder_ptr->fc,
-                   &pcs_ptr->ref_frame_context[pcs_ptr->parent_pcs_ptr->frm_hdr.primary_ref_frame],
-                   sizeof(FRAME_CONTEXT));
-        else
-            reset_entropy_coder(scs_ptr->encode_context_ptr,
-                                pcs_ptr->entropy_coding_info[tile_idx]->entropy_coder_ptr,
-                                entropy_coding_qp,
-                                pcs_ptr->slice_type);
-
-        entropy_coding_reset_neighbor_arrays(pcs_ptr, tile_idx);
-    }
     return;
 }
 
+/**************************************************
+ * Reset Entropy Coding Tile
+ *
+ * Each tile has its own entropy coder and neighbor
+ *   arrays, so they are reset by the process coding
+ *   the tile and the tiles start independently.
+ **************************************************/
+static void reset_entropy_coding_tile(EntropyCodingContext *context_ptr,
+                                      PictureControlSet *pcs_ptr, SequenceControlSet *scs_ptr,
+                                      uint16_t tile_idx) {
+    EntropyCoder *entropy_coder_ptr = pcs_ptr->entropy_coding_info[tile_idx]->entropy_coder_ptr;
+    FrameHeader * frm_hdr           = &pcs_ptr->parent_pcs_ptr->frm_hdr;
+#if !EC_MEM_OPT
+    output_bitstream_reset(entropy_coder_get_bitstream_ptr(entropy_coder_ptr));
+#endif
+    context_ptr->is_16bit = (EbBool)(scs_ptr->static_config.encoder_bit_depth > EB_8BIT);
+
+    // Asuming cb and cr offset to be the same for chroma QP in both slice and pps for lambda computation
+    uint32_t entropy_coding_qp = frm_hdr->quantization_params.base_q_idx;
+
+    OutputBitstreamUnit *output_bitstream_ptr =
+        (OutputBitstreamUnit *)(entropy_coder_ptr->ec_output_bitstream_ptr);
+    //****************************************************************//
+    uint8_t *data = output_bitstream_ptr->buffer_av1;
+    entropy_coder_ptr->ec_writer.allow_update_cdf = !pcs_ptr->parent_pcs_ptr->large_scale_tile;
+    entropy_coder_ptr->ec_writer.allow_update_cdf =
+        entropy_coder_ptr->ec_writer.allow_update_cdf && !frm_hdr->disable_cdf_update;
+
+    aom_start_encode(&entropy_coder_ptr->ec_writer, data);
+
+    // ADD Reset here
+    if (frm_hdr->primary_ref_frame != PRIMARY_REF_NONE)
+        eb_memcpy(entropy_coder_ptr->fc,
+               &pcs_ptr->ref_frame_context[frm_hdr->primary_ref_frame],
+               sizeof(FRAME_CONTEXT));
+    else
+        reset_entropy_coder(scs_ptr->encode_context_ptr,
+                            entropy_coder_ptr,
+                            entropy_coding_qp,
+                            pcs_ptr->slice_type);
+
+    entropy_coding_reset_neighbor_arrays(pcs_ptr, tile_idx);
+}
+
 /******************************************************
  * Update Entropy Coding Rows
  *
@@ -389,6 +400,8 @@ void *entropy_coding_kernel(void *input_ptr) {
 
         {
             EbBool   frame_entropy_done = EB_FALSE, initial_process_call = EB_TRUE;
+            EbBool   tile_entropy_done  = EB_FALSE;
+            uint64_t decode_order       = 0;
             uint32_t y_sb_index = rest_results_ptr->completed_sb_row_index_start;
 
             // SB-loops
@@ -404,9 +417,10 @@ void *entropy_coding_kernel(void *input_ptr) {
                     if (pcs_ptr->entropy_coding_pic_reset_flag) {
                         pcs_ptr->entropy_coding_pic_reset_flag = EB_FALSE;
 
-                        reset_entropy_coding_picture(context_ptr, pcs_ptr, scs_ptr);
+                        reset_entropy_coding_picture(pcs_ptr, scs_ptr);
                     }
                     eb_release_mutex(pcs_ptr->entropy_coding_pic_mutex);
+                    reset_entropy_coding_tile(context_ptr, pcs_ptr, scs_ptr, tile_idx);
                     pcs_ptr->entropy_coding_info[tile_idx]->entropy_coding_tile_done = EB_FALSE;
                 }
 
@@ -488,6 +502,13 @@ void *entropy_coding_kernel(void *input_ptr) {
                                 break;
                             }
                         }
+                        // Keep the picture alive for packetization: once the mutex is
+                        // released the last tile may finish and the picture be released
+                        if (!pic_ready && scs_ptr->static_config.subframe_output) {
+                            eb_object_inc_live_count(rest_results_ptr->pcs_wrapper_ptr, 1);
+                            tile_entropy_done = EB_TRUE;
+                            decode_order      = pcs_ptr->parent_pcs_ptr->decode_order;
+                        }
                         eb_release_mutex(pcs_ptr->entropy_coding_pic_mutex);
 
                         //Jing, two pass doesn't work with multi-tile right now
@@ -559,7 +580,7 @@ void *entropy_coding_kernel(void *input_ptr) {
             }
             // Move the post here.
             // In some cases, PAK ends fast, pcs will be released before we quit the while-loop
-            if (frame_entropy_done) {
+            if (frame_entropy_done || tile_entropy_done) {
                 // Get Empty Entropy Coding Results
                 eb_get_empty_object(context_ptr->entropy_coding_output_fifo_ptr,
                         &entropy_coding_results_wrapper_ptr);
@@ -568,6 +589,8 @@ void *entropy_coding_kernel(void *input_ptr) {
                     entropy_coding_results_wrapper_ptr->object_ptr;
                 entropy_coding_results_ptr->pcs_wrapper_ptr =
                     rest_results_ptr->pcs_wrapper_ptr;
+                entropy_coding_results_ptr->partial      = tile_entropy_done;
+                entropy_coding_results_ptr->decode_order = decode_order;
 
                 // Post EntropyCoding Results
                 eb_post_full_object(entropy_coding_results_wrapper_ptr);
@@ -18,6 +18,10 @@ extern "C" {
 typedef struct EntropyCodingResults {
     EbDctor          dctor;
     EbObjectWrapper *pcs_wrapper_ptr;
+    // Sub-frame output: a tile of the picture is done, the picture is not.
+    // The sender holds a live count on pcs_wrapper_ptr for the receiver.
+    EbBool   partial;
+    uint64_t decode_order;
 } EntropyCodingResults;
 
 typedef struct EntropyCodingResultsInitData {
@@ -25,6 +25,29 @@
 #include "global_motion.h"
 #include "corner_detect.h"
 
+// Global motion search of one reference picture
+typedef struct GmRefSearch {
+    EbPictureBufferDesc *input_pic;
+    EbPictureBufferDesc *ref_pic;
+    int *                frm_corners;
+    int                  num_frm_corners;
+    int                  allow_high_precision_mv;
+    EbTaskPool *         task_pool;
+    EbWarpedMotionParams global_motion;
+} GmRefSearch;
+
+// Searches the reference of list task_index, job_ptr is the GmRefSearch array
+static void gm_ref_search(void *job_ptr, uint32_t task_index) {
+    GmRefSearch *search = (GmRefSearch *)job_ptr + task_index;
+    compute_global_motion(search->input_pic,
+                          search->ref_pic,
+                          search->frm_corners,
+                          search->num_frm_corners,
+                          &search->global_motion,
+                          search->allow_high_precision_mv,
+                          search->task_pool);
+}
+
 void global_motion_estimation(PictureParentControlSet *pcs_ptr, MeContext *context_ptr,
                               EbPictureBufferDesc *input_picture_ptr) {
     // Get downsampled pictures with a downsampling factor of 2 in each dimension
@@ -37,6 +60,11 @@ void global_motion_estimation(PictureParentControlSet *pcs_ptr, MeContext *conte
 #endif
     EbPictureBufferDesc *ref_picture_ptr;
     SequenceControlSet * scs_ptr = (SequenceControlSet *)pcs_ptr->scs_wrapper_ptr->object_ptr;
+    EbTaskPool *         task_pool = scs_ptr->encode_context_ptr->task_pool;
+    GmRefSearch          search[MAX_NUM_OF_REF_PIC_LIST];
+    uint32_t             num_of_ref_pic_to_search[MAX_NUM_OF_REF_PIC_LIST] = {0, 0};
+    EbBool               searched[MAX_NUM_OF_REF_PIC_LIST]                 = {EB_FALSE, EB_FALSE};
+    int                  frm_corners[2 * MAX_CORNERS];
     pa_reference_object =
             (EbPaReferenceObject *)pcs_ptr->pa_reference_picture_wrapper_ptr->object_ptr;
     quarter_picture_ptr =
@@ -48,72 +76,98 @@ void global_motion_estimation(PictureParentControlSet *pcs_ptr, MeContext *conte
         (scs_ptr->down_sampling_method_me_search == ME_FILTERED_DOWNSAMPLED)
             ? (EbPictureBufferDesc *)pa_reference_object->sixteenth_filtered_picture_ptr
             : (EbPictureBufferDesc *)pa_reference_object->sixteenth_decimated_picture_ptr;
+    if (pcs_ptr->gm_level == GM_DOWN16)
+        input_picture_ptr = sixteenth_picture_ptr;
+    else
 #endif
+    if (pcs_ptr->gm_level == GM_DOWN)
+        input_picture_ptr = quarter_picture_ptr;
+
+    // The source corners do not depend on the reference, detect them once
+    const int num_frm_corners = av1_fast_corner_detect(
+        input_picture_ptr->buffer_y + input_picture_ptr->origin_x +
+            input_picture_ptr->origin_y * input_picture_ptr->stride_y,
+        input_picture_ptr->width,
+        input_picture_ptr->height,
+        input_picture_ptr->stride_y,
+        frm_corners,
+        MAX_CORNERS);
+
     uint32_t num_of_list_to_search =
             (pcs_ptr->slice_type == P_SLICE) ? (uint32_t)REF_LIST_0 : (uint32_t)REF_LIST_1;
 
     for (uint32_t list_index = REF_LIST_0; list_index <= num_of_list_to_search; ++list_index) {
-        uint32_t num_of_ref_pic_to_search;
         if (context_ptr->me_alt_ref == EB_TRUE)
-            num_of_ref_pic_to_search = 1;
+            num_of_ref_pic_to_search[list_index] = 1;
         else
 #if ON_OFF_FEATURE_MRP
-            num_of_ref_pic_to_search = pcs_ptr->slice_type == P_SLICE
+            num_of_ref_pic_to_search[list_index] = pcs_ptr->slice_type == P_SLICE
                                      ? pcs_ptr->mrp_ctrls.ref_list0_count_try:
                                       list_index == REF_LIST_0 ? pcs_ptr->mrp_ctrls.ref_list0_count_try:
                                       pcs_ptr->mrp_ctrls.ref_list1_count_try;
 #else
-            num_of_ref_pic_to_search = pcs_ptr->slice_type == P_SLICE
+            num_of_ref_pic_to_search[list_index] = pcs_ptr->slice_type == P_SLICE
                                           ? pcs_ptr->ref_list0_count_try
                                           : list_index == REF_LIST_0 ? pcs_ptr->ref_list0_count_try
                                           : pcs_ptr->ref_list1_count_try;
 #endif
 
         // Limit the global motion search to the first frame types of ref lists
-        num_of_ref_pic_to_search = MIN(num_of_ref_pic_to_search, 1);
-
-        // Ref Picture Loop
-        for (uint32_t ref_pic_index = 0; ref_pic_index < num_of_ref_pic_to_search;
-             ++ref_pic_index) {
-            EbPaReferenceObject *reference_object;
-
-            if (context_ptr->me_alt_ref == EB_TRUE)
-                reference_object = (EbPaReferenceObject *)context_ptr->alt_ref_reference_ptr;
-            else
-                reference_object =
-                        (EbPaReferenceObject *)pcs_ptr->ref_pa_pic_ptr_array[list_index][ref_pic_index]
-                                ->object_ptr;
-
-            // Set the source and the reference picture to be used by the global motion search
-            // based on the input search mode
-#if GM_DOWN_16
-            if (pcs_ptr->gm_level == GM_DOWN16) {
-                sixteenth_ref_pic_ptr =
-                    (scs_ptr->down_sampling_method_me_search == ME_FILTERED_DOWNSAMPLED)
-                    ? (EbPictureBufferDesc *)reference_object->sixteenth_filtered_picture_ptr
-                    : (EbPictureBufferDesc *)reference_object->sixteenth_decimated_picture_ptr;
-                ref_picture_ptr = sixteenth_ref_pic_ptr;
-                input_picture_ptr = sixteenth_picture_ptr;
+        num_of_ref_pic_to_search[list_index] = MIN(num_of_ref_pic_to_search[list_index], 1);
+        if (!num_of_ref_pic_to_search[list_index]) continue;
 
-            }
-            else if (pcs_ptr->gm_level == GM_DOWN) {
+        EbPaReferenceObject *reference_object;
+
+        if (context_ptr->me_alt_ref == EB_TRUE)
+            reference_object = (EbPaReferenceObject *)context_ptr->alt_ref_reference_ptr;
+        else
+            reference_object =
+                    (EbPaReferenceObject *)pcs_ptr->ref_pa_pic_ptr_array[list_index][0]
+                            ->object_ptr;
+
+        // Set the reference picture to be used by the global motion search based on the
+        // input search mode
+#if GM_DOWN_16
+        if (pcs_ptr->gm_level == GM_DOWN16) {
+            sixteenth_ref_pic_ptr =
+                (scs_ptr->down_sampling_method_me_search == ME_FILTERED_DOWNSAMPLED)
+                ? (EbPictureBufferDesc *)reference_object->sixteenth_filtered_picture_ptr
+                : (EbPictureBufferDesc *)reference_object->sixteenth_decimated_picture_ptr;
+            ref_picture_ptr = sixteenth_ref_pic_ptr;
+        }
+        else if (pcs_ptr->gm_level == GM_DOWN) {
 #else
-            if (pcs_ptr->gm_level == GM_DOWN) {
+        if (pcs_ptr->gm_level == GM_DOWN) {
 #endif
-                quarter_ref_pic_ptr =
-                        (scs_ptr->down_sampling_method_me_search == ME_FILTERED_DOWNSAMPLED)
-                        ? (EbPictureBufferDesc *)reference_object->quarter_filtered_picture_ptr
-                        : (EbPictureBufferDesc *)reference_object->quarter_decimated_picture_ptr;
-                ref_picture_ptr   = quarter_ref_pic_ptr;
-                input_picture_ptr = quarter_picture_ptr;
-            } else {
-                ref_picture_ptr = (EbPictureBufferDesc *)reference_object->input_padded_picture_ptr;
-            }
+            quarter_ref_pic_ptr =
+                    (scs_ptr->down_sampling_method_me_search == ME_FILTERED_DOWNSAMPLED)
+                    ? (EbPictureBufferDesc *)reference_object->quarter_filtered_picture_ptr
+                    : (EbPictureBufferDesc *)reference_object->quarter_decimated_picture_ptr;
+            ref_picture_ptr = quarter_ref_pic_ptr;
+        } else {
+            ref_picture_ptr = (EbPictureBufferDesc *)reference_object->input_padded_picture_ptr;
+        }
+
+        search[list_index].input_pic               = input_picture_ptr;
+        search[list_index].ref_pic                 = ref_picture_ptr;
+        search[list_index].frm_corners             = frm_corners;
+        search[list_index].num_frm_corners         = num_frm_corners;
+        search[list_index].allow_high_precision_mv = pcs_ptr->frm_hdr.allow_high_precision_mv;
+        search[list_index].task_pool               = task_pool;
+    }
 
-            compute_global_motion(input_picture_ptr,
-                                  ref_picture_ptr,
-                                  &pcs_ptr->global_motion_estimation[list_index][ref_pic_index],
-                                  pcs_ptr->frm_hdr.allow_high_precision_mv);
+    // When the task pool has threads, the two references are searched as pool tasks. The
+    // list 1 result is then dropped if the identity exit applies.
+    if (task_pool->thread_count && num_of_ref_pic_to_search[REF_LIST_0] &&
+        num_of_ref_pic_to_search[REF_LIST_1]) {
+        eb_task_pool_run(task_pool, gm_ref_search, search, MAX_NUM_OF_REF_PIC_LIST);
+        searched[REF_LIST_0] = searched[REF_LIST_1] = EB_TRUE;
+    }
+
+    for (uint32_t list_index = REF_LIST_0; list_index <= num_of_list_to_search; ++list_index) {
+        if (num_of_ref_pic_to_search[list_index]) {
+            if (!searched[list_index]) gm_ref_search(search, list_index);
+            pcs_ptr->global_motion_estimation[list_index][0] = search[list_index].global_motion;
         }
 
 #if GM_LIST1
@@ -136,14 +190,27 @@ static INLINE int convert_to_trans_prec(int allow_hp, int coor) {
         return ROUND_POWER_OF_TWO_SIGNED(coor, WARPEDMODEL_PREC_BITS - 2) * 2;
 }
 
-void compute_global_motion(EbPictureBufferDesc *input_pic, EbPictureBufferDesc *ref_pic,
-                           EbWarpedMotionParams *bestWarpedMotion, int allow_high_precision_mv) {
-    MotionModel params_by_motion[RANSAC_NUM_MOTIONS];
-    for (int m = 0; m < RANSAC_NUM_MOTIONS; m++) {
-        memset(&params_by_motion[m], 0, sizeof(params_by_motion[m]));
-        params_by_motion[m].inliers =
-            malloc(sizeof(*(params_by_motion[m].inliers)) * 2 * MAX_CORNERS);
-    }
+// RANSAC and refinement of one motion model, independent from the other models
+typedef struct GmModelSearch {
+    TransformationType   model;
+    EbPictureBufferDesc *input_pic;
+    EbPictureBufferDesc *ref_pic;
+    int *                frm_corners;
+    int                  num_frm_corners;
+    // Set when a refined candidate was found, with its parameters and warp error
+    int                  found;
+    int64_t              best_warp_error;
+    EbWarpedMotionParams global_motion;
+} GmModelSearch;
+
+// Searches model job_ptr[task_index], job_ptr points to a GmModelSearch array
+static void gm_model_search(void *job_ptr, uint32_t task_index) {
+    GmModelSearch *      search    = (GmModelSearch *)job_ptr + task_index;
+    EbPictureBufferDesc *input_pic = search->input_pic;
+    EbPictureBufferDesc *ref_pic   = search->ref_pic;
+    MotionModel          params_by_motion[RANSAC_NUM_MOTIONS];
+    int                  inliers_by_motion[RANSAC_NUM_MOTIONS];
+    EbWarpedMotionParams tmp_wm_params;
 
     // clang-format off
     static const double k_indentity_params[MAX_PARAMDIM - 1] = {
@@ -151,6 +218,80 @@ void compute_global_motion(EbPictureBufferDesc *input_pic, EbPictureBufferDesc *
     };
     // clang-format on
 
+    unsigned char *frm_buffer =
+        input_pic->buffer_y + input_pic->origin_x + input_pic->origin_y * input_pic->stride_y;
+    unsigned char *ref_buffer =
+        ref_pic->buffer_y + ref_pic->origin_x + ref_pic->origin_y * ref_pic->stride_y;
+
+    search->found           = 0;
+    search->best_warp_error = INT64_MAX;
+
+    // Initially set all params to identity.
+    for (unsigned i = 0; i < RANSAC_NUM_MOTIONS; ++i) {
+        memset(&params_by_motion[i], 0, sizeof(params_by_motion[i]));
+        params_by_motion[i].inliers =
+            malloc(sizeof(*(params_by_motion[i].inliers)) * 2 * MAX_CORNERS);
+        eb_memcpy(params_by_motion[i].params,
+               k_indentity_params,
+               (MAX_PARAMDIM - 1) * sizeof(*(params_by_motion[i].params)));
+    }
+
+    av1_compute_global_motion(search->model,
+                              frm_buffer,
+                              input_pic->width,
+                              input_pic->height,
+                              input_pic->stride_y,
+                              search->frm_corners,
+                              search->num_frm_corners,
+                              ref_buffer,
+                              ref_pic->stride_y,
+                              EB_8BIT,
+                              GLOBAL_MOTION_FEATURE_BASED,
+                              inliers_by_motion,
+                              params_by_motion,
+                              RANSAC_NUM_MOTIONS);
+
+    for (unsigned i = 0; i < RANSAC_NUM_MOTIONS; ++i) {
+        if (inliers_by_motion[i] == 0) continue;
+        av1_convert_model_to_params(params_by_motion[i].params, &tmp_wm_params);
+
+        if (tmp_wm_params.wmtype != IDENTITY) {
+            const int64_t warp_error = av1_refine_integerized_param(&tmp_wm_params,
+                                                                    tmp_wm_params.wmtype,
+                                                                    EB_FALSE,
+                                                                    EB_8BIT,
+                                                                    ref_buffer,
+                                                                    ref_pic->width,
+                                                                    ref_pic->height,
+                                                                    ref_pic->stride_y,
+                                                                    frm_buffer,
+                                                                    input_pic->width,
+                                                                    input_pic->height,
+                                                                    input_pic->stride_y,
+                                                                    5,
+                                                                    search->best_warp_error);
+            if (warp_error < search->best_warp_error) {
+                search->best_warp_error = warp_error;
+                search->found           = 1;
+                // Save the wm_params modified by
+                // av1_refine_integerized_param() rather than motion index to
+                // avoid rerunning refine() below.
+                eb_memcpy(&search->global_motion, &tmp_wm_params, sizeof(EbWarpedMotionParams));
+            }
+        }
+    }
+
+    for (int m = 0; m < RANSAC_NUM_MOTIONS; m++) { free(params_by_motion[m].inliers); }
+}
+
+void compute_global_motion(EbPictureBufferDesc *input_pic, EbPictureBufferDesc *ref_pic,
+                           int *frm_corners, int num_frm_corners,
+                           EbWarpedMotionParams *bestWarpedMotion, int allow_high_precision_mv,
+                           EbTaskPool *task_pool) {
+#define GLOBAL_TRANS_TYPES_ENC 3
+    GmModelSearch search[GLOBAL_TRANS_TYPES_ENC + 1];
+    EbBool        searched[GLOBAL_TRANS_TYPES_ENC + 1] = {EB_FALSE};
+
     unsigned char *frm_buffer =
         input_pic->buffer_y + input_pic->origin_x + input_pic->origin_y * input_pic->stride_y;
     unsigned char *ref_buffer =
@@ -161,114 +302,67 @@ void compute_global_motion(EbPictureBufferDesc *input_pic, EbPictureBufferDesc *
     // TODO: check ref_params
     const EbWarpedMotionParams *ref_params = &default_warp_params;
 
-    {
-        int frm_corners[2 * MAX_CORNERS], inliers_by_motion[RANSAC_NUM_MOTIONS];
-        // compute interest points using FAST features
-        int num_frm_corners = av1_fast_corner_detect(frm_buffer,
-                                                     input_pic->width,
-                                                     input_pic->height,
-                                                     input_pic->stride_y,
-                                                     frm_corners,
-                                                     MAX_CORNERS);
-
-        TransformationType model;
-        EbWarpedMotionParams tmp_wm_params;
-#define GLOBAL_TRANS_TYPES_ENC 3
+    int64_t ref_frame_error = -1;
 
-        const GlobalMotionEstimationType gm_estimation_type = GLOBAL_MOTION_FEATURE_BASED;
-        for (model = ROTZOOM; model <= GLOBAL_TRANS_TYPES_ENC; ++model) {
-            int64_t best_warp_error = INT64_MAX;
-            // Initially set all params to identity.
-            for (unsigned i = 0; i < RANSAC_NUM_MOTIONS; ++i) {
-                eb_memcpy(params_by_motion[i].params,
-                       k_indentity_params,
-                       (MAX_PARAMDIM - 1) * sizeof(*(params_by_motion[i].params)));
-#if GLOBAL_ME_BUG_FIX_1
-                params_by_motion[i].num_inliers = 0;
-#endif
-            }
+    for (TransformationType model = ROTZOOM; model <= GLOBAL_TRANS_TYPES_ENC; ++model) {
+        search[model].model           = model;
+        search[model].input_pic       = input_pic;
+        search[model].ref_pic         = ref_pic;
+        search[model].frm_corners     = frm_corners;
+        search[model].num_frm_corners = num_frm_corners;
+    }
 
-            av1_compute_global_motion(model,
-                                      frm_buffer,
-                                      input_pic->width,
-                                      input_pic->height,
-                                      input_pic->stride_y,
-                                      frm_corners,
-                                      num_frm_corners,
-                                      ref_buffer,
-                                      ref_pic->stride_y,
-                                      EB_8BIT,
-                                      gm_estimation_type,
-                                      inliers_by_motion,
-                                      params_by_motion,
-                                      RANSAC_NUM_MOTIONS);
-
-            for (unsigned i = 0; i < RANSAC_NUM_MOTIONS; ++i) {
-                if (inliers_by_motion[i] == 0) continue;
-                av1_convert_model_to_params(params_by_motion[i].params, &tmp_wm_params);
-
-                if (tmp_wm_params.wmtype != IDENTITY) {
-                    const int64_t warp_error = av1_refine_integerized_param(&tmp_wm_params,
-                                                                            tmp_wm_params.wmtype,
-                                                                            EB_FALSE,
-                                                                            EB_8BIT,
-                                                                            ref_buffer,
-                                                                            ref_pic->width,
-                                                                            ref_pic->height,
-                                                                            ref_pic->stride_y,
-                                                                            frm_buffer,
-                                                                            input_pic->width,
-                                                                            input_pic->height,
-                                                                            input_pic->stride_y,
-                                                                            5,
-                                                                            best_warp_error);
-                    if (warp_error < best_warp_error) {
-                        best_warp_error = warp_error;
-                        // Save the wm_params modified by
-                        // av1_refine_integerized_param() rather than motion index to
-                        // avoid rerunning refine() below.
-                        eb_memcpy(&global_motion, &tmp_wm_params, sizeof(EbWarpedMotionParams));
-                    }
-                }
-            }
-            if (global_motion.wmtype <= AFFINE)
-                if (!eb_get_shear_params(&global_motion)) global_motion = default_warp_params;
-
-            if (global_motion.wmtype == TRANSLATION) {
-                global_motion.wmmat[0] =
-                    convert_to_trans_prec(allow_high_precision_mv, global_motion.wmmat[0]) *
-                    GM_TRANS_ONLY_DECODE_FACTOR;
-                global_motion.wmmat[1] =
-                    convert_to_trans_prec(allow_high_precision_mv, global_motion.wmmat[1]) *
-                    GM_TRANS_ONLY_DECODE_FACTOR;
-            }
+    // The models are searched independently and only selected in order below, so the
+    // affine search can run speculatively as a pool task next to the rotzoom one. Its
+    // result is dropped if rotzoom is selected.
+    if (task_pool && task_pool->thread_count) {
+        eb_task_pool_run(task_pool, gm_model_search, &search[ROTZOOM], AFFINE - ROTZOOM + 1);
+        searched[ROTZOOM] = searched[AFFINE] = EB_TRUE;
+    }
 
-            if (global_motion.wmtype == IDENTITY) continue;
-
-            const int64_t ref_frame_error = eb_av1_frame_error(EB_FALSE,
-                                                               EB_8BIT,
-                                                               ref_buffer,
-                                                               ref_pic->stride_y,
-                                                               frm_buffer,
-                                                               input_pic->width,
-                                                               input_pic->height,
-                                                               input_pic->stride_y);
-
-            if (ref_frame_error == 0) continue;
-
-            // If the best error advantage found doesn't meet the threshold for
-            // this motion type, revert to IDENTITY.
-            if (!av1_is_enough_erroradvantage(
-                    (double)best_warp_error / ref_frame_error,
-                    gm_get_params_cost(&global_motion, ref_params, allow_high_precision_mv),
-                    GM_ERRORADV_TR_0 /* TODO: check error advantage */)) {
-                global_motion = default_warp_params;
-            }
-            if (global_motion.wmtype != IDENTITY) { break; }
+    for (TransformationType model = ROTZOOM; model <= GLOBAL_TRANS_TYPES_ENC; ++model) {
+        if (!searched[model]) gm_model_search(search, model);
+        // A model without any refined candidate keeps the previous model parameters
+        const int64_t best_warp_error = search[model].best_warp_error;
+        if (search[model].found) global_motion = search[model].global_motion;
+
+        if (global_motion.wmtype <= AFFINE)
+            if (!eb_get_shear_params(&global_motion)) global_motion = default_warp_params;
+
+        if (global_motion.wmtype == TRANSLATION) {
+            global_motion.wmmat[0] =
+                convert_to_trans_prec(allow_high_precision_mv, global_motion.wmmat[0]) *
+                GM_TRANS_ONLY_DECODE_FACTOR;
+            global_motion.wmmat[1] =
+                convert_to_trans_prec(allow_high_precision_mv, global_motion.wmmat[1]) *
+                GM_TRANS_ONLY_DECODE_FACTOR;
+        }
+
+        if (global_motion.wmtype == IDENTITY) continue;
+
+        // The error of the unwarped reference is the same for all the models
+        if (ref_frame_error < 0)
+            ref_frame_error = eb_av1_frame_error(EB_FALSE,
+                                                 EB_8BIT,
+                                                 ref_buffer,
+                                                 ref_pic->stride_y,
+                                                 frm_buffer,
+                                                 input_pic->width,
+                                                 input_pic->height,
+                                                 input_pic->stride_y);
+
+        if (ref_frame_error == 0) continue;
+
+        // If the best error advantage found doesn't meet the threshold for
+        // this motion type, revert to IDENTITY.
+        if (!av1_is_enough_erroradvantage(
+                (double)best_warp_error / ref_frame_error,
+                gm_get_params_cost(&global_motion, ref_params, allow_high_precision_mv),
+                GM_ERRORADV_TR_0 /* TODO: check error advantage */)) {
+            global_motion = default_warp_params;
         }
+        if (global_motion.wmtype != IDENTITY) { break; }
     }
 
     *bestWarpedMotion = global_motion;
-
-    for (int m = 0; m < RANSAC_NUM_MOTIONS; m++) { free(params_by_motion[m].inliers); }
 }
@@ -19,10 +19,13 @@
 
 #include "EbPictureBufferDesc.h"
 #include "EbMotionEstimationContext.h"
+#include "EbTaskPool.h"
 
 void global_motion_estimation(PictureParentControlSet *pcs_ptr, MeContext *context_ptr,
                               EbPictureBufferDesc *input_picture_ptr);
 void compute_global_motion(EbPictureBufferDesc *input_pic, EbPictureBufferDesc *ref_pic,
-                           EbWarpedMotionParams *bestWarpedMotion, int allow_high_precision_mv);
+                           int *frm_corners, int num_frm_corners,
+                           EbWarpedMotionParams *bestWarpedMotion, int allow_high_precision_mv,
+                           EbTaskPool *task_pool);
 
 #endif // EbGlobalMotionEstimation_h
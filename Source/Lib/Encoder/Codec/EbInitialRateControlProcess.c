@@ -20,6 +20,8 @@
 #include "EbLog.h"
 #include "EbIntraPrediction.h"
 #include "EbMotionEstimation.h"
+#include "EbTaskPool.h"
+#include "EbWavefront.h"
 #endif
 /**************************************
  * Context
@@ -27,6 +29,10 @@
 typedef struct InitialRateControlContext {
     EbFifo *motion_estimation_results_input_fifo_ptr;
     EbFifo *initialrate_control_results_output_fifo_ptr;
+#if TPL_LA
+    // Number of SBs dispensed in each SB row of the TPL picture
+    EbWavefront *tpl_wavefront;
+#endif
 } InitialRateControlContext;
 
 /**************************************
@@ -425,6 +431,9 @@ void detect_global_motion(PictureParentControlSet *pcs_ptr) {
 static void initial_rate_control_context_dctor(EbPtr p) {
     EbThreadContext *          thread_context_ptr = (EbThreadContext *)p;
     InitialRateControlContext *obj = (InitialRateControlContext *)thread_context_ptr->priv;
+#if TPL_LA
+    EB_DELETE(obj->tpl_wavefront);
+#endif
     EB_FREE_ARRAY(obj);
 }
 
@@ -443,6 +452,12 @@ EbErrorType initial_rate_control_context_ctor(EbThreadContext *  thread_context_
     context_ptr->initialrate_control_results_output_fifo_ptr = eb_system_resource_get_producer_fifo(
         enc_handle_ptr->initial_rate_control_results_resource_ptr, 0);
 
+#if TPL_LA
+    const SequenceControlSet *scs_ptr = enc_handle_ptr->scs_instance_array[0]->scs_ptr;
+    EB_NEW(context_ptr->tpl_wavefront,
+           eb_wavefront_ctor,
+           (scs_ptr->max_input_luma_height + BLOCK_SIZE_64 - 1) / BLOCK_SIZE_64);
+#endif
     return EB_ErrorNone;
 }
 
@@ -1021,19 +1036,26 @@ int32_t eb_av1_compute_qdelta(double qstart, double qtarget, AomBitDepth bit_dep
 #endif
 extern void filter_intra_edge(OisMbResults *ois_mb_results_ptr, uint8_t mode, uint16_t max_frame_width, uint16_t max_frame_height,
                             int32_t p_angle, int32_t cu_origin_x, int32_t cu_origin_y, uint8_t *above_row, uint8_t *left_col);
-/************************************************
-* Genrate TPL MC Flow Dispenser  Based on Lookahead
-** LAD Window: sliding window size
-************************************************/
-void tpl_mc_flow_dispenser(
-    EncodeContext                   *encode_context_ptr,
-    SequenceControlSet              *scs_ptr,
-    PictureParentControlSet         *pcs_ptr,
-    int32_t                          frame_idx)
-{
-    uint32_t    picture_width_in_sb = (pcs_ptr->enhanced_picture_ptr->width + BLOCK_SIZE_64 - 1) / BLOCK_SIZE_64;
+// Frame level state of the TPL dispenser, shared by the tasks dispensing its SB rows
+typedef struct TplDispenserFrame {
+    EncodeContext *          encode_context_ptr;
+    SequenceControlSet *     scs_ptr;
+    PictureParentControlSet *pcs_ptr;
+    int32_t                  frame_idx;
+    uint32_t                 picture_width_in_sb;
+    uint32_t                 picture_height_in_sb;
+    struct ScaleFactors      sf;
+    MacroblockPlane          mb_plane;
+    EbWavefront *            wavefront_ptr;
+} TplDispenserFrame;
+
+static void tpl_mc_flow_dispenser_sb(TplDispenserFrame *frame, uint32_t sb_index) {
+    EncodeContext *          encode_context_ptr = frame->encode_context_ptr;
+    SequenceControlSet *     scs_ptr            = frame->scs_ptr;
+    PictureParentControlSet *pcs_ptr            = frame->pcs_ptr;
+    const int32_t            frame_idx          = frame->frame_idx;
+    uint32_t    picture_width_in_sb = frame->picture_width_in_sb;
     uint32_t    picture_width_in_mb = (pcs_ptr->enhanced_picture_ptr->width + 16 - 1) / 16;
-    uint32_t    picture_height_in_sb = (pcs_ptr->enhanced_picture_ptr->height + BLOCK_SIZE_64 - 1) / BLOCK_SIZE_64;
     uint32_t    sb_origin_x;
     uint32_t    sb_origin_y;
     int16_t     x_curr_mv = 0;
@@ -1042,7 +1064,6 @@ void tpl_mc_flow_dispenser(
     TxSize      tx_size = TX_16X16;
     EbPictureBufferDesc  *ref_pic_ptr;
     EbReferenceObject    *referenceObject;
-    struct      ScaleFactors sf;
     BlockGeom   blk_geom;
     uint32_t    kernel = (EIGHTTAP_REGULAR << 16) | EIGHTTAP_REGULAR;
     EbPictureBufferDesc *input_picture_ptr = pcs_ptr->enhanced_picture_ptr;
@@ -1051,8 +1072,6 @@ void tpl_mc_flow_dispenser(
 #endif
     TplStats  tpl_stats;
 
-    (void)scs_ptr;
-
     DECLARE_ALIGNED(32, uint8_t, predictor8[256 * 2]);
     DECLARE_ALIGNED(32, int16_t, src_diff[256]);
     DECLARE_ALIGNED(32, TranLow, coeff[256]);
@@ -1064,13 +1083,313 @@ void tpl_mc_flow_dispenser(
     blk_geom.bwidth  = 16;
     blk_geom.bheight = 16;
 
+    sb_origin_x = (sb_index % picture_width_in_sb) * BLOCK_SIZE_64;
+    sb_origin_y = (sb_index / picture_width_in_sb) * BLOCK_SIZE_64;
+    if (((sb_origin_x + 16) <= input_picture_ptr->width) &&
+        ((sb_origin_y + 16) <= input_picture_ptr->height)) {
+        SbParams *sb_params = &scs_ptr->sb_params_array[sb_index];
+        uint32_t pa_blk_index = 0;
+        while (pa_blk_index < CU_MAX_COUNT) {
+            const CodedBlockStats *blk_stats_ptr;
+            blk_stats_ptr = get_coded_blk_stats(pa_blk_index);
+            uint8_t bsize = blk_stats_ptr->size;
+            EbBool small_boundary_blk = EB_FALSE;
+
+            //if(sb_params->raster_scan_blk_validity[md_scan_to_raster_scan[pa_blk_index]])
+            {
+                uint32_t cu_origin_x = sb_params->origin_x + blk_stats_ptr->origin_x;
+                uint32_t cu_origin_y = sb_params->origin_y + blk_stats_ptr->origin_y;
+                if ((blk_stats_ptr->origin_x % 16) == 0 && (blk_stats_ptr->origin_y % 16) == 0 &&
+                        ((pcs_ptr->enhanced_picture_ptr->width - cu_origin_x) < 16 || (pcs_ptr->enhanced_picture_ptr->height - cu_origin_y) < 16))
+                    small_boundary_blk = EB_TRUE;
+            }
+            if(bsize != 16 && !small_boundary_blk) {
+                pa_blk_index++;
+                continue;
+            }
+            if (sb_params->raster_scan_blk_validity[md_scan_to_raster_scan[pa_blk_index]]) {
+                uint32_t mb_origin_x = sb_params->origin_x + blk_stats_ptr->origin_x;
+                uint32_t mb_origin_y = sb_params->origin_y + blk_stats_ptr->origin_y;
+                const int dst_buffer_stride = input_picture_ptr->stride_y;
+                const int dst_mb_offset = mb_origin_y * dst_buffer_stride + mb_origin_x;
+                const int dst_basic_offset = input_picture_ptr->origin_y * input_picture_ptr->stride_y + input_picture_ptr->origin_x;
+                uint8_t *dst_buffer = encode_context_ptr->mc_flow_rec_picture_buffer[frame_idx] + dst_basic_offset + dst_mb_offset;
+                int64_t inter_cost;
+#if TPL_IMP
+                int64_t recon_error = 1, sse = 1;
+#endif
+                int32_t best_rf_idx = -1;
+                int64_t best_inter_cost = INT64_MAX;
+                MV final_best_mv = {0, 0};
+#if REMOVE_MRP_MODE
+                uint32_t max_inter_ref = MAX_PA_ME_MV;
+#else
+                uint32_t max_inter_ref = ((scs_ptr->mrp_mode == 0) ? ME_MV_MRP_MODE_0 : ME_MV_MRP_MODE_1);
+#endif
+                OisMbResults *ois_mb_results_ptr = pcs_ptr->ois_mb_results[(mb_origin_y >> 4) * picture_width_in_mb + (mb_origin_x >> 4)];
+                int64_t best_intra_cost = ois_mb_results_ptr->intra_cost;
+                uint8_t best_mode = DC_PRED;
+                uint8_t *src_mb = input_picture_ptr->buffer_y + input_picture_ptr->origin_x + mb_origin_x +
+                                 (input_picture_ptr->origin_y + mb_origin_y) * input_picture_ptr->stride_y;
+                memset(&tpl_stats, 0, sizeof(tpl_stats));
+                blk_geom.origin_x = blk_stats_ptr->origin_x;
+                blk_geom.origin_y = blk_stats_ptr->origin_y;
+                me_mb_offset = get_me_info_index(pcs_ptr->max_number_of_pus_per_sb, &blk_geom, 0, 0);
+                for(uint32_t rf_idx = 0; rf_idx < max_inter_ref; rf_idx++) {
+#if REMOVE_MRP_MODE
+                    uint32_t list_index = rf_idx < 4 ? 0 : 1;
+                    uint32_t ref_pic_index = rf_idx >= 4 ? (rf_idx - 4) : rf_idx;
+#else
+                    uint32_t list_index = (scs_ptr->mrp_mode == 0) ? (rf_idx < 4 ? 0 : 1)
+                                                                   : (rf_idx < 2 ? 0 : 1);
+                    uint32_t ref_pic_index = (scs_ptr->mrp_mode == 0) ? (rf_idx >= 4 ? (rf_idx - 4) : rf_idx)
+                                                                      : (rf_idx >= 2 ? (rf_idx - 2) : rf_idx);
+#endif
+                    if(!pcs_ptr->ref_pa_pic_ptr_array[list_index][ref_pic_index])
+                        continue;
+                    uint32_t ref_poc = pcs_ptr->ref_order_hint[rf_idx];
+                    uint32_t ref_frame_idx = 0;
+#if FIX_WARNINGS_WIN
+                    while(ref_frame_idx < MAX_TPL_LA_SW && encode_context_ptr->poc_map_idx[ref_frame_idx] != ref_poc)
+#else
+                    while(ref_frame_idx < MAX_TPL_LA_SW && encode_context_ptr->poc_map_idx[ref_frame_idx] != (int32_t)ref_poc)
+#endif
+                        ref_frame_idx++;
+                    if(ref_frame_idx == MAX_TPL_LA_SW || (int32_t)ref_frame_idx >= frame_idx) {
+                        continue;
+                    }
+
+                    referenceObject = (EbReferenceObject*)pcs_ptr->ref_pa_pic_ptr_array[list_index][ref_pic_index]->object_ptr;
+                    ref_pic_ptr = /*is16bit ? (EbPictureBufferDesc*)referenceObject->reference_picture16bit : */(EbPictureBufferDesc*)referenceObject->reference_picture;
+                    const int ref_basic_offset = ref_pic_ptr->origin_y * ref_pic_ptr->stride_y + ref_pic_ptr->origin_x;
+                    const int ref_mb_offset = mb_origin_y * ref_pic_ptr->stride_y + mb_origin_x;
+                    uint8_t *ref_mb = ref_pic_ptr->buffer_y + ref_basic_offset + ref_mb_offset;
+
+                    struct Buf2D ref_buf = { NULL, ref_pic_ptr->buffer_y + ref_basic_offset,
+                                              ref_pic_ptr->width, ref_pic_ptr->height,
+                                              ref_pic_ptr->stride_y };
+#if DECOUPLE_ME_RES
+                    const MeSbResults *me_results = pcs_ptr->pa_me_data->me_results[sb_index];
+#else
+                    const MeSbResults *me_results = pcs_ptr->me_results[sb_index];
+#endif
+#if ME_MEM_OPT
+#if REMOVE_MRP_MODE
+                    x_curr_mv = me_results->me_mv_array[me_mb_offset * MAX_PA_ME_MV + (list_index ? 4 : 0) + ref_pic_index].x_mv << 1;
+                    y_curr_mv = me_results->me_mv_array[me_mb_offset * MAX_PA_ME_MV + (list_index ? 4 : 0) + ref_pic_index].y_mv << 1;
+#else
+                    uint32_t pu_stride = scs_ptr->mrp_mode == 0 ? ME_MV_MRP_MODE_0 : ME_MV_MRP_MODE_1;
+                    x_curr_mv = me_results->me_mv_array[me_mb_offset * pu_stride + (list_index ? ((scs_ptr->mrp_mode == 0) ? 4 : 2) : 0) + ref_pic_index].x_mv << 1;
+                    y_curr_mv = me_results->me_mv_array[me_mb_offset * pu_stride + (list_index ? ((scs_ptr->mrp_mode == 0) ? 4 : 2) : 0) + ref_pic_index].y_mv << 1;
+#endif
+#else
+                    x_curr_mv = me_results->me_mv_array[me_mb_offset][(list_index ? ((scs_ptr->mrp_mode == 0) ? 4 : 2) : 0) + ref_pic_index].x_mv << 1;
+                    y_curr_mv = me_results->me_mv_array[me_mb_offset][(list_index ? ((scs_ptr->mrp_mode == 0) ? 4 : 2) : 0) + ref_pic_index].y_mv << 1;
+#endif
+                    InterPredParams inter_pred_params;
+                    svt_av1_init_inter_params(&inter_pred_params, 16, 16, mb_origin_y,
+                            mb_origin_x, 0, 0, 8, 0, 0,
+                            &frame->sf, &ref_buf, kernel);
+
+                    inter_pred_params.conv_params = get_conv_params(0, 0, 0, 8);
+
+                    MV best_mv = {y_curr_mv, x_curr_mv};
+                    av1_build_inter_predictor(pcs_ptr->av1_cm,
+                                              ref_mb,
+                                              input_picture_ptr->stride_y,
+                                              predictor,
+                                              16,
+                                              &best_mv,
+                                              mb_origin_x,
+                                              mb_origin_y,
+                                              &inter_pred_params);
+                    eb_aom_subtract_block(16, 16, src_diff, 16, src_mb, input_picture_ptr->stride_y, predictor, 16);
+
+                    svt_av1_wht_fwd_txfm(src_diff, 16, coeff, tx_size, 8, 0);
+
+                    inter_cost = svt_aom_satd(coeff, 256);
+                    if (inter_cost < best_inter_cost) {
+                        memcpy(best_coeff, coeff, sizeof(best_coeff));
+                        best_rf_idx = rf_idx;
+                        best_inter_cost = inter_cost;
+                        final_best_mv = best_mv;
+
+                        if (best_inter_cost < best_intra_cost) best_mode = NEWMV;
+                    }
+                } // rf_idx
+                if(best_inter_cost < INT64_MAX) {
+                    uint16_t eob;
+                    get_quantize_error(&frame->mb_plane, best_coeff, qcoeff, dqcoeff, tx_size, &eob, &recon_error, &sse);
+#if TPL_OPT
+                    int rate_cost = pcs_ptr->tpl_opt_flag? 0 : rate_estimator(qcoeff, eob, tx_size);
+#else
+                    int rate_cost = rate_estimator(qcoeff, eob, tx_size);
+#endif
+                    tpl_stats.srcrf_rate = rate_cost << TPL_DEP_COST_SCALE_LOG2;
+                }
+                best_intra_cost = AOMMAX(best_intra_cost, 1);
+                if (frame_is_intra_only(pcs_ptr))
+                    best_inter_cost = 0;
+                else
+                    best_inter_cost = AOMMIN(best_intra_cost, best_inter_cost);
+
+                tpl_stats.srcrf_dist = recon_error << (TPL_DEP_COST_SCALE_LOG2);
+
+                if (best_mode == NEWMV) {
+                    // inter recon with rec_picture as reference pic
+                    uint32_t ref_poc = pcs_ptr->ref_order_hint[best_rf_idx];
+                    uint32_t ref_frame_idx = 0;
+#if FIX_WARNINGS_WIN
+                    while(ref_frame_idx < MAX_TPL_LA_SW && encode_context_ptr->poc_map_idx[ref_frame_idx] != ref_poc)
+#else
+                    while(ref_frame_idx < MAX_TPL_LA_SW && encode_context_ptr->poc_map_idx[ref_frame_idx] != (int32_t)ref_poc)
+#endif
+                        ref_frame_idx++;
+                    assert(ref_frame_idx != MAX_TPL_LA_SW);
+
+                    const int ref_basic_offset = input_picture_ptr->origin_y * input_picture_ptr->stride_y + input_picture_ptr->origin_x;
+                    const int ref_mb_offset = mb_origin_y * input_picture_ptr->stride_y + mb_origin_x;
+                    uint8_t *ref_mb = encode_context_ptr->mc_flow_rec_picture_buffer[ref_frame_idx] + ref_basic_offset + ref_mb_offset;
+
+                    struct Buf2D ref_buf = { NULL, encode_context_ptr->mc_flow_rec_picture_buffer[ref_frame_idx] + ref_basic_offset,
+                                              input_picture_ptr->width, input_picture_ptr->height,
+                                              input_picture_ptr->stride_y};
+                    InterPredParams inter_pred_params;
+                    svt_av1_init_inter_params(&inter_pred_params, 16, 16, mb_origin_y,
+                        mb_origin_x, 0, 0, 8, 0, 0,
+                        &frame->sf, &ref_buf, kernel);
+
+                    inter_pred_params.conv_params = get_conv_params(0, 0, 0, 8);
+                    av1_build_inter_predictor(pcs_ptr->av1_cm,
+                                              ref_mb,
+                                              input_picture_ptr->stride_y,
+                                              dst_buffer,
+                                              dst_buffer_stride,
+                                              &final_best_mv,
+                                              mb_origin_x,
+                                              mb_origin_y,
+                                              &inter_pred_params);
+                } else {
+                    // intra recon
+                    uint8_t *above_row;
+                    uint8_t *left_col;
+                    DECLARE_ALIGNED(16, uint8_t, left_data[MAX_TX_SIZE * 2 + 32]);
+                    DECLARE_ALIGNED(16, uint8_t, above_data[MAX_TX_SIZE * 2 + 32]);
+
+                    above_row = above_data + 16;
+                    left_col = left_data + 16;
+                    TxSize tx_size = TX_16X16;
+#if TPL_IMP
+                    uint8_t *recon_buffer =
+                        encode_context_ptr->mc_flow_rec_picture_buffer[frame_idx] +
+                        dst_basic_offset;
+                    update_neighbor_samples_array_open_loop_mb_recon(above_row - 1,
+                                                                     left_col - 1,
+                                                                     recon_buffer,
+                                                                     dst_buffer_stride,
+                                                                     mb_origin_x,
+                                                                     mb_origin_y,
+                                                                     16,
+                                                                     16,
+                                                                     input_picture_ptr->width,
+                                                                     input_picture_ptr->height);
+#else
+                    update_neighbor_samples_array_open_loop_mb(above_row - 1, left_col - 1,
+                                                               input_picture_ptr,
+                                                               input_picture_ptr->stride_y, mb_origin_x, mb_origin_y, 16, 16);
+#endif
+                    uint8_t ois_intra_mode = ois_mb_results_ptr->intra_mode;
+                    int32_t p_angle = av1_is_directional_mode((PredictionMode)ois_intra_mode) ? mode_to_angle_map[(PredictionMode)ois_intra_mode] : 0;
+                    // Edge filter
+                    if(av1_is_directional_mode((PredictionMode)ois_intra_mode) && 1/*scs_ptr->seq_header.enable_intra_edge_filter*/) {
+                        filter_intra_edge(ois_mb_results_ptr, ois_intra_mode, scs_ptr->seq_header.max_frame_width, scs_ptr->seq_header.max_frame_height, p_angle, mb_origin_x, mb_origin_y, above_row, left_col);
+                    }
+                    // PRED
+                    intra_prediction_open_loop_mb(p_angle, ois_intra_mode, mb_origin_x, mb_origin_y, tx_size, above_row, left_col, dst_buffer, dst_buffer_stride);
+                }
+
+                eb_aom_subtract_block(16, 16, src_diff, 16, src_mb, input_picture_ptr->stride_y, dst_buffer, dst_buffer_stride);
+                svt_av1_wht_fwd_txfm(src_diff, 16, coeff, tx_size, 8, 0);
+
+                uint16_t eob;
+
+                get_quantize_error(&frame->mb_plane, coeff, qcoeff, dqcoeff, tx_size, &eob, &recon_error, &sse);
+#if TPL_OPT
+                int rate_cost = pcs_ptr->tpl_opt_flag ? 0 : rate_estimator(qcoeff, eob, tx_size);
+#else
+                int rate_cost = rate_estimator(qcoeff, eob, tx_size);
+#endif
+
+                if(eob) {
+                    av1_inv_transform_recon8bit((int32_t*)dqcoeff, dst_buffer, dst_buffer_stride, dst_buffer, dst_buffer_stride, TX_16X16, DCT_DCT, PLANE_TYPE_Y, eob, 0);
+                }
+
+                tpl_stats.recrf_dist = recon_error << (TPL_DEP_COST_SCALE_LOG2);
+                tpl_stats.recrf_rate = rate_cost << TPL_DEP_COST_SCALE_LOG2;
+                if (best_mode != NEWMV) {
+                    tpl_stats.srcrf_dist = recon_error << (TPL_DEP_COST_SCALE_LOG2);
+                    tpl_stats.srcrf_rate = rate_cost << TPL_DEP_COST_SCALE_LOG2;
+                }
+                tpl_stats.recrf_dist = AOMMAX(tpl_stats.srcrf_dist, tpl_stats.recrf_dist);
+                tpl_stats.recrf_rate = AOMMAX(tpl_stats.srcrf_rate, tpl_stats.recrf_rate);
+
+                if (!frame_is_intra_only(pcs_ptr) && best_rf_idx != -1) {
+                    tpl_stats.mv = final_best_mv;
+                    tpl_stats.ref_frame_poc = pcs_ptr->ref_order_hint[best_rf_idx];
+                }
+                // Motion flow dependency dispenser.
+                result_model_store(pcs_ptr, &tpl_stats, mb_origin_x, mb_origin_y);
+            }
+            pa_blk_index++;
+        }
+    }
+}
+
+// Dispenses an SB row. The intra recon of an MB uses the recon of the MBs above it, so the
+// SB at column x waits until the row above has dispensed its first x + 1 SBs.
+static void tpl_mc_flow_dispenser_row(void *job_ptr, uint32_t sb_row) {
+    TplDispenserFrame *frame = (TplDispenserFrame *)job_ptr;
+
+    for (uint32_t sb_col = 0; sb_col < frame->picture_width_in_sb; ++sb_col) {
+        const uint32_t sb_index = sb_row * frame->picture_width_in_sb + sb_col;
+        if (sb_index >= frame->pcs_ptr->sb_total_count) break;
+        if (sb_row) eb_wavefront_wait(frame->wavefront_ptr, sb_row - 1, sb_col + 1);
+        tpl_mc_flow_dispenser_sb(frame, sb_index);
+        eb_wavefront_post(frame->wavefront_ptr, sb_row, sb_col + 1);
+    }
+    eb_wavefront_post(frame->wavefront_ptr, sb_row, frame->picture_width_in_sb);
+}
+
+/************************************************
+* Genrate TPL MC Flow Dispenser  Based on Lookahead
+** LAD Window: sliding window size
+************************************************/
+void tpl_mc_flow_dispenser(
+    InitialRateControlContext       *context_ptr,
+    EncodeContext                   *encode_context_ptr,
+    SequenceControlSet              *scs_ptr,
+    PictureParentControlSet         *pcs_ptr,
+    int32_t                          frame_idx)
+{
+    uint32_t    picture_width_in_sb = (pcs_ptr->enhanced_picture_ptr->width + BLOCK_SIZE_64 - 1) / BLOCK_SIZE_64;
+    uint32_t    picture_height_in_sb = (pcs_ptr->enhanced_picture_ptr->height + BLOCK_SIZE_64 - 1) / BLOCK_SIZE_64;
+    EbPictureBufferDesc *input_picture_ptr = pcs_ptr->enhanced_picture_ptr;
+    TplDispenserFrame frame;
+
+    frame.encode_context_ptr   = encode_context_ptr;
+    frame.scs_ptr              = scs_ptr;
+    frame.pcs_ptr              = pcs_ptr;
+    frame.frame_idx            = frame_idx;
+    frame.picture_width_in_sb  = picture_width_in_sb;
+    frame.picture_height_in_sb = picture_height_in_sb;
+
     eb_av1_setup_scale_factors_for_frame(
-                &sf, picture_width_in_sb * BLOCK_SIZE_64,
+                &frame.sf, picture_width_in_sb * BLOCK_SIZE_64,
                 picture_height_in_sb * BLOCK_SIZE_64,
                 picture_width_in_sb * BLOCK_SIZE_64,
                 picture_height_in_sb * BLOCK_SIZE_64);
 
-    MacroblockPlane mb_plane;
+    MacroblockPlane *mb_plane = &frame.mb_plane;
     int32_t qIndex = quantizer_to_qindex[(uint8_t)scs_ptr->static_config.qp];
 
 #if TPL_IMP
@@ -1114,278 +1433,22 @@ void tpl_mc_flow_dispenser(
         pcs_ptr->frm_hdr.quantization_params.delta_q_ac[AOM_PLANE_V],
         quants_bd,
         deq_bd);
-    mb_plane.quant_qtx       = pcs_ptr->quants_bd.y_quant[qIndex];
-    mb_plane.quant_fp_qtx    = pcs_ptr->quants_bd.y_quant_fp[qIndex];
-    mb_plane.round_fp_qtx    = pcs_ptr->quants_bd.y_round_fp[qIndex];
-    mb_plane.quant_shift_qtx = pcs_ptr->quants_bd.y_quant_shift[qIndex];
-    mb_plane.zbin_qtx        = pcs_ptr->quants_bd.y_zbin[qIndex];
-    mb_plane.round_qtx       = pcs_ptr->quants_bd.y_round[qIndex];
-    mb_plane.dequant_qtx     = pcs_ptr->deq_bd.y_dequant_qtx[qIndex];
+    mb_plane->quant_qtx       = pcs_ptr->quants_bd.y_quant[qIndex];
+    mb_plane->quant_fp_qtx    = pcs_ptr->quants_bd.y_quant_fp[qIndex];
+    mb_plane->round_fp_qtx    = pcs_ptr->quants_bd.y_round_fp[qIndex];
+    mb_plane->quant_shift_qtx = pcs_ptr->quants_bd.y_quant_shift[qIndex];
+    mb_plane->zbin_qtx        = pcs_ptr->quants_bd.y_zbin[qIndex];
+    mb_plane->round_qtx       = pcs_ptr->quants_bd.y_round[qIndex];
+    mb_plane->dequant_qtx     = pcs_ptr->deq_bd.y_dequant_qtx[qIndex];
     pcs_ptr->base_rdmult = svt_av1_compute_rd_mult_based_on_qindex((AomBitDepth)8/*scs_ptr->static_config.encoder_bit_depth*/, qIndex) / 6;
 
-    // Walk the first N entries in the sliding window
-    for (uint32_t sb_index = 0; sb_index < pcs_ptr->sb_total_count; ++sb_index) {
-        sb_origin_x = (sb_index % picture_width_in_sb) * BLOCK_SIZE_64;
-        sb_origin_y = (sb_index / picture_width_in_sb) * BLOCK_SIZE_64;
-        if (((sb_origin_x + 16) <= input_picture_ptr->width) &&
-            ((sb_origin_y + 16) <= input_picture_ptr->height)) {
-            SbParams *sb_params = &scs_ptr->sb_params_array[sb_index];
-            uint32_t pa_blk_index = 0;
-            while (pa_blk_index < CU_MAX_COUNT) {
-                const CodedBlockStats *blk_stats_ptr;
-                blk_stats_ptr = get_coded_blk_stats(pa_blk_index);
-                uint8_t bsize = blk_stats_ptr->size;
-                EbBool small_boundary_blk = EB_FALSE;
-
-                //if(sb_params->raster_scan_blk_validity[md_scan_to_raster_scan[pa_blk_index]])
-                {
-                    uint32_t cu_origin_x = sb_params->origin_x + blk_stats_ptr->origin_x;
-                    uint32_t cu_origin_y = sb_params->origin_y + blk_stats_ptr->origin_y;
-                    if ((blk_stats_ptr->origin_x % 16) == 0 && (blk_stats_ptr->origin_y % 16) == 0 &&
-                            ((pcs_ptr->enhanced_picture_ptr->width - cu_origin_x) < 16 || (pcs_ptr->enhanced_picture_ptr->height - cu_origin_y) < 16))
-                        small_boundary_blk = EB_TRUE;
-                }
-                if(bsize != 16 && !small_boundary_blk) {
-                    pa_blk_index++;
-                    continue;
-                }
-                if (sb_params->raster_scan_blk_validity[md_scan_to_raster_scan[pa_blk_index]]) {
-                    uint32_t mb_origin_x = sb_params->origin_x + blk_stats_ptr->origin_x;
-                    uint32_t mb_origin_y = sb_params->origin_y + blk_stats_ptr->origin_y;
-                    const int dst_buffer_stride = input_picture_ptr->stride_y;
-                    const int dst_mb_offset = mb_origin_y * dst_buffer_stride + mb_origin_x;
-                    const int dst_basic_offset = input_picture_ptr->origin_y * input_picture_ptr->stride_y + input_picture_ptr->origin_x;
-                    uint8_t *dst_buffer = encode_context_ptr->mc_flow_rec_picture_buffer[frame_idx] + dst_basic_offset + dst_mb_offset;
-                    int64_t inter_cost;
-#if TPL_IMP
-                    int64_t recon_error = 1, sse = 1;
-#endif
-                    int32_t best_rf_idx = -1;
-                    int64_t best_inter_cost = INT64_MAX;
-                    MV final_best_mv = {0, 0};
-#if REMOVE_MRP_MODE
-                    uint32_t max_inter_ref = MAX_PA_ME_MV;
-#else
-                    uint32_t max_inter_ref = ((scs_ptr->mrp_mode == 0) ? ME_MV_MRP_MODE_0 : ME_MV_MRP_MODE_1);
-#endif
-                    OisMbResults *ois_mb_results_ptr = pcs_ptr->ois_mb_results[(mb_origin_y >> 4) * picture_width_in_mb + (mb_origin_x >> 4)];
-                    int64_t best_intra_cost = ois_mb_results_ptr->intra_cost;
-                    uint8_t best_mode = DC_PRED;
-                    uint8_t *src_mb = input_picture_ptr->buffer_y + input_picture_ptr->origin_x + mb_origin_x +
-                                     (input_picture_ptr->origin_y + mb_origin_y) * input_picture_ptr->stride_y;
-                    memset(&tpl_stats, 0, sizeof(tpl_stats));
-                    blk_geom.origin_x = blk_stats_ptr->origin_x;
-                    blk_geom.origin_y = blk_stats_ptr->origin_y;
-                    me_mb_offset = get_me_info_index(pcs_ptr->max_number_of_pus_per_sb, &blk_geom, 0, 0);
-                    for(uint32_t rf_idx = 0; rf_idx < max_inter_ref; rf_idx++) {
-#if REMOVE_MRP_MODE
-                        uint32_t list_index = rf_idx < 4 ? 0 : 1;
-                        uint32_t ref_pic_index = rf_idx >= 4 ? (rf_idx - 4) : rf_idx;
-#else
-                        uint32_t list_index = (scs_ptr->mrp_mode == 0) ? (rf_idx < 4 ? 0 : 1)
-                                                                       : (rf_idx < 2 ? 0 : 1);
-                        uint32_t ref_pic_index = (scs_ptr->mrp_mode == 0) ? (rf_idx >= 4 ? (rf_idx - 4) : rf_idx)
-                                                                          : (rf_idx >= 2 ? (rf_idx - 2) : rf_idx);
-#endif
-                        if(!pcs_ptr->ref_pa_pic_ptr_array[list_index][ref_pic_index])
-                            continue;
-                        uint32_t ref_poc = pcs_ptr->ref_order_hint[rf_idx];
-                        uint32_t ref_frame_idx = 0;
-#if FIX_WARNINGS_WIN
-                        while(ref_frame_idx < MAX_TPL_LA_SW && encode_context_ptr->poc_map_idx[ref_frame_idx] != ref_poc)
-#else
-                        while(ref_frame_idx < MAX_TPL_LA_SW && encode_context_ptr->poc_map_idx[ref_frame_idx] != (int32_t)ref_poc)
-#endif
-                            ref_frame_idx++;
-                        if(ref_frame_idx == MAX_TPL_LA_SW || (int32_t)ref_frame_idx >= frame_idx) {
-                            continue;
-                        }
-
-                        referenceObject = (EbReferenceObject*)pcs_ptr->ref_pa_pic_ptr_array[list_index][ref_pic_index]->object_ptr;
-                        ref_pic_ptr = /*is16bit ? (EbPictureBufferDesc*)referenceObject->reference_picture16bit : */(EbPictureBufferDesc*)referenceObject->reference_picture;
-                        const int ref_basic_offset = ref_pic_ptr->origin_y * ref_pic_ptr->stride_y + ref_pic_ptr->origin_x;
-                        const int ref_mb_offset = mb_origin_y * ref_pic_ptr->stride_y + mb_origin_x;
-                        uint8_t *ref_mb = ref_pic_ptr->buffer_y + ref_basic_offset + ref_mb_offset;
-
-                        struct Buf2D ref_buf = { NULL, ref_pic_ptr->buffer_y + ref_basic_offset,
-                                                  ref_pic_ptr->width, ref_pic_ptr->height,
-                                                  ref_pic_ptr->stride_y };
-#if DECOUPLE_ME_RES
-                        const MeSbResults *me_results = pcs_ptr->pa_me_data->me_results[sb_index];
-#else
-                        const MeSbResults *me_results = pcs_ptr->me_results[sb_index];
-#endif
-#if ME_MEM_OPT
-#if REMOVE_MRP_MODE
-                        x_curr_mv = me_results->me_mv_array[me_mb_offset * MAX_PA_ME_MV + (list_index ? 4 : 0) + ref_pic_index].x_mv << 1;
-                        y_curr_mv = me_results->me_mv_array[me_mb_offset * MAX_PA_ME_MV + (list_index ? 4 : 0) + ref_pic_index].y_mv << 1;
-#else
-                        uint32_t pu_stride = scs_ptr->mrp_mode == 0 ? ME_MV_MRP_MODE_0 : ME_MV_MRP_MODE_1;
-                        x_curr_mv = me_results->me_mv_array[me_mb_offset * pu_stride + (list_index ? ((scs_ptr->mrp_mode == 0) ? 4 : 2) : 0) + ref_pic_index].x_mv << 1;
-                        y_curr_mv = me_results->me_mv_array[me_mb_offset * pu_stride + (list_index ? ((scs_ptr->mrp_mode == 0) ? 4 : 2) : 0) + ref_pic_index].y_mv << 1;
-#endif
-#else
-                        x_curr_mv = me_results->me_mv_array[me_mb_offset][(list_index ? ((scs_ptr->mrp_mode == 0) ? 4 : 2) : 0) + ref_pic_index].x_mv << 1;
-                        y_curr_mv = me_results->me_mv_array[me_mb_offset][(list_index ? ((scs_ptr->mrp_mode == 0) ? 4 : 2) : 0) + ref_pic_index].y_mv << 1;
-#endif
-                        InterPredParams inter_pred_params;
-                        svt_av1_init_inter_params(&inter_pred_params, 16, 16, mb_origin_y,
-                                mb_origin_x, 0, 0, 8, 0, 0,
-                                &sf, &ref_buf, kernel);
-
-                        inter_pred_params.conv_params = get_conv_params(0, 0, 0, 8);
-
-                        MV best_mv = {y_curr_mv, x_curr_mv};
-                        av1_build_inter_predictor(pcs_ptr->av1_cm,
-                                                  ref_mb,
-                                                  input_picture_ptr->stride_y,
-                                                  predictor,
-                                                  16,
-                                                  &best_mv,
-                                                  mb_origin_x,
-                                                  mb_origin_y,
-                                                  &inter_pred_params);
-                        eb_aom_subtract_block(16, 16, src_diff, 16, src_mb, input_picture_ptr->stride_y, predictor, 16);
-
-                        svt_av1_wht_fwd_txfm(src_diff, 16, coeff, tx_size, 8, 0);
-
-                        inter_cost = svt_aom_satd(coeff, 256);
-                        if (inter_cost < best_inter_cost) {
-                            memcpy(best_coeff, coeff, sizeof(best_coeff));
-                            best_rf_idx = rf_idx;
-                            best_inter_cost = inter_cost;
-                            final_best_mv = best_mv;
-
-                            if (best_inter_cost < best_intra_cost) best_mode = NEWMV;
-                        }
-                    } // rf_idx
-                    if(best_inter_cost < INT64_MAX) {
-                        uint16_t eob;
-                        get_quantize_error(&mb_plane, best_coeff, qcoeff, dqcoeff, tx_size, &eob, &recon_error, &sse);
-#if TPL_OPT
-                        int rate_cost = pcs_ptr->tpl_opt_flag? 0 : rate_estimator(qcoeff, eob, tx_size);
-#else
-                        int rate_cost = rate_estimator(qcoeff, eob, tx_size);
-#endif
-                        tpl_stats.srcrf_rate = rate_cost << TPL_DEP_COST_SCALE_LOG2;
-                    }
-                    best_intra_cost = AOMMAX(best_intra_cost, 1);
-                    if (frame_is_intra_only(pcs_ptr))
-                        best_inter_cost = 0;
-                    else
-                        best_inter_cost = AOMMIN(best_intra_cost, best_inter_cost);
-
-                    tpl_stats.srcrf_dist = recon_error << (TPL_DEP_COST_SCALE_LOG2);
-
-                    if (best_mode == NEWMV) {
-                        // inter recon with rec_picture as reference pic
-                        uint32_t ref_poc = pcs_ptr->ref_order_hint[best_rf_idx];
-                        uint32_t ref_frame_idx = 0;
-#if FIX_WARNINGS_WIN
-                        while(ref_frame_idx < MAX_TPL_LA_SW && encode_context_ptr->poc_map_idx[ref_frame_idx] != ref_poc)
-#else
-                        while(ref_frame_idx < MAX_TPL_LA_SW && encode_context_ptr->poc_map_idx[ref_frame_idx] != (int32_t)ref_poc)
-#endif
-                            ref_frame_idx++;
-                        assert(ref_frame_idx != MAX_TPL_LA_SW);
-
-                        const int ref_basic_offset = input_picture_ptr->origin_y * input_picture_ptr->stride_y + input_picture_ptr->origin_x;
-                        const int ref_mb_offset = mb_origin_y * input_picture_ptr->stride_y + mb_origin_x;
-                        uint8_t *ref_mb = encode_context_ptr->mc_flow_rec_picture_buffer[ref_frame_idx] + ref_basic_offset + ref_mb_offset;
-
-                        struct Buf2D ref_buf = { NULL, encode_context_ptr->mc_flow_rec_picture_buffer[ref_frame_idx] + ref_basic_offset,
-                                                  input_picture_ptr->width, input_picture_ptr->height,
-                                                  input_picture_ptr->stride_y};
-                        InterPredParams inter_pred_params;
-                        svt_av1_init_inter_params(&inter_pred_params, 16, 16, mb_origin_y,
-                            mb_origin_x, 0, 0, 8, 0, 0,
-                            &sf, &ref_buf, kernel);
-
-                        inter_pred_params.conv_params = get_conv_params(0, 0, 0, 8);
-                        av1_build_inter_predictor(pcs_ptr->av1_cm,
-                                                  ref_mb,
-                                                  input_picture_ptr->stride_y,
-                                                  dst_buffer,
-                                                  dst_buffer_stride,
-                                                  &final_best_mv,
-                                                  mb_origin_x,
-                                                  mb_origin_y,
-                                                  &inter_pred_params);
-                    } else {
-                        // intra recon
-                        uint8_t *above_row;
-                        uint8_t *left_col;
-                        DECLARE_ALIGNED(16, uint8_t, left_data[MAX_TX_SIZE * 2 + 32]);
-                        DECLARE_ALIGNED(16, uint8_t, above_data[MAX_TX_SIZE * 2 + 32]);
-
-                        above_row = above_data + 16;
-                        left_col = left_data + 16;
-                        TxSize tx_size = TX_16X16;
-#if TPL_IMP
-                        uint8_t *recon_buffer =
-                            encode_context_ptr->mc_flow_rec_picture_buffer[frame_idx] +
-                            dst_basic_offset;
-                        update_neighbor_samples_array_open_loop_mb_recon(above_row - 1,
-                                                                         left_col - 1,
-                                                                         recon_buffer,
-                                                                         dst_buffer_stride,
-                                                                         mb_origin_x,
-                                                                         mb_origin_y,
-                                                                         16,
-                                                                         16,
-                                                                         input_picture_ptr->width,
-                                                                         input_picture_ptr->height);
-#else
-                        update_neighbor_samples_array_open_loop_mb(above_row - 1, left_col - 1,
-                                                                   input_picture_ptr,
-                                                                   input_picture_ptr->stride_y, mb_origin_x, mb_origin_y, 16, 16);
-#endif
-                        uint8_t ois_intra_mode = ois_mb_results_ptr->intra_mode;
-                        int32_t p_angle = av1_is_directional_mode((PredictionMode)ois_intra_mode) ? mode_to_angle_map[(PredictionMode)ois_intra_mode] : 0;
-                        // Edge filter
-                        if(av1_is_directional_mode((PredictionMode)ois_intra_mode) && 1/*scs_ptr->seq_header.enable_intra_edge_filter*/) {
-                            filter_intra_edge(ois_mb_results_ptr, ois_intra_mode, scs_ptr->seq_header.max_frame_width, scs_ptr->seq_header.max_frame_height, p_angle, mb_origin_x, mb_origin_y, above_row, left_col);
-                        }
-                        // PRED
-                        intra_prediction_open_loop_mb(p_angle, ois_intra_mode, mb_origin_x, mb_origin_y, tx_size, above_row, left_col, dst_buffer, dst_buffer_stride);
-                    }
-
-                    eb_aom_subtract_block(16, 16, src_diff, 16, src_mb, input_picture_ptr->stride_y, dst_buffer, dst_buffer_stride);
-                    svt_av1_wht_fwd_txfm(src_diff, 16, coeff, tx_size, 8, 0);
-
-                    uint16_t eob;
-
-                    get_quantize_error(&mb_plane, coeff, qcoeff, dqcoeff, tx_size, &eob, &recon_error, &sse);
-#if TPL_OPT
-                    int rate_cost = pcs_ptr->tpl_opt_flag ? 0 : rate_estimator(qcoeff, eob, tx_size);
-#else
-                    int rate_cost = rate_estimator(qcoeff, eob, tx_size);
-#endif
-
-                    if(eob) {
-                        av1_inv_transform_recon8bit((int32_t*)dqcoeff, dst_buffer, dst_buffer_stride, dst_buffer, dst_buffer_stride, TX_16X16, DCT_DCT, PLANE_TYPE_Y, eob, 0);
-                    }
-
-                    tpl_stats.recrf_dist = recon_error << (TPL_DEP_COST_SCALE_LOG2);
-                    tpl_stats.recrf_rate = rate_cost << TPL_DEP_COST_SCALE_LOG2;
-                    if (best_mode != NEWMV) {
-                        tpl_stats.srcrf_dist = recon_error << (TPL_DEP_COST_SCALE_LOG2);
-                        tpl_stats.srcrf_rate = rate_cost << TPL_DEP_COST_SCALE_LOG2;
-                    }
-                    tpl_stats.recrf_dist = AOMMAX(tpl_stats.srcrf_dist, tpl_stats.recrf_dist);
-                    tpl_stats.recrf_rate = AOMMAX(tpl_stats.srcrf_rate, tpl_stats.recrf_rate);
-
-                    if (!frame_is_intra_only(pcs_ptr) && best_rf_idx != -1) {
-                        tpl_stats.mv = final_best_mv;
-                        tpl_stats.ref_frame_poc = pcs_ptr->ref_order_hint[best_rf_idx];
-                    }
-                    // Motion flow dependency dispenser.
-                    result_model_store(pcs_ptr, &tpl_stats, mb_origin_x, mb_origin_y);
-                }
-                pa_blk_index++;
-            }
-        }
-    }
+    // Rows are started in order, a row only waits for the row above it
+    frame.wavefront_ptr = context_ptr->tpl_wavefront;
+    eb_wavefront_reset(frame.wavefront_ptr);
+    eb_task_pool_run(encode_context_ptr->task_pool,
+                     tpl_mc_flow_dispenser_row,
+                     &frame,
+                     picture_height_in_sb);
 
     // padding current recon picture
     generate_padding(
@@ -1663,6 +1726,7 @@ static void generate_r0beta(PictureParentControlSet *pcs_ptr)
 ************************************************/
 #if LAD_MEM_RED
 EbErrorType tpl_mc_flow(
+    InitialRateControlContext       *context_ptr,
     EncodeContext                   *encode_context_ptr,
     SequenceControlSet              *scs_ptr,
     PictureParentControlSet         *pcs_ptr)
@@ -1753,7 +1817,7 @@ EbErrorType tpl_mc_flow(
                 memset(pcs_array[frame_idx]->tpl_stats[blky * (picture_width_in_mb << shift)], 0, (picture_width_in_mb << shift) * sizeof(TplStats));
             }
 
-            tpl_mc_flow_dispenser(encode_context_ptr, scs_ptr, pcs_array[frame_idx], frame_idx);
+            tpl_mc_flow_dispenser(context_ptr, encode_context_ptr, scs_ptr, pcs_array[frame_idx], frame_idx);
 
         }
 
@@ -1806,7 +1870,7 @@ EbErrorType tpl_mc_flow(
                 memset(pcs_array[frame_idx]->tpl_stats[blky * (picture_width_in_mb << shift)], 0, (picture_width_in_mb << shift) * sizeof(TplStats));
             }
 
-            tpl_mc_flow_dispenser(encode_context_ptr, scs_ptr, pcs_array[frame_idx], frame_idx);
+            tpl_mc_flow_dispenser(context_ptr, encode_context_ptr, scs_ptr, pcs_array[frame_idx], frame_idx);
             if (frame_idx == 1 && pcs_array[frame_idx]->temporal_layer_index == 0) {
                 // save frame_idx1 picture buffer for next LA
                 memcpy(encode_context_ptr->mc_flow_rec_picture_buffer_saved, encode_context_ptr->mc_flow_rec_picture_buffer[frame_idx], input_picture_ptr->stride_y * (input_picture_ptr->origin_y * 2 + input_picture_ptr->height));
@@ -1834,6 +1898,7 @@ EbErrorType tpl_mc_flow(
 }
 #else
 EbErrorType tpl_mc_flow(
+    InitialRateControlContext       *context_ptr,
     EncodeContext                   *encode_context_ptr,
     SequenceControlSet              *scs_ptr,
     PictureParentControlSet         *pcs_ptr)
@@ -1911,7 +1976,7 @@ EbErrorType tpl_mc_flow(
                 memset(pcs_array[frame_idx]->tpl_stats[blky * (picture_width_in_mb << shift)], 0, (picture_width_in_mb << shift) * sizeof(TplStats));
             }
 
-            tpl_mc_flow_dispenser(encode_context_ptr, scs_ptr, pcs_array[frame_idx], frame_idx);
+            tpl_mc_flow_dispenser(context_ptr, encode_context_ptr, scs_ptr, pcs_array[frame_idx], frame_idx);
         }
 
         // synthesizer I0 or frame_idx0 pic in LA1
@@ -1934,7 +1999,7 @@ EbErrorType tpl_mc_flow(
             for (uint32_t blky = 0; blky < (picture_height_in_mb << shift); blky++) {
                 memset(pcs_array[frame_idx]->tpl_stats[blky * (picture_width_in_mb << shift)], 0, (picture_width_in_mb << shift) * sizeof(TplStats));
             }
-            tpl_mc_flow_dispenser(encode_context_ptr, scs_ptr, pcs_array[frame_idx], frame_idx);
+            tpl_mc_flow_dispenser(context_ptr, encode_context_ptr, scs_ptr, pcs_array[frame_idx], frame_idx);
         }
         // synthesizer frame_idx1 pic in LA1 or LA2+
         PictureParentControlSet *pcs_array_reorder[MAX_TPL_LA_SW] = {NULL, };
@@ -2277,7 +2342,7 @@ void *initial_rate_control_kernel(void *input_ptr) {
                             //pcs_ptr->frames_in_sw > 16/*(2 << scs_ptr->static_config.hierarchical_levels)*/ &&
 #endif
                             pcs_ptr->temporal_layer_index == 0) {
-                            tpl_mc_flow(encode_context_ptr, scs_ptr, pcs_ptr);
+                            tpl_mc_flow(context_ptr, encode_context_ptr, scs_ptr, pcs_ptr);
                         }
 #endif
                         // Get Empty Results Object
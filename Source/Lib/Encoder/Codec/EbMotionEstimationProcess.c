@@ -20,8 +20,10 @@
 #endif
 #include "EbTemporalFiltering.h"
 #include "EbGlobalMotionEstimation.h"
+#include "EbTime.h"
 
 #include "EbResize.h"
+#include "EbLog.h"
 
 /* --32x32-
 |00||01|
@@ -1973,9 +1975,23 @@ void *motion_estimation_kernel(void *input_ptr) {
             if (pcs_ptr->gm_level == GM_FULL || pcs_ptr->gm_level == GM_DOWN) {
 #endif
                 if (context_ptr->me_context_ptr->compute_global_motion &&
-                    in_results_ptr->segment_index == 0)
+                    in_results_ptr->segment_index == 0) {
+                    uint64_t gm_start_seconds, gm_start_u_seconds;
+                    uint64_t gm_finish_seconds, gm_finish_u_seconds;
+                    double   gm_time_ms;
+                    eb_start_time(&gm_start_seconds, &gm_start_u_seconds);
                     global_motion_estimation(
                         pcs_ptr, context_ptr->me_context_ptr, input_picture_ptr);
+                    eb_finish_time(&gm_finish_seconds, &gm_finish_u_seconds);
+                    eb_compute_overall_elapsed_time_ms(gm_start_seconds,
+                                                       gm_start_u_seconds,
+                                                       gm_finish_seconds,
+                                                       gm_finish_u_seconds,
+                                                       &gm_time_ms);
+                    SVT_DEBUG("POC %d global motion %.2f ms\n",
+                              (int32_t)pcs_ptr->picture_number,
+                              gm_time_ms);
+                }
             }
 
             // Segments
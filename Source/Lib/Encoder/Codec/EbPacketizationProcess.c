@@ -316,7 +316,7 @@ static uint32_t count_frames_in_next_tu(const EncodeContext *encode_context_ptr,
         if (!wrapper) return 0;
 
         const EbBufferHeaderType *output_stream_ptr = (EbBufferHeaderType *)wrapper->object_ptr;
-        *data_size += output_stream_ptr->n_filled_len;
+        *data_size += output_stream_ptr->n_filled_len - queue_entry_ptr->subframe_bytes_sent;
 
         i++;
         //we have a td when we got a displable frame
@@ -517,9 +517,12 @@ static void collect_frames_info(PacketizationContext* context_ptr, const EncodeC
 #define TD_SIZE 2
 
 //a tu start with a td, + 0 more not displable frame, + 1 display frame
+//with sub-frame output the td and the start of the first frame may already be sent
 static EbErrorType encode_tu(EncodeContext *encode_context_ptr, int frames, uint32_t total_bytes,
                              EbBufferHeaderType *output_stream_ptr) {
-    total_bytes += TD_SIZE;
+    const EbBool has_td = get_reorder_queue_entry(encode_context_ptr, 0)->subframe_bytes_sent == 0;
+    if (has_td)
+        total_bytes += TD_SIZE;
     if (total_bytes > output_stream_ptr->n_alloc_len) {
         uint8_t *pbuff;
         EB_MALLOC(pbuff, total_bytes);
@@ -541,9 +544,9 @@ static EbErrorType encode_tu(EncodeContext *encode_context_ptr, int frames, uint
         PacketizationReorderEntry *queue_entry_ptr = get_reorder_queue_entry(encode_context_ptr, i);
         EbObjectWrapper* wrapper = queue_entry_ptr->output_stream_wrapper_ptr;
         EbBufferHeaderType *       src_stream_ptr = (EbBufferHeaderType *)wrapper->object_ptr;
-        uint32_t size = src_stream_ptr->n_filled_len;
+        uint32_t size = src_stream_ptr->n_filled_len - queue_entry_ptr->subframe_bytes_sent;
         dst -= size;
-        memmove(dst, src_stream_ptr->p_buffer, size);
+        memmove(dst, src_stream_ptr->p_buffer + queue_entry_ptr->subframe_bytes_sent, size);
         //1. The last frame is a displayable frame, others are undisplayed.
         //2. We do not push alt ref frame since the overlay frame will carry the pts.
         if (i != frames - 1 && !queue_entry_ptr->is_alt_ref)
@@ -551,10 +554,12 @@ static EbErrorType encode_tu(EncodeContext *encode_context_ptr, int frames, uint
     }
     if (frames > 1)
         sort_undisplayed_frame(encode_context_ptr);
-    dst -= TD_SIZE;
-    encode_td_av1(dst);
+    if (has_td) {
+        dst -= TD_SIZE;
+        encode_td_av1(dst);
+        output_stream_ptr->flags |= EB_BUFFERFLAG_HAS_TD;
+    }
     output_stream_ptr->n_filled_len = total_bytes;
-    output_stream_ptr->flags |= EB_BUFFERFLAG_HAS_TD;
     return EB_ErrorNone;
 }
 
@@ -596,6 +601,8 @@ static void release_frames(EncodeContext *encode_context_ptr, int frames) {
         // Reset the Reorder Queue Entry
         queue_entry_ptr->picture_number += PACKETIZATION_REORDER_QUEUE_MAX_DEPTH;
         queue_entry_ptr->output_stream_wrapper_ptr = (EbObjectWrapper *)NULL;
+        queue_entry_ptr->subframe_tiles_written    = 0;
+        queue_entry_ptr->subframe_bytes_sent       = 0;
     }
     encode_context_ptr->packetization_reorder_queue_head_index = get_reorder_queue_pos(encode_context_ptr, frames);
 }
@@ -614,6 +621,77 @@ static inline EbErrorType malloc_p_buffer(EbBufferHeaderType *output_stream_ptr)
     return EB_ErrorNone;
 }
 
+static uint32_t get_output_pic_type(const PictureControlSet *pcs_ptr) {
+    return pcs_ptr->parent_pcs_ptr->is_used_as_reference_flag
+        ? pcs_ptr->parent_pcs_ptr->idr_flag ? EB_AV1_KEY_PICTURE : pcs_ptr->slice_type
+        : EB_AV1_NON_REF_PICTURE;
+}
+
+/* Sub-frame output: appends the tiles finished, in tile order, to the picture
+ * bitstream holding the frame header and outputs what was not sent yet, the
+ * first chunk of the temporal unit starting with the td. Only the frame at the
+ * head of the reorder queue is streamed, later frames are sent with their
+ * next chunk once they reach the head. */
+static void encode_subframe(EncodeContext *encode_context_ptr, PictureControlSet *pcs_ptr,
+                            PacketizationReorderEntry *queue_entry_ptr) {
+    Av1Common *const cm       = pcs_ptr->parent_pcs_ptr->av1_cm;
+    const uint16_t   tile_cnt = cm->tiles_info.tile_rows * cm->tiles_info.tile_cols;
+    uint16_t         tiles_done = queue_entry_ptr->subframe_tiles_written;
+
+    eb_block_on_mutex(pcs_ptr->entropy_coding_pic_mutex);
+    while (tiles_done < tile_cnt &&
+           pcs_ptr->entropy_coding_info[tiles_done]->entropy_coding_tile_done)
+        tiles_done++;
+    eb_release_mutex(pcs_ptr->entropy_coding_pic_mutex);
+    if (tiles_done == queue_entry_ptr->subframe_tiles_written) return;
+
+    for (uint16_t tile_idx = queue_entry_ptr->subframe_tiles_written; tile_idx < tiles_done;
+         tile_idx++)
+        write_tile_group_obu_av1(pcs_ptr->bitstream_ptr, pcs_ptr, tile_idx);
+    queue_entry_ptr->subframe_tiles_written = tiles_done;
+
+    EbObjectWrapper *output_stream_wrapper_ptr;
+    eb_get_empty_object(encode_context_ptr->stream_output_fifo_ptr, &output_stream_wrapper_ptr);
+    EbBufferHeaderType *output_stream_ptr = (EbBufferHeaderType *)
+                                                output_stream_wrapper_ptr->object_ptr;
+    const EbBool   has_td = queue_entry_ptr->subframe_bytes_sent == 0;
+    const uint32_t size   = (uint32_t)bitstream_get_bytes_count(pcs_ptr->bitstream_ptr) -
+        queue_entry_ptr->subframe_bytes_sent;
+
+    output_stream_ptr->n_alloc_len = size + TD_SIZE;
+    malloc_p_buffer(output_stream_ptr);
+    assert(output_stream_ptr->p_buffer != NULL && "bit-stream memory allocation failure");
+
+    output_stream_ptr->flags        = EB_BUFFERFLAG_PARTIAL_TU;
+    output_stream_ptr->n_filled_len = 0;
+    if (has_td) {
+        encode_td_av1(output_stream_ptr->p_buffer);
+        output_stream_ptr->n_filled_len = TD_SIZE;
+        output_stream_ptr->flags |= EB_BUFFERFLAG_HAS_TD;
+    }
+    eb_memcpy(output_stream_ptr->p_buffer + output_stream_ptr->n_filled_len,
+              ((OutputBitstreamUnit *)pcs_ptr->bitstream_ptr->output_bitstream_ptr)
+                      ->buffer_begin_av1 +
+                  queue_entry_ptr->subframe_bytes_sent,
+              size);
+    output_stream_ptr->n_filled_len += size;
+    queue_entry_ptr->subframe_bytes_sent += size;
+
+    output_stream_ptr->pts           = pcs_ptr->parent_pcs_ptr->input_ptr->pts;
+    output_stream_ptr->dts           = output_stream_ptr->pts;
+    output_stream_ptr->pic_type      = get_output_pic_type(pcs_ptr);
+    output_stream_ptr->qp            = pcs_ptr->parent_pcs_ptr->picture_qp;
+    output_stream_ptr->n_tick_count  = 0;
+    output_stream_ptr->p_app_private = NULL;
+    output_stream_ptr->luma_sse      = 0;
+    output_stream_ptr->cr_sse        = 0;
+    output_stream_ptr->cb_sse        = 0;
+    output_stream_ptr->luma_ssim     = 0;
+    output_stream_ptr->cr_ssim       = 0;
+    output_stream_ptr->cb_ssim       = 0;
+    eb_post_full_object(output_stream_wrapper_ptr);
+}
+
 void *packetization_kernel(void *input_ptr) {
     // Context
     EbThreadContext *     thread_context_ptr = (EbThreadContext *)input_ptr;
@@ -640,6 +718,20 @@ void *packetization_kernel(void *input_ptr) {
                                          entropy_coding_results_ptr->pcs_wrapper_ptr->object_ptr;
         SequenceControlSet *scs_ptr = (SequenceControlSet *)pcs_ptr->scs_wrapper_ptr->object_ptr;
         EncodeContext *     encode_context_ptr = scs_ptr->encode_context_ptr;
+
+        if (entropy_coding_results_ptr->partial) {
+            // The picture may already be complete and its parent released, only
+            // stream it while it is the next, unfinished, frame of the queue
+            PacketizationReorderEntry *head_entry_ptr =
+                get_reorder_queue_entry(encode_context_ptr, 0);
+            if (head_entry_ptr->picture_number == entropy_coding_results_ptr->decode_order &&
+                !head_entry_ptr->output_stream_wrapper_ptr)
+                encode_subframe(encode_context_ptr, pcs_ptr, head_entry_ptr);
+            // Release the live count taken by entropy coding for this result
+            eb_release_object(entropy_coding_results_ptr->pcs_wrapper_ptr);
+            eb_release_object(entropy_coding_results_wrapper_ptr);
+            continue;
+        }
         FrameHeader *    frm_hdr    = &pcs_ptr->parent_pcs_ptr->frm_hdr;
         Av1Common *const cm = pcs_ptr->parent_pcs_ptr->av1_cm;
         uint16_t            tile_cnt = cm->tiles_info.tile_rows * cm->tiles_info.tile_cols;
@@ -672,10 +764,7 @@ void *packetization_kernel(void *input_ptr) {
         output_stream_ptr->pts          = pcs_ptr->parent_pcs_ptr->input_ptr->pts;
         //we output one temporal unit a time, so dts alwasy equals to pts.
         output_stream_ptr->dts          = output_stream_ptr->pts;
-        output_stream_ptr->pic_type =
-            pcs_ptr->parent_pcs_ptr->is_used_as_reference_flag
-                ? pcs_ptr->parent_pcs_ptr->idr_flag ? EB_AV1_KEY_PICTURE : pcs_ptr->slice_type
-                : EB_AV1_NON_REF_PICTURE;
+        output_stream_ptr->pic_type = get_output_pic_type(pcs_ptr);
         output_stream_ptr->p_app_private = pcs_ptr->parent_pcs_ptr->input_ptr->p_app_private;
         output_stream_ptr->qp            = pcs_ptr->parent_pcs_ptr->picture_qp;
 
@@ -725,13 +814,21 @@ void *packetization_kernel(void *input_ptr) {
             picture_manager_results_ptr->picture_type    = EB_PIC_FEEDBACK;
             picture_manager_results_ptr->scs_wrapper_ptr = pcs_ptr->scs_wrapper_ptr;
         }
-        // Reset the Bitstream before writing to it
-        bitstream_reset(pcs_ptr->bitstream_ptr);
+        if (scs_ptr->static_config.subframe_output) {
+            // The header and the tiles streamed so far are in the bitstream already
+            for (uint16_t tile_idx = queue_entry_ptr->subframe_tiles_written; tile_idx < tile_cnt;
+                 tile_idx++)
+                write_tile_group_obu_av1(pcs_ptr->bitstream_ptr, pcs_ptr, tile_idx);
+            queue_entry_ptr->subframe_tiles_written = tile_cnt;
+        } else {
+            // Reset the Bitstream before writing to it
+            bitstream_reset(pcs_ptr->bitstream_ptr);
 
-        // Code the SPS
-        if (frm_hdr->frame_type == KEY_FRAME) { encode_sps_av1(pcs_ptr->bitstream_ptr, scs_ptr); }
+            // Code the SPS
+            if (frm_hdr->frame_type == KEY_FRAME) { encode_sps_av1(pcs_ptr->bitstream_ptr, scs_ptr); }
 
-        write_frame_header_av1(pcs_ptr->bitstream_ptr, scs_ptr, pcs_ptr, 0);
+            write_frame_header_av1(pcs_ptr->bitstream_ptr, scs_ptr, pcs_ptr, 0);
+        }
 
         output_stream_ptr->n_alloc_len = bitstream_get_bytes_count(pcs_ptr->bitstream_ptr) + TD_SIZE;
         malloc_p_buffer(output_stream_ptr);
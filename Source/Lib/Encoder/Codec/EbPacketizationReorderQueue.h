@@ -43,6 +43,9 @@ typedef struct PacketizationReorderEntry {
     //valid when has_show_existing is true
     int64_t    next_pts;
     uint8_t    is_alt_ref;
+    //sub-frame output: tiles appended to the picture bitstream and bytes of it already output
+    uint16_t   subframe_tiles_written;
+    uint32_t   subframe_bytes_sent;
 } PacketizationReorderEntry;
 
 extern EbErrorType packetization_reorder_entry_ctor(PacketizationReorderEntry *entry_ptr,
@@ -287,6 +287,8 @@ void picture_control_set_dctor(EbPtr p) {
     EB_DESTROY_MUTEX(obj->intra_mutex);
     EB_DESTROY_MUTEX(obj->cdef_search_mutex);
     EB_DESTROY_MUTEX(obj->rest_search_mutex);
+    EB_DESTROY_MUTEX(obj->dlf_mutex);
+    EB_DELETE(obj->dlf_wavefront);
 }
 // Token buffer is only used for palette tokens.
 static INLINE unsigned int get_token_alloc(int mb_rows, int mb_cols, int sb_size_log2,
@@ -1188,6 +1190,8 @@ EbErrorType picture_control_set_ctor(PictureControlSet *object_ptr, EbPtr object
            init_data_ptr->picture_height);
     // Segments
     object_ptr->enc_dec_coded_sb_count = 0;
+    // Rows of 64x64 SBs, enough for any SB size
+    const uint16_t picture_sb_row_count = (uint16_t)((init_data_ptr->picture_height + 63) >> 6);
 
     EB_MALLOC_ARRAY(object_ptr->enc_dec_segment_ctrl, total_tile_cnt);
 
@@ -1213,6 +1217,9 @@ EbErrorType picture_control_set_ctor(PictureControlSet *object_ptr, EbPtr object
 
     EB_CREATE_MUTEX(object_ptr->rest_search_mutex);
 
+    EB_CREATE_MUTEX(object_ptr->dlf_mutex);
+    EB_NEW(object_ptr->dlf_wavefront, eb_wavefront_ctor, picture_sb_row_count);
+
     //the granularity is 4x4
     EB_MALLOC_ARRAY(object_ptr->mi_grid_base,
                     all_sb * (init_data_ptr->sb_size_pix >> MI_SIZE_LOG2) *
@@ -1577,6 +1584,7 @@ EbErrorType picture_parent_control_set_ctor(PictureParentControlSet *object_ptr,
         fg_init_data.stride_y = init_data_ptr->picture_width + init_data_ptr->left_padding +
                                 init_data_ptr->right_padding;
         fg_init_data.stride_cb = fg_init_data.stride_cr = fg_init_data.stride_y >> subsampling_x;
+        fg_init_data.task_pool = init_data_ptr->task_pool;
 
         EB_NEW(object_ptr->denoise_and_model, denoise_and_model_ctor, (EbPtr)&fg_init_data);
     }
@@ -19,6 +19,7 @@
 #include "EbNeighborArrays.h"
 #include "EbModeDecisionSegments.h"
 #include "EbEncDecSegments.h"
+#include "EbWavefront.h"
 #include "EbRateControlTables.h"
 #include "EbRestoration.h"
 #include "EbObject.h"
@@ -280,6 +281,14 @@ typedef struct PictureControlSet {
     uint8_t  cdef_segments_column_count;
     uint8_t  cdef_segments_row_count;
 
+    // SB rows filtered by the DLF processes
+    EbHandle             dlf_mutex;
+    EbWavefront *        dlf_wavefront; // SBs filtered in each SB row
+    EbPictureBufferDesc *dlf_recon_picture_ptr;
+    uint32_t             dlf_next_sb_row;
+    uint32_t             dlf_filtered_sb_row_count;
+    uint32_t             cdef_segment_rows_posted;
+
     uint64_t (*mse_seg[2])[TOTAL_STRENGTHS];
 
     uint16_t *src[3]; //dlfed recon in 16bit form
@@ -395,8 +404,7 @@ typedef struct PictureControlSet {
     SpeedFeatures    sf;
     SearchSiteConfig ss_cfg; //CHKN this might be a seq based
     HashTable        hash_table;
-    CRC_CALCULATOR   crc_calculator1;
-    CRC_CALCULATOR   crc_calculator2;
+    CRC32C           crc_calculator;
 
     FRAME_CONTEXT *                 ec_ctx_array;
 #if MD_FRAME_CONTEXT_MEM_OPT
@@ -937,6 +945,7 @@ typedef struct PictureControlSetInitData {
     uint8_t   hbd_mode_decision;
 #endif
     uint16_t  film_grain_noise_level;
+    EbTaskPool *task_pool;
     EbBool    ext_block_flag;
 #if !REMOVE_MRP_MODE
     uint8_t   mrp_mode;
@@ -279,8 +279,8 @@ void *picture_manager_kernel(void *input_ptr) {
     SequenceControlSet *      entry_scs_ptr;
 
     // Initialization
-    uint8_t                     pic_width_in_sb;
-    uint8_t                     picture_height_in_sb;
+    uint16_t                    pic_width_in_sb;
+    uint16_t                    picture_height_in_sb;
 #if !DECOUPLE_ME_RES
     PictureManagerReorderEntry *queue_entry_ptr;
     int32_t                     queue_entry_index;
@@ -1008,16 +1008,19 @@ void *picture_manager_kernel(void *input_ptr) {
                         child_pcs_ptr->parent_pcs_ptr->av1_cm->rst_tmpbuf = child_pcs_ptr->rst_tmpbuf;
 
                         //3.make all  init for ChildPCS
-                        pic_width_in_sb = (uint8_t)((entry_pcs_ptr->aligned_width +
-                                                     entry_scs_ptr->sb_size_pix - 1) /
-                                                    entry_scs_ptr->sb_size_pix);
+                        pic_width_in_sb = (uint16_t)((entry_pcs_ptr->aligned_width +
+                                                      entry_scs_ptr->sb_size_pix - 1) /
+                                                     entry_scs_ptr->sb_size_pix);
                         picture_height_in_sb =
-                            (uint8_t)((entry_pcs_ptr->aligned_height +
-                                       entry_scs_ptr->sb_size_pix - 1) /
-                                      entry_scs_ptr->sb_size_pix);
+                            (uint16_t)((entry_pcs_ptr->aligned_height +
+                                        entry_scs_ptr->sb_size_pix - 1) /
+                                       entry_scs_ptr->sb_size_pix);
 
                         set_tile_info(entry_pcs_ptr);
 
+                        // SB rows filtered by the DLF processes
+                        eb_wavefront_reset(child_pcs_ptr->dlf_wavefront);
+
                         int      sb_size_log2    = entry_scs_ptr->seq_header.sb_size_log2;
                         uint32_t enc_dec_seg_col_cnt = entry_scs_ptr->enc_dec_segment_col_count_array
                                                        [entry_pcs_ptr->temporal_layer_index];
@@ -1041,12 +1044,20 @@ void *picture_manager_kernel(void *input_ptr) {
                             entry_scs_ptr
                                 ->tile_group_row_count_array[entry_pcs_ptr->temporal_layer_index]);
 
+                        // Merge SBs into larger segments for the cheaper pictures of the
+                        // higher layers, keeping a segment row per EncDec process
+                        enc_dec_segments_adapt(&enc_dec_seg_col_cnt,
+                                               &enc_dec_seg_row_cnt,
+                                               pic_width_in_sb * picture_height_in_sb,
+                                               entry_pcs_ptr->temporal_layer_index,
+                                               entry_scs_ptr->enc_dec_process_init_count);
+
                         if (tile_group_cols * tile_group_rows > 1) {
                             enc_dec_seg_col_cnt = MIN(enc_dec_seg_col_cnt,
-                                                      (uint8_t)(pic_width_in_sb / tile_group_cols));
+                                                      (uint32_t)(pic_width_in_sb / tile_group_cols));
                             enc_dec_seg_row_cnt = MIN(
                                 enc_dec_seg_row_cnt,
-                                (uint8_t)(picture_height_in_sb / tile_group_rows));
+                                (uint32_t)(picture_height_in_sb / tile_group_rows));
                         }
 
                         ppcs_ptr->tile_group_cols = tile_group_cols;
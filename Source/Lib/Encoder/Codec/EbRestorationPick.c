@@ -13,12 +13,14 @@
 
 #include "EbPsnr.h"
 #include "EbPictureControlSet.h"
+#include "EbSequenceControlSet.h"
 #include "aom_dsp_rtcd.h"
 #include "EbRestoration.h"
 #include "EbRestorationPick.h"
 
 #include "EbRestProcess.h"
 #include "EbLog.h"
+#include "EbTaskPool.h"
 
 void av1_foreach_rest_unit_in_frame_seg(Av1Common *cm, int32_t plane, RestTileStartVisitor on_tile,
                                         RestUnitVisitor on_rest_unit, void *priv,
@@ -1567,65 +1569,90 @@ void restoration_seg_search(int32_t *rst_tmpbuf, Yv12BufferConfig *org_fts,
                                            segment_index);
     }
 }
-void rest_finish_search(PictureParentControlSet *p_pcs_ptr, Macroblock *x, Av1Common *const cm) {
-    const int32_t   num_planes           = 3;
-    RestorationType force_restore_type_d = (cm->wn_filter_mode) ? RESTORE_TYPES : RESTORE_SGRPROJ;
-    int32_t         ntiles[2];
-    for (int32_t is_uv = 0; is_uv < 2; ++is_uv) ntiles[is_uv] = rest_tiles_in_plane(cm, is_uv);
-
-    assert(ntiles[1] <= ntiles[0]);
-    RestUnitSearchInfo *rusi = (RestUnitSearchInfo *)eb_aom_memalign(16, sizeof(*rusi) * ntiles[0]);
-
-    // If the restoration unit dimensions are not multiples of
-    // rsi->restoration_unit_size then some elements of the rusi array may be
-    // left uninitialised when we reach copy_unit_info(...). This is not a
-    // problem, as these elements are ignored later, but in order to quiet
-    // Valgrind's warnings we initialise the array below.
-    memset(rusi, 0, sizeof(*rusi) * ntiles[0]);
+// Frame restoration type selection, one task per plane
+typedef struct RestFinishJob {
+    PictureParentControlSet *p_pcs_ptr;
+    Macroblock *             x;
+    Av1Common *              cm;
+    // rusi - units of each plane
+    RestUnitSearchInfo *rusi[MAX_MB_PLANE];
+} RestFinishJob;
+
+static void rest_finish_search_plane(void *job_ptr, uint32_t plane) {
+    RestFinishJob *     job                  = (RestFinishJob *)job_ptr;
+    Av1Common *const    cm                   = job->cm;
+    RestUnitSearchInfo *rusi                 = job->rusi[plane];
+    RestorationType     force_restore_type_d = (cm->wn_filter_mode) ? RESTORE_TYPES
+                                                                    : RESTORE_SGRPROJ;
 
     RestSearchCtxt rsc;
-    const int32_t  plane_start = AOM_PLANE_Y;
-    const int32_t  plane_end   = num_planes > 1 ? AOM_PLANE_V : AOM_PLANE_Y;
-    for (int32_t plane = plane_start; plane <= plane_end; ++plane) {
-        //init rsc context for this plane
-        rsc.cm       = cm;
-        rsc.x        = x;
-        rsc.plane    = plane;
-        rsc.rusi     = rusi;
-        rsc.pic_num  = (uint32_t)p_pcs_ptr->picture_number;
-        rsc.rusi_pic = p_pcs_ptr->rusi_picture[plane];
+    //init rsc context for this plane
+    rsc.cm       = cm;
+    rsc.x        = job->x;
+    rsc.plane    = plane;
+    rsc.rusi     = rusi;
+    rsc.pic_num  = (uint32_t)job->p_pcs_ptr->picture_number;
+    rsc.rusi_pic = job->p_pcs_ptr->rusi_picture[plane];
+
+    const int32_t         plane_ntiles = rest_tiles_in_plane(cm, plane > 0);
+    const RestorationType num_rtypes =
+        (plane_ntiles > 1) ? RESTORE_TYPES : RESTORE_SWITCHABLE_TYPES;
 
-        const int32_t         plane_ntiles = ntiles[plane > 0];
-        const RestorationType num_rtypes =
-            (plane_ntiles > 1) ? RESTORE_TYPES : RESTORE_SWITCHABLE_TYPES;
-
-        double          best_cost  = 0;
-        RestorationType best_rtype = RESTORE_NONE;
+    double          best_cost  = 0;
+    RestorationType best_rtype = RESTORE_NONE;
 
-        for (int32_t rest_type = 0; rest_type < num_rtypes; ++rest_type) {
-            RestorationType r = (RestorationType)rest_type;
+    for (int32_t rest_type = 0; rest_type < num_rtypes; ++rest_type) {
+        RestorationType r = (RestorationType)rest_type;
 
-            if ((force_restore_type_d != RESTORE_TYPES) && (r != RESTORE_NONE) &&
-                (r != force_restore_type_d))
-                continue;
+        if ((force_restore_type_d != RESTORE_TYPES) && (r != RESTORE_NONE) &&
+            (r != force_restore_type_d))
+            continue;
 
-            double cost = search_rest_type_finish(&rsc, r);
+        double cost = search_rest_type_finish(&rsc, r);
 
-            if (r == 0 || cost < best_cost) {
-                best_cost  = cost;
-                best_rtype = r;
-            }
+        if (r == 0 || cost < best_cost) {
+            best_cost  = cost;
+            best_rtype = r;
         }
+    }
 
-        cm->rst_info[plane].frame_restoration_type = best_rtype;
-        if (force_restore_type_d != RESTORE_TYPES)
-            assert(best_rtype == force_restore_type_d || best_rtype == RESTORE_NONE);
+    cm->rst_info[plane].frame_restoration_type = best_rtype;
+    if (force_restore_type_d != RESTORE_TYPES)
+        assert(best_rtype == force_restore_type_d || best_rtype == RESTORE_NONE);
 
-        if (best_rtype != RESTORE_NONE) {
-            for (int32_t u = 0; u < plane_ntiles; ++u)
-                copy_unit_info(best_rtype, &rusi[u], &cm->rst_info[plane].unit_info[u]);
-        }
+    if (best_rtype != RESTORE_NONE) {
+        for (int32_t u = 0; u < plane_ntiles; ++u)
+            copy_unit_info(best_rtype, &rusi[u], &cm->rst_info[plane].unit_info[u]);
     }
+}
+
+void rest_finish_search(PictureParentControlSet *p_pcs_ptr, Macroblock *x, Av1Common *const cm) {
+    const int32_t num_planes = 3;
+    int32_t       ntiles[2];
+    for (int32_t is_uv = 0; is_uv < 2; ++is_uv) ntiles[is_uv] = rest_tiles_in_plane(cm, is_uv);
+
+    assert(ntiles[1] <= ntiles[0]);
+    // Each plane uses its own units
+    RestUnitSearchInfo *rusi =
+        (RestUnitSearchInfo *)eb_aom_memalign(16, sizeof(*rusi) * (ntiles[0] + 2 * ntiles[1]));
+
+    // If the restoration unit dimensions are not multiples of
+    // rsi->restoration_unit_size then some elements of the rusi array may be
+    // left uninitialised when we reach copy_unit_info(...). This is not a
+    // problem, as these elements are ignored later, but in order to quiet
+    // Valgrind's warnings we initialise the array below.
+    memset(rusi, 0, sizeof(*rusi) * (ntiles[0] + 2 * ntiles[1]));
+
+    RestFinishJob job = {p_pcs_ptr,
+                         x,
+                         cm,
+                         {rusi, rusi + ntiles[0], rusi + ntiles[0] + ntiles[1]}};
+
+    // Each plane selects its type on its own, the luma plane has the most units and starts first
+    eb_task_pool_run(p_pcs_ptr->scs_ptr->encode_context_ptr->task_pool,
+                     rest_finish_search_plane,
+                     &job,
+                     num_planes);
 
     eb_aom_free(rusi);
 }
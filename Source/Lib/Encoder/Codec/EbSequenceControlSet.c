@@ -334,8 +334,12 @@ EbErrorType copy_sequence_control_set(SequenceControlSet *dst, SequenceControlSe
     write_count += sizeof(int32_t);
     dst->enc_dec_process_init_count = src->enc_dec_process_init_count;
     write_count += sizeof(int32_t);
+    dst->dlf_process_init_count = src->dlf_process_init_count;
+    write_count += sizeof(int32_t);
     dst->entropy_coding_process_init_count = src->entropy_coding_process_init_count;
     write_count += sizeof(int32_t);
+    dst->task_pool_thread_count = src->task_pool_thread_count;
+    write_count += sizeof(int32_t);
     dst->total_process_init_count = src->total_process_init_count;
     write_count += sizeof(int32_t);
     dst->left_padding = src->left_padding;
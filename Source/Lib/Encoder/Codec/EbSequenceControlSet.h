@@ -206,6 +206,7 @@ typedef struct SequenceControlSet {
     uint32_t dlf_process_init_count;
     uint32_t cdef_process_init_count;
     uint32_t rest_process_init_count;
+    uint32_t task_pool_thread_count;
     uint32_t total_process_init_count;
 
 } SequenceControlSet;
@@ -0,0 +1,146 @@
+/*
+* Copyright(c) 2019 Intel Corporation
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+#include "EbTaskPool.h"
+#include "EbThreads.h"
+
+// Wake ups of the pool threads can outnumber the jobs, the extra ones find no task
+#define TASK_POOL_MAX_WAKE_UP_COUNT 0x7FFFFFFF
+
+static void eb_task_pool_dctor(EbPtr p) {
+    EbTaskPool *obj = (EbTaskPool *)p;
+    EB_DESTROY_SEMAPHORE(obj->task_semaphore);
+    EB_DESTROY_MUTEX(obj->mutex);
+}
+
+/**************************************
+ * eb_task_pool_ctor
+ **************************************/
+EbErrorType eb_task_pool_ctor(EbTaskPool *pool_ptr) {
+    pool_ptr->dctor = eb_task_pool_dctor;
+    EB_CREATE_SEMAPHORE(pool_ptr->task_semaphore, 0, TASK_POOL_MAX_WAKE_UP_COUNT);
+    EB_CREATE_MUTEX(pool_ptr->mutex);
+    return EB_ErrorNone;
+}
+
+/**************************************
+ * task_pool_start_task
+ *   Starts the next task of job_ptr, the job leaves the queue with its
+ *   last task. Called with the pool mutex held.
+ **************************************/
+static uint32_t task_pool_start_task(EbTaskPool *pool_ptr, EbTaskJob *job_ptr) {
+    const uint32_t task_index = job_ptr->next_task++;
+    if (job_ptr->next_task == job_ptr->task_count) {
+        EbTaskJob **link_ptr = &pool_ptr->first_job_ptr;
+        EbTaskJob * prev_ptr = NULL;
+        while (*link_ptr != job_ptr) {
+            prev_ptr = *link_ptr;
+            link_ptr = &prev_ptr->next_ptr;
+        }
+        *link_ptr = job_ptr->next_ptr;
+        if (pool_ptr->last_job_ptr == job_ptr) pool_ptr->last_job_ptr = prev_ptr;
+    }
+    return task_index;
+}
+
+/**************************************
+ * eb_task_pool_kernel
+ **************************************/
+void *eb_task_pool_kernel(void *input_ptr) {
+    EbTaskPool *pool_ptr = (EbTaskPool *)input_ptr;
+
+    for (;;) {
+        eb_block_on_semaphore(pool_ptr->task_semaphore);
+
+        eb_block_on_mutex(pool_ptr->mutex);
+        if (pool_ptr->quit_signal) {
+            eb_release_mutex(pool_ptr->mutex);
+            break;
+        }
+        EbTaskJob *job_ptr = pool_ptr->first_job_ptr;
+        if (!job_ptr) {
+            // The submitting threads started the tasks already
+            eb_release_mutex(pool_ptr->mutex);
+            continue;
+        }
+        const uint32_t task_index = task_pool_start_task(pool_ptr, job_ptr);
+        // More tasks left, let another pool thread help
+        if (pool_ptr->first_job_ptr) eb_post_semaphore(pool_ptr->task_semaphore);
+        eb_release_mutex(pool_ptr->mutex);
+
+        job_ptr->task_function(job_ptr->job_ptr, task_index);
+
+        eb_block_on_mutex(pool_ptr->mutex);
+        if (++job_ptr->done_count == job_ptr->task_count && job_ptr->done_semaphore)
+            eb_post_semaphore(job_ptr->done_semaphore);
+        eb_release_mutex(pool_ptr->mutex);
+    }
+    return NULL;
+}
+
+/**************************************
+ * eb_task_pool_shutdown
+ **************************************/
+void eb_task_pool_shutdown(EbTaskPool *pool_ptr) {
+    eb_block_on_mutex(pool_ptr->mutex);
+    pool_ptr->quit_signal = EB_TRUE;
+    const uint32_t thread_count = pool_ptr->thread_count;
+    eb_release_mutex(pool_ptr->mutex);
+    for (uint32_t i = 0; i < thread_count; i++) eb_post_semaphore(pool_ptr->task_semaphore);
+}
+
+/**************************************
+ * eb_task_pool_run
+ **************************************/
+void eb_task_pool_run(EbTaskPool *pool_ptr, EbTaskFunction task_function, void *job_ptr,
+                      uint32_t task_count) {
+    if (!pool_ptr || !pool_ptr->thread_count || task_count < 2) {
+        for (uint32_t task_index = 0; task_index < task_count; task_index++)
+            task_function(job_ptr, task_index);
+        return;
+    }
+
+    EbTaskJob job;
+    job.task_function  = task_function;
+    job.job_ptr        = job_ptr;
+    job.task_count     = task_count;
+    job.next_task      = 0;
+    job.done_count     = 0;
+    job.done_semaphore = NULL;
+    job.next_ptr       = NULL;
+
+    eb_block_on_mutex(pool_ptr->mutex);
+    if (pool_ptr->last_job_ptr)
+        pool_ptr->last_job_ptr->next_ptr = &job;
+    else
+        pool_ptr->first_job_ptr = &job;
+    pool_ptr->last_job_ptr = &job;
+    eb_release_mutex(pool_ptr->mutex);
+    // Woken pool threads wake the next ones while tasks are left
+    eb_post_semaphore(pool_ptr->task_semaphore);
+
+    // Run the tasks the pool threads did not start
+    for (;;) {
+        eb_block_on_mutex(pool_ptr->mutex);
+        if (job.next_task == task_count) break;
+        const uint32_t task_index = task_pool_start_task(pool_ptr, &job);
+        eb_release_mutex(pool_ptr->mutex);
+
+        task_function(job_ptr, task_index);
+
+        eb_block_on_mutex(pool_ptr->mutex);
+        job.done_count++;
+        eb_release_mutex(pool_ptr->mutex);
+    }
+
+    // Wait for the tasks still running on pool threads, the mutex is held here
+    if (job.done_count < task_count) {
+        job.done_semaphore = eb_create_semaphore(0, 1);
+        eb_release_mutex(pool_ptr->mutex);
+        eb_block_on_semaphore(job.done_semaphore);
+        eb_destroy_semaphore(job.done_semaphore);
+    } else
+        eb_release_mutex(pool_ptr->mutex);
+}
@@ -0,0 +1,74 @@
+/*
+* Copyright(c) 2019 Intel Corporation
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+#ifndef EbTaskPool_h
+#define EbTaskPool_h
+
+#include "EbDefinitions.h"
+#include "EbObject.h"
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************************************************************
+     * Task Pool
+     *   Runs the independent tasks of a picture level job (rows of a
+     *   picture, references, models) on a set of encoder threads that
+     *   are created once with the other kernels. The thread submitting
+     *   a job runs its tasks too, so a job completes even when every
+     *   pool thread is busy, and jobs can be submitted from pool tasks.
+     *   Tasks are started in index order, a task may wait for the
+     *   progress of a task with a lower index.
+     *********************************************************************/
+typedef void (*EbTaskFunction)(void *job_ptr, uint32_t task_index);
+
+typedef struct EbTaskJob {
+    EbTaskFunction    task_function;
+    void *            job_ptr;
+    uint32_t          task_count;
+    // next_task - index of the next task to start
+    uint32_t          next_task;
+    // done_count - number of tasks completed
+    uint32_t          done_count;
+    // done_semaphore - set when the submitting thread waits for the
+    //   tasks still running on pool threads
+    EbHandle          done_semaphore;
+    struct EbTaskJob *next_ptr;
+} EbTaskJob;
+
+typedef struct EbTaskPool {
+    EbDctor dctor;
+    // task_semaphore - wakes a pool thread when a job is submitted
+    EbHandle task_semaphore;
+    // mutex - protects the job queue and the task counters of the jobs
+    EbHandle mutex;
+    // first_job_ptr / last_job_ptr - jobs with tasks not started yet
+    EbTaskJob *first_job_ptr;
+    EbTaskJob *last_job_ptr;
+    // thread_count - number of threads running eb_task_pool_kernel
+    uint32_t thread_count;
+    EbBool   quit_signal;
+} EbTaskPool;
+
+/**************************************
+     * Extern Function Declarations
+     **************************************/
+extern EbErrorType eb_task_pool_ctor(EbTaskPool *pool_ptr);
+
+// Body of the pool threads, created by the owner of the pool
+extern void *eb_task_pool_kernel(void *input_ptr);
+
+// Lets the pool threads exit, jobs submitted afterwards run on the calling thread
+extern void eb_task_pool_shutdown(EbTaskPool *pool_ptr);
+
+// Runs task_function(job_ptr, i) for i in [0, task_count) and returns when all are done.
+// pool_ptr can be NULL to run the tasks on the calling thread.
+extern void eb_task_pool_run(EbTaskPool *pool_ptr, EbTaskFunction task_function, void *job_ptr,
+                             uint32_t task_count);
+
+#ifdef __cplusplus
+}
+#endif
+#endif // EbTaskPool_h
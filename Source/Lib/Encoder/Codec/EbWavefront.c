@@ -0,0 +1,73 @@
+/*
+* Copyright(c) 2019 Intel Corporation
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+#include "EbWavefront.h"
+#include "EbThreads.h"
+
+static void eb_wavefront_dctor(EbPtr p) {
+    EbWavefront *obj = (EbWavefront *)p;
+    if (obj->row_semaphore) {
+        for (uint32_t row = 0; row < obj->row_count; row++)
+            EB_DESTROY_SEMAPHORE(obj->row_semaphore[row]);
+    }
+    EB_FREE_ARRAY(obj->row_semaphore);
+    EB_FREE_ARRAY(obj->row_progress);
+    EB_FREE_ARRAY(obj->row_wait);
+    EB_DESTROY_MUTEX(obj->mutex);
+}
+
+/**************************************
+ * eb_wavefront_ctor
+ **************************************/
+EbErrorType eb_wavefront_ctor(EbWavefront *wavefront_ptr, uint32_t row_count) {
+    wavefront_ptr->dctor = eb_wavefront_dctor;
+    EB_CREATE_MUTEX(wavefront_ptr->mutex);
+    EB_CALLOC_ARRAY(wavefront_ptr->row_semaphore, row_count);
+    wavefront_ptr->row_count = row_count;
+    for (uint32_t row = 0; row < row_count; row++)
+        EB_CREATE_SEMAPHORE(wavefront_ptr->row_semaphore[row], 0, 1);
+    EB_CALLOC_ARRAY(wavefront_ptr->row_progress, row_count);
+    EB_CALLOC_ARRAY(wavefront_ptr->row_wait, row_count);
+    return EB_ErrorNone;
+}
+
+/**************************************
+ * eb_wavefront_reset
+ **************************************/
+void eb_wavefront_reset(EbWavefront *wavefront_ptr) {
+    eb_block_on_mutex(wavefront_ptr->mutex);
+    memset(wavefront_ptr->row_progress, 0, wavefront_ptr->row_count * sizeof(uint32_t));
+    eb_release_mutex(wavefront_ptr->mutex);
+}
+
+/**************************************
+ * eb_wavefront_wait
+ **************************************/
+void eb_wavefront_wait(EbWavefront *wavefront_ptr, uint32_t row, uint32_t progress) {
+    eb_block_on_mutex(wavefront_ptr->mutex);
+    if (wavefront_ptr->row_progress[row] >= progress) {
+        eb_release_mutex(wavefront_ptr->mutex);
+        return;
+    }
+    wavefront_ptr->row_wait[row] = progress;
+    eb_release_mutex(wavefront_ptr->mutex);
+    // Posted once by the post reaching the target
+    eb_block_on_semaphore(wavefront_ptr->row_semaphore[row]);
+}
+
+/**************************************
+ * eb_wavefront_post
+ **************************************/
+void eb_wavefront_post(EbWavefront *wavefront_ptr, uint32_t row, uint32_t progress) {
+    eb_block_on_mutex(wavefront_ptr->mutex);
+    if (progress > wavefront_ptr->row_progress[row]) {
+        wavefront_ptr->row_progress[row] = progress;
+        if (wavefront_ptr->row_wait[row] && progress >= wavefront_ptr->row_wait[row]) {
+            wavefront_ptr->row_wait[row] = 0;
+            eb_post_semaphore(wavefront_ptr->row_semaphore[row]);
+        }
+    }
+    eb_release_mutex(wavefront_ptr->mutex);
+}
@@ -0,0 +1,54 @@
+/*
+* Copyright(c) 2019 Intel Corporation
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+#ifndef EbWavefront_h
+#define EbWavefront_h
+
+#include "EbDefinitions.h"
+#include "EbObject.h"
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************************************************************
+     * Wavefront
+     *   Progress of the rows of a picture processed by several threads,
+     *   for row tasks that depend on the progress of another row (the
+     *   SBs of the row above) or of another stage (the SB rows coded).
+     *   A thread waiting for a row sleeps on the semaphore of the row
+     *   until the progress it needs is posted. A row has at most one
+     *   waiting thread at a time.
+     *********************************************************************/
+typedef struct EbWavefront {
+    EbDctor dctor;
+    // mutex - protects the progress and the wait targets of the rows
+    EbHandle mutex;
+    // row_semaphore - wakes the thread waiting for the row
+    EbHandle *row_semaphore;
+    // row_progress - posted progress of each row
+    uint32_t *row_progress;
+    // row_wait - progress the waiting thread needs, 0 when none waits
+    uint32_t *row_wait;
+    uint32_t  row_count;
+} EbWavefront;
+
+/**************************************
+     * Extern Function Declarations
+     **************************************/
+extern EbErrorType eb_wavefront_ctor(EbWavefront *wavefront_ptr, uint32_t row_count);
+
+// Sets the progress of all the rows to 0, no thread may wait
+extern void eb_wavefront_reset(EbWavefront *wavefront_ptr);
+
+// Returns once the progress of row reaches progress
+extern void eb_wavefront_wait(EbWavefront *wavefront_ptr, uint32_t row, uint32_t progress);
+
+// Raises the progress of row to progress, a lower progress is ignored
+extern void eb_wavefront_post(EbWavefront *wavefront_ptr, uint32_t row, uint32_t progress);
+
+#ifdef __cplusplus
+}
+#endif
+#endif // EbWavefront_h
@@ -69,6 +69,13 @@ void setup_rtcd_internal(CPU_FLAGS flags) {
 
     eb_aom_highbd_sse = eb_aom_highbd_sse_c;
 
+    aom_ssim_parms_8x8 = aom_ssim_parms_8x8_c;
+    aom_highbd_ssim_parms_8x8 = aom_highbd_ssim_parms_8x8_c;
+
+    av1_get_crc32c_value = av1_get_crc32c_value_c;
+    av1_get_2x2_same_value_row = av1_get_2x2_same_value_row_c;
+    av1_highbd_get_2x2_same_value_row = av1_highbd_get_2x2_same_value_row_c;
+
     eb_av1_wedge_compute_delta_squares = av1_wedge_compute_delta_squares_c;
     eb_av1_wedge_sign_from_residuals = av1_wedge_sign_from_residuals_c;
 
@@ -78,6 +85,9 @@ void setup_rtcd_internal(CPU_FLAGS flags) {
     eb_av1_compute_stats = eb_av1_compute_stats_c;
     eb_av1_compute_stats_highbd = eb_av1_compute_stats_highbd_c;
 
+    eb_aom_flat_block_gradient_stats = eb_aom_flat_block_gradient_stats_c;
+    eb_aom_noise_eqns_add_observation = eb_aom_noise_eqns_add_observation_c;
+
     eb_av1_lowbd_pixel_proj_error = eb_av1_lowbd_pixel_proj_error_c;
     eb_av1_highbd_pixel_proj_error = eb_av1_highbd_pixel_proj_error_c;
     eb_av1_calc_frame_error = eb_av1_calc_frame_error_c;
@@ -367,6 +377,8 @@ void setup_rtcd_internal(CPU_FLAGS flags) {
     compute_interm_var_four8x8 = compute_interm_var_four8x8_c;
     sad_16b_kernel = sad_16b_kernel_c;
     eb_av1_compute_cross_correlation = av1_compute_cross_correlation_c;
+    eb_av1_fast9_detect_row = av1_fast9_detect_row_c;
+    eb_av1_ransac_find_inliers = av1_ransac_find_inliers_c;
     eb_av1_k_means_dim1 = av1_k_means_dim1_c;
     eb_av1_k_means_dim2 = av1_k_means_dim2_c;
     eb_av1_calc_indices_dim1 = av1_calc_indices_dim1_c;
@@ -383,12 +395,25 @@ void setup_rtcd_internal(CPU_FLAGS flags) {
     flags &= get_cpu_flags_to_use();
     if (flags & HAS_AVX2) eb_aom_sse = eb_aom_sse_avx2;
     if (flags & HAS_AVX2) eb_aom_highbd_sse = aom_highbd_sse_avx2;
+    SET_AVX2_AVX512(aom_ssim_parms_8x8,
+                    aom_ssim_parms_8x8_c,
+                    aom_ssim_parms_8x8_avx2,
+                    aom_ssim_parms_8x8_avx512);
+    SET_AVX2_AVX512(aom_highbd_ssim_parms_8x8,
+                    aom_highbd_ssim_parms_8x8_c,
+                    aom_highbd_ssim_parms_8x8_avx2,
+                    aom_highbd_ssim_parms_8x8_avx512);
+    if (flags & HAS_SSE4_2) av1_get_crc32c_value = av1_get_crc32c_value_sse4_2;
+    if (flags & HAS_AVX2) av1_get_2x2_same_value_row = av1_get_2x2_same_value_row_avx2;
+    if (flags & HAS_AVX2) av1_highbd_get_2x2_same_value_row = av1_highbd_get_2x2_same_value_row_avx2;
     if (flags & HAS_AVX2) eb_av1_wedge_compute_delta_squares = eb_av1_wedge_compute_delta_squares_avx2;
     if (flags & HAS_AVX2) eb_av1_wedge_sign_from_residuals = eb_av1_wedge_sign_from_residuals_avx2;
     if (flags & HAS_AVX2) eb_compute_cdef_dist = compute_cdef_dist_avx2;
     if (flags & HAS_AVX2) eb_compute_cdef_dist_8bit = compute_cdef_dist_8bit_avx2;
     if (flags & HAS_AVX2) eb_av1_compute_stats = eb_av1_compute_stats_avx2;
     if (flags & HAS_AVX2) eb_av1_compute_stats_highbd = eb_av1_compute_stats_highbd_avx2;
+    if (flags & HAS_AVX2) eb_aom_flat_block_gradient_stats = eb_aom_flat_block_gradient_stats_avx2;
+    if (flags & HAS_AVX2) eb_aom_noise_eqns_add_observation = eb_aom_noise_eqns_add_observation_avx2;
 #ifndef NON_AVX512_SUPPORT
     if (flags & HAS_AVX512F) {
         eb_av1_compute_stats = eb_av1_compute_stats_avx512;
@@ -503,6 +528,16 @@ void setup_rtcd_internal(CPU_FLAGS flags) {
                 if (flags & HAS_AVX2) eb_aom_obmc_sad8x32 = aom_obmc_sad8x32_avx2;
                 if (flags & HAS_AVX2) eb_aom_obmc_sad8x4 = aom_obmc_sad8x4_avx2;
                 if (flags & HAS_AVX2) eb_aom_obmc_sad8x8 = aom_obmc_sad8x8_avx2;
+#ifndef NON_AVX512_SUPPORT
+                if (flags & HAS_AVX512F) {
+                    eb_aom_obmc_sad128x128 = aom_obmc_sad128x128_avx512;
+                    eb_aom_obmc_sad128x64 = aom_obmc_sad128x64_avx512;
+                    eb_aom_obmc_sad64x128 = aom_obmc_sad64x128_avx512;
+                    eb_aom_obmc_sad64x64 = aom_obmc_sad64x64_avx512;
+                    eb_aom_obmc_sad64x32 = aom_obmc_sad64x32_avx512;
+                    eb_aom_obmc_sad64x16 = aom_obmc_sad64x16_avx512;
+                }
+#endif // !NON_AVX512_SUPPORT
                 if (flags & HAS_SSE4_1) eb_aom_obmc_sub_pixel_variance128x128 = aom_obmc_sub_pixel_variance128x128_sse4_1;
                 if (flags & HAS_SSE4_1) eb_aom_obmc_sub_pixel_variance128x64 = aom_obmc_sub_pixel_variance128x64_sse4_1;
                 if (flags & HAS_SSE4_1) eb_aom_obmc_sub_pixel_variance16x16 = aom_obmc_sub_pixel_variance16x16_sse4_1;
@@ -547,6 +582,16 @@ void setup_rtcd_internal(CPU_FLAGS flags) {
                 if (flags & HAS_AVX2) eb_aom_obmc_variance8x32 = aom_obmc_variance8x32_avx2;
                 if (flags & HAS_AVX2) eb_aom_obmc_variance8x4 = aom_obmc_variance8x4_avx2;
                 if (flags & HAS_AVX2) eb_aom_obmc_variance8x8 = aom_obmc_variance8x8_avx2;
+#ifndef NON_AVX512_SUPPORT
+                if (flags & HAS_AVX512F) {
+                    eb_aom_obmc_variance128x128 = aom_obmc_variance128x128_avx512;
+                    eb_aom_obmc_variance128x64 = aom_obmc_variance128x64_avx512;
+                    eb_aom_obmc_variance64x128 = aom_obmc_variance64x128_avx512;
+                    eb_aom_obmc_variance64x64 = aom_obmc_variance64x64_avx512;
+                    eb_aom_obmc_variance64x32 = aom_obmc_variance64x32_avx512;
+                    eb_aom_obmc_variance64x16 = aom_obmc_variance64x16_avx512;
+                }
+#endif // !NON_AVX512_SUPPORT
                 if (flags & HAS_AVX2) eb_aom_variance4x4 = eb_aom_variance4x4_sse2;
                 if (flags & HAS_AVX2) eb_aom_variance4x8 = eb_aom_variance4x8_sse2;
                 if (flags & HAS_AVX2) eb_aom_variance4x16 = eb_aom_variance4x16_sse2;
@@ -569,6 +614,16 @@ void setup_rtcd_internal(CPU_FLAGS flags) {
                 if (flags & HAS_AVX2) eb_aom_variance64x128 = eb_aom_variance64x128_avx2;
                 if (flags & HAS_AVX2) eb_aom_variance128x64 = eb_aom_variance128x64_avx2;
                 if (flags & HAS_AVX2) eb_aom_variance128x128 = eb_aom_variance128x128_avx2;
+#ifndef NON_AVX512_SUPPORT
+                if (flags & HAS_AVX512F) {
+                    eb_aom_variance64x16 = eb_aom_variance64x16_avx512;
+                    eb_aom_variance64x32 = eb_aom_variance64x32_avx512;
+                    eb_aom_variance64x64 = eb_aom_variance64x64_avx512;
+                    eb_aom_variance64x128 = eb_aom_variance64x128_avx512;
+                    eb_aom_variance128x64 = eb_aom_variance128x64_avx512;
+                    eb_aom_variance128x128 = eb_aom_variance128x128_avx512;
+                }
+#endif // !NON_AVX512_SUPPORT
                 if (flags & HAS_AVX2) eb_aom_highbd_10_variance8x8 = eb_aom_highbd_10_variance8x8_sse2;
                 if (flags & HAS_AVX2) eb_aom_highbd_10_variance8x16 = eb_aom_highbd_10_variance8x16_sse2;
                 if (flags & HAS_AVX2) eb_aom_highbd_10_variance8x32 = eb_aom_highbd_10_variance8x32_sse2;
@@ -660,12 +715,14 @@ void setup_rtcd_internal(CPU_FLAGS flags) {
 #endif
                     SET_SSE41(
                         svt_av1_apply_filtering, svt_av1_apply_filtering_c, svt_av1_apply_temporal_filter_sse4_1);
-                    SET_AVX2(svt_av1_apply_temporal_filter_planewise,
+                    SET_AVX2_AVX512(svt_av1_apply_temporal_filter_planewise,
                         svt_av1_apply_temporal_filter_planewise_c,
-                        svt_av1_apply_temporal_filter_planewise_avx2);
-                    SET_AVX2(svt_av1_apply_temporal_filter_planewise_hbd,
+                        svt_av1_apply_temporal_filter_planewise_avx2,
+                        svt_av1_apply_temporal_filter_planewise_avx512);
+                    SET_AVX2_AVX512(svt_av1_apply_temporal_filter_planewise_hbd,
                         svt_av1_apply_temporal_filter_planewise_hbd_c,
-                        svt_av1_apply_temporal_filter_planewise_hbd_avx2);
+                        svt_av1_apply_temporal_filter_planewise_hbd_avx2,
+                        svt_av1_apply_temporal_filter_planewise_hbd_avx512);
                     SET_SSE41(svt_av1_apply_filtering_highbd,
                         svt_av1_apply_filtering_highbd_c,
                         svt_av1_highbd_apply_temporal_filter_sse4_1);
@@ -735,6 +792,10 @@ void setup_rtcd_internal(CPU_FLAGS flags) {
                     SET_AVX2(eb_av1_compute_cross_correlation,
                         av1_compute_cross_correlation_c,
                         av1_compute_cross_correlation_avx2);
+                    SET_AVX2(eb_av1_fast9_detect_row, av1_fast9_detect_row_c, av1_fast9_detect_row_avx2);
+                    SET_AVX2(eb_av1_ransac_find_inliers,
+                        av1_ransac_find_inliers_c,
+                        av1_ransac_find_inliers_avx2);
                     SET_AVX2(eb_av1_k_means_dim1, av1_k_means_dim1_c, av1_k_means_dim1_avx2);
                     SET_AVX2(eb_av1_k_means_dim2, av1_k_means_dim2_c, av1_k_means_dim2_avx2);
                     SET_AVX2(eb_av1_calc_indices_dim1, av1_calc_indices_dim1_c, av1_calc_indices_dim1_avx2);
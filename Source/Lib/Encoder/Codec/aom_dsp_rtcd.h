@@ -67,6 +67,16 @@ extern "C" {
     RTCD_EXTERN int64_t(*eb_aom_sse)(const uint8_t *a, int a_stride, const uint8_t *b, int b_stride, int width, int height);
     int64_t eb_aom_highbd_sse_c(const uint8_t *a8, int a_stride, const uint8_t *b8, int b_stride, int width, int height);
     RTCD_EXTERN int64_t(*eb_aom_highbd_sse)(const uint8_t *a8, int a_stride, const uint8_t *b8, int b_stride, int width, int height);
+    void aom_ssim_parms_8x8_c(const uint8_t *s, int sp, const uint8_t *r, int rp, uint32_t *sum_s, uint32_t *sum_r, uint32_t *sum_sq_s, uint32_t *sum_sq_r, uint32_t *sum_sxr);
+    RTCD_EXTERN void(*aom_ssim_parms_8x8)(const uint8_t *s, int sp, const uint8_t *r, int rp, uint32_t *sum_s, uint32_t *sum_r, uint32_t *sum_sq_s, uint32_t *sum_sq_r, uint32_t *sum_sxr);
+    void aom_highbd_ssim_parms_8x8_c(const uint8_t *s, int sp, const uint8_t *sinc, int spinc, const uint16_t *r, int rp, uint32_t *sum_s, uint32_t *sum_r, uint32_t *sum_sq_s, uint32_t *sum_sq_r, uint32_t *sum_sxr);
+    RTCD_EXTERN void(*aom_highbd_ssim_parms_8x8)(const uint8_t *s, int sp, const uint8_t *sinc, int spinc, const uint16_t *r, int rp, uint32_t *sum_s, uint32_t *sum_r, uint32_t *sum_sq_s, uint32_t *sum_sq_r, uint32_t *sum_sxr);
+    uint32_t av1_get_crc32c_value_c(void *crc_calculator, uint8_t *p, size_t length);
+    RTCD_EXTERN uint32_t(*av1_get_crc32c_value)(void *crc_calculator, uint8_t *p, size_t length);
+    void av1_get_2x2_same_value_row_c(const uint8_t *src, int stride, int width, int8_t *row_same, int8_t *col_same);
+    RTCD_EXTERN void(*av1_get_2x2_same_value_row)(const uint8_t *src, int stride, int width, int8_t *row_same, int8_t *col_same);
+    void av1_highbd_get_2x2_same_value_row_c(const uint16_t *src, int stride, int width, int8_t *row_same, int8_t *col_same);
+    RTCD_EXTERN void(*av1_highbd_get_2x2_same_value_row)(const uint16_t *src, int stride, int width, int8_t *row_same, int8_t *col_same);
     void av1_wedge_compute_delta_squares_c(int16_t *d, const int16_t *a, const int16_t *b, int N);
     RTCD_EXTERN void(*eb_av1_wedge_compute_delta_squares)(int16_t *d, const int16_t *a, const int16_t *b, int N);
     int8_t av1_wedge_sign_from_residuals_c(const int16_t *ds, const uint8_t *m, int N, int64_t limit);
@@ -79,6 +89,10 @@ extern "C" {
     RTCD_EXTERN void(*eb_av1_compute_stats)(int32_t wiener_win, const uint8_t *dgd8, const uint8_t *src8, int32_t h_start, int32_t h_end, int32_t v_start, int32_t v_end, int32_t dgd_stride, int32_t src_stride, int64_t *M, int64_t *H);
     void eb_av1_compute_stats_highbd_c(int32_t wiener_win, const uint8_t *dgd8, const uint8_t *src8, int32_t h_start, int32_t h_end, int32_t v_start, int32_t v_end, int32_t dgd_stride, int32_t src_stride, int64_t *M, int64_t *H, AomBitDepth bit_depth);
     RTCD_EXTERN void(*eb_av1_compute_stats_highbd)(int32_t wiener_win, const uint8_t *dgd8, const uint8_t *src8, int32_t h_start, int32_t h_end, int32_t v_start, int32_t v_end, int32_t dgd_stride, int32_t src_stride, int64_t *M, int64_t *H, AomBitDepth bit_depth);
+    void eb_aom_flat_block_gradient_stats_c(const double *block, int32_t block_size, double *g_xx, double *g_xy, double *g_yy, double *sum, double *sum_sq);
+    RTCD_EXTERN void(*eb_aom_flat_block_gradient_stats)(const double *block, int32_t block_size, double *g_xx, double *g_xy, double *g_yy, double *sum, double *sum_sq);
+    void eb_aom_noise_eqns_add_observation_c(double *A, double *b, const double *buffer, double val, int32_t n);
+    RTCD_EXTERN void(*eb_aom_noise_eqns_add_observation)(double *A, double *b, const double *buffer, double val, int32_t n);
     typedef uint64_t(*EbSpatialFullDistType)(
         uint8_t   *input,
         uint32_t   input_offset,
@@ -539,6 +553,10 @@ extern "C" {
     RTCD_EXTERN void(*av1_get_gradient_hist)(const uint8_t *src, int src_stride, int rows, int cols, uint64_t *hist);
     double av1_compute_cross_correlation_c(unsigned char *im1, int stride1, int x1, int y1, unsigned char *im2, int stride2, int x2, int y2);
     RTCD_EXTERN double(*eb_av1_compute_cross_correlation)(unsigned char *im1, int stride1, int x1, int y1, unsigned char *im2, int stride2, int x2, int y2);
+    int av1_fast9_detect_row_c(const uint8_t *src, int stride, int width, int b, int *xs);
+    RTCD_EXTERN int(*eb_av1_fast9_detect_row)(const uint8_t *src, int stride, int width, int b, int *xs);
+    int av1_ransac_find_inliers_c(const double *proj, const double *corners, int npoints, double threshold, int *inlier_indices, double *distances);
+    RTCD_EXTERN int(*eb_av1_ransac_find_inliers)(const double *proj, const double *corners, int npoints, double threshold, int *inlier_indices, double *distances);
     void av1_k_means_dim1_c(const int* data, int* centroids, uint8_t* indices, int n, int k, int max_itr);
     RTCD_EXTERN void(*eb_av1_k_means_dim1)(const int* data, int* centroids, uint8_t* indices, int n, int k, int max_itr);
     void av1_k_means_dim2_c(const int* data, int* centroids, uint8_t* indices, int n, int k, int max_itr);
@@ -630,6 +648,15 @@ extern "C" {
     int64_t eb_aom_sse_avx2(const uint8_t *a, int a_stride, const uint8_t *b, int b_stride, int width, int height);
     int64_t aom_highbd_sse_avx2(const uint8_t *a8, int a_stride, const uint8_t *b8, int b_stride, int width, int height);
 
+    void aom_ssim_parms_8x8_avx2(const uint8_t *s, int sp, const uint8_t *r, int rp, uint32_t *sum_s, uint32_t *sum_r, uint32_t *sum_sq_s, uint32_t *sum_sq_r, uint32_t *sum_sxr);
+    void aom_ssim_parms_8x8_avx512(const uint8_t *s, int sp, const uint8_t *r, int rp, uint32_t *sum_s, uint32_t *sum_r, uint32_t *sum_sq_s, uint32_t *sum_sq_r, uint32_t *sum_sxr);
+    void aom_highbd_ssim_parms_8x8_avx2(const uint8_t *s, int sp, const uint8_t *sinc, int spinc, const uint16_t *r, int rp, uint32_t *sum_s, uint32_t *sum_r, uint32_t *sum_sq_s, uint32_t *sum_sq_r, uint32_t *sum_sxr);
+    void aom_highbd_ssim_parms_8x8_avx512(const uint8_t *s, int sp, const uint8_t *sinc, int spinc, const uint16_t *r, int rp, uint32_t *sum_s, uint32_t *sum_r, uint32_t *sum_sq_s, uint32_t *sum_sq_r, uint32_t *sum_sxr);
+
+    uint32_t av1_get_crc32c_value_sse4_2(void *crc_calculator, uint8_t *p, size_t length);
+    void av1_get_2x2_same_value_row_avx2(const uint8_t *src, int stride, int width, int8_t *row_same, int8_t *col_same);
+    void av1_highbd_get_2x2_same_value_row_avx2(const uint16_t *src, int stride, int width, int8_t *row_same, int8_t *col_same);
+
     void eb_av1_wedge_compute_delta_squares_avx2(int16_t *d, const int16_t *a, const int16_t *b, int N);
 
 
@@ -644,6 +671,9 @@ extern "C" {
     void eb_av1_compute_stats_highbd_avx2(int32_t wiener_win, const uint8_t *dgd8, const uint8_t *src8, int32_t h_start, int32_t h_end, int32_t v_start, int32_t v_end, int32_t dgd_stride, int32_t src_stride, int64_t *M, int64_t *H, AomBitDepth bit_depth);
     void eb_av1_compute_stats_highbd_avx512(int32_t wiener_win, const uint8_t *dgd8, const uint8_t *src8, int32_t h_start, int32_t h_end, int32_t v_start, int32_t v_end, int32_t dgd_stride, int32_t src_stride, int64_t *M, int64_t *H, AomBitDepth bit_depth);
 
+    void eb_aom_flat_block_gradient_stats_avx2(const double *block, int32_t block_size, double *g_xx, double *g_xy, double *g_yy, double *sum, double *sum_sq);
+    void eb_aom_noise_eqns_add_observation_avx2(double *A, double *b, const double *buffer, double val, int32_t n);
+
 
     int64_t eb_av1_lowbd_pixel_proj_error_avx2(const uint8_t *src8, int32_t width, int32_t height, int32_t src_stride, const uint8_t *dat8, int32_t dat_stride, int32_t *flt0, int32_t flt0_stride, int32_t *flt1, int32_t flt1_stride, int32_t xq[2], const SgrParamsType *params);
     int64_t eb_av1_lowbd_pixel_proj_error_avx512(const uint8_t *src8, int32_t width, int32_t height, int32_t src_stride, const uint8_t *dat8, int32_t dat_stride, int32_t *flt0, int32_t flt0_stride, int32_t *flt1, int32_t flt1_stride, int32_t xq[2], const SgrParamsType *params);
@@ -889,6 +919,18 @@ extern "C" {
 
     unsigned int aom_obmc_sad8x8_avx2(const uint8_t *pre, int pre_stride, const int32_t *wsrc, const int32_t *mask);
 
+    unsigned int aom_obmc_sad128x128_avx512(const uint8_t *pre, int pre_stride, const int32_t *wsrc, const int32_t *mask);
+
+    unsigned int aom_obmc_sad128x64_avx512(const uint8_t *pre, int pre_stride, const int32_t *wsrc, const int32_t *mask);
+
+    unsigned int aom_obmc_sad64x128_avx512(const uint8_t *pre, int pre_stride, const int32_t *wsrc, const int32_t *mask);
+
+    unsigned int aom_obmc_sad64x64_avx512(const uint8_t *pre, int pre_stride, const int32_t *wsrc, const int32_t *mask);
+
+    unsigned int aom_obmc_sad64x32_avx512(const uint8_t *pre, int pre_stride, const int32_t *wsrc, const int32_t *mask);
+
+    unsigned int aom_obmc_sad64x16_avx512(const uint8_t *pre, int pre_stride, const int32_t *wsrc, const int32_t *mask);
+
     unsigned int aom_obmc_sub_pixel_variance128x128_sse4_1(const uint8_t *pre, int pre_stride, int xoffset, int yoffset, const int32_t *wsrc, const int32_t *mask, unsigned int *sse);
 
     unsigned int aom_obmc_sub_pixel_variance128x64_sse4_1(const uint8_t *pre, int pre_stride, int xoffset, int yoffset, const int32_t *wsrc, const int32_t *mask, unsigned int *sse);
@@ -977,6 +1019,18 @@ extern "C" {
 
     unsigned int aom_obmc_variance8x8_avx2(const uint8_t *pre, int pre_stride, const int32_t *wsrc, const int32_t *mask, unsigned int *sse);
 
+    unsigned int aom_obmc_variance128x128_avx512(const uint8_t *pre, int pre_stride, const int32_t *wsrc, const int32_t *mask, unsigned int *sse);
+
+    unsigned int aom_obmc_variance128x64_avx512(const uint8_t *pre, int pre_stride, const int32_t *wsrc, const int32_t *mask, unsigned int *sse);
+
+    unsigned int aom_obmc_variance64x128_avx512(const uint8_t *pre, int pre_stride, const int32_t *wsrc, const int32_t *mask, unsigned int *sse);
+
+    unsigned int aom_obmc_variance64x64_avx512(const uint8_t *pre, int pre_stride, const int32_t *wsrc, const int32_t *mask, unsigned int *sse);
+
+    unsigned int aom_obmc_variance64x32_avx512(const uint8_t *pre, int pre_stride, const int32_t *wsrc, const int32_t *mask, unsigned int *sse);
+
+    unsigned int aom_obmc_variance64x16_avx512(const uint8_t *pre, int pre_stride, const int32_t *wsrc, const int32_t *mask, unsigned int *sse);
+
 
     unsigned int eb_aom_variance4x4_sse2(const uint8_t *src_ptr, int source_stride, const uint8_t *ref_ptr, int ref_stride, unsigned int *sse);
 
@@ -1022,6 +1076,18 @@ extern "C" {
 
     unsigned int eb_aom_variance128x128_avx2(const uint8_t *src_ptr, int source_stride, const uint8_t *ref_ptr, int ref_stride, unsigned int *sse);
 
+    unsigned int eb_aom_variance64x16_avx512(const uint8_t *src_ptr, int source_stride, const uint8_t *ref_ptr, int ref_stride, unsigned int *sse);
+
+    unsigned int eb_aom_variance64x32_avx512(const uint8_t *src_ptr, int source_stride, const uint8_t *ref_ptr, int ref_stride, unsigned int *sse);
+
+    unsigned int eb_aom_variance64x64_avx512(const uint8_t *src_ptr, int source_stride, const uint8_t *ref_ptr, int ref_stride, unsigned int *sse);
+
+    unsigned int eb_aom_variance64x128_avx512(const uint8_t *src_ptr, int source_stride, const uint8_t *ref_ptr, int ref_stride, unsigned int *sse);
+
+    unsigned int eb_aom_variance128x64_avx512(const uint8_t *src_ptr, int source_stride, const uint8_t *ref_ptr, int ref_stride, unsigned int *sse);
+
+    unsigned int eb_aom_variance128x128_avx512(const uint8_t *src_ptr, int source_stride, const uint8_t *ref_ptr, int ref_stride, unsigned int *sse);
+
 
 
 
@@ -1140,6 +1206,8 @@ extern "C" {
     void av1_get_gradient_hist_avx2(const uint8_t *src, int src_stride, int rows, int cols, uint64_t *hist);
 
     double av1_compute_cross_correlation_avx2(unsigned char *im1, int stride1, int x1, int y1, unsigned char *im2, int stride2, int x2, int y2);
+    int av1_fast9_detect_row_avx2(const uint8_t *src, int stride, int width, int b, int *xs);
+    int av1_ransac_find_inliers_avx2(const double *proj, const double *corners, int npoints, double threshold, int *inlier_indices, double *distances);
 
     void av1_k_means_dim1_avx2(const int* data, int* centroids, uint8_t* indices, int n, int k, int max_itr);
 
@@ -1296,6 +1364,36 @@ extern "C" {
         const uint16_t *v_pre, int uv_pre_stride, unsigned int block_width, unsigned int block_height,
         int ss_x, int ss_y, const double *noise_levels, const int decay_control, uint32_t *y_accum,
         uint16_t *y_count, uint32_t *u_accum, uint16_t *u_count, uint32_t *v_accum, uint16_t *v_count);
+#endif
+    void svt_av1_apply_temporal_filter_planewise_avx512(
+#if TF_IMP
+        struct MeContext *context_ptr, const uint8_t *y_src, int y_src_stride, const uint8_t *y_pre,
+        int y_pre_stride, const uint8_t *u_src, const uint8_t *v_src, int uv_src_stride,
+        const uint8_t *u_pre, const uint8_t *v_pre, int uv_pre_stride, unsigned int block_width,
+        unsigned int block_height, int ss_x, int ss_y, const double *noise_levels,
+        const int decay_control, uint32_t *y_accum, uint16_t *y_count, uint32_t *u_accum,
+        uint16_t *u_count, uint32_t *v_accum, uint16_t *v_count);
+#else
+        const uint8_t *y_src, int y_src_stride, const uint8_t *y_pre, int y_pre_stride,
+        const uint8_t *u_src, const uint8_t *v_src, int uv_src_stride, const uint8_t *u_pre,
+        const uint8_t *v_pre, int uv_pre_stride, unsigned int block_width, unsigned int block_height,
+        int ss_x, int ss_y, const double *noise_levels, const int decay_control, uint32_t *y_accum,
+        uint16_t *y_count, uint32_t *u_accum, uint16_t *u_count, uint32_t *v_accum, uint16_t *v_count);
+#endif
+    void svt_av1_apply_temporal_filter_planewise_hbd_avx512(
+#if TF_IMP
+        struct MeContext *context_ptr, const uint16_t *y_src, int y_src_stride, const uint16_t *y_pre,
+        int y_pre_stride, const uint16_t *u_src, const uint16_t *v_src, int uv_src_stride,
+        const uint16_t *u_pre, const uint16_t *v_pre, int uv_pre_stride, unsigned int block_width,
+        unsigned int block_height, int ss_x, int ss_y, const double *noise_levels,
+        const int decay_control, uint32_t *y_accum, uint16_t *y_count, uint32_t *u_accum,
+        uint16_t *u_count, uint32_t *v_accum, uint16_t *v_count);
+#else
+        const uint16_t *y_src, int y_src_stride, const uint16_t *y_pre, int y_pre_stride,
+        const uint16_t *u_src, const uint16_t *v_src, int uv_src_stride, const uint16_t *u_pre,
+        const uint16_t *v_pre, int uv_pre_stride, unsigned int block_width, unsigned int block_height,
+        int ss_x, int ss_y, const double *noise_levels, const int decay_control, uint32_t *y_accum,
+        uint16_t *y_count, uint32_t *u_accum, uint16_t *u_count, uint32_t *v_accum, uint16_t *v_count);
 #endif
     uint32_t variance_highbd_avx2(const uint16_t *a, int a_stride, const uint16_t *b, int b_stride,
                               int w, int h, uint32_t *sse);
@@ -13,14 +13,104 @@
 #include "fast.h"
 
 #include "corner_detect.h"
+#include "aom_dsp_rtcd.h"
+
+// Returns 1 if the 16-bit circle mask m has 9 contiguous bits set.
+static INLINE int fast9_has_arc(uint32_t m) {
+    m |= m << 16;
+    uint32_t r = m & (m >> 1); // bits i..i+1
+    r &= r >> 2; // bits i..i+3
+    r &= r >> 4; // bits i..i+7
+    r &= m >> 8; // bits i..i+8
+    return (r & 0xffff) != 0;
+}
+
+// FAST-9 segment test of the pixels 3 <= x < width - 3 of a row. The rows
+// [-3, 3] around src must be readable. Corner positions are written to xs in
+// increasing order and their count is returned.
+int av1_fast9_detect_row_c(const uint8_t *src, int stride, int width, int b, int *xs) {
+    const int offsets[16] = {3 * stride,
+                             1 + 3 * stride,
+                             2 + 2 * stride,
+                             3 + stride,
+                             3,
+                             3 - stride,
+                             2 - 2 * stride,
+                             1 - 3 * stride,
+                             -3 * stride,
+                             -1 - 3 * stride,
+                             -2 - 2 * stride,
+                             -3 - stride,
+                             -3,
+                             -3 + stride,
+                             -2 + 2 * stride,
+                             -1 + 3 * stride};
+    int       num_corners = 0;
+
+    for (int x = 3; x < width - 3; x++) {
+        const uint8_t *p      = src + x;
+        const int      cb     = *p + b;
+        const int      c_b    = *p - b;
+        uint32_t       bright = 0, dark = 0;
+        for (int k = 0; k < 16; k++) {
+            const int v = p[offsets[k]];
+            bright |= (uint32_t)(v > cb) << k;
+            dark |= (uint32_t)(v < c_b) << k;
+        }
+        if (fast9_has_arc(bright) || fast9_has_arc(dark)) xs[num_corners++] = x;
+    }
+    return num_corners;
+}
+
+// Same as aom_fast9_detect(), with the segment test done a row at a time.
+static xy *fast9_detect(const uint8_t *im, int xsize, int ysize, int stride, int b,
+                        int *ret_num_corners) {
+    int  num_corners = 0;
+    int  rsize       = 512;
+    xy * corners     = (xy *)malloc(sizeof(*corners) * rsize);
+    int *xs          = (int *)malloc(sizeof(*xs) * (xsize > 0 ? xsize : 1));
+
+    if (!corners || !xs) {
+        free(corners);
+        free(xs);
+        return NULL;
+    }
+    for (int y = 3; y < ysize - 3; y++) {
+        const int n = eb_av1_fast9_detect_row(im + y * stride, stride, xsize, b, xs);
+        if (num_corners + n > rsize) {
+            while (num_corners + n > rsize) rsize *= 2;
+            xy *temp = (xy *)realloc(corners, sizeof(*temp) * rsize);
+            if (!temp) {
+                free(corners);
+                free(xs);
+                return NULL;
+            }
+            corners = temp;
+        }
+        for (int i = 0; i < n; i++) {
+            corners[num_corners].x = xs[i];
+            corners[num_corners].y = y;
+            num_corners++;
+        }
+    }
+    free(xs);
+    *ret_num_corners = num_corners;
+    return corners;
+}
 
 // Fast_9 wrapper
 #define FAST_BARRIER 18
 int av1_fast_corner_detect(unsigned char *buf, int width, int height, int stride, int *points,
                            int max_points) {
-    int       num_points;
-    xy *const frm_corners_xy =
-        aom_fast9_detect_nonmax(buf, width, height, stride, FAST_BARRIER, &num_points);
+    int num_points = 0;
+    xy *corners    = fast9_detect(buf, width, height, stride, FAST_BARRIER, &num_points);
+    xy *frm_corners_xy = NULL;
+    if (corners) {
+        int *scores    = aom_fast9_score(buf, stride, corners, num_points, FAST_BARRIER);
+        frm_corners_xy = aom_nonmax_suppression(corners, scores, num_points, &num_points);
+        free(scores);
+        free(corners);
+    }
     num_points = (num_points <= max_points ? num_points : max_points);
     if (num_points > 0 && frm_corners_xy) {
         eb_memcpy(points, frm_corners_xy, sizeof(*frm_corners_xy) * num_points);
@@ -9,7 +9,9 @@
  * PATENTS file, you can obtain it at www.aomedia.org/license/patent.
  */
 
+#include <string.h>
 #include "hash.h"
+#include "aom_dsp_rtcd.h"
 #if CRC_CALC_FIX
 static void crc_calculator_process_data(CRC_CALCULATOR *p_crc_calculator,
     uint8_t *pData, uint32_t dataLength) {
@@ -72,3 +74,44 @@ uint32_t av1_get_crc_value(void *crc_calculator, uint8_t *p, int length) {
     crc_calculator_process_data(p_crc_calculator, p, length);
     return crc_calculator_get_crc(p_crc_calculator);
 }
+
+/* CRC-32C (iSCSI) polynomial in reversed bit order. */
+#define POLY 0x82f63b78
+
+/* Construct table for software CRC-32C calculation. */
+void av1_crc32c_calculator_init(CRC32C *p_crc32c) {
+    for (uint32_t n = 0; n < 256; n++) {
+        uint32_t crc = n;
+        for (int k = 0; k < 8; k++) crc = crc & 1 ? (crc >> 1) ^ POLY : crc >> 1;
+        p_crc32c->table[0][n] = crc;
+    }
+    for (uint32_t n = 0; n < 256; n++) {
+        uint32_t crc = p_crc32c->table[0][n];
+        for (int k = 1; k < 8; k++) {
+            crc                   = p_crc32c->table[0][crc & 0xff] ^ (crc >> 8);
+            p_crc32c->table[k][n] = crc;
+        }
+    }
+}
+
+/* Table-driven software version, 8 bytes at a time. This assumes
+   little-endian integers, as the crc32 instruction does. */
+uint32_t av1_get_crc32c_value_c(void *crc_calculator, uint8_t *p, size_t length) {
+    const CRC32C * c    = (const CRC32C *)crc_calculator;
+    const uint8_t *next = p;
+    uint64_t       crc  = 0xffffffff;
+
+    while (length >= 8) {
+        uint64_t data;
+        memcpy(&data, next, sizeof(data));
+        crc ^= data;
+        crc = c->table[7][crc & 0xff] ^ c->table[6][(crc >> 8) & 0xff] ^
+              c->table[5][(crc >> 16) & 0xff] ^ c->table[4][(crc >> 24) & 0xff] ^
+              c->table[3][(crc >> 32) & 0xff] ^ c->table[2][(crc >> 40) & 0xff] ^
+              c->table[1][(crc >> 48) & 0xff] ^ c->table[0][crc >> 56];
+        next += 8;
+        length -= 8;
+    }
+    while (length--) crc = c->table[0][(crc ^ *next++) & 0xff] ^ (crc >> 8);
+    return (uint32_t)crc ^ 0xffffffff;
+}
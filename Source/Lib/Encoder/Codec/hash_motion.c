@@ -9,9 +9,11 @@
  * PATENTS file, you can obtain it at www.aomedia.org/license/patent.
  */
 
+#include <string.h>
 #include "hash.h"
 #include "hash_motion.h"
 #include "EbPictureControlSet.h"
+#include "aom_dsp_rtcd.h"
 
 void             eb_aom_free(void *memblk);
 static const int crc_bits        = 16;
@@ -49,24 +51,41 @@ static void get_pixels_in_1d_short_array_by_block_2x2(uint16_t *y_src, int strid
     }
 }
 
-static int is_block_2x2_row_same_value(uint8_t *p) {
-    if (p[0] != p[1] || p[2] != p[3]) return 0;
-    return 1;
+// Hashes a 2x2 block of pixels. The second hash reads the block in column
+// order, so the hashes of larger blocks, which are built from these, are two
+// independent functions of the pixels.
+static void get_2x2_hash_values(CRC32C *crc_calculator, const uint8_t *p, int sample_size,
+                                uint32_t *hash_value1, uint32_t *hash_value2) {
+    uint8_t transposed[4 * sizeof(uint16_t)];
+    memcpy(transposed, p, sample_size);
+    memcpy(transposed + sample_size, p + 2 * sample_size, sample_size);
+    memcpy(transposed + 2 * sample_size, p + sample_size, sample_size);
+    memcpy(transposed + 3 * sample_size, p + 3 * sample_size, sample_size);
+    *hash_value1 = av1_get_crc32c_value(crc_calculator, (uint8_t *)p, 4 * sample_size);
+    *hash_value2 = av1_get_crc32c_value(crc_calculator, transposed, 4 * sample_size);
 }
 
-static int is_block16_2x2_row_same_value(uint16_t *p) {
-    if (p[0] != p[1] || p[2] != p[3]) return 0;
-    return 1;
-}
-
-static int is_block_2x2_col_same_value(uint8_t *p) {
-    if ((p[0] != p[2]) || (p[1] != p[3])) return 0;
-    return 1;
+// For each of the width 2x2 blocks starting on the row at src, checks whether
+// both rows (row_same) or both columns (col_same) of the block have the same
+// value
+void av1_get_2x2_same_value_row_c(const uint8_t *src, int stride, int width, int8_t *row_same,
+                                  int8_t *col_same) {
+    const uint8_t *a = src;
+    const uint8_t *b = src + stride;
+    for (int x = 0; x < width; x++) {
+        row_same[x] = a[x] == a[x + 1] && b[x] == b[x + 1];
+        col_same[x] = a[x] == b[x] && a[x + 1] == b[x + 1];
+    }
 }
 
-static int is_block16_2x2_col_same_value(uint16_t *p) {
-    if ((p[0] != p[2]) || (p[1] != p[3])) return 0;
-    return 1;
+void av1_highbd_get_2x2_same_value_row_c(const uint16_t *src, int stride, int width,
+                                         int8_t *row_same, int8_t *col_same) {
+    const uint16_t *a = src;
+    const uint16_t *b = src + stride;
+    for (int x = 0; x < width; x++) {
+        row_same[x] = a[x] == a[x + 1] && b[x] == b[x + 1];
+        col_same[x] = a[x] == b[x] && a[x + 1] == b[x + 1];
+    }
 }
 
 // the hash value (hash_value1 consists two parts, the first 3 bits relate to
@@ -137,23 +156,23 @@ void av1_generate_block_2x2_hash_value(const Yv12BufferConfig *picture, uint32_t
     const int x_end  = picture->y_crop_width - width + 1;
     const int y_end  = picture->y_crop_height - height + 1;
 
-    const int length = width * 2;
     if (picture->flags & YV12_FLAG_HIGHBITDEPTH) {
         uint16_t p[4];
         int      pos = 0;
         for (int y_pos = 0; y_pos < y_end; y_pos++) {
+            uint16_t *src = CONVERT_TO_SHORTPTR(picture->y_buffer) + y_pos * picture->y_stride;
+            av1_highbd_get_2x2_same_value_row(src,
+                                              picture->y_stride,
+                                              x_end,
+                                              pic_block_same_info[0] + pos,
+                                              pic_block_same_info[1] + pos);
             for (int x_pos = 0; x_pos < x_end; x_pos++) {
-                get_pixels_in_1d_short_array_by_block_2x2(
-                    CONVERT_TO_SHORTPTR(picture->y_buffer) + y_pos * picture->y_stride + x_pos,
-                    picture->y_stride,
-                    p);
-                pic_block_same_info[0][pos] = is_block16_2x2_row_same_value(p);
-                pic_block_same_info[1][pos] = is_block16_2x2_col_same_value(p);
-
-                pic_block_hash[0][pos] =
-                    av1_get_crc_value(&pcs->crc_calculator1, (uint8_t *)p, length * sizeof(p[0]));
-                pic_block_hash[1][pos] =
-                    av1_get_crc_value(&pcs->crc_calculator2, (uint8_t *)p, length * sizeof(p[0]));
+                get_pixels_in_1d_short_array_by_block_2x2(src + x_pos, picture->y_stride, p);
+                get_2x2_hash_values(&pcs->crc_calculator,
+                                    (uint8_t *)p,
+                                    sizeof(p[0]),
+                                    &pic_block_hash[0][pos],
+                                    &pic_block_hash[1][pos]);
                 pos++;
             }
             pos += width - 1;
@@ -162,16 +181,19 @@ void av1_generate_block_2x2_hash_value(const Yv12BufferConfig *picture, uint32_t
         uint8_t p[4];
         int     pos = 0;
         for (int y_pos = 0; y_pos < y_end; y_pos++) {
+            uint8_t *src = picture->y_buffer + y_pos * picture->y_stride;
+            av1_get_2x2_same_value_row(src,
+                                       picture->y_stride,
+                                       x_end,
+                                       pic_block_same_info[0] + pos,
+                                       pic_block_same_info[1] + pos);
             for (int x_pos = 0; x_pos < x_end; x_pos++) {
-                get_pixels_in_1d_char_array_by_block_2x2(
-                    picture->y_buffer + y_pos * picture->y_stride + x_pos, picture->y_stride, p);
-                pic_block_same_info[0][pos] = is_block_2x2_row_same_value(p);
-                pic_block_same_info[1][pos] = is_block_2x2_col_same_value(p);
-
-                pic_block_hash[0][pos] =
-                    av1_get_crc_value(&pcs->crc_calculator1, p, length * sizeof(p[0]));
-                pic_block_hash[1][pos] =
-                    av1_get_crc_value(&pcs->crc_calculator2, p, length * sizeof(p[0]));
+                get_pixels_in_1d_char_array_by_block_2x2(src + x_pos, picture->y_stride, p);
+                get_2x2_hash_values(&pcs->crc_calculator,
+                                    p,
+                                    sizeof(p[0]),
+                                    &pic_block_hash[0][pos],
+                                    &pic_block_hash[1][pos]);
                 pos++;
             }
             pos += width - 1;
@@ -201,14 +223,14 @@ void av1_generate_block_hash_value(const Yv12BufferConfig *picture, int block_si
             p[2] = src_pic_block_hash[0][pos + src_size * pic_width];
             p[3] = src_pic_block_hash[0][pos + src_size * pic_width + src_size];
             dst_pic_block_hash[0][pos] =
-                av1_get_crc_value(&pcs->crc_calculator1, (uint8_t *)p, length);
+                av1_get_crc32c_value(&pcs->crc_calculator, (uint8_t *)p, length);
 
             p[0] = src_pic_block_hash[1][pos];
             p[1] = src_pic_block_hash[1][pos + src_size];
             p[2] = src_pic_block_hash[1][pos + src_size * pic_width];
             p[3] = src_pic_block_hash[1][pos + src_size * pic_width + src_size];
             dst_pic_block_hash[1][pos] =
-                av1_get_crc_value(&pcs->crc_calculator2, (uint8_t *)p, length);
+                av1_get_crc32c_value(&pcs->crc_calculator, (uint8_t *)p, length);
 
             dst_pic_block_same_info[0][pos] =
                 src_pic_block_same_info[0][pos] && src_pic_block_same_info[0][pos + quad_size] &&
@@ -278,7 +300,6 @@ void av1_add_to_hash_map_by_row_with_precal_data(HashTable *p_hash_table, uint32
 void av1_get_block_hash_value(uint8_t *y_src, int stride, int block_size, uint32_t *hash_value1,
                               uint32_t *hash_value2, int use_highbitdepth,
                               struct PictureControlSet *pcs, IntraBcContext *x) {
-    UNUSED(pcs);
     uint32_t  to_hash[4];
     const int add_value = hash_block_size_to_index(block_size) << crc_bits;
     assert(add_value >= 0);
@@ -295,10 +316,11 @@ void av1_get_block_hash_value(uint8_t *y_src, int stride, int block_size, uint32
                 get_pixels_in_1d_short_array_by_block_2x2(
                     y16_src + y_pos * stride + x_pos, stride, pixel_to_hash);
                 assert(pos < AOM_BUFFER_SIZE_FOR_BLOCK_HASH);
-                x->hash_value_buffer[0][0][pos] = av1_get_crc_value(
-                    &x->crc_calculator1, (uint8_t *)pixel_to_hash, sizeof(pixel_to_hash));
-                x->hash_value_buffer[1][0][pos] = av1_get_crc_value(
-                    &x->crc_calculator2, (uint8_t *)pixel_to_hash, sizeof(pixel_to_hash));
+                get_2x2_hash_values(&pcs->crc_calculator,
+                                    (uint8_t *)pixel_to_hash,
+                                    sizeof(pixel_to_hash[0]),
+                                    &x->hash_value_buffer[0][0][pos],
+                                    &x->hash_value_buffer[1][0][pos]);
             }
         }
     } else {
@@ -309,10 +331,11 @@ void av1_get_block_hash_value(uint8_t *y_src, int stride, int block_size, uint32
                 get_pixels_in_1d_char_array_by_block_2x2(
                     y_src + y_pos * stride + x_pos, stride, pixel_to_hash);
                 assert(pos < AOM_BUFFER_SIZE_FOR_BLOCK_HASH);
-                x->hash_value_buffer[0][0][pos] =
-                    av1_get_crc_value(&x->crc_calculator1, pixel_to_hash, sizeof(pixel_to_hash));
-                x->hash_value_buffer[1][0][pos] =
-                    av1_get_crc_value(&x->crc_calculator2, pixel_to_hash, sizeof(pixel_to_hash));
+                get_2x2_hash_values(&pcs->crc_calculator,
+                                    pixel_to_hash,
+                                    sizeof(pixel_to_hash[0]),
+                                    &x->hash_value_buffer[0][0][pos],
+                                    &x->hash_value_buffer[1][0][pos]);
             }
         }
     }
@@ -341,14 +364,14 @@ void av1_get_block_hash_value(uint8_t *y_src, int stride, int block_size, uint32
                 to_hash[2] = x->hash_value_buffer[0][src_idx][src_pos + src_sub_block_in_width];
                 to_hash[3] = x->hash_value_buffer[0][src_idx][src_pos + src_sub_block_in_width + 1];
                 x->hash_value_buffer[0][dst_idx][dst_pos] =
-                    av1_get_crc_value(&x->crc_calculator1, (uint8_t *)to_hash, sizeof(to_hash));
+                    av1_get_crc32c_value(&pcs->crc_calculator, (uint8_t *)to_hash, sizeof(to_hash));
 
                 to_hash[0] = x->hash_value_buffer[1][src_idx][src_pos];
                 to_hash[1] = x->hash_value_buffer[1][src_idx][src_pos + 1];
                 to_hash[2] = x->hash_value_buffer[1][src_idx][src_pos + src_sub_block_in_width];
                 to_hash[3] = x->hash_value_buffer[1][src_idx][src_pos + src_sub_block_in_width + 1];
                 x->hash_value_buffer[1][dst_idx][dst_pos] =
-                    av1_get_crc_value(&x->crc_calculator2, (uint8_t *)to_hash, sizeof(to_hash));
+                    av1_get_crc32c_value(&pcs->crc_calculator, (uint8_t *)to_hash, sizeof(to_hash));
                 dst_pos++;
             }
         }
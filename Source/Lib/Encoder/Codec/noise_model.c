@@ -16,6 +16,7 @@
 #include "noise_util.h"
 #include "mathutils.h"
 #include "EbLog.h"
+#include "aom_dsp_rtcd.h"
 
 #define kLowPolyNumParams 3
 
@@ -550,6 +551,35 @@ static int32_t compare_scores(const void *a, const void *b) {
     return 0;
 }
 
+void eb_aom_flat_block_gradient_stats_c(const double *block, int32_t block_size, double *g_xx,
+                                        double *g_xy, double *g_yy, double *sum, double *sum_sq) {
+    // Sums are kept in 4 interleaved partial sums (by column) and combined in a
+    // fixed order, so that vectorized versions can match this one exactly.
+    double xx[4] = {0}, xy[4] = {0}, yy[4] = {0}, s[4] = {0}, s2[4] = {0};
+
+    for (int32_t yi = 1; yi < block_size - 1; ++yi) {
+        for (int32_t xi = 1; xi < block_size - 1; ++xi) {
+            const int32_t k  = (xi - 1) & 3;
+            const double  gx =
+                (block[yi * block_size + xi + 1] - block[yi * block_size + xi - 1]) / 2;
+            const double gy = (block[yi * block_size + xi + block_size] -
+                               block[yi * block_size + xi - block_size]) /
+                              2;
+            xx[k] += gx * gx;
+            xy[k] += gx * gy;
+            yy[k] += gy * gy;
+
+            s[k] += block[yi * block_size + xi];
+            s2[k] += block[yi * block_size + xi] * block[yi * block_size + xi];
+        }
+    }
+    *g_xx   = (xx[0] + xx[2]) + (xx[1] + xx[3]);
+    *g_xy   = (xy[0] + xy[2]) + (xy[1] + xy[3]);
+    *g_yy   = (yy[0] + yy[2]) + (yy[1] + yy[3]);
+    *sum    = (s[0] + s[2]) + (s[1] + s[3]);
+    *sum_sq = (s2[0] + s2[2]) + (s2[1] + s2[3]);
+}
+
 int32_t eb_aom_flat_block_finder_run(const AomFlatBlockFinder *block_finder,
                                      const uint8_t *const data, int32_t w, int32_t h,
                                      int32_t stride, uint8_t *flat_blocks) {
@@ -585,28 +615,13 @@ int32_t eb_aom_flat_block_finder_run(const AomFlatBlockFinder *block_finder,
     for (by = 0; by < num_blocks_h; ++by) {
         for (bx = 0; bx < num_blocks_w; ++bx) {
             // Compute gradient covariance matrix.
-            double  g_xx = 0, g_xy = 0, g_yy = 0;
-            double  var  = 0;
-            double  mean = 0;
-            int32_t xi, yi;
+            double g_xx, g_xy, g_yy;
+            double var;
+            double mean;
             eb_aom_flat_block_finder_extract_block(
                 block_finder, data, w, h, stride, bx * block_size, by * block_size, plane, block);
 
-            for (yi = 1; yi < block_size - 1; ++yi) {
-                for (xi = 1; xi < block_size - 1; ++xi) {
-                    const double gx =
-                        (block[yi * block_size + xi + 1] - block[yi * block_size + xi - 1]) / 2;
-                    const double gy = (block[yi * block_size + xi + block_size] -
-                                       block[yi * block_size + xi - block_size]) /
-                                      2;
-                    g_xx += gx * gx;
-                    g_xy += gx * gy;
-                    g_yy += gy * gy;
-
-                    mean += block[yi * block_size + xi];
-                    var += block[yi * block_size + xi] * block[yi * block_size + xi];
-                }
-            }
+            eb_aom_flat_block_gradient_stats(block, block_size, &g_xx, &g_xy, &g_yy, &mean, &var);
             mean /= (block_size - 2) * (block_size - 2);
 
             // Normalize gradients by BlockSize.
@@ -790,36 +805,70 @@ void eb_aom_noise_model_free(AomNoiseModel *model) {
 EXTRACT_AR_ROW(uint8_t, lowbd);
 EXTRACT_AR_ROW(uint16_t, highbd);
 
-static int32_t add_block_observations(AomNoiseModel *noise_model, int32_t c,
-                                      const uint8_t *const data, const uint8_t *const denoised,
-                                      int32_t w, int32_t h, int32_t stride, int32_t sub_log2[2],
-                                      const uint8_t *const alt_data,
-                                      const uint8_t *const alt_denoised, int32_t alt_stride,
-                                      const uint8_t *const flat_blocks, int32_t block_size,
-                                      int32_t num_blocks_w, int32_t num_blocks_h) {
-    const int32_t lag           = noise_model->params.lag;
-    const int32_t num_coords    = noise_model->n;
-    const double  normalization = (1 << noise_model->params.bit_depth) - 1;
-    double *      A             = noise_model->latest_state[c].eqns.A;
-    double *      b             = noise_model->latest_state[c].eqns.b;
-    double *      buffer        = (double *)malloc(sizeof(*buffer) * (num_coords + 1));
-    const int32_t n             = noise_model->latest_state[c].eqns.n;
+void eb_aom_noise_eqns_add_observation_c(double *A, double *b, const double *buffer, double val,
+                                         int32_t n) {
+    // A is symmetric, only its upper triangle is accumulated here
+    for (int32_t i = 0; i < n; ++i) {
+        for (int32_t j = i; j < n; ++j) A[i * n + j] += buffer[i] * buffer[j];
+        b[i] += buffer[i] * val;
+    }
+}
+
+typedef struct BlockObservationsContext {
+    AomNoiseModel *noise_model;
+    int32_t        c;
+    const uint8_t *data;
+    const uint8_t *denoised;
+    int32_t        w;
+    int32_t        h;
+    int32_t        stride;
+    int32_t *      sub_log2;
+    const uint8_t *alt_data;
+    const uint8_t *alt_denoised;
+    int32_t        alt_stride;
+    const uint8_t *flat_blocks;
+    int32_t        block_size;
+    int32_t        num_blocks_w;
+    int32_t        num_blocks_h;
+    // Per block row sums of the unnormalized observations (upper triangle of A
+    // followed by b)
+    double * row_eqns;
+    // Number of observations of each block row, -1 if the row failed
+    int32_t *row_observations;
+} BlockObservationsContext;
+
+static void add_block_row_observations(void *arg, uint32_t task_index) {
+    BlockObservationsContext *ctx           = (BlockObservationsContext *)arg;
+    const int32_t             by            = (int32_t)task_index;
+    AomNoiseModel *           noise_model   = ctx->noise_model;
+    const int32_t             lag           = noise_model->params.lag;
+    const int32_t             num_coords    = noise_model->n;
+    const int32_t             n             = noise_model->latest_state[ctx->c].eqns.n;
+    const uint8_t *const      flat_blocks   = ctx->flat_blocks;
+    const int32_t             block_size    = ctx->block_size;
+    const int32_t             num_blocks_w  = ctx->num_blocks_w;
+    int32_t *                 sub_log2      = ctx->sub_log2;
+    double *                  buffer = (double *)malloc(sizeof(*buffer) * (num_coords + 1));
 
     if (!buffer) {
         SVT_ERROR("Unable to allocate buffer of size %d\n", num_coords + 1);
-        return 0;
+        ctx->row_observations[by] = -1;
+        return;
     }
-    for (int32_t by = 0; by < num_blocks_h; ++by) {
-        const int32_t y_o = by * (block_size >> sub_log2[1]);
+    {
+        const int32_t y_o              = by * (block_size >> sub_log2[1]);
+        double *      A                = ctx->row_eqns + by * (n * n + n);
+        double *      b                = A + n * n;
+        int32_t       num_observations = 0;
         for (int32_t bx = 0; bx < num_blocks_w; ++bx) {
             const int32_t x_o = bx * (block_size >> sub_log2[0]);
             if (!flat_blocks[by * num_blocks_w + bx]) continue;
             int32_t y_start = (by > 0 && flat_blocks[(by - 1) * num_blocks_w + bx]) ? 0 : lag;
             int32_t x_start = (bx > 0 && flat_blocks[by * num_blocks_w + bx - 1]) ? 0 : lag;
-            int32_t y_end   = AOMMIN((h >> sub_log2[1]) - by * (block_size >> sub_log2[1]),
+            int32_t y_end   = AOMMIN((ctx->h >> sub_log2[1]) - by * (block_size >> sub_log2[1]),
                                    block_size >> sub_log2[1]);
             int32_t x_end =
-                AOMMIN((w >> sub_log2[0]) - bx * (block_size >> sub_log2[0]) - lag,
+                AOMMIN((ctx->w >> sub_log2[0]) - bx * (block_size >> sub_log2[0]) - lag,
                        (bx + 1 < num_blocks_w && flat_blocks[by * num_blocks_w + bx + 1])
                            ? (block_size >> sub_log2[0])
                            : ((block_size >> sub_log2[0]) - lag));
@@ -829,42 +878,102 @@ static int32_t add_block_observations(AomNoiseModel *noise_model, int32_t c,
                         noise_model->params.use_highbd
                             ? extract_ar_row_highbd(noise_model->coords,
                                                     num_coords,
-                                                    (const uint16_t *const)data,
-                                                    (const uint16_t *const)denoised,
-                                                    stride,
+                                                    (const uint16_t *const)ctx->data,
+                                                    (const uint16_t *const)ctx->denoised,
+                                                    ctx->stride,
                                                     sub_log2,
-                                                    (const uint16_t *const)alt_data,
-                                                    (const uint16_t *const)alt_denoised,
-                                                    alt_stride,
+                                                    (const uint16_t *const)ctx->alt_data,
+                                                    (const uint16_t *const)ctx->alt_denoised,
+                                                    ctx->alt_stride,
                                                     x + x_o,
                                                     y + y_o,
                                                     buffer)
                             : extract_ar_row_lowbd(noise_model->coords,
                                                    num_coords,
-                                                   data,
-                                                   denoised,
-                                                   stride,
+                                                   ctx->data,
+                                                   ctx->denoised,
+                                                   ctx->stride,
                                                    sub_log2,
-                                                   alt_data,
-                                                   alt_denoised,
-                                                   alt_stride,
+                                                   ctx->alt_data,
+                                                   ctx->alt_denoised,
+                                                   ctx->alt_stride,
                                                    x + x_o,
                                                    y + y_o,
                                                    buffer);
-                    for (int32_t i = 0; i < n; ++i) {
-                        for (int32_t j = 0; j < n; ++j) {
-                            A[i * n + j] +=
-                                (buffer[i] * buffer[j]) / (normalization * normalization);
-                        }
-                        b[i] += (buffer[i] * val) / (normalization * normalization);
-                    }
-                    noise_model->latest_state[c].num_observations++;
+                    eb_aom_noise_eqns_add_observation(A, b, buffer, val, n);
+                    num_observations++;
                 }
             }
         }
+        ctx->row_observations[by] = num_observations;
     }
     free(buffer);
-    return 1;
+}
+
+static int32_t add_block_observations(AomNoiseModel *noise_model, int32_t c,
+                                      const uint8_t *const data, const uint8_t *const denoised,
+                                      int32_t w, int32_t h, int32_t stride, int32_t sub_log2[2],
+                                      const uint8_t *const alt_data,
+                                      const uint8_t *const alt_denoised, int32_t alt_stride,
+                                      const uint8_t *const flat_blocks, int32_t block_size,
+                                      int32_t num_blocks_w, int32_t num_blocks_h) {
+    const double  normalization = (1 << noise_model->params.bit_depth) - 1;
+    const double  norm2         = normalization * normalization;
+    double *      A             = noise_model->latest_state[c].eqns.A;
+    double *      b             = noise_model->latest_state[c].eqns.b;
+    const int32_t n             = noise_model->latest_state[c].eqns.n;
+    int32_t       ret           = 1;
+
+    // Every block row is accumulated into its own equation system by a task of
+    // the encoder task pool, the rows are then normalized and summed in order,
+    // so the result does not depend on the thread count.
+    double *row_eqns = (double *)calloc(num_blocks_h * (n * n + n), sizeof(*row_eqns));
+    int32_t *row_observations = (int32_t *)calloc(num_blocks_h, sizeof(*row_observations));
+    if (!row_eqns || !row_observations) {
+        SVT_ERROR("Unable to allocate block observations of %d rows\n", num_blocks_h);
+        free(row_eqns);
+        free(row_observations);
+        return 0;
+    }
+
+    BlockObservationsContext ctx;
+    ctx.noise_model      = noise_model;
+    ctx.c                = c;
+    ctx.data             = data;
+    ctx.denoised         = denoised;
+    ctx.w                = w;
+    ctx.h                = h;
+    ctx.stride           = stride;
+    ctx.sub_log2         = sub_log2;
+    ctx.alt_data         = alt_data;
+    ctx.alt_denoised     = alt_denoised;
+    ctx.alt_stride       = alt_stride;
+    ctx.flat_blocks      = flat_blocks;
+    ctx.block_size       = block_size;
+    ctx.num_blocks_w     = num_blocks_w;
+    ctx.num_blocks_h     = num_blocks_h;
+    ctx.row_eqns         = row_eqns;
+    ctx.row_observations = row_observations;
+    eb_task_pool_run(noise_model->task_pool, add_block_row_observations, &ctx, num_blocks_h);
+    for (int32_t by = 0; by < num_blocks_h; ++by)
+        if (row_observations[by] < 0) ret = 0;
+
+    if (ret) {
+        for (int32_t by = 0; by < num_blocks_h; ++by) {
+            const double *row_A = row_eqns + by * (n * n + n);
+            const double *row_b = row_A + n * n;
+            for (int32_t i = 0; i < n; ++i) {
+                for (int32_t j = i; j < n; ++j) A[i * n + j] += row_A[i * n + j] / norm2;
+                b[i] += row_b[i] / norm2;
+            }
+            noise_model->latest_state[c].num_observations += row_observations[by];
+        }
+        for (int32_t i = 0; i < n; ++i)
+            for (int32_t j = 0; j < i; ++j) A[i * n + j] = A[j * n + i];
+    }
+    free(row_eqns);
+    free(row_observations);
+    return ret;
 }
 
 static void add_noise_std_observations(AomNoiseModel *noise_model, int32_t c, const double *coeffs,
@@ -1498,6 +1607,7 @@ EbErrorType denoise_and_model_ctor(AomDenoiseAndModel *object_ptr, EbPtr object_
     object_ptr->height    = init_data_ptr->height;
     object_ptr->y_stride  = init_data_ptr->stride_y;
     object_ptr->uv_stride = init_data_ptr->stride_cb;
+    object_ptr->task_pool = init_data_ptr->task_pool;
 
     //todo: consider replacing with EbPictureBuffersDesc
 
@@ -1547,6 +1657,7 @@ static int32_t denoise_and_model_realloc_if_necessary(struct AomDenoiseAndModel
         SVT_ERROR("Unable to init noise model\n");
         return 0;
     }
+    ctx->noise_model.task_pool = ctx->task_pool;
 
     // Simply use a flat PSD (although we could use the flat blocks to estimate
     // PSD) those to estimate an actual noise PSD)
@@ -20,6 +20,7 @@ extern "C" {
 #include "grainSynthesis.h"
 #include "EbPictureBufferDesc.h"
 #include "EbObject.h"
+#include "EbTaskPool.h"
 
 #define DENOISING_BlockSize 32
 
@@ -188,6 +189,7 @@ typedef struct {
     int32_t (*coords)[2]; // Offsets (x,y) of the coefficient samples
     int32_t n; // Number of parameters (size of coords)
     int32_t bit_depth;
+    EbTaskPool *task_pool; // Threads used to accumulate the equations of a frame
 } AomNoiseModel;
 
 /*!\brief Result of a noise model update. */
@@ -212,6 +214,7 @@ typedef struct DenoiseAndModelInitData {
     uint16_t stride_y;
     uint16_t stride_cb;
     uint16_t stride_cr;
+    EbTaskPool *task_pool;
 } DenoiseAndModelInitData;
 
 typedef struct AomDenoiseAndModel {
@@ -227,6 +230,7 @@ typedef struct AomDenoiseAndModel {
     int32_t uv_stride;
     int32_t num_blocks_w;
     int32_t num_blocks_h;
+    EbTaskPool *task_pool;
 
     // Buffers for image and noise_psd allocated on the fly
     float *              noise_psd[3];
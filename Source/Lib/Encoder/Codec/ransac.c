@@ -16,7 +16,7 @@
 #include "ransac.h"
 #include "mathutils.h"
 #include "random.h"
-#include "common_dsp_rtcd.h"
+#include "aom_dsp_rtcd.h"
 #define MAX_MINPTS 4
 #define MAX_DEGENERATE_ITER 10
 #define MINPTS_MULTIPLIER 5
@@ -354,6 +354,23 @@ static void clear_motion(RANSAC_MOTION *motion, int num_points) {
     memset(motion->inlier_indices, 0, sizeof(*motion->inlier_indices * num_points));
 }
 
+int av1_ransac_find_inliers_c(const double *proj, const double *corners, int npoints,
+                              double threshold, int *inlier_indices, double *distances) {
+    int num_inliers = 0;
+    for (int i = 0; i < npoints; ++i) {
+        double dx       = proj[i * 2] - corners[i * 2];
+        double dy       = proj[i * 2 + 1] - corners[i * 2 + 1];
+        double distance = sqrt(dx * dx + dy * dy);
+
+        if (distance < threshold) {
+            inlier_indices[num_inliers] = i;
+            distances[num_inliers]      = distance;
+            num_inliers++;
+        }
+    }
+    return num_inliers;
+}
+
 static int ransac(const int *matched_points, int npoints, int *num_inliers_by_motion,
                   MotionModel *params_by_motion, int num_desired_motions, int minpts,
                   IsDegenerateFunc is_degenerate, FindTransformationFunc find_transformation,
@@ -368,6 +385,7 @@ static int ransac(const int *matched_points, int npoints, int *num_inliers_by_mo
     double *points1, *points2;
     double *corners1, *corners2;
     double *image1_coord;
+    double *inlier_distances;
 
     // Store information for the num_desired_motions best transformations found
     // and the worst motion among them, as well as the motion currently under
@@ -387,11 +405,12 @@ static int ransac(const int *matched_points, int npoints, int *num_inliers_by_mo
     if (npoints < minpts * MINPTS_MULTIPLIER || npoints == 0)
         return 1;
 
-    points1      = (double *)malloc(sizeof(*points1) * npoints * 2);
-    points2      = (double *)malloc(sizeof(*points2) * npoints * 2);
-    corners1     = (double *)malloc(sizeof(*corners1) * npoints * 2);
-    corners2     = (double *)malloc(sizeof(*corners2) * npoints * 2);
-    image1_coord = (double *)malloc(sizeof(*image1_coord) * npoints * 2);
+    points1          = (double *)malloc(sizeof(*points1) * npoints * 2);
+    points2          = (double *)malloc(sizeof(*points2) * npoints * 2);
+    corners1         = (double *)malloc(sizeof(*corners1) * npoints * 2);
+    corners2         = (double *)malloc(sizeof(*corners2) * npoints * 2);
+    image1_coord     = (double *)malloc(sizeof(*image1_coord) * npoints * 2);
+    inlier_distances = (double *)malloc(sizeof(*inlier_distances) * npoints);
 
     motions = (RANSAC_MOTION *)malloc(sizeof(RANSAC_MOTION) * num_desired_motions);
     for (int i = 0; i < num_desired_motions; ++i) {
@@ -403,8 +422,8 @@ static int ransac(const int *matched_points, int npoints, int *num_inliers_by_mo
 
     worst_kept_motion = motions;
 
-    if (!(points1 && points2 && corners1 && corners2 && image1_coord && motions &&
-          current_motion.inlier_indices)) {
+    if (!(points1 && points2 && corners1 && corners2 && image1_coord && inlier_distances &&
+          motions && current_motion.inlier_indices)) {
         ret_val = 1;
         goto finish_ransac;
     }
@@ -451,16 +470,15 @@ static int ransac(const int *matched_points, int npoints, int *num_inliers_by_mo
 
         projectpoints(params_this_motion, corners1, image1_coord, npoints, 2, 2);
 
-        for (int i = 0; i < npoints; ++i) {
-            double dx       = image1_coord[i * 2] - corners2[i * 2];
-            double dy       = image1_coord[i * 2 + 1] - corners2[i * 2 + 1];
-            double distance = sqrt(dx * dx + dy * dy);
-
-            if (distance < INLIER_THRESHOLD) {
-                current_motion.inlier_indices[current_motion.num_inliers++] = i;
-                sum_distance += distance;
-                sum_distance_squared += distance * distance;
-            }
+        current_motion.num_inliers = eb_av1_ransac_find_inliers(image1_coord,
+                                                                corners2,
+                                                                npoints,
+                                                                INLIER_THRESHOLD,
+                                                                current_motion.inlier_indices,
+                                                                inlier_distances);
+        for (int i = 0; i < current_motion.num_inliers; ++i) {
+            sum_distance += inlier_distances[i];
+            sum_distance_squared += inlier_distances[i] * inlier_distances[i];
         }
 
         if (current_motion.num_inliers >= worst_kept_motion->num_inliers &&
@@ -530,6 +548,7 @@ finish_ransac:
     free(corners1);
     free(corners2);
     free(image1_coord);
+    free(inlier_distances);
     free(current_motion.inlier_indices);
     if (motions) {
         for (int i = 0; i < num_desired_motions; ++i)
@@ -555,6 +574,7 @@ static int ransac_double_prec(const double *matched_points, int npoints, int *nu
     double *points1, *points2;
     double *corners1, *corners2;
     double *image1_coord;
+    double *inlier_distances;
 
     // Store information for the num_desired_motions best transformations found
     // and the worst motion among them, as well as the motion currently under
@@ -574,11 +594,12 @@ static int ransac_double_prec(const double *matched_points, int npoints, int *nu
     if (npoints < minpts * MINPTS_MULTIPLIER || npoints == 0)
         return 1;
 
-    points1      = (double *)malloc(sizeof(*points1) * npoints * 2);
-    points2      = (double *)malloc(sizeof(*points2) * npoints * 2);
-    corners1     = (double *)malloc(sizeof(*corners1) * npoints * 2);
-    corners2     = (double *)malloc(sizeof(*corners2) * npoints * 2);
-    image1_coord = (double *)malloc(sizeof(*image1_coord) * npoints * 2);
+    points1          = (double *)malloc(sizeof(*points1) * npoints * 2);
+    points2          = (double *)malloc(sizeof(*points2) * npoints * 2);
+    corners1         = (double *)malloc(sizeof(*corners1) * npoints * 2);
+    corners2         = (double *)malloc(sizeof(*corners2) * npoints * 2);
+    image1_coord     = (double *)malloc(sizeof(*image1_coord) * npoints * 2);
+    inlier_distances = (double *)malloc(sizeof(*inlier_distances) * npoints);
 
     motions = (RANSAC_MOTION *)malloc(sizeof(RANSAC_MOTION) * num_desired_motions);
     for (int i = 0; i < num_desired_motions; ++i) {
@@ -590,8 +611,8 @@ static int ransac_double_prec(const double *matched_points, int npoints, int *nu
 
     worst_kept_motion = motions;
 
-    if (!(points1 && points2 && corners1 && corners2 && image1_coord && motions &&
-          current_motion.inlier_indices)) {
+    if (!(points1 && points2 && corners1 && corners2 && image1_coord && inlier_distances &&
+          motions && current_motion.inlier_indices)) {
         ret_val = 1;
         goto finish_ransac;
     }
@@ -638,16 +659,15 @@ static int ransac_double_prec(const double *matched_points, int npoints, int *nu
 
         projectpoints(params_this_motion, corners1, image1_coord, npoints, 2, 2);
 
-        for (int i = 0; i < npoints; ++i) {
-            double dx       = image1_coord[i * 2] - corners2[i * 2];
-            double dy       = image1_coord[i * 2 + 1] - corners2[i * 2 + 1];
-            double distance = sqrt(dx * dx + dy * dy);
-
-            if (distance < INLIER_THRESHOLD) {
-                current_motion.inlier_indices[current_motion.num_inliers++] = i;
-                sum_distance += distance;
-                sum_distance_squared += distance * distance;
-            }
+        current_motion.num_inliers = eb_av1_ransac_find_inliers(image1_coord,
+                                                                corners2,
+                                                                npoints,
+                                                                INLIER_THRESHOLD,
+                                                                current_motion.inlier_indices,
+                                                                inlier_distances);
+        for (int i = 0; i < current_motion.num_inliers; ++i) {
+            sum_distance += inlier_distances[i];
+            sum_distance_squared += inlier_distances[i] * inlier_distances[i];
         }
 
         if (current_motion.num_inliers >= worst_kept_motion->num_inliers &&
@@ -715,6 +735,7 @@ finish_ransac:
     free(corners1);
     free(corners2);
     free(image1_coord);
+    free(inlier_distances);
     free(current_motion.inlier_indices);
     if (motions) {
         for (int i = 0; i < num_desired_motions; ++i)
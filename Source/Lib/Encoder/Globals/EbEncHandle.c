@@ -90,6 +90,9 @@
 #define ENCDEC_INPUT_PORT_MDC                                0
 #define ENCDEC_INPUT_PORT_ENCDEC                             1
 #define ENCDEC_INPUT_PORT_INVALID                           -1
+#define DLF_INPUT_PORT_ENCDEC                                0
+#define DLF_INPUT_PORT_DLF                                   1
+#define DLF_INPUT_PORT_INVALID                              -1
 #if NOISE_BASED_TF_FRAMES
 #define SCD_LAD                                             12
 #else
@@ -370,6 +373,56 @@ int32_t set_parent_pcs(EbSvtAv1EncConfiguration*   config, uint32_t core_count,
         return -1;
     }
 }
+/*
+* Auto tiling: tile_rows / tile_columns set to -1 are picked from the resolution, the
+* core count and the level. Each tile row is an EncDec tile group with its own segment
+* wavefront and each tile is entropy coded by its own process, so tiles shorten the
+* wavefront ramp-up and ramp-down when there are many more cores than a single
+* wavefront can keep busy. Aim for one tile per 8 cores with tiles of at least
+* 1024x512 luma samples, splitting rows first.
+*/
+void set_auto_tiles(SequenceControlSet *scs_ptr, uint32_t core_count) {
+    EbSvtAv1EncConfiguration *config = &scs_ptr->static_config;
+    const uint32_t            width  = scs_ptr->max_input_luma_width;
+    const uint32_t            height = scs_ptr->max_input_luma_height;
+    // log2 of MaxTiles and MaxTileCols (Annex A.3), the level is coded as 10 * major + minor
+    static const int32_t max_log2_tiles_per_level[]     = {7, 7, 3, 4, 5, 6, 7, 7};
+    static const int32_t max_log2_tile_cols_per_level[] = {4, 4, 2, 2, 3, 3, 4, 4};
+    const uint32_t       major        = MIN(config->level / 10, 7);
+    const int32_t        max_log2_tiles = max_log2_tiles_per_level[major];
+    const int32_t        max_log2_cols  = max_log2_tile_cols_per_level[major];
+    const EbBool         auto_rows      = config->tile_rows == -1;
+    const EbBool         auto_cols      = config->tile_columns == -1;
+    int32_t              log2_rows      = auto_rows ? 0 : config->tile_rows;
+    int32_t              log2_cols      = auto_cols ? 0 : config->tile_columns;
+    int32_t              target_log2_tiles = 0;
+
+    if (!auto_rows && !auto_cols) return;
+    while ((core_count >> (target_log2_tiles + 1)) >= 8) target_log2_tiles++;
+    target_log2_tiles = MIN(target_log2_tiles, max_log2_tiles);
+
+    // Tiles required by the maximum tile width and area
+    if (auto_cols)
+        while ((width >> log2_cols) > MAX_TILE_WIDTH && log2_cols < max_log2_cols) log2_cols++;
+    if (auto_rows)
+        while ((uint64_t)(width >> log2_cols) * (height >> log2_rows) > MAX_TILE_AREA &&
+               log2_rows + log2_cols < max_log2_tiles)
+            log2_rows++;
+
+    for (;;) {
+        const EbBool split_rows = auto_rows && (height >> (log2_rows + 1)) >= 512;
+        const EbBool split_cols = auto_cols && (width >> (log2_cols + 1)) >= 1024 &&
+                                  log2_cols < max_log2_cols;
+        if (log2_rows + log2_cols >= target_log2_tiles || (!split_rows && !split_cols)) break;
+        if (split_rows && (log2_rows <= log2_cols || !split_cols))
+            log2_rows++;
+        else
+            log2_cols++;
+    }
+    config->tile_rows    = MIN(log2_rows, 6);
+    config->tile_columns = MIN(log2_cols, 4);
+}
+
 EbErrorType load_default_buffer_configuration_settings(
     SequenceControlSet       *scs_ptr){
     EbErrorType           return_error = EB_ErrorNone;
@@ -396,6 +449,8 @@ EbErrorType load_default_buffer_configuration_settings(
         scs_ptr->static_config.logical_processors > lp_count / num_groups)
         core_count = lp_count;
 #endif
+    set_auto_tiles(scs_ptr, core_count);
+
     int32_t return_ppcs = set_parent_pcs(&scs_ptr->static_config,
         core_count, scs_ptr->input_resolution);
     if (return_ppcs == -1)
@@ -638,7 +693,9 @@ EbErrorType load_default_buffer_configuration_settings(
         scs_ptr->total_process_init_count += (scs_ptr->source_based_operations_process_init_count     = MAX(MIN(3, core_count >> 1), core_count / 12));
         scs_ptr->total_process_init_count += (scs_ptr->mode_decision_configuration_process_init_count = MAX(MIN(3, core_count >> 1), core_count / 12));
         scs_ptr->total_process_init_count += (scs_ptr->enc_dec_process_init_count                     = MAX(MIN(40, core_count >> 1), core_count));
-        scs_ptr->total_process_init_count += (scs_ptr->entropy_coding_process_init_count              = MAX(MIN(3, core_count >> 1), core_count / 12));
+        // Tiles are entropy coded independently, allow one process per tile
+        scs_ptr->total_process_init_count += (scs_ptr->entropy_coding_process_init_count              = MAX(MAX(MIN(3, core_count >> 1), core_count / 12),
+                                                                                                             MIN(core_count, (1u << scs_ptr->static_config.tile_rows) << scs_ptr->static_config.tile_columns)));
         scs_ptr->total_process_init_count += (scs_ptr->dlf_process_init_count                         = MAX(MIN(40, core_count >> 1), core_count));
         scs_ptr->total_process_init_count += (scs_ptr->cdef_process_init_count                        = MAX(MIN(40, core_count >> 1), core_count));
         scs_ptr->total_process_init_count += (scs_ptr->rest_process_init_count                        = MAX(MIN(40, core_count >> 1), core_count));
@@ -646,6 +703,9 @@ EbErrorType load_default_buffer_configuration_settings(
 
             scs_ptr->total_process_init_count += (scs_ptr->motion_estimation_process_init_count = MAX(core_count, MAX(MIN(20, core_count >> 1), core_count / 3)));
         }
+        // The task pool threads only run when a process splits its picture, the process
+        // thread runs tasks too
+        scs_ptr->total_process_init_count += (scs_ptr->task_pool_thread_count                         = core_count - 1);
     }else{
         scs_ptr->total_process_init_count += (scs_ptr->picture_analysis_process_init_count            = 1);
         scs_ptr->total_process_init_count += (scs_ptr->motion_estimation_process_init_count           = 1);
@@ -656,6 +716,7 @@ EbErrorType load_default_buffer_configuration_settings(
         scs_ptr->total_process_init_count += (scs_ptr->dlf_process_init_count                         = 1);
         scs_ptr->total_process_init_count += (scs_ptr->cdef_process_init_count                        = 1);
         scs_ptr->total_process_init_count += (scs_ptr->rest_process_init_count                        = 1);
+        scs_ptr->task_pool_thread_count                                                               = 0;
     }
 
     scs_ptr->total_process_init_count += 6; // single processes count
@@ -740,6 +801,42 @@ static uint32_t enc_dec_port_total_count(void){
         total_count += enc_dec_ports[port_index++].count;
     return total_count;
 }
+
+// Dlf
+typedef struct {
+    int32_t  type;
+    uint32_t  count;
+} DlfPorts_t;
+static DlfPorts_t dlf_ports[] = {
+    {DLF_INPUT_PORT_ENCDEC,        0},
+    {DLF_INPUT_PORT_DLF,           0},
+    {DLF_INPUT_PORT_INVALID,       0}
+};
+
+/*****************************************
+ * Input Port Lookup
+ *****************************************/
+// Dlf
+static uint32_t dlf_port_lookup(
+    int32_t  type,
+    uint32_t  port_type_index)
+{
+    uint32_t port_index = 0;
+    uint32_t port_count = 0;
+
+    while ((type != dlf_ports[port_index].type) && (type != DLF_INPUT_PORT_INVALID))
+        port_count += dlf_ports[port_index++].count;
+    return (port_count + port_type_index);
+}
+// Dlf
+static uint32_t dlf_port_total_count(void){
+    uint32_t port_index = 0;
+    uint32_t total_count = 0;
+
+    while (dlf_ports[port_index].type != DLF_INPUT_PORT_INVALID)
+        total_count += dlf_ports[port_index++].count;
+    return total_count;
+}
 /*****************************************
  * Input Port Total Count
  *****************************************/
@@ -793,6 +890,9 @@ static void eb_enc_handle_stop_threads(EbEncHandle *enc_handle_ptr)
 
     // Packetization
     EB_DESTROY_THREAD(enc_handle_ptr->packetization_thread_handle);
+
+    // Task Pool
+    EB_DESTROY_THREAD_ARRAY(enc_handle_ptr->task_pool_thread_handle_array, control_set_ptr->task_pool_thread_count);
 }
 /**********************************
 * Encoder Library Handle Deonstructor
@@ -1042,6 +1142,7 @@ EB_API EbErrorType svt_av1_enc_init(EbComponentType *svt_enc_component)
         input_data.speed_control = (uint8_t)enc_handle_ptr->scs_instance_array[instance_index]->scs_ptr->static_config.speed_control_flag;
         input_data.hbd_mode_decision = enc_handle_ptr->scs_instance_array[instance_index]->scs_ptr->static_config.enable_hbd_mode_decision;
         input_data.film_grain_noise_level = enc_handle_ptr->scs_instance_array[0]->scs_ptr->static_config.film_grain_denoise_strength;
+        input_data.task_pool = enc_handle_ptr->scs_instance_array[instance_index]->encode_context_ptr->task_pool;
         input_data.bit_depth = enc_handle_ptr->scs_instance_array[instance_index]->scs_ptr->static_config.encoder_bit_depth;
         input_data.ext_block_flag = (uint8_t)enc_handle_ptr->scs_instance_array[instance_index]->scs_ptr->static_config.ext_block_flag;
 #if !REMOVE_MRP_MODE
@@ -1161,6 +1262,9 @@ EB_API EbErrorType svt_av1_enc_init(EbComponentType *svt_enc_component)
     enc_dec_ports[ENCDEC_INPUT_PORT_MDC].count = enc_handle_ptr->scs_instance_array[0]->scs_ptr->mode_decision_configuration_process_init_count;
     enc_dec_ports[ENCDEC_INPUT_PORT_ENCDEC].count = enc_handle_ptr->scs_instance_array[0]->scs_ptr->enc_dec_process_init_count;
 
+    dlf_ports[DLF_INPUT_PORT_ENCDEC].count = enc_handle_ptr->scs_instance_array[0]->scs_ptr->enc_dec_process_init_count;
+    dlf_ports[DLF_INPUT_PORT_DLF].count = enc_handle_ptr->scs_instance_array[0]->scs_ptr->dlf_process_init_count;
+
     for (instance_index = 0; instance_index < enc_handle_ptr->encode_instance_total_count; ++instance_index) {
         EbReferenceObjectDescInitData     eb_ref_obj_ect_desc_init_data_structure;
         EbPaReferenceObjectDescInitData   eb_pa_ref_obj_ect_desc_init_data_structure;
@@ -1484,7 +1588,7 @@ EB_API EbErrorType svt_av1_enc_init(EbComponentType *svt_enc_component)
             enc_handle_ptr->enc_dec_results_resource_ptr,
             eb_system_resource_ctor,
             enc_handle_ptr->scs_instance_array[0]->scs_ptr->enc_dec_fifo_init_count,
-            enc_handle_ptr->scs_instance_array[0]->scs_ptr->enc_dec_process_init_count,
+            dlf_port_total_count(),
             enc_handle_ptr->scs_instance_array[0]->scs_ptr->dlf_process_init_count,
             enc_dec_results_creator,
             &enc_dec_result_init_data,
@@ -1675,7 +1779,8 @@ EB_API EbErrorType svt_av1_enc_init(EbComponentType *svt_enc_component)
             enc_handle_ptr->dlf_context_ptr_array[process_index],
             dlf_context_ctor,
             enc_handle_ptr,
-            process_index);
+            process_index,
+            dlf_port_lookup(DLF_INPUT_PORT_DLF, process_index));
     }
 
     //CDEF Contexts
@@ -1792,6 +1897,17 @@ EB_API EbErrorType svt_av1_enc_init(EbComponentType *svt_enc_component)
     // Packetization
     EB_CREATE_THREAD(enc_handle_ptr->packetization_thread_handle, packetization_kernel, enc_handle_ptr->packetization_context_ptr);
 
+    // Task Pool
+    {
+        EbTaskPool *task_pool = enc_handle_ptr->scs_instance_array[0]->encode_context_ptr->task_pool;
+        task_pool->thread_count = control_set_ptr->task_pool_thread_count;
+        if (task_pool->thread_count) {
+            EB_ALLOC_PTR_ARRAY(enc_handle_ptr->task_pool_thread_handle_array, task_pool->thread_count);
+            for (uint32_t thread_index = 0; thread_index < task_pool->thread_count; ++thread_index)
+                EB_CREATE_THREAD(enc_handle_ptr->task_pool_thread_handle_array[thread_index], eb_task_pool_kernel, task_pool);
+        }
+    }
+
 #if DISPLAY_MEMORY
     EB_MEMORY();
 #endif
@@ -1824,6 +1940,7 @@ EB_API EbErrorType svt_av1_enc_deinit(EbComponentType *svt_enc_component){
         eb_shutdown_process(handle->dlf_results_resource_ptr);
         eb_shutdown_process(handle->cdef_results_resource_ptr);
         eb_shutdown_process(handle->rest_results_resource_ptr);
+        eb_task_pool_shutdown(handle->scs_instance_array[0]->encode_context_ptr->task_pool);
     }
 
     return EB_ErrorNone;
@@ -2392,6 +2509,7 @@ void copy_api_from_app(
     // Adaptive Loop Filter
     scs_ptr->static_config.tile_rows = ((EbSvtAv1EncConfiguration*)config_struct)->tile_rows;
     scs_ptr->static_config.tile_columns = ((EbSvtAv1EncConfiguration*)config_struct)->tile_columns;
+    scs_ptr->static_config.subframe_output = config_struct->subframe_output;
     scs_ptr->static_config.unrestricted_motion_vector = ((EbSvtAv1EncConfiguration*)config_struct)->unrestricted_motion_vector;
 
     // Rate Control
@@ -2755,14 +2873,18 @@ static EbErrorType verify_settings(
 
         return_error = EB_ErrorBadParameter;
     }
-    if (config->tile_rows < 0 || config->tile_columns < 0 || config->tile_rows > 6 || config->tile_columns > 6) {
-        SVT_LOG("Error Instance %u: Log2Tile rows/cols must be [0 - 6] \n", channel_number + 1);
+    if (config->tile_rows < -1 || config->tile_columns < -1 || config->tile_rows > 6 || config->tile_columns > 6) {
+        SVT_LOG("Error Instance %u: Log2Tile rows/cols must be [0 - 6], or -1 for auto \n", channel_number + 1);
         return_error = EB_ErrorBadParameter;
     }
-    if ((1 << config->tile_rows) * (1 << config->tile_columns) > 128 || config->tile_columns > 4) {
+    else if ((1 << MAX(config->tile_rows, 0)) * (1 << MAX(config->tile_columns, 0)) > 128 || config->tile_columns > 4) {
         SVT_LOG("Error Instance %u: MaxTiles is 128 and MaxTileCols is 16 (Annex A.3) \n", channel_number + 1);
         return_error = EB_ErrorBadParameter;
     }
+    if (config->subframe_output > 1) {
+        SVT_LOG("Error Instance %u: Invalid SubframeOutput flag [0 - 1]\n", channel_number + 1);
+        return_error = EB_ErrorBadParameter;
+    }
     if (config->unrestricted_motion_vector > 1) {
         SVT_LOG("Error Instance %u : Invalid Unrestricted Motion Vector flag [0 - 1]\n", channel_number + 1);
         return_error = EB_ErrorBadParameter;
@@ -3177,6 +3299,7 @@ EbErrorType eb_svt_enc_init_parameter(
     config_ptr->stat_report = 0;
     config_ptr->tile_rows = 0;
     config_ptr->tile_columns = 0;
+    config_ptr->subframe_output = EB_FALSE;
 
     config_ptr->qp = 50;
     config_ptr->use_qp_file = EB_FALSE;
@@ -3373,6 +3496,8 @@ static void print_lib_params(
     SVT_LOG("\nSVT [config]: EncoderMode \t\t\t\t\t\t\t: %d ", config->enc_mode);
     SVT_LOG("\nSVT [config]: EncoderBitDepth / EncoderColorFormat / CompressedTenBitFormat\t: %d / %d / %d", config->encoder_bit_depth, config->encoder_color_format, config->compressed_ten_bit_format);
     SVT_LOG("\nSVT [config]: SourceWidth / SourceHeight\t\t\t\t\t: %d / %d ", config->source_width, config->source_height);
+    if (config->tile_rows || config->tile_columns)
+        SVT_LOG("\nSVT [config]: Log2 TileRows / TileColumns \t\t\t\t\t: %d / %d ", config->tile_rows, config->tile_columns);
     if (config->frame_rate_denominator != 0 && config->frame_rate_numerator != 0)
         SVT_LOG("\nSVT [config]: Fps_Numerator / Fps_Denominator / Gop Size / IntraRefreshType \t: %d / %d / %d / %d", config->frame_rate_numerator > (1 << 16) ? config->frame_rate_numerator >> 16 : config->frame_rate_numerator,
             config->frame_rate_denominator > (1 << 16) ? config->frame_rate_denominator >> 16 : config->frame_rate_denominator,
@@ -3832,7 +3957,7 @@ EB_API EbErrorType svt_av1_enc_get_packet(
 
     if (eb_wrapper_ptr) {
         packet = (EbBufferHeaderType*)eb_wrapper_ptr->object_ptr;
-        if ( packet->flags & 0xfffffff0 )
+        if ( packet->flags & EB_BUFFERFLAG_ERROR_MASK )
             return_error = EB_ErrorMax;
         // return the output stream buffer
         *p_buffer = packet;
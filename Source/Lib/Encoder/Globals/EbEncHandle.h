@@ -70,6 +70,7 @@ struct _EbEncHandle {
     EbHandle *dlf_thread_handle_array;
     EbHandle *cdef_thread_handle_array;
     EbHandle *rest_thread_handle_array;
+    EbHandle *task_pool_thread_handle_array;
 
     EbHandle packetization_thread_handle;
 
@@ -118,4 +119,6 @@ struct _EbEncHandle {
     EbFifo *output_recon_buffer_consumer_fifo_ptr;
 };
 
+// Picks the tile_rows / tile_columns left at -1 in the static config
+void set_auto_tiles(SequenceControlSet *scs_ptr, uint32_t core_count);
 #endif // EbEncHandle_h
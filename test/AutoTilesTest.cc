@@ -0,0 +1,100 @@
+/*
+ * Copyright(c) 2019 Intel Corporation
+ * SPDX - License - Identifier: BSD - 2 - Clause - Patent
+ */
+
+/******************************************************************************
+ * @file AutoTilesTest.cc
+ *
+ * @brief Unit test of the automatic tile configuration:
+ * - set_auto_tiles
+ *
+ ******************************************************************************/
+
+#include <string.h>
+#include "gtest/gtest.h"
+// workaround to eliminate the compiling warning on linux
+// The macro will conflict with definition in gtest.h
+#ifdef __USE_GNU
+#undef __USE_GNU  // defined in EbThreads.h
+#endif
+#ifdef _GNU_SOURCE
+#undef _GNU_SOURCE  // defined in EbThreads.h
+#endif
+extern "C" {
+#include "EbEncHandle.h"
+}
+
+namespace {
+
+typedef struct AutoTilesParam {
+    uint32_t width;
+    uint32_t height;
+    uint32_t level;        /**< 10 * major + minor, 0 for no level */
+    uint32_t core_count;
+    int32_t tile_rows;     /**< log2, -1 for auto */
+    int32_t tile_columns;  /**< log2, -1 for auto */
+    int32_t expected_rows;
+    int32_t expected_columns;
+} AutoTilesParam;
+
+static const AutoTilesParam auto_tiles_params[] = {
+    // one tile per 8 cores
+    {1920, 1080, 0, 1, -1, -1, 0, 0},
+    {1920, 1080, 0, 8, -1, -1, 0, 0},
+    {3840, 2160, 0, 1, -1, -1, 0, 0},
+    {3840, 2160, 0, 8, -1, -1, 0, 0},
+    // rows are split first, tiles stay at 1024x512 or larger
+    {3840, 2160, 0, 64, -1, -1, 2, 1},
+    {1920, 1080, 0, 64, -1, -1, 1, 0},
+    {1280, 720, 0, 64, -1, -1, 0, 0},
+    {7680, 4320, 0, 64, -1, -1, 2, 1},
+    // the maximum tile width and area need tiles whatever the core count
+    {7680, 4320, 0, 1, -1, -1, 1, 1},
+    {7680, 4320, 0, 8, -1, -1, 1, 1},
+    // the level caps the tile and tile column counts
+    {16384, 8704, 0, 64, -1, -1, 2, 2},
+    {16384, 8704, 20, 64, -1, -1, 1, 2},
+    {3840, 2160, 51, 64, -1, -1, 2, 1},
+    // a fixed dimension is kept, the other one is picked
+    {3840, 2160, 0, 64, 0, -1, 0, 1},
+    {3840, 2160, 0, 64, -1, 0, 2, 0},
+    {3840, 2160, 0, 64, 1, 1, 1, 1},
+};
+
+/**
+ * @brief Unit test for set_auto_tiles
+ *
+ * Test strategy:
+ * Set the resolution, level, core count and tile configuration of a
+ * sequence control set, then pick the tiles.
+ *
+ * Expected result:
+ * The picked tile rows and columns are the expected ones.
+ *
+ * Test coverage:
+ * Core counts 1, 8 and 64, from 720p to 16K, with and without a level, with
+ * both dimensions auto and with one or both fixed.
+ */
+TEST(AutoTilesTest, set_auto_tiles) {
+    for (const AutoTilesParam &param : auto_tiles_params) {
+        SequenceControlSet scs;
+        memset(&scs, 0, sizeof(scs));
+        scs.max_input_luma_width = param.width;
+        scs.max_input_luma_height = param.height;
+        scs.static_config.level = param.level;
+        scs.static_config.tile_rows = param.tile_rows;
+        scs.static_config.tile_columns = param.tile_columns;
+
+        set_auto_tiles(&scs, param.core_count);
+
+        EXPECT_EQ(param.expected_rows, scs.static_config.tile_rows)
+            << param.width << "x" << param.height << " level " << param.level
+            << " cores " << param.core_count;
+        EXPECT_EQ(param.expected_columns, scs.static_config.tile_columns)
+            << param.width << "x" << param.height << " level " << param.level
+            << " cores " << param.core_count;
+    }
+}
+
+}  // namespace
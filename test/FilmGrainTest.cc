@@ -30,6 +30,7 @@
 #include "FilmGrainExpectedResult.h"
 #include "acm_random.h"
 #include "noise_model.h"
+#include "EbThreads.h"
 #include "aom_dsp_rtcd.h"
 
 static AomFilmGrain film_grain_test_vectors[3] = {
@@ -209,6 +210,8 @@ class AddFilmGrainTest : public ::testing::Test {
     static const int chroma_size = luma_size >> 2;
 
     void SetUp() override {
+        // grain blending is dispatched through the common rtcd
+        setup_common_rtcd_internal(get_cpu_flags_to_use());
         luma_ = (uint8_t *)eb_aom_malloc(luma_size);
         cb_ = (uint8_t *)eb_aom_malloc(chroma_size);
         cr_ = (uint8_t *)eb_aom_malloc(chroma_size);
@@ -271,6 +274,196 @@ TEST_F(AddFilmGrainTest, MatchTest) {
     }
 }
 
+/**
+ * @brief Unit test for the film grain blending functions:
+ * - eb_fgn_add_luma_noise_{sse4_1,avx2}
+ * - eb_fgn_add_chroma_noise_{sse4_1,avx2}
+ * - eb_fgn_add_luma_noise_hbd_{sse4_1,avx2}
+ * - eb_fgn_add_chroma_noise_hbd_{sse4_1,avx2}
+ *
+ * Test strategy:
+ * Feed random samples, grain and scaling functions to the SIMD and C versions
+ * and check their outputs are bit-exact, for block widths with and without a
+ * remainder, all chroma subsamplings and 8/10/12-bit samples.
+ */
+class FilmGrainBlendTest : public ::testing::Test {
+  protected:
+    static const int kMaxSize = 64;
+    static const int kStride = 2 * kMaxSize + 8;
+
+    void SetUp() override {
+        rnd_.Reset(libaom_test::ACMRandom::DeterministicSeed());
+    }
+
+    void prepare_data(int bit_depth) {
+        const int grain_center = 128 << (bit_depth - 8);
+        const int grain_max = (256 << (bit_depth - 8)) - 1 - grain_center;
+        for (int i = 0; i < 256; i++)
+            scaling_lut_[i] = rnd_.Rand8();
+        for (int i = 0; i < kMaxSize * kStride; i++)
+            grain_[i] = (int32_t)(rnd_.Rand16() % (2 * grain_max + 2)) - grain_center;
+        for (int i = 0; i < 2 * kMaxSize * kStride; i++) {
+            luma_[i] = rnd_.Rand8();
+            luma16_[i] = rnd_.Rand16() & ((1 << bit_depth) - 1);
+        }
+        for (int i = 0; i < kMaxSize * kStride; i++) {
+            chroma_ref_[i] = chroma_tst_[i] = rnd_.Rand8();
+            chroma16_ref_[i] = chroma16_tst_[i] =
+                rnd_.Rand16() & ((1 << bit_depth) - 1);
+        }
+        scaling_shift_ = 8 + rnd_.PseudoUniform(4);
+        if (rnd_.Rand8() & 1) {
+            min_ = 16 << (bit_depth - 8);
+            max_ = 235 << (bit_depth - 8);
+        } else {
+            min_ = 0;
+            max_ = (256 << (bit_depth - 8)) - 1;
+        }
+        mult_ = rnd_.Rand8() - 128;
+        luma_mult_ = rnd_.Rand8() - 128;
+        offset_ = ((rnd_.Rand16() & 511) << (bit_depth - 8)) - (1 << bit_depth);
+    }
+
+    template <typename Sample>
+    void check_output(const Sample *ref, const Sample *tst, int width,
+                      int height, const char *name) {
+        for (int i = 0; i < height; i++)
+            for (int j = 0; j < width; j++)
+                ASSERT_EQ(ref[i * kStride + j], tst[i * kStride + j])
+                    << name << " mismatch at (" << j << ", " << i
+                    << ") of " << width << "x" << height;
+    }
+
+    libaom_test::ACMRandom rnd_;
+    int32_t scaling_lut_[256];
+    int32_t grain_[kMaxSize * kStride];
+    uint8_t luma_[2 * kMaxSize * kStride];
+    uint16_t luma16_[2 * kMaxSize * kStride];
+    uint8_t chroma_ref_[kMaxSize * kStride];
+    uint8_t chroma_tst_[kMaxSize * kStride];
+    uint16_t chroma16_ref_[kMaxSize * kStride];
+    uint16_t chroma16_tst_[kMaxSize * kStride];
+    int32_t scaling_shift_, min_, max_, mult_, luma_mult_, offset_;
+};
+
+typedef void (*FgnAddLumaNoiseFunc)(const int32_t *scaling_lut, uint8_t *luma,
+                                    int32_t luma_stride, const int32_t *grain,
+                                    int32_t grain_stride, int32_t width,
+                                    int32_t height, int32_t scaling_shift,
+                                    int32_t min_luma, int32_t max_luma);
+typedef void (*FgnAddChromaNoiseFunc)(
+    const int32_t *scaling_lut, uint8_t *chroma, int32_t chroma_stride,
+    const uint8_t *luma, int32_t luma_stride, const int32_t *grain,
+    int32_t grain_stride, int32_t width, int32_t height,
+    int32_t chroma_subsamp_x, int32_t chroma_subsamp_y, int32_t mult,
+    int32_t luma_mult, int32_t offset, int32_t scaling_shift,
+    int32_t min_chroma, int32_t max_chroma);
+typedef void (*FgnAddLumaNoiseHbdFunc)(const int32_t *scaling_lut,
+                                       uint16_t *luma, int32_t luma_stride,
+                                       const int32_t *grain,
+                                       int32_t grain_stride, int32_t width,
+                                       int32_t height, int32_t scaling_shift,
+                                       int32_t min_luma, int32_t max_luma,
+                                       int32_t bit_depth);
+typedef void (*FgnAddChromaNoiseHbdFunc)(
+    const int32_t *scaling_lut, uint16_t *chroma, int32_t chroma_stride,
+    const uint16_t *luma, int32_t luma_stride, const int32_t *grain,
+    int32_t grain_stride, int32_t width, int32_t height,
+    int32_t chroma_subsamp_x, int32_t chroma_subsamp_y, int32_t mult,
+    int32_t luma_mult, int32_t offset, int32_t scaling_shift,
+    int32_t min_chroma, int32_t max_chroma, int32_t bit_depth);
+
+static const int blend_test_widths[] = {1, 2, 4, 7, 8, 15, 16, 30, 32, 64};
+static const int blend_test_heights[] = {1, 2, 16, 32};
+
+TEST_F(FilmGrainBlendTest, AddNoiseMatchC) {
+    const FgnAddLumaNoiseFunc luma_funcs[] = {eb_fgn_add_luma_noise_sse4_1,
+                                              eb_fgn_add_luma_noise_avx2};
+    const FgnAddChromaNoiseFunc chroma_funcs[] = {
+        eb_fgn_add_chroma_noise_sse4_1, eb_fgn_add_chroma_noise_avx2};
+    const CPU_FLAGS func_flags[] = {CPU_FLAGS_SSE4_1, CPU_FLAGS_AVX2};
+
+    for (int f = 0; f < 2; f++) {
+        if (!(get_cpu_flags_to_use() & func_flags[f]))
+            continue;
+        for (int w : blend_test_widths) {
+            for (int h : blend_test_heights) {
+                prepare_data(8);
+                eb_fgn_add_luma_noise_c(scaling_lut_, chroma_ref_, kStride,
+                                        grain_, kStride, w, h,
+                                        scaling_shift_, min_, max_);
+                luma_funcs[f](scaling_lut_, chroma_tst_, kStride, grain_,
+                              kStride, w, h, scaling_shift_, min_, max_);
+                check_output(chroma_ref_, chroma_tst_, w, h, "luma");
+
+                for (int ss = 0; ss < 3; ss++) {
+                    // 4:4:4, 4:2:2 and 4:2:0
+                    const int ss_x = ss ? 1 : 0, ss_y = ss == 2 ? 1 : 0;
+                    prepare_data(8);
+                    eb_fgn_add_chroma_noise_c(scaling_lut_, chroma_ref_,
+                                              kStride, luma_, kStride, grain_,
+                                              kStride, w, h, ss_x, ss_y, mult_,
+                                              luma_mult_, offset_,
+                                              scaling_shift_, min_, max_);
+                    chroma_funcs[f](scaling_lut_, chroma_tst_, kStride, luma_,
+                                    kStride, grain_, kStride, w, h, ss_x,
+                                    ss_y, mult_, luma_mult_, offset_,
+                                    scaling_shift_, min_, max_);
+                    check_output(chroma_ref_, chroma_tst_, w, h, "chroma");
+                }
+            }
+        }
+    }
+}
+
+TEST_F(FilmGrainBlendTest, AddNoiseHbdMatchC) {
+    const FgnAddLumaNoiseHbdFunc luma_funcs[] = {
+        eb_fgn_add_luma_noise_hbd_sse4_1, eb_fgn_add_luma_noise_hbd_avx2};
+    const FgnAddChromaNoiseHbdFunc chroma_funcs[] = {
+        eb_fgn_add_chroma_noise_hbd_sse4_1, eb_fgn_add_chroma_noise_hbd_avx2};
+    const CPU_FLAGS func_flags[] = {CPU_FLAGS_SSE4_1, CPU_FLAGS_AVX2};
+
+    for (int f = 0; f < 2; f++) {
+        if (!(get_cpu_flags_to_use() & func_flags[f]))
+            continue;
+        for (int bd = 8; bd <= 12; bd += 2) {
+            for (int w : blend_test_widths) {
+                for (int h : blend_test_heights) {
+                    prepare_data(bd);
+                    eb_fgn_add_luma_noise_hbd_c(scaling_lut_, chroma16_ref_,
+                                                kStride, grain_, kStride, w, h,
+                                                scaling_shift_, min_, max_, bd);
+                    luma_funcs[f](scaling_lut_, chroma16_tst_, kStride, grain_,
+                                  kStride, w, h, scaling_shift_, min_, max_,
+                                  bd);
+                    check_output(
+                        chroma16_ref_, chroma16_tst_, w, h, "luma hbd");
+
+                    for (int ss = 0; ss < 3; ss++) {
+                        const int ss_x = ss ? 1 : 0, ss_y = ss == 2 ? 1 : 0;
+                        prepare_data(bd);
+                        eb_fgn_add_chroma_noise_hbd_c(
+                            scaling_lut_, chroma16_ref_, kStride, luma16_,
+                            kStride, grain_, kStride, w, h, ss_x, ss_y, mult_,
+                            luma_mult_, offset_, scaling_shift_, min_, max_,
+                            bd);
+                        chroma_funcs[f](scaling_lut_, chroma16_tst_, kStride,
+                                        luma16_, kStride, grain_, kStride, w,
+                                        h, ss_x, ss_y, mult_, luma_mult_,
+                                        offset_, scaling_shift_, min_, max_,
+                                        bd);
+                        check_output(chroma16_ref_,
+                                     chroma16_tst_,
+                                     w,
+                                     h,
+                                     "chroma hbd");
+                    }
+                }
+            }
+        }
+    }
+}
+
 extern "C" {
 #include "EbPictureControlSet.h"
 #include "EbPictureBufferDesc.h"
@@ -394,6 +587,14 @@ class DenoiseModelRunTest : public ::testing::Test {
         fg_init_data.stride_y = width_;
         fg_init_data.stride_cb = fg_init_data.stride_cr =
             fg_init_data.stride_y >> subsampling_x_;
+        // fit the noise model rows on a few pool threads
+        memset(&task_pool_, 0, sizeof(task_pool_));
+        err = eb_task_pool_ctor(&task_pool_);
+        EXPECT_EQ(err, 0) << "eb_task_pool_ctor fail";
+        task_pool_.thread_count = pool_thread_count_;
+        for (uint32_t i = 0; i < pool_thread_count_; ++i)
+            pool_threads_[i] = eb_create_thread(eb_task_pool_kernel, &task_pool_);
+        fg_init_data.task_pool = &task_pool_;
 
         memset(&noise_model, 0, sizeof(noise_model));
         err = denoise_and_model_ctor(&noise_model, &fg_init_data);
@@ -403,6 +604,10 @@ class DenoiseModelRunTest : public ::testing::Test {
     ~DenoiseModelRunTest() {
         eb_picture_buffer_desc_dctor(&in_pic_);
         denoise_and_model_dctor(&noise_model);
+        eb_task_pool_shutdown(&task_pool_);
+        for (uint32_t i = 0; i < pool_thread_count_; ++i)
+            eb_destroy_thread(pool_threads_[i]);
+        task_pool_.dctor(&task_pool_);
     }
 
     void SetUp() override {
@@ -426,6 +631,11 @@ class DenoiseModelRunTest : public ::testing::Test {
             eb_aom_ifft8x8_float = eb_aom_ifft8x8_float_avx2;
             eb_aom_ifft2x2_float = eb_aom_ifft2x2_float_c;
             eb_aom_ifft4x4_float = eb_aom_ifft4x4_float_sse2;
+
+            eb_aom_flat_block_gradient_stats =
+                eb_aom_flat_block_gradient_stats_avx2;
+            eb_aom_noise_eqns_add_observation =
+                eb_aom_noise_eqns_add_observation_avx2;
         }
     }
 
@@ -462,6 +672,9 @@ class DenoiseModelRunTest : public ::testing::Test {
     int subsampling_y_;
     EbPictureBufferDesc in_pic_;
     AomDenoiseAndModel noise_model;
+    static const uint32_t pool_thread_count_ = 3;
+    EbTaskPool task_pool_;
+    EbHandle pool_threads_[pool_thread_count_];
     AomFilmGrain output_film_grain;
     libaom_test::ACMRandom random_;
     uint8_t *data_ptr_[3];
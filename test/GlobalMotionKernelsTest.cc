@@ -0,0 +1,188 @@
+/*
+ * Copyright(c) 2019 Intel Corporation
+ * SPDX - License - Identifier: BSD - 2 - Clause - Patent
+ */
+
+/******************************************************************************
+ * @file GlobalMotionKernelsTest.cc
+ *
+ * @brief Unit test for the global motion estimation kernels:
+ * - av1_fast9_detect_row_avx2
+ * - av1_ransac_find_inliers_avx2
+ *
+ * Test strategy:
+ * Run the C and the SIMD kernels on the same random input and compare the
+ * results, which must be bit-exact. The C segment test is also checked against
+ * the reference FAST-9 detector.
+ *
+ ******************************************************************************/
+
+#include <vector>
+#include "gtest/gtest.h"
+#include "EbDefinitions.h"
+#include "aom_dsp_rtcd.h"
+extern "C" {
+#include "fast.h"
+}
+#include "random.h"
+#include "util.h"
+
+namespace {
+using svt_av1_test_tool::SVTRandom;
+
+typedef int (*Fast9DetectRowFunc)(const uint8_t *src, int stride, int width,
+                                  int b, int *xs);
+
+#define FAST_MAX_W 200
+#define FAST_MAX_H 16
+#define FAST_STRIDE 256
+
+class Fast9DetectRowTest
+    : public ::testing::TestWithParam<Fast9DetectRowFunc> {
+  public:
+    Fast9DetectRowTest() : func_tst_(GetParam()) {
+    }
+
+  protected:
+    // Random pixels give many corners, smooth ones with some noise give few.
+    void prepare_image(SVTRandom &rnd, bool smooth) {
+        SVTRandom noise(-8, 8);
+        for (int y = 0; y < FAST_MAX_H; y++) {
+            for (int x = 0; x < FAST_STRIDE; x++) {
+                if (smooth) {
+                    const int v = ((x * 3 + y * 5) & 0xff) + noise.random();
+                    image_[y * FAST_STRIDE + x] =
+                        (uint8_t)(v < 0 ? 0 : v > 255 ? 255 : v);
+                } else {
+                    image_[y * FAST_STRIDE + x] = (uint8_t)rnd.random();
+                }
+            }
+        }
+    }
+
+    void run_test() {
+        SVTRandom rnd(0, 255);
+        const int barriers[] = {0, 18, 40, 255};
+        int xs_ref[FAST_MAX_W], xs_tst[FAST_MAX_W];
+
+        for (int smooth = 0; smooth < 2; smooth++) {
+            for (int width = 7; width <= FAST_MAX_W; width++) {
+                prepare_image(rnd, smooth != 0);
+                for (const int b : barriers) {
+                    for (int y = 3; y < FAST_MAX_H - 3; y++) {
+                        const uint8_t *src = image_ + y * FAST_STRIDE;
+                        const int n_ref = av1_fast9_detect_row_c(
+                            src, FAST_STRIDE, width, b, xs_ref);
+                        const int n_tst =
+                            func_tst_(src, FAST_STRIDE, width, b, xs_tst);
+                        ASSERT_EQ(n_ref, n_tst)
+                            << "width " << width << " b " << b << " y " << y;
+                        for (int i = 0; i < n_ref; i++)
+                            ASSERT_EQ(xs_ref[i], xs_tst[i])
+                                << "width " << width << " b " << b << " y "
+                                << y;
+                    }
+                }
+            }
+        }
+    }
+
+    void run_reference_test() {
+        SVTRandom rnd(0, 255);
+        int xs[FAST_MAX_W];
+
+        for (int smooth = 0; smooth < 2; smooth++) {
+            prepare_image(rnd, smooth != 0);
+            int num_corners = 0;
+            xy *corners = aom_fast9_detect(image_,
+                                           FAST_MAX_W,
+                                           FAST_MAX_H,
+                                           FAST_STRIDE,
+                                           18,
+                                           &num_corners);
+            std::vector<xy> ref(corners, corners + num_corners);
+            free(corners);
+
+            std::vector<xy> tst;
+            for (int y = 3; y < FAST_MAX_H - 3; y++) {
+                const int n = func_tst_(
+                    image_ + y * FAST_STRIDE, FAST_STRIDE, FAST_MAX_W, 18, xs);
+                for (int i = 0; i < n; i++) tst.push_back({xs[i], y});
+            }
+            ASSERT_EQ(ref.size(), tst.size());
+            for (size_t i = 0; i < ref.size(); i++) {
+                ASSERT_EQ(ref[i].x, tst[i].x);
+                ASSERT_EQ(ref[i].y, tst[i].y);
+            }
+        }
+    }
+
+    Fast9DetectRowFunc func_tst_;
+    uint8_t image_[FAST_MAX_H * FAST_STRIDE];
+};
+
+TEST_P(Fast9DetectRowTest, MatchTest) {
+    run_test();
+}
+
+TEST_P(Fast9DetectRowTest, ReferenceTest) {
+    run_reference_test();
+}
+
+INSTANTIATE_TEST_CASE_P(GlobalMotion, Fast9DetectRowTest,
+                        ::testing::Values(av1_fast9_detect_row_c,
+                                          av1_fast9_detect_row_avx2));
+
+typedef int (*RansacFindInliersFunc)(const double *proj,
+                                     const double *corners, int npoints,
+                                     double threshold, int *inlier_indices,
+                                     double *distances);
+
+#define MAX_POINTS 256
+
+class RansacFindInliersTest
+    : public ::testing::TestWithParam<RansacFindInliersFunc> {
+  public:
+    RansacFindInliersTest() : func_tst_(GetParam()) {
+    }
+
+  protected:
+    void run_test() {
+        SVTRandom rnd(0, 1 << 16);
+        SVTRandom rnd_err(-(1 << 12), 1 << 12);
+        double proj[2 * MAX_POINTS], corners[2 * MAX_POINTS];
+        int idx_ref[MAX_POINTS], idx_tst[MAX_POINTS];
+        double dist_ref[MAX_POINTS], dist_tst[MAX_POINTS];
+
+        for (int npoints = 1; npoints <= MAX_POINTS; npoints++) {
+            // the projections are close to the corners, within a few pixels
+            for (int i = 0; i < 2 * npoints; i++) {
+                corners[i] = rnd.random() / 64.0;
+                proj[i] = corners[i] + rnd_err.random() / 1024.0;
+            }
+            const double threshold = 1.25;
+            const int n_ref = av1_ransac_find_inliers_c(
+                proj, corners, npoints, threshold, idx_ref, dist_ref);
+            const int n_tst = func_tst_(
+                proj, corners, npoints, threshold, idx_tst, dist_tst);
+
+            ASSERT_EQ(n_ref, n_tst) << "npoints " << npoints;
+            ASSERT_EQ(0, memcmp(idx_ref, idx_tst, n_ref * sizeof(*idx_ref)))
+                << "npoints " << npoints;
+            ASSERT_EQ(0,
+                      memcmp(dist_ref, dist_tst, n_ref * sizeof(*dist_ref)))
+                << "npoints " << npoints;
+        }
+    }
+
+    RansacFindInliersFunc func_tst_;
+};
+
+TEST_P(RansacFindInliersTest, MatchTest) {
+    run_test();
+}
+
+INSTANTIATE_TEST_CASE_P(GlobalMotion, RansacFindInliersTest,
+                        ::testing::Values(av1_ransac_find_inliers_avx2));
+
+}  // namespace
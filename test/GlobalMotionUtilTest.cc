@@ -29,6 +29,7 @@
 #endif
 #include "EbDefinitions.h"
 #include "EbUtility.h"
+#include "aom_dsp_rtcd.h"
 extern "C" {
 #include "ransac.h"
 }
@@ -87,6 +88,8 @@ template <typename Sample, typename FuncType>
 class RansacTest : public ::testing::TestWithParam<TransformationType> {
   protected:
     RansacTest() : rnd_(0, CoordinateMax) {
+        // inlier scoring is dispatched through the encoder rtcd
+        setup_rtcd_internal(get_cpu_flags_to_use());
         data_.clear();
         ref_.clear();
         memset(&mat_, 0, sizeof(mat_));
@@ -0,0 +1,99 @@
+/*
+ * Copyright(c) 2019 Intel Corporation
+ * SPDX - License - Identifier: BSD - 2 - Clause - Patent
+ */
+
+/******************************************************************************
+ * @file HashTest.cc
+ *
+ * @brief Unit test of the IntraBC block hashing kernels:
+ * - av1_get_crc32c_value_sse4_2
+ * - av1_get_2x2_same_value_row_avx2
+ * - av1_highbd_get_2x2_same_value_row_avx2
+ *
+ * Test strategy:
+ * Check the C CRC-32C against the reference check value, then compare the
+ * SIMD kernels with the C versions on random data, using few distinct sample
+ * values so the same-value checks see both outcomes.
+ *
+ ******************************************************************************/
+
+#include "gtest/gtest.h"
+#include "aom_dsp_rtcd.h"
+#include "hash.h"
+#include "random.h"
+
+namespace {
+using svt_av1_test_tool::SVTRandom;
+
+static const int hash_max_len = 256;
+static const int hash_num_iter = 10000;
+
+TEST(Crc32cTest, CheckValue) {
+    CRC32C crc;
+    uint8_t check[] = {'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+    av1_crc32c_calculator_init(&crc);
+    ASSERT_EQ(0xe3069283u, av1_get_crc32c_value_c(&crc, check, sizeof(check)));
+}
+
+TEST(Crc32cTest, MatchTest) {
+    if (!(get_cpu_flags_to_use() & CPU_FLAGS_SSE4_2))
+        return;
+    SVTRandom rnd(8, false);
+    CRC32C crc;
+    uint8_t buf[hash_max_len + 8];
+    av1_crc32c_calculator_init(&crc);
+
+    for (int iter = 0; iter < hash_num_iter; ++iter) {
+        const size_t len = rnd.random() % hash_max_len;
+        const int offset = rnd.random() % 8;
+        for (size_t i = 0; i < len + offset; ++i)
+            buf[i] = (uint8_t)rnd.random();
+        ASSERT_EQ(av1_get_crc32c_value_c(&crc, buf + offset, len),
+                  av1_get_crc32c_value_sse4_2(&crc, buf + offset, len))
+            << "length " << len << " offset " << offset;
+    }
+}
+
+template <typename Sample, typename FuncType>
+static void run_same_value_test(FuncType func_ref, FuncType func_tst) {
+    SVTRandom rnd(8, false);
+    const int stride = hash_max_len + 8;
+    Sample src[2 * stride];
+    int8_t row_ref[hash_max_len], col_ref[hash_max_len];
+    int8_t row_tst[hash_max_len], col_tst[hash_max_len];
+
+    for (int iter = 0; iter < hash_num_iter; ++iter) {
+        const int width = 1 + rnd.random() % (hash_max_len - 1);
+        const int levels = 1 + rnd.random() % 3;
+        for (int i = 0; i < 2 * stride; ++i)
+            src[i] = (Sample)(rnd.random() % levels) * 257;
+        memset(row_ref, 0x55, sizeof(row_ref));
+        memset(col_ref, 0x55, sizeof(col_ref));
+        memset(row_tst, 0x55, sizeof(row_tst));
+        memset(col_tst, 0x55, sizeof(col_tst));
+
+        func_ref(src, stride, width, row_ref, col_ref);
+        func_tst(src, stride, width, row_tst, col_tst);
+        ASSERT_EQ(0, memcmp(row_ref, row_tst, sizeof(row_ref)))
+            << "width " << width;
+        ASSERT_EQ(0, memcmp(col_ref, col_tst, sizeof(col_ref)))
+            << "width " << width;
+    }
+}
+
+TEST(SameValue2x2Test, MatchTest) {
+    if (!(get_cpu_flags_to_use() & CPU_FLAGS_AVX2))
+        return;
+    run_same_value_test<uint8_t>(av1_get_2x2_same_value_row_c,
+                                 av1_get_2x2_same_value_row_avx2);
+}
+
+TEST(SameValue2x2Test, HbdMatchTest) {
+    if (!(get_cpu_flags_to_use() & CPU_FLAGS_AVX2))
+        return;
+    run_same_value_test<uint16_t>(av1_highbd_get_2x2_same_value_row_c,
+                                  av1_highbd_get_2x2_same_value_row_avx2);
+}
+
+}  // namespace
@@ -0,0 +1,131 @@
+/*
+ * Copyright(c) 2019 Intel Corporation
+ * SPDX - License - Identifier: BSD - 2 - Clause - Patent
+ */
+
+/******************************************************************************
+ * @file InvQuantizeTest.cc
+ *
+ * @brief Unit test for the decoder dequantization:
+ * - eb_av1_inverse_quantize_{sse4_1,avx2}
+ *
+ * Test strategy:
+ * Dequantize the same random levels with the C and the SIMD kernels, for all
+ * transform sizes and types, bit depths, with and without quant matrices, and
+ * compare the whole output buffers.
+ *
+ ******************************************************************************/
+
+#include "gtest/gtest.h"
+#include "EbDefinitions.h"
+#include "EbCoefficients.h"
+#include "EbInvTransforms.h"
+#include "common_dsp_rtcd.h"
+#include "random.h"
+#include "util.h"
+
+namespace {
+using svt_av1_test_tool::SVTRandom;
+
+typedef void (*InvQuantizeFunc)(const int32_t *level, int32_t *qcoeffs,
+                                const int16_t *scan, int32_t n_coeffs,
+                                const int16_t *dequant,
+                                const QmVal *iqmatrix, int32_t shift,
+                                int32_t bit_depth);
+
+#define MAX_COEFFS (32 * 32)
+
+class InvQuantizeTest : public ::testing::TestWithParam<InvQuantizeFunc> {
+  public:
+    InvQuantizeTest() : func_tst_(GetParam()) {
+    }
+
+  protected:
+    void prepare_levels(SVTRandom &rnd, SVTRandom &rnd_large, int n_coeffs,
+                        int nz_percent) {
+        SVTRandom rnd_percent(0, 99);
+        for (int i = 0; i < n_coeffs; i++) {
+            if (rnd_percent.random() >= nz_percent)
+                level_[i] = 0;
+            else if (rnd_percent.random() < 90)
+                level_[i] = rnd.random();
+            else
+                level_[i] = rnd_large.random();
+        }
+    }
+
+    void run_test(int bit_depth, bool use_qm) {
+        SVTRandom rnd(-64, 64);
+        SVTRandom rnd_large(-(1 << 20), 1 << 20);
+        SVTRandom rnd_qindex(0, 255);
+        SVTRandom rnd_qm(32, 255);
+        SVTRandom rnd_fill(-(1 << 16), 1 << 16);
+        QmVal iqmatrix[MAX_COEFFS];
+
+        for (int i = 0; i < MAX_COEFFS; i++) iqmatrix[i] = rnd_qm.random();
+
+        for (int tx_size = TX_4X4; tx_size < TX_SIZES_ALL; tx_size++) {
+            const int max_eob = av1_get_max_eob((TxSize)tx_size);
+            const int shift = av1_get_tx_scale((TxSize)tx_size);
+            for (int tx_type = DCT_DCT; tx_type < TX_TYPES; tx_type++) {
+                const int16_t *scan = av1_scan_orders[tx_size][tx_type].scan;
+                SVTRandom rnd_eob(1, max_eob);
+                for (int nz_percent = 10; nz_percent <= 100; nz_percent += 30) {
+                    const int qindex = rnd_qindex.random();
+                    const int n_coeffs = rnd_eob.random();
+                    const int16_t dequant[2] = {
+                        eb_av1_dc_quant_qtx(qindex, 0, (AomBitDepth)bit_depth),
+                        eb_av1_ac_quant_qtx(qindex, 0, (AomBitDepth)bit_depth)};
+
+                    prepare_levels(rnd, rnd_large, n_coeffs, nz_percent);
+                    // untouched coefficients must stay as they are
+                    for (int i = 0; i < MAX_COEFFS; i++)
+                        qcoeffs_ref_[i] = qcoeffs_tst_[i] = rnd_fill.random();
+
+                    eb_av1_inverse_quantize_c(level_,
+                                              qcoeffs_ref_,
+                                              scan,
+                                              n_coeffs,
+                                              dequant,
+                                              use_qm ? iqmatrix : NULL,
+                                              shift,
+                                              bit_depth);
+                    func_tst_(level_,
+                              qcoeffs_tst_,
+                              scan,
+                              n_coeffs,
+                              dequant,
+                              use_qm ? iqmatrix : NULL,
+                              shift,
+                              bit_depth);
+
+                    ASSERT_EQ(0,
+                              memcmp(qcoeffs_ref_,
+                                     qcoeffs_tst_,
+                                     sizeof(qcoeffs_ref_)))
+                        << "tx_size " << tx_size << " tx_type " << tx_type
+                        << " n_coeffs " << n_coeffs << " bit_depth "
+                        << bit_depth << " qm " << use_qm;
+                }
+            }
+        }
+    }
+
+    InvQuantizeFunc func_tst_;
+    int32_t level_[MAX_COEFFS];
+    int32_t qcoeffs_ref_[MAX_COEFFS];
+    int32_t qcoeffs_tst_[MAX_COEFFS];
+};
+
+TEST_P(InvQuantizeTest, MatchTest) {
+    for (int bit_depth = 8; bit_depth <= 12; bit_depth += 2) {
+        run_test(bit_depth, false);
+        run_test(bit_depth, true);
+    }
+}
+
+INSTANTIATE_TEST_CASE_P(InvQuantize, InvQuantizeTest,
+                        ::testing::Values(eb_av1_inverse_quantize_sse4_1,
+                                          eb_av1_inverse_quantize_avx2));
+
+}  // namespace
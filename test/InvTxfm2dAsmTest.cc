@@ -730,4 +730,17 @@ INSTANTIATE_TEST_CASE_P(
                        ::testing::Values(static_cast<int>(AOM_BITS_8),
                                          static_cast<int>(AOM_BITS_10))));
 
+#ifndef NON_AVX512_SUPPORT
+extern "C" void eb_av1_lowbd_inv_txfm2d_add_avx512(
+    const int32_t *input, uint8_t *output_r, int32_t stride_r,
+    uint8_t *output_w, int32_t stride_w, TxType tx_type, TxSize tx_size,
+    int32_t eob);
+
+INSTANTIATE_TEST_CASE_P(
+    TX_AVX512, InvTxfm2dAsmTest,
+    ::testing::Combine(::testing::Values(eb_av1_lowbd_inv_txfm2d_add_avx512),
+                       ::testing::Values(static_cast<int>(AOM_BITS_8),
+                                         static_cast<int>(AOM_BITS_10))));
+#endif
+
 }  // namespace
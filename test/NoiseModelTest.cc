@@ -0,0 +1,139 @@
+/*
+ * Copyright(c) 2019 Intel Corporation
+ * SPDX - License - Identifier: BSD - 2 - Clause - Patent
+ */
+
+/******************************************************************************
+ * @file NoiseModelTest.cc
+ *
+ * @brief Unit test for the film grain noise model estimation kernels:
+ * - eb_aom_flat_block_gradient_stats_avx2
+ * - eb_aom_noise_eqns_add_observation_avx2
+ *
+ * Test strategy:
+ * Run the C and the SIMD kernels on the same random input and compare the
+ * results, which must be bit-exact.
+ *
+ ******************************************************************************/
+
+#include "gtest/gtest.h"
+#include "EbDefinitions.h"
+#include "aom_dsp_rtcd.h"
+#include "random.h"
+#include "util.h"
+
+namespace {
+using svt_av1_test_tool::SVTRandom;
+
+typedef void (*GradientStatsFunc)(const double *block, int32_t block_size,
+                                  double *g_xx, double *g_xy, double *g_yy,
+                                  double *sum, double *sum_sq);
+
+class FlatBlockGradientStatsTest
+    : public ::testing::TestWithParam<GradientStatsFunc> {
+  public:
+    FlatBlockGradientStatsTest() : func_tst_(GetParam()) {
+    }
+
+  protected:
+    void run_test() {
+        SVTRandom rnd(-(1 << 10), 1 << 10);
+        double block[64 * 64];
+
+        for (int block_size = 3; block_size <= 64; block_size++) {
+            for (int iter = 0; iter < 10; iter++) {
+                for (int i = 0; i < block_size * block_size; i++)
+                    block[i] = rnd.random() / 1023.0;
+
+                double ref[5], tst[5];
+                eb_aom_flat_block_gradient_stats_c(block,
+                                                   block_size,
+                                                   &ref[0],
+                                                   &ref[1],
+                                                   &ref[2],
+                                                   &ref[3],
+                                                   &ref[4]);
+                func_tst_(block,
+                          block_size,
+                          &tst[0],
+                          &tst[1],
+                          &tst[2],
+                          &tst[3],
+                          &tst[4]);
+                ASSERT_EQ(0, memcmp(ref, tst, sizeof(ref)))
+                    << "block_size " << block_size;
+            }
+        }
+    }
+
+    GradientStatsFunc func_tst_;
+};
+
+TEST_P(FlatBlockGradientStatsTest, MatchTest) {
+    run_test();
+}
+
+INSTANTIATE_TEST_CASE_P(
+    NoiseModel, FlatBlockGradientStatsTest,
+    ::testing::Values(eb_aom_flat_block_gradient_stats_avx2));
+
+typedef void (*EqnsAddObservationFunc)(double *A, double *b,
+                                       const double *buffer, double val,
+                                       int32_t n);
+
+#define MAX_EQNS 32
+
+class NoiseEqnsAddObservationTest
+    : public ::testing::TestWithParam<EqnsAddObservationFunc> {
+  public:
+    NoiseEqnsAddObservationTest() : func_tst_(GetParam()) {
+    }
+
+  protected:
+    void run_test() {
+        SVTRandom rnd(-(1 << 12), 1 << 12);
+        double buffer[MAX_EQNS];
+
+        for (int n = 1; n <= MAX_EQNS; n++) {
+            for (int bit_depth = 8; bit_depth <= 12; bit_depth += 2) {
+                memset(A_ref_, 0, sizeof(A_ref_));
+                memset(A_tst_, 0, sizeof(A_tst_));
+                memset(b_ref_, 0, sizeof(b_ref_));
+                memset(b_tst_, 0, sizeof(b_tst_));
+
+                // accumulate a few observations, as done for a block
+                for (int iter = 0; iter < 100; iter++) {
+                    for (int i = 0; i < n; i++)
+                        buffer[i] = rnd.random() >> (12 - bit_depth);
+                    const double val = rnd.random() >> (12 - bit_depth);
+
+                    eb_aom_noise_eqns_add_observation_c(
+                        A_ref_, b_ref_, buffer, val, n);
+                    func_tst_(A_tst_, b_tst_, buffer, val, n);
+                }
+
+                // entries beyond n * n must stay untouched
+                ASSERT_EQ(0, memcmp(A_ref_, A_tst_, sizeof(A_ref_)))
+                    << "n " << n << " bit_depth " << bit_depth;
+                ASSERT_EQ(0, memcmp(b_ref_, b_tst_, sizeof(b_ref_)))
+                    << "n " << n << " bit_depth " << bit_depth;
+            }
+        }
+    }
+
+    EqnsAddObservationFunc func_tst_;
+    double A_ref_[MAX_EQNS * MAX_EQNS + 4];
+    double A_tst_[MAX_EQNS * MAX_EQNS + 4];
+    double b_ref_[MAX_EQNS + 4];
+    double b_tst_[MAX_EQNS + 4];
+};
+
+TEST_P(NoiseEqnsAddObservationTest, MatchTest) {
+    run_test();
+}
+
+INSTANTIATE_TEST_CASE_P(
+    NoiseModel, NoiseEqnsAddObservationTest,
+    ::testing::Values(eb_aom_noise_eqns_add_observation_avx2));
+
+}  // namespace
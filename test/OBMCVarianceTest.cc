@@ -115,6 +115,23 @@ static const ObmcVarParam obmc_var_test_params[] = {
 INSTANTIATE_TEST_CASE_P(OBMC, OBMCVarianceTest,
                         ::testing::ValuesIn(obmc_var_test_params));
 
+#ifndef NON_AVX512_SUPPORT
+#define OBMC_VAR_FUNC_AVX512(W, H) aom_obmc_variance##W##x##H##_avx512
+#define GEN_OBMC_VAR_AVX512_TEST_PARAM(W, H) \
+    ObmcVarParam(OBMC_VAR_FUNC_C(W, H), OBMC_VAR_FUNC_AVX512(W, H))
+
+static const ObmcVarParam obmc_var_avx512_test_params[] = {
+    GEN_OBMC_VAR_AVX512_TEST_PARAM(128, 128),
+    GEN_OBMC_VAR_AVX512_TEST_PARAM(128, 64),
+    GEN_OBMC_VAR_AVX512_TEST_PARAM(64, 128),
+    GEN_OBMC_VAR_AVX512_TEST_PARAM(64, 64),
+    GEN_OBMC_VAR_AVX512_TEST_PARAM(64, 32),
+    GEN_OBMC_VAR_AVX512_TEST_PARAM(64, 16)};
+
+INSTANTIATE_TEST_CASE_P(OBMC_AVX512, OBMCVarianceTest,
+                        ::testing::ValuesIn(obmc_var_avx512_test_params));
+#endif
+
 using ObmcSubPixVarFunc = unsigned int (*)(const uint8_t *pre, int pre_stride,
                                            int xoffset, int yoffset,
                                            const int32_t *wsrc,
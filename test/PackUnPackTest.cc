@@ -16,6 +16,11 @@
  * - unpack_avg_avx2_intrin
  * - unpack_avg_sse2_intrin
  * - unpack_avg_safe_sub_avx2_intrin
+ * - eb_downshift_16bit_to_8bit_avx2
+ * - eb_upshift_16bit_avx2
+ * - eb_interleave_uv_8bit_avx2
+ * - eb_interleave_uv_16bit_to_8bit_avx2
+ * - eb_interleave_uv_16bit_avx2
  *
  * @author Cidana-Ivy, Cidana-Wenyao
  *
@@ -739,4 +744,114 @@ TEST_P(UnPackAvgTest, UnPackSubAvgTest) {
 INSTANTIATE_TEST_CASE_P(UNPACKAVG, UnPackAvgTest,
                         ::testing::ValuesIn(TEST_AVG_SIZES));
 
+// test the decoder output conversions, which take any picture width: use
+// TEST_OUTPUT_SIZES to cover the SIMD loops and their scalar tails.
+AreaSize TEST_OUTPUT_SIZES[] = {AreaSize(1, 1),
+                                AreaSize(7, 3),
+                                AreaSize(15, 5),
+                                AreaSize(16, 2),
+                                AreaSize(17, 3),
+                                AreaSize(31, 4),
+                                AreaSize(32, 3),
+                                AreaSize(33, 5),
+                                AreaSize(48, 2),
+                                AreaSize(63, 2),
+                                AreaSize(64, 64),
+                                AreaSize(65, 3),
+                                AreaSize(100, 7)};
+
+class OutputConvertTest : public ::testing::TestWithParam<AreaSize> {
+  public:
+    OutputConvertTest()
+        : area_width_(std::get<0>(GetParam())),
+          area_height_(std::get<1>(GetParam())) {
+    }
+
+  protected:
+    static const uint32_t in_stride_ = 112;
+    static const uint32_t out_stride_ = 2 * in_stride_ + 8;
+    static const uint32_t test_size_ = out_stride_ * 64;
+
+    void prepare_data(uint32_t bit_depth) {
+        SVTRandom rnd(0, (1 << bit_depth) - 1);
+        for (uint32_t i = 0; i < test_size_; i++) {
+            in_u_[i] = rnd.random();
+            in_v_[i] = rnd.random();
+            in_u_8bit_[i] = (uint8_t)in_v_[i];
+            in_v_8bit_[i] = (uint8_t)in_u_[i];
+        }
+        // untouched samples must stay as they are
+        memset(out_c_, 0xa5, sizeof(out_c_));
+        memset(out_avx2_, 0xa5, sizeof(out_avx2_));
+    }
+
+    void check_output() {
+        ASSERT_EQ(0, memcmp(out_c_, out_avx2_, sizeof(out_c_)))
+            << "size (" << area_width_ << "," << area_height_ << ")";
+    }
+
+    void run_test() {
+        for (uint32_t bit_depth = 8; bit_depth <= 12; bit_depth += 2) {
+            const uint32_t down = bit_depth - 8, up = 16 - bit_depth;
+            for (int i = 0; i < RANDOM_TIME; i++) {
+                prepare_data(bit_depth);
+                eb_downshift_16bit_to_8bit_c(in_u_, in_stride_, (uint8_t *)out_c_,
+                                             out_stride_, area_width_,
+                                             area_height_, down);
+                eb_downshift_16bit_to_8bit_avx2(
+                    in_u_, in_stride_, (uint8_t *)out_avx2_, out_stride_,
+                    area_width_, area_height_, down);
+                check_output();
+
+                eb_upshift_16bit_c(in_u_, in_stride_, out_c_, out_stride_,
+                                   area_width_, area_height_, up);
+                eb_upshift_16bit_avx2(in_u_, in_stride_, out_avx2_,
+                                      out_stride_, area_width_, area_height_,
+                                      up);
+                check_output();
+
+                eb_interleave_uv_8bit_c(in_u_8bit_, in_stride_, in_v_8bit_,
+                                        in_stride_, (uint8_t *)out_c_,
+                                        out_stride_, area_width_,
+                                        area_height_);
+                eb_interleave_uv_8bit_avx2(in_u_8bit_, in_stride_,
+                                           in_v_8bit_, in_stride_,
+                                           (uint8_t *)out_avx2_, out_stride_,
+                                           area_width_, area_height_);
+                check_output();
+
+                eb_interleave_uv_16bit_to_8bit_c(
+                    in_u_, in_stride_, in_v_, in_stride_, (uint8_t *)out_c_,
+                    out_stride_, area_width_, area_height_, down);
+                eb_interleave_uv_16bit_to_8bit_avx2(
+                    in_u_, in_stride_, in_v_, in_stride_,
+                    (uint8_t *)out_avx2_, out_stride_, area_width_,
+                    area_height_, down);
+                check_output();
+
+                eb_interleave_uv_16bit_c(in_u_, in_stride_, in_v_, in_stride_,
+                                         out_c_, out_stride_, area_width_,
+                                         area_height_, up);
+                eb_interleave_uv_16bit_avx2(in_u_, in_stride_, in_v_,
+                                            in_stride_, out_avx2_,
+                                            out_stride_, area_width_,
+                                            area_height_, up);
+                check_output();
+            }
+        }
+    }
+
+    uint32_t area_width_, area_height_;
+    uint16_t in_u_[test_size_], in_v_[test_size_];
+    uint8_t in_u_8bit_[test_size_], in_v_8bit_[test_size_];
+    uint16_t out_c_[test_size_], out_avx2_[test_size_];
+};
+
+TEST_P(OutputConvertTest, OutputConvertTest) {
+    run_test();
+};
+
+INSTANTIATE_TEST_CASE_P(OUTPUTCONVERT, OutputConvertTest,
+                        ::testing::ValuesIn(TEST_OUTPUT_SIZES));
+
 }  // namespace
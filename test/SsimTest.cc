@@ -0,0 +1,171 @@
+/*
+ * Copyright(c) 2019 Intel Corporation
+ * SPDX - License - Identifier: BSD - 2 - Clause - Patent
+ */
+
+/******************************************************************************
+ * @file SsimTest.cc
+ *
+ * @brief Unit test of the SSIM statistics used by the stat report:
+ * - aom_ssim_parms_8x8_avx2
+ * - aom_ssim_parms_8x8_avx512
+ * - aom_highbd_ssim_parms_8x8_avx2
+ * - aom_highbd_ssim_parms_8x8_avx512
+ *
+ * Test strategy:
+ * Feed random and extreme 8x8 blocks to the C reference and the SIMD
+ * kernels, starting from the same non-zero sums, and check all five
+ * accumulated statistics match.
+ *
+ ******************************************************************************/
+
+#include "gtest/gtest.h"
+// workaround to eliminate the compiling warning on linux
+// The macro will conflict with definition in gtest.h
+#ifdef __USE_GNU
+#undef __USE_GNU  // defined in EbThreads.h
+#endif
+#ifdef _GNU_SOURCE
+#undef _GNU_SOURCE  // defined in EbThreads.h
+#endif
+#include "aom_dsp_rtcd.h"
+#include "EbDefinitions.h"
+#include "random.h"
+#include "util.h"
+
+namespace {
+using svt_av1_test_tool::SVTRandom;
+
+using SsimParmsFunc = void (*)(const uint8_t *s, int sp, const uint8_t *r,
+                               int rp, uint32_t *sum_s, uint32_t *sum_r,
+                               uint32_t *sum_sq_s, uint32_t *sum_sq_r,
+                               uint32_t *sum_sxr);
+using HbdSsimParmsFunc = void (*)(const uint8_t *s, int sp,
+                                  const uint8_t *sinc, int spinc,
+                                  const uint16_t *r, int rp, uint32_t *sum_s,
+                                  uint32_t *sum_r, uint32_t *sum_sq_s,
+                                  uint32_t *sum_sq_r, uint32_t *sum_sxr);
+
+static const int ssim_stride = 64;
+static const int ssim_num_iter = 10000;
+
+/**< accumulated statistics of one kernel */
+typedef struct {
+    uint32_t sum_s, sum_r, sum_sq_s, sum_sq_r, sum_sxr;
+} SsimSums;
+
+static void init_sums(SsimSums *sums, SVTRandom &rnd) {
+    sums->sum_s = rnd.random();
+    sums->sum_r = rnd.random();
+    sums->sum_sq_s = rnd.random();
+    sums->sum_sq_r = rnd.random();
+    sums->sum_sxr = rnd.random();
+}
+
+static void check_sums(const SsimSums &ref, const SsimSums &tst,
+                       const int iter) {
+    ASSERT_EQ(ref.sum_s, tst.sum_s) << "iteration " << iter;
+    ASSERT_EQ(ref.sum_r, tst.sum_r) << "iteration " << iter;
+    ASSERT_EQ(ref.sum_sq_s, tst.sum_sq_s) << "iteration " << iter;
+    ASSERT_EQ(ref.sum_sq_r, tst.sum_sq_r) << "iteration " << iter;
+    ASSERT_EQ(ref.sum_sxr, tst.sum_sxr) << "iteration " << iter;
+}
+
+class SsimParmsTest : public ::testing::TestWithParam<SsimParmsFunc> {
+  protected:
+    void run_test() {
+        SVTRandom rnd(8, false);
+        SVTRandom rnd_sum(16, false);
+        const SsimParmsFunc func_tst = GetParam();
+
+        for (int iter = 0; iter < ssim_num_iter; ++iter) {
+            // every 4th block has only black and white samples
+            const bool extreme = (iter & 3) == 0;
+            for (int i = 0; i < 8 * ssim_stride; ++i) {
+                src_[i] = extreme ? (rnd.random() & 1) * 255 : rnd.random();
+                ref_[i] = extreme ? (rnd.random() & 1) * 255 : rnd.random();
+            }
+            const int off = rnd.random() % (ssim_stride - 8);
+            SsimSums sums_ref, sums_tst;
+            init_sums(&sums_ref, rnd_sum);
+            sums_tst = sums_ref;
+
+            aom_ssim_parms_8x8_c(src_ + off, ssim_stride, ref_ + off,
+                                 ssim_stride, &sums_ref.sum_s, &sums_ref.sum_r,
+                                 &sums_ref.sum_sq_s, &sums_ref.sum_sq_r,
+                                 &sums_ref.sum_sxr);
+            func_tst(src_ + off, ssim_stride, ref_ + off, ssim_stride,
+                     &sums_tst.sum_s, &sums_tst.sum_r, &sums_tst.sum_sq_s,
+                     &sums_tst.sum_sq_r, &sums_tst.sum_sxr);
+            check_sums(sums_ref, sums_tst, iter);
+        }
+    }
+
+    uint8_t src_[8 * ssim_stride];
+    uint8_t ref_[8 * ssim_stride];
+};
+
+TEST_P(SsimParmsTest, MatchTest) {
+    run_test();
+}
+
+INSTANTIATE_TEST_CASE_P(AVX2, SsimParmsTest,
+                        ::testing::Values(aom_ssim_parms_8x8_avx2));
+
+#ifndef NON_AVX512_SUPPORT
+INSTANTIATE_TEST_CASE_P(AVX512, SsimParmsTest,
+                        ::testing::Values(aom_ssim_parms_8x8_avx512));
+#endif
+
+class HbdSsimParmsTest : public ::testing::TestWithParam<HbdSsimParmsFunc> {
+  protected:
+    void run_test() {
+        SVTRandom rnd(8, false);
+        SVTRandom rnd10(10, false);
+        SVTRandom rnd_sum(16, false);
+        const HbdSsimParmsFunc func_tst = GetParam();
+
+        for (int iter = 0; iter < ssim_num_iter; ++iter) {
+            const bool extreme = (iter & 3) == 0;
+            for (int i = 0; i < 8 * ssim_stride; ++i) {
+                // the source is split in 8 msb and the 2 lsb in the top
+                // bits of the inc plane, the other inc bits are ignored
+                src_[i] = extreme ? (rnd.random() & 1) * 255 : rnd.random();
+                src_inc_[i] = extreme ? (rnd.random() & 1) * 255 : rnd.random();
+                ref_[i] = extreme ? (rnd.random() & 1) * 1023 : rnd10.random();
+            }
+            const int off = rnd.random() % (ssim_stride - 8);
+            SsimSums sums_ref, sums_tst;
+            init_sums(&sums_ref, rnd_sum);
+            sums_tst = sums_ref;
+
+            aom_highbd_ssim_parms_8x8_c(
+                src_ + off, ssim_stride, src_inc_ + off, ssim_stride,
+                ref_ + off, ssim_stride, &sums_ref.sum_s, &sums_ref.sum_r,
+                &sums_ref.sum_sq_s, &sums_ref.sum_sq_r, &sums_ref.sum_sxr);
+            func_tst(src_ + off, ssim_stride, src_inc_ + off, ssim_stride,
+                     ref_ + off, ssim_stride, &sums_tst.sum_s,
+                     &sums_tst.sum_r, &sums_tst.sum_sq_s, &sums_tst.sum_sq_r,
+                     &sums_tst.sum_sxr);
+            check_sums(sums_ref, sums_tst, iter);
+        }
+    }
+
+    uint8_t src_[8 * ssim_stride];
+    uint8_t src_inc_[8 * ssim_stride];
+    uint16_t ref_[8 * ssim_stride];
+};
+
+TEST_P(HbdSsimParmsTest, MatchTest) {
+    run_test();
+}
+
+INSTANTIATE_TEST_CASE_P(AVX2, HbdSsimParmsTest,
+                        ::testing::Values(aom_highbd_ssim_parms_8x8_avx2));
+
+#ifndef NON_AVX512_SUPPORT
+INSTANTIATE_TEST_CASE_P(AVX512, HbdSsimParmsTest,
+                        ::testing::Values(aom_highbd_ssim_parms_8x8_avx512));
+#endif
+
+}  // namespace
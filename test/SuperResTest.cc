@@ -0,0 +1,172 @@
+/*
+ * Copyright(c) 2019 Intel Corporation
+ * SPDX - License - Identifier: BSD - 2 - Clause - Patent
+ */
+
+/******************************************************************************
+ * @file SuperResTest.cc
+ *
+ * @brief Unit test of the super-res horizontal upscaler:
+ * - eb_av1_convolve_horiz_rs_avx2
+ * - eb_av1_convolve_horiz_rs_avx512
+ * - eb_av1_highbd_convolve_horiz_rs_avx2
+ * - eb_av1_highbd_convolve_horiz_rs_avx512
+ *
+ * Test strategy:
+ * Upscale random rows with every super-res denominator and random
+ * widths, heights and initial subpel positions, and compare the output of
+ * the SIMD kernels with the C reference.
+ *
+ ******************************************************************************/
+
+#include "gtest/gtest.h"
+#include "common_dsp_rtcd.h"
+#include "EbDefinitions.h"
+#include "EbInterPrediction.h"
+#include "EbSuperRes.h"
+#include "acm_random.h"
+#include "util.h"
+
+namespace {
+using libaom_test::ACMRandom;
+
+static const int rs_src_stride = 512;
+static const int rs_dst_stride = 512;
+static const int rs_max_w = 480;
+static const int rs_max_h = 8;
+// Margin in front of the row for the taps left of the first output
+static const int rs_border = 16;
+
+typedef void (*ConvolveHorizRsFunc)(const uint8_t *src, int src_stride,
+                                    uint8_t *dst, int dst_stride, int w, int h,
+                                    const int16_t *x_filters, int x0_qn,
+                                    int x_step_qn);
+typedef void (*HbdConvolveHorizRsFunc)(const uint16_t *src, int src_stride,
+                                       uint16_t *dst, int dst_stride, int w,
+                                       int h, const int16_t *x_filters,
+                                       int x0_qn, int x_step_qn, int bd);
+
+// Step of the upscaler for denominator denom, as set up by
+// upscale_normative_rect()
+static int rs_step(const int denom) {
+    return ((SCALE_NUMERATOR << RS_SCALE_SUBPEL_BITS) + denom / 2) / denom;
+}
+
+class ConvolveHorizRsTest
+    : public ::testing::TestWithParam<ConvolveHorizRsFunc> {
+  protected:
+    void run_test(const int iterations) {
+        ACMRandom rnd(ACMRandom::DeterministicSeed());
+        const ConvolveHorizRsFunc func_tst = GetParam();
+
+        for (int denom = SCALE_NUMERATOR + 1; denom <= 2 * SCALE_NUMERATOR;
+             ++denom) {
+            const int step = rs_step(denom);
+            for (int i = 0; i < iterations; ++i) {
+                const int w = 1 + rnd.PseudoUniform(rs_max_w);
+                const int h = 1 + rnd.PseudoUniform(rs_max_h);
+                const int x0_qn = rnd.PseudoUniform(1 << RS_SCALE_SUBPEL_BITS) -
+                                  (1 << (RS_SCALE_SUBPEL_BITS - 1));
+                const bool extreme = (i & 3) == 0;
+                for (int j = 0; j < rs_src_stride * (rs_max_h + 1); ++j)
+                    src_[j] = extreme ? (rnd.Rand8() & 1) * 255 : rnd.Rand8();
+                memset(dst_ref_, 0, sizeof(dst_ref_));
+                memset(dst_tst_, 0, sizeof(dst_tst_));
+
+                eb_av1_convolve_horiz_rs_c(src_ + rs_border, rs_src_stride,
+                                           dst_ref_, rs_dst_stride, w, h,
+                                           &av1_resize_filter_normative[0][0],
+                                           x0_qn, step);
+                func_tst(src_ + rs_border, rs_src_stride, dst_tst_,
+                         rs_dst_stride, w, h,
+                         &av1_resize_filter_normative[0][0], x0_qn, step);
+
+                ASSERT_EQ(0, memcmp(dst_ref_, dst_tst_, sizeof(dst_ref_)))
+                    << "denom " << denom << " w " << w << " h " << h
+                    << " x0_qn " << x0_qn;
+            }
+        }
+    }
+
+    uint8_t src_[rs_src_stride * (rs_max_h + 1)];
+    uint8_t dst_ref_[rs_dst_stride * rs_max_h];
+    uint8_t dst_tst_[rs_dst_stride * rs_max_h];
+};
+
+TEST_P(ConvolveHorizRsTest, MatchTest) {
+    run_test(100);
+}
+
+INSTANTIATE_TEST_CASE_P(AVX2, ConvolveHorizRsTest,
+                        ::testing::Values(eb_av1_convolve_horiz_rs_avx2));
+
+#ifndef NON_AVX512_SUPPORT
+INSTANTIATE_TEST_CASE_P(AVX512, ConvolveHorizRsTest,
+                        ::testing::Values(eb_av1_convolve_horiz_rs_avx512));
+#endif
+
+typedef std::tuple<HbdConvolveHorizRsFunc, int> HbdConvolveHorizRsParam;
+
+class HbdConvolveHorizRsTest
+    : public ::testing::TestWithParam<HbdConvolveHorizRsParam> {
+  protected:
+    void run_test(const int iterations) {
+        ACMRandom rnd(ACMRandom::DeterministicSeed());
+        const HbdConvolveHorizRsFunc func_tst = TEST_GET_PARAM(0);
+        const int bd = TEST_GET_PARAM(1);
+        const uint16_t mask = (1 << bd) - 1;
+
+        for (int denom = SCALE_NUMERATOR + 1; denom <= 2 * SCALE_NUMERATOR;
+             ++denom) {
+            const int step = rs_step(denom);
+            for (int i = 0; i < iterations; ++i) {
+                const int w = 1 + rnd.PseudoUniform(rs_max_w);
+                const int h = 1 + rnd.PseudoUniform(rs_max_h);
+                const int x0_qn = rnd.PseudoUniform(1 << RS_SCALE_SUBPEL_BITS) -
+                                  (1 << (RS_SCALE_SUBPEL_BITS - 1));
+                const bool extreme = (i & 3) == 0;
+                for (int j = 0; j < rs_src_stride * (rs_max_h + 1); ++j)
+                    src_[j] = extreme ? (rnd.Rand8() & 1) * mask
+                                      : rnd.Rand16() & mask;
+                memset(dst_ref_, 0, sizeof(dst_ref_));
+                memset(dst_tst_, 0, sizeof(dst_tst_));
+
+                eb_av1_highbd_convolve_horiz_rs_c(
+                    src_ + rs_border, rs_src_stride, dst_ref_, rs_dst_stride,
+                    w, h, &av1_resize_filter_normative[0][0], x0_qn, step,
+                    bd);
+                func_tst(src_ + rs_border, rs_src_stride, dst_tst_,
+                         rs_dst_stride, w, h,
+                         &av1_resize_filter_normative[0][0], x0_qn, step, bd);
+
+                ASSERT_EQ(0, memcmp(dst_ref_, dst_tst_, sizeof(dst_ref_)))
+                    << "bd " << bd << " denom " << denom << " w " << w
+                    << " h " << h << " x0_qn " << x0_qn;
+            }
+        }
+    }
+
+    uint16_t src_[rs_src_stride * (rs_max_h + 1)];
+    uint16_t dst_ref_[rs_dst_stride * rs_max_h];
+    uint16_t dst_tst_[rs_dst_stride * rs_max_h];
+};
+
+TEST_P(HbdConvolveHorizRsTest, MatchTest) {
+    run_test(100);
+}
+
+INSTANTIATE_TEST_CASE_P(
+    AVX2, HbdConvolveHorizRsTest,
+    ::testing::Combine(
+        ::testing::Values(eb_av1_highbd_convolve_horiz_rs_avx2),
+        ::testing::Values(10, 12)));
+
+#ifndef NON_AVX512_SUPPORT
+INSTANTIATE_TEST_CASE_P(
+    AVX512, HbdConvolveHorizRsTest,
+    ::testing::Combine(
+        ::testing::Values(eb_av1_highbd_convolve_horiz_rs_avx512),
+        ::testing::Values(10, 12)));
+#endif
+
+}  // namespace
@@ -449,6 +449,13 @@ INSTANTIATE_TEST_CASE_P(
     ::testing::Combine(::testing::Values(svt_av1_apply_temporal_filter_planewise_c),
                        ::testing::Values(svt_av1_apply_temporal_filter_planewise_avx2)));
 
+#ifndef NON_AVX512_SUPPORT
+INSTANTIATE_TEST_CASE_P(
+    AVX512, TemporalFilterTestPlanewise,
+    ::testing::Combine(::testing::Values(svt_av1_apply_temporal_filter_planewise_c),
+                       ::testing::Values(svt_av1_apply_temporal_filter_planewise_avx512)));
+#endif
+
 
 class TemporalFilterTestPlanewiseHbd
     : public ::testing::TestWithParam<TemporalFilterWithParamHbd> {
@@ -746,3 +753,11 @@ INSTANTIATE_TEST_CASE_P(
         ::testing::Values(svt_av1_apply_temporal_filter_planewise_hbd_c),
         ::testing::Values(svt_av1_apply_temporal_filter_planewise_hbd_avx2)));
 
+#ifndef NON_AVX512_SUPPORT
+INSTANTIATE_TEST_CASE_P(
+    AVX512, TemporalFilterTestPlanewiseHbd,
+    ::testing::Combine(
+        ::testing::Values(svt_av1_apply_temporal_filter_planewise_hbd_c),
+        ::testing::Values(svt_av1_apply_temporal_filter_planewise_hbd_avx512)));
+#endif
+
@@ -0,0 +1,484 @@
+/*
+ * Copyright(c) 2019 Netflix, Inc.
+ * SPDX - License - Identifier: BSD - 2 - Clause - Patent
+ */
+
+/******************************************************************************
+ * @file SvtAv1DecApiTest.cc
+ *
+ * @brief SVT-AV1 decoder api test, check incremental input and external
+ * frame buffers
+ *
+ ******************************************************************************/
+#include <algorithm>
+#include <map>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+#include "EbSvtAv1Enc.h"
+#include "EbSvtAv1Dec.h"
+#include "gtest/gtest.h"
+
+namespace {
+
+static const uint32_t width = 128;
+static const uint32_t height = 128;
+static const uint32_t frame_count = 6;
+
+typedef std::vector<uint8_t> Packet;
+typedef std::vector<uint8_t> Picture;
+
+/** Encode a short 8-bit 4:2:0 clip, one packet per temporal unit */
+static bool encode_stream(std::vector<Packet> &tus) {
+    EbComponentType *enc_handle = nullptr;
+    EbSvtAv1EncConfiguration enc_params;
+    memset(&enc_params, 0, sizeof(enc_params));
+    if (svt_av1_enc_init_handle(&enc_handle, nullptr, &enc_params) !=
+        EB_ErrorNone)
+        return false;
+    enc_params.enc_mode = 8;
+    enc_params.source_width = width;
+    enc_params.source_height = height;
+    enc_params.frame_rate = 30;
+    enc_params.intra_period_length = -1;
+    bool ok = svt_av1_enc_set_parameter(enc_handle, &enc_params) ==
+                  EB_ErrorNone &&
+              svt_av1_enc_init(enc_handle) == EB_ErrorNone;
+
+    std::vector<uint8_t> luma(width * height), cb(width * height / 4),
+        cr(width * height / 4);
+    EbSvtIOFormat frame;
+    memset(&frame, 0, sizeof(frame));
+    frame.luma = luma.data();
+    frame.cb = cb.data();
+    frame.cr = cr.data();
+    frame.y_stride = width;
+    frame.cb_stride = width / 2;
+    frame.cr_stride = width / 2;
+    frame.width = width;
+    frame.height = height;
+    frame.color_fmt = EB_YUV420;
+    frame.bit_depth = EB_EIGHT_BIT;
+
+    EbBufferHeaderType in_buf;
+    memset(&in_buf, 0, sizeof(in_buf));
+    in_buf.size = sizeof(in_buf);
+    in_buf.p_buffer = (uint8_t *)&frame;
+    in_buf.n_filled_len = width * height * 3 / 2;
+    in_buf.pic_type = EB_AV1_INVALID_PICTURE;
+
+    // moving gradient with some texture, so inter frames are not empty
+    for (uint32_t i = 0; ok && i < frame_count; i++) {
+        for (uint32_t y = 0; y < height; y++)
+            for (uint32_t x = 0; x < width; x++)
+                luma[y * width + x] =
+                    (uint8_t)(x + 2 * y + 3 * i + ((x * y) >> 5));
+        for (uint32_t y = 0; y < height / 2; y++)
+            for (uint32_t x = 0; x < width / 2; x++) {
+                cb[y * width / 2 + x] = (uint8_t)(128 + x - i);
+                cr[y * width / 2 + x] = (uint8_t)(128 + y + i);
+            }
+        in_buf.pts = i;
+        ok = svt_av1_enc_send_picture(enc_handle, &in_buf) == EB_ErrorNone;
+    }
+    if (ok) {
+        EbBufferHeaderType eos;
+        memset(&eos, 0, sizeof(eos));
+        eos.flags = EB_BUFFERFLAG_EOS;
+        ok = svt_av1_enc_send_picture(enc_handle, &eos) == EB_ErrorNone;
+    }
+
+    // a hidden alt ref is stored with the frame following it
+    Packet tu;
+    while (ok) {
+        EbBufferHeaderType *out_buf = nullptr;
+        EbErrorType ret = svt_av1_enc_get_packet(enc_handle, &out_buf, 1);
+        if (ret == EB_ErrorMax) {
+            ok = false;
+            break;
+        }
+        if (ret == EB_NoErrorEmptyQueue)
+            continue;
+        const uint32_t flags = out_buf->flags;
+        tu.insert(tu.end(),
+                  out_buf->p_buffer,
+                  out_buf->p_buffer + out_buf->n_filled_len);
+        svt_av1_enc_release_out_buffer(&out_buf);
+        if (!(flags & EB_BUFFERFLAG_IS_ALT_REF) && !tu.empty()) {
+            tus.push_back(tu);
+            tu.clear();
+        }
+        if (flags & EB_BUFFERFLAG_EOS)
+            break;
+    }
+
+    svt_av1_enc_deinit(enc_handle);
+    svt_av1_enc_deinit_handle(enc_handle);
+    return ok && !tus.empty();
+}
+
+/** Decoder handle together with an output picture buffer */
+class Decoder {
+  public:
+    Decoder() : handle_(nullptr) {
+        memset(&cfg_, 0, sizeof(cfg_));
+        memset(&io_, 0, sizeof(io_));
+        memset(&buf_, 0, sizeof(buf_));
+        io_.luma = (uint8_t *)malloc(width * height);
+        io_.cb = (uint8_t *)malloc(width * height / 4);
+        io_.cr = (uint8_t *)malloc(width * height / 4);
+        io_.y_stride = width;
+        io_.cb_stride = width / 2;
+        io_.cr_stride = width / 2;
+        io_.width = width;
+        io_.height = height;
+        buf_.p_buffer = (uint8_t *)&io_;
+    }
+    ~Decoder() {
+        if (handle_) {
+            svt_av1_dec_deinit(handle_);
+            svt_av1_dec_deinit_handle(handle_);
+        }
+        free(io_.luma);
+        free(io_.cb);
+        free(io_.cr);
+    }
+    bool init() {
+        if (svt_av1_dec_init_handle(&handle_, nullptr, &cfg_) != EB_ErrorNone)
+            return false;
+        io_.bit_depth = cfg_.max_bit_depth;
+        return svt_av1_dec_set_parameter(handle_, &cfg_) == EB_ErrorNone &&
+               svt_av1_dec_init(handle_) == EB_ErrorNone;
+    }
+    /** Append the next output picture to pics, if there is one */
+    bool get_picture(std::vector<Picture> &pics) {
+        EbAV1StreamInfo stream_info;
+        EbAV1FrameInfo frame_info;
+        if (svt_av1_dec_get_picture(
+                handle_, &buf_, &stream_info, &frame_info) != EB_ErrorNone)
+            return false;
+        Picture pic(io_.luma, io_.luma + width * height);
+        pic.insert(pic.end(), io_.cb, io_.cb + width * height / 4);
+        pic.insert(pic.end(), io_.cr, io_.cr + width * height / 4);
+        pics.push_back(pic);
+        return true;
+    }
+    EbComponentType *handle() {
+        return handle_;
+    }
+
+  private:
+    EbComponentType *handle_;
+    EbSvtAv1DecConfiguration cfg_;
+    EbSvtIOFormat io_;
+    EbBufferHeaderType buf_;
+};
+
+/** Frame buffer allocator for the decoder, refuses buffers past its budget */
+class FrameBufPool {
+  public:
+    explicit FrameBufPool(size_t budget)
+        : budget_(budget), alloc_count_(0), release_count_(0) {
+    }
+    ~FrameBufPool() {
+        for (auto &live : live_)
+            free(live.second.raw);
+    }
+    static int alloc(EbExtFrameBuf *fb, uint32_t min_size, void *priv) {
+        FrameBufPool *pool = (FrameBufPool *)priv;
+        if (pool->live_.size() >= pool->budget_)
+            return -1;
+        uint8_t *raw = (uint8_t *)malloc(min_size + 31);
+        if (!raw)
+            return -1;
+        fb->buffer = (uint8_t *)(((uintptr_t)raw + 31) & ~(uintptr_t)31);
+        fb->buffer_size = min_size;
+        fb->private_data = raw;
+        pool->live_[fb->buffer] = {raw, min_size};
+        pool->alloc_count_++;
+        return 0;
+    }
+    static int release(EbExtFrameBuf *fb, void *priv) {
+        FrameBufPool *pool = (FrameBufPool *)priv;
+        auto live = pool->live_.find(fb->buffer);
+        if (live == pool->live_.end() || live->second.raw != fb->private_data)
+            return -1;
+        free(live->second.raw);
+        pool->live_.erase(live);
+        pool->release_count_++;
+        return 0;
+    }
+    /** private_data of the live buffer holding ptr, nullptr if none */
+    void *owner(const uint8_t *ptr) const {
+        for (auto &live : live_)
+            if (ptr >= live.first && ptr < live.first + live.second.size)
+                return live.second.raw;
+        return nullptr;
+    }
+    size_t live_count() const {
+        return live_.size();
+    }
+    size_t alloc_count() const {
+        return alloc_count_;
+    }
+    size_t release_count() const {
+        return release_count_;
+    }
+
+  private:
+    typedef struct LiveBuf {
+        uint8_t *raw;
+        uint32_t size;
+    } LiveBuf;
+    size_t budget_;
+    size_t alloc_count_;
+    size_t release_count_;
+    std::map<uint8_t *, LiveBuf> live_;
+};
+
+/** Decoder handle using a FrameBufPool, the output planes are not owned */
+class ExtBufDecoder {
+  public:
+    explicit ExtBufDecoder(FrameBufPool &pool) : pool_(pool), handle_(nullptr) {
+        memset(&io_, 0, sizeof(io_));
+        memset(&buf_, 0, sizeof(buf_));
+        buf_.p_buffer = (uint8_t *)&io_;
+    }
+    ~ExtBufDecoder() {
+        deinit();
+    }
+    bool init() {
+        EbSvtAv1DecConfiguration cfg;
+        memset(&cfg, 0, sizeof(cfg));
+        if (svt_av1_dec_init_handle(&handle_, nullptr, &cfg) != EB_ErrorNone)
+            return false;
+        // the first picture goes to the copy path when planes do not match
+        io_.color_fmt = EB_YUV420;
+        io_.bit_depth = cfg.max_bit_depth;
+        return svt_av1_dec_set_parameter(handle_, &cfg) == EB_ErrorNone &&
+               svt_av1_dec_init(handle_) == EB_ErrorNone &&
+               svt_av1_dec_set_frame_buffer_functions(handle_,
+                                                      FrameBufPool::alloc,
+                                                      FrameBufPool::release,
+                                                      &pool_) == EB_ErrorNone;
+    }
+    void deinit() {
+        if (handle_) {
+            svt_av1_dec_deinit(handle_);
+            svt_av1_dec_deinit_handle(handle_);
+            handle_ = nullptr;
+        }
+    }
+    EbComponentType *handle() {
+        return handle_;
+    }
+    EbBufferHeaderType &buf() {
+        return buf_;
+    }
+    /** Copy of the output picture, row by row */
+    Picture picture() const {
+        Picture pic;
+        for (uint32_t y = 0; y < height; y++)
+            pic.insert(pic.end(),
+                       io_.luma + y * io_.y_stride,
+                       io_.luma + y * io_.y_stride + width);
+        for (uint32_t y = 0; y < height / 2; y++)
+            pic.insert(pic.end(),
+                       io_.cb + y * io_.cb_stride,
+                       io_.cb + y * io_.cb_stride + width / 2);
+        for (uint32_t y = 0; y < height / 2; y++)
+            pic.insert(pic.end(),
+                       io_.cr + y * io_.cr_stride,
+                       io_.cr + y * io_.cr_stride + width / 2);
+        return pic;
+    }
+    const EbSvtIOFormat &io() const {
+        return io_;
+    }
+
+  private:
+    FrameBufPool &pool_;
+    EbComponentType *handle_;
+    EbSvtIOFormat io_;
+    EbBufferHeaderType buf_;
+};
+
+/** @brief feed_in_pieces is a api test case
+ * DecApiTest.feed_in_pieces checks that svt_av1_dec_feed produces the same
+ * pictures as svt_av1_dec_frame, whatever the size of the input pieces
+ *
+ * Test strategy: <br>
+ * Encode a short clip with the encoder api, decode it one temporal unit at a
+ * time with svt_av1_dec_frame, then feed the whole stream to a new decoder in
+ * pieces of 1, 13 and 4096 bytes with svt_av1_dec_feed. A piece boundary
+ * falls inside OBU headers, OBU sizes and tile data.
+ *
+ * Expected result: <br>
+ * svt_av1_dec_feed returns a picture for each shown frame, in the same order
+ * and with the same content as the reference decode, and asks for more data
+ * when the stream is incomplete.
+ *
+ * Test coverage:
+ * svt_av1_dec_feed, svt_av1_dec_get_picture.
+ */
+TEST(DecApiTest, feed_in_pieces) {
+    std::vector<Packet> tus;
+    ASSERT_TRUE(encode_stream(tus));
+
+    std::vector<Picture> ref_pics;
+    Packet stream;
+    {
+        Decoder dec;
+        ASSERT_TRUE(dec.init());
+        for (const Packet &tu : tus) {
+            ASSERT_EQ(EB_ErrorNone,
+                      svt_av1_dec_frame(dec.handle(), tu.data(), tu.size(), 0));
+            dec.get_picture(ref_pics);
+            stream.insert(stream.end(), tu.begin(), tu.end());
+        }
+    }
+    ASSERT_EQ(frame_count, ref_pics.size());
+
+    const size_t piece_sizes[] = {1, 13, 4096};
+    for (const size_t piece : piece_sizes) {
+        SCOPED_TRACE(piece);
+        Decoder dec;
+        ASSERT_TRUE(dec.init());
+        std::vector<Picture> pics;
+        for (size_t pos = 0; pos < stream.size(); pos += piece) {
+            const size_t size = std::min(piece, stream.size() - pos);
+            EbErrorType ret =
+                svt_av1_dec_feed(dec.handle(), stream.data() + pos, size, 0);
+            // drain the pictures completed by the data buffered so far
+            while (ret == EB_ErrorNone) {
+                ASSERT_TRUE(dec.get_picture(pics));
+                ret = svt_av1_dec_feed(dec.handle(), nullptr, 0, 0);
+            }
+            ASSERT_EQ(EB_DecNoOutputPicture, ret);
+        }
+        ASSERT_EQ(ref_pics.size(), pics.size());
+        for (size_t i = 0; i < pics.size(); i++)
+            EXPECT_TRUE(pics[i] == ref_pics[i]) << "picture " << i;
+    }
+}
+
+/** @brief ext_frame_buf_zero_copy is a api test case
+ * DecApiTest.ext_frame_buf_zero_copy checks that the decoder outputs the
+ * pictures held in external frame buffers without a copy and returns every
+ * buffer to the application
+ *
+ * Test strategy: <br>
+ * Encode a short clip with the encoder api and decode it with the decoder
+ * copying its output. Decode it again with frame buffer callbacks that track
+ * the buffers handed out.
+ *
+ * Expected result: <br>
+ * Every output picture is reported as ext_frame_buf, its planes lie
+ * in a buffer handed out and not released, p_app_private is the private data
+ * of that buffer, and the content is the one of the copying decoder. All the
+ * buffers are released by svt_av1_dec_deinit.
+ *
+ * Test coverage:
+ * svt_av1_dec_set_frame_buffer_functions, svt_av1_dec_get_picture.
+ */
+TEST(DecApiTest, ext_frame_buf_zero_copy) {
+    std::vector<Packet> tus;
+    ASSERT_TRUE(encode_stream(tus));
+
+    std::vector<Picture> ref_pics;
+    {
+        Decoder dec;
+        ASSERT_TRUE(dec.init());
+        for (const Packet &tu : tus) {
+            ASSERT_EQ(EB_ErrorNone,
+                      svt_av1_dec_frame(dec.handle(), tu.data(), tu.size(), 0));
+            ASSERT_TRUE(dec.get_picture(ref_pics));
+        }
+    }
+
+    FrameBufPool pool(64);
+    {
+        ExtBufDecoder dec(pool);
+        ASSERT_TRUE(dec.init());
+        for (size_t i = 0; i < tus.size(); i++) {
+            SCOPED_TRACE(i);
+            EbAV1StreamInfo stream_info;
+            EbAV1FrameInfo frame_info;
+            ASSERT_EQ(EB_ErrorNone,
+                      svt_av1_dec_frame(
+                          dec.handle(), tus[i].data(), tus[i].size(), 0));
+            ASSERT_EQ(EB_ErrorNone,
+                      svt_av1_dec_get_picture(
+                          dec.handle(), &dec.buf(), &stream_info, &frame_info));
+            EXPECT_TRUE(frame_info.ext_frame_buf);
+            void *owner = pool.owner(dec.io().luma);
+            ASSERT_NE(nullptr, owner);
+            EXPECT_EQ(owner, pool.owner(dec.io().cb));
+            EXPECT_EQ(owner, pool.owner(dec.io().cr));
+            EXPECT_EQ(owner, dec.buf().p_app_private);
+            EXPECT_TRUE(dec.picture() == ref_pics[i]);
+        }
+        EXPECT_LT(0u, pool.live_count());
+        dec.deinit();
+    }
+    EXPECT_EQ(0u, pool.live_count());
+    EXPECT_EQ(pool.alloc_count(), pool.release_count());
+}
+
+/** @brief ext_frame_buf_refused is a api test case
+ * DecApiTest.ext_frame_buf_refused checks that the decoder reports a frame
+ * buffer the application refuses instead of decoding into it
+ *
+ * Test strategy: <br>
+ * Encode a short clip with the encoder api and decode it with frame buffer
+ * callbacks refusing every buffer, then refusing all but the first one.
+ * Decoding stops at the first frame that gets no buffer.
+ *
+ * Expected result: <br>
+ * svt_av1_dec_frame returns EB_ErrorInsufficientResources for the frame
+ * that gets no buffer, and the frames decoded before are output. The
+ * buffers handed out are all released by svt_av1_dec_deinit.
+ *
+ * Test coverage:
+ * svt_av1_dec_set_frame_buffer_functions, svt_av1_dec_frame.
+ */
+TEST(DecApiTest, ext_frame_buf_refused) {
+    std::vector<Packet> tus;
+    ASSERT_TRUE(encode_stream(tus));
+
+    const size_t budgets[] = {0, 1};
+    for (const size_t budget : budgets) {
+        SCOPED_TRACE(budget);
+        FrameBufPool pool(budget);
+        {
+            ExtBufDecoder dec(pool);
+            ASSERT_TRUE(dec.init());
+            for (size_t i = 0; i < tus.size(); i++) {
+                SCOPED_TRACE(i);
+                EbAV1StreamInfo stream_info;
+                EbAV1FrameInfo frame_info;
+                const EbErrorType ret = svt_av1_dec_frame(
+                    dec.handle(), tus[i].data(), tus[i].size(), 0);
+                if (i < budget) {
+                    ASSERT_EQ(EB_ErrorNone, ret);
+                    EXPECT_EQ(EB_ErrorNone,
+                              svt_av1_dec_get_picture(dec.handle(),
+                                                      &dec.buf(),
+                                                      &stream_info,
+                                                      &frame_info));
+                } else {
+                    // the following frames would miss their references
+                    EXPECT_EQ(EB_ErrorInsufficientResources, ret);
+                    break;
+                }
+            }
+            EXPECT_EQ(budget, pool.alloc_count());
+            dec.deinit();
+        }
+        EXPECT_EQ(0u, pool.live_count());
+        EXPECT_EQ(pool.alloc_count(), pool.release_count());
+    }
+}
+
+}  // namespace
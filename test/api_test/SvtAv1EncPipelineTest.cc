@@ -0,0 +1,496 @@
+/*
+ * Copyright(c) 2019 Netflix, Inc.
+ * SPDX - License - Identifier: BSD - 2 - Clause - Patent
+ */
+
+/******************************************************************************
+ * @file SvtAv1EncPipelineTest.cc
+ *
+ * @brief SVT-AV1 encoder api test, check the output of the encoder pipeline
+ * against the decoder and against other encoder configurations
+ *
+ ******************************************************************************/
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+#include "EbSvtAv1Enc.h"
+#include "EbSvtAv1Dec.h"
+#include "gtest/gtest.h"
+
+namespace {
+
+static const uint32_t width = 256;
+static const uint32_t height = 256;
+static const uint32_t frame_size = width * height * 3 / 2;
+static const uint32_t frame_count = 6;
+
+typedef std::vector<uint8_t> Packet;
+typedef std::vector<uint8_t> Picture;
+
+/** Encoder settings the tests vary, the rest are the api defaults */
+typedef struct EncSettings {
+    uint8_t enc_mode;
+    EbBool is_16bit_pipeline;
+    int32_t tile_rows;
+    int32_t tile_columns;
+    uint32_t logical_processors;
+    EbBool subframe_output;
+    uint8_t enable_tpl_la;
+    EbBool enable_global_motion;
+} EncSettings;
+
+/** Output of an encode: the temporal units, the packets they are made of with
+ * their flags, and the recon pictures by pts */
+typedef struct EncOutput {
+    std::vector<Packet> tus;
+    std::vector<Packet> packets;
+    std::vector<uint32_t> packet_flags;
+    std::vector<Picture> recon;
+} EncOutput;
+
+/** Store the recon pictures available so far, returns false after the last
+ * one. The recon of a shown frame comes after the recon of its alt ref. */
+static bool drain_recon(EbComponentType *enc_handle,
+                        EbBufferHeaderType &recon_buf, EncOutput &out,
+                        bool &ok) {
+    EbErrorType ret;
+    while ((ret = svt_av1_get_recon(enc_handle, &recon_buf)) ==
+           EB_ErrorNone) {
+        if (recon_buf.pts >= frame_count ||
+            recon_buf.n_filled_len != frame_size) {
+            ok = false;
+            return false;
+        }
+        out.recon[recon_buf.pts].assign(
+            recon_buf.p_buffer, recon_buf.p_buffer + frame_size);
+        if (recon_buf.flags & EB_BUFFERFLAG_EOS)
+            return false;
+    }
+    ok = ok && ret == EB_NoErrorEmptyQueue;
+    return ok;
+}
+
+/** Encode a short 8-bit 4:2:0 clip with the recon enabled */
+static bool encode_clip(const EncSettings &settings, EncOutput &out) {
+    EbComponentType *enc_handle = nullptr;
+    EbSvtAv1EncConfiguration enc_params;
+    memset(&enc_params, 0, sizeof(enc_params));
+    if (svt_av1_enc_init_handle(&enc_handle, nullptr, &enc_params) !=
+        EB_ErrorNone)
+        return false;
+    enc_params.enc_mode = settings.enc_mode;
+    enc_params.is_16bit_pipeline = settings.is_16bit_pipeline;
+    enc_params.tile_rows = settings.tile_rows;
+    enc_params.tile_columns = settings.tile_columns;
+    enc_params.logical_processors = settings.logical_processors;
+    enc_params.subframe_output = settings.subframe_output;
+    enc_params.enable_tpl_la = settings.enable_tpl_la;
+    enc_params.enable_global_motion = settings.enable_global_motion;
+    enc_params.source_width = width;
+    enc_params.source_height = height;
+    enc_params.frame_rate = 30;
+    enc_params.intra_period_length = -1;
+    enc_params.recon_enabled = EB_TRUE;
+    bool ok = svt_av1_enc_set_parameter(enc_handle, &enc_params) ==
+                  EB_ErrorNone &&
+              svt_av1_enc_init(enc_handle) == EB_ErrorNone;
+
+    std::vector<uint8_t> luma(width * height), cb(width * height / 4),
+        cr(width * height / 4);
+    EbSvtIOFormat frame;
+    memset(&frame, 0, sizeof(frame));
+    frame.luma = luma.data();
+    frame.cb = cb.data();
+    frame.cr = cr.data();
+    frame.y_stride = width;
+    frame.cb_stride = width / 2;
+    frame.cr_stride = width / 2;
+    frame.width = width;
+    frame.height = height;
+    frame.color_fmt = EB_YUV420;
+    frame.bit_depth = EB_EIGHT_BIT;
+
+    EbBufferHeaderType in_buf;
+    memset(&in_buf, 0, sizeof(in_buf));
+    in_buf.size = sizeof(in_buf);
+    in_buf.p_buffer = (uint8_t *)&frame;
+    in_buf.n_filled_len = frame_size;
+    in_buf.pic_type = EB_AV1_INVALID_PICTURE;
+
+    // moving texture with sharp edges, so the loop filters have work to do
+    for (uint32_t i = 0; ok && i < frame_count; i++) {
+        for (uint32_t y = 0; y < height; y++)
+            for (uint32_t x = 0; x < width; x++)
+                luma[y * width + x] =
+                    (uint8_t)(x + 2 * y + 3 * i + ((x * y) >> 5) +
+                              ((((x + i) >> 3) ^ (y >> 3)) & 1) * 64);
+        for (uint32_t y = 0; y < height / 2; y++)
+            for (uint32_t x = 0; x < width / 2; x++) {
+                cb[y * width / 2 + x] = (uint8_t)(128 + x - i);
+                cr[y * width / 2 + x] = (uint8_t)(128 + y + i);
+            }
+        in_buf.pts = i;
+        ok = svt_av1_enc_send_picture(enc_handle, &in_buf) == EB_ErrorNone;
+    }
+    if (ok) {
+        EbBufferHeaderType eos;
+        memset(&eos, 0, sizeof(eos));
+        eos.flags = EB_BUFFERFLAG_EOS;
+        ok = svt_av1_enc_send_picture(enc_handle, &eos) == EB_ErrorNone;
+    }
+
+    EbBufferHeaderType recon_buf;
+    memset(&recon_buf, 0, sizeof(recon_buf));
+    recon_buf.size = sizeof(recon_buf);
+    Picture recon(frame_size);
+    recon_buf.p_buffer = recon.data();
+    recon_buf.n_alloc_len = frame_size;
+    out.recon.assign(frame_count, Picture());
+
+    // a hidden alt ref is stored with the frame following it, the chunks of a
+    // partial temporal unit with the packet completing it
+    Packet tu;
+    bool recon_done = false;
+    while (ok) {
+        recon_done = recon_done || !drain_recon(enc_handle, recon_buf, out, ok);
+
+        EbBufferHeaderType *out_buf = nullptr;
+        EbErrorType ret = svt_av1_enc_get_packet(enc_handle, &out_buf, 1);
+        if (ret == EB_ErrorMax) {
+            ok = false;
+            break;
+        }
+        if (ret == EB_NoErrorEmptyQueue)
+            continue;
+        const uint32_t flags = out_buf->flags;
+        out.packets.push_back(Packet(
+            out_buf->p_buffer, out_buf->p_buffer + out_buf->n_filled_len));
+        out.packet_flags.push_back(flags);
+        tu.insert(tu.end(),
+                  out_buf->p_buffer,
+                  out_buf->p_buffer + out_buf->n_filled_len);
+        svt_av1_enc_release_out_buffer(&out_buf);
+        if (!(flags & (EB_BUFFERFLAG_IS_ALT_REF | EB_BUFFERFLAG_PARTIAL_TU)) &&
+            !tu.empty()) {
+            out.tus.push_back(tu);
+            tu.clear();
+        }
+        if (flags & EB_BUFFERFLAG_EOS)
+            break;
+    }
+
+    // the recon of the last frames may follow the last packet
+    while (ok && !recon_done)
+        recon_done = !drain_recon(enc_handle, recon_buf, out, ok);
+
+    svt_av1_enc_deinit(enc_handle);
+    svt_av1_enc_deinit_handle(enc_handle);
+    return ok && out.tus.size() == frame_count;
+}
+
+/** Decode the temporal units, one picture per shown frame. With feed set the
+ * packets, which may hold parts of temporal units, go through
+ * svt_av1_dec_feed on a decoder with 2 threads, which keeps the tiles of a
+ * frame buffered until its last tile group arrives. */
+static bool decode_clip(const std::vector<Packet> &tus,
+                        std::vector<Picture> &pics, bool feed = false) {
+    EbComponentType *dec_handle = nullptr;
+    EbSvtAv1DecConfiguration dec_params;
+    memset(&dec_params, 0, sizeof(dec_params));
+    if (svt_av1_dec_init_handle(&dec_handle, nullptr, &dec_params) !=
+        EB_ErrorNone)
+        return false;
+    if (feed)
+        dec_params.threads = 2;
+    bool ok = svt_av1_dec_set_parameter(dec_handle, &dec_params) ==
+                  EB_ErrorNone &&
+              svt_av1_dec_init(dec_handle) == EB_ErrorNone;
+
+    Picture pic(frame_size);
+    EbSvtIOFormat io;
+    memset(&io, 0, sizeof(io));
+    io.luma = pic.data();
+    io.cb = io.luma + width * height;
+    io.cr = io.cb + width * height / 4;
+    io.y_stride = width;
+    io.cb_stride = width / 2;
+    io.cr_stride = width / 2;
+    io.width = width;
+    io.height = height;
+    io.color_fmt = EB_YUV420;
+    io.bit_depth = dec_params.max_bit_depth;
+    EbBufferHeaderType buf;
+    memset(&buf, 0, sizeof(buf));
+    buf.p_buffer = (uint8_t *)&io;
+
+    for (size_t i = 0; ok && i < tus.size(); i++) {
+        EbAV1StreamInfo stream_info;
+        EbAV1FrameInfo frame_info;
+        if (!feed) {
+            ok = svt_av1_dec_frame(
+                     dec_handle, tus[i].data(), tus[i].size(), 0) ==
+                     EB_ErrorNone &&
+                 svt_av1_dec_get_picture(dec_handle,
+                                         &buf,
+                                         &stream_info,
+                                         &frame_info) == EB_ErrorNone;
+            if (ok)
+                pics.push_back(pic);
+            continue;
+        }
+        EbErrorType ret =
+            svt_av1_dec_feed(dec_handle, tus[i].data(), tus[i].size(), 0);
+        // drain the pictures completed by the data buffered so far
+        while (ok && ret == EB_ErrorNone) {
+            ok = svt_av1_dec_get_picture(
+                     dec_handle, &buf, &stream_info, &frame_info) ==
+                 EB_ErrorNone;
+            if (ok)
+                pics.push_back(pic);
+            ret = svt_av1_dec_feed(dec_handle, nullptr, 0, 0);
+        }
+        ok = ok && ret == EB_DecNoOutputPicture;
+    }
+
+    svt_av1_dec_deinit(dec_handle);
+    svt_av1_dec_deinit_handle(dec_handle);
+    return ok;
+}
+
+/** @brief dlf_multi_tile_recon is a api test case
+ * EncPipelineTest.dlf_multi_tile_recon checks the pictures the DLF processes
+ * filter with loop_filter_mode 1 when the picture has several tiles, in the
+ * 8-bit and in the 16-bit pipeline
+ *
+ * Test strategy: <br>
+ * Encode a clip with 2x2 tiles in a preset using loop_filter_mode 1 for the
+ * reference pictures, once per pipeline. The DLF processes filter the SB
+ * rows of a picture in parallel once EncDec is done. Decode the bitstream,
+ * the decoder filters each picture serially.
+ *
+ * Expected result: <br>
+ * The recon of each frame is the decoded picture, and both pipelines give the
+ * same bitstream with one and with all the logical processors.
+ *
+ * Test coverage:
+ * DLF process, svt_av1_get_recon.
+ */
+TEST(EncPipelineTest, dlf_multi_tile_recon) {
+    const EbBool pipelines[] = {EB_FALSE, EB_TRUE};
+    for (const EbBool is_16bit_pipeline : pipelines) {
+        SCOPED_TRACE(is_16bit_pipeline ? "16-bit pipeline" : "8-bit pipeline");
+        EncSettings settings = {8, is_16bit_pipeline, 1, 1, 0};
+        EncOutput enc;
+        ASSERT_TRUE(encode_clip(settings, enc));
+        std::vector<Picture> pics;
+        ASSERT_TRUE(decode_clip(enc.tus, pics));
+        ASSERT_EQ(frame_count, pics.size());
+        for (uint32_t i = 0; i < frame_count; i++)
+            EXPECT_TRUE(enc.recon[i] == pics[i]) << "frame " << i;
+
+        settings.logical_processors = 1;
+        EncOutput serial_enc;
+        ASSERT_TRUE(encode_clip(settings, serial_enc));
+        EXPECT_TRUE(serial_enc.tus == enc.tus);
+    }
+}
+
+/** @brief cdef_restoration_search_serial is a api test case
+ * EncPipelineTest.cdef_restoration_search_serial checks the CDEF strength
+ * search and the restoration type search split into task pool tasks pick
+ * what the serial search picks
+ *
+ * Test strategy: <br>
+ * Encode a clip in a preset searching the CDEF strengths and the restoration
+ * types, with one logical processor, where the tasks run one after the other
+ * on the calling thread, and with all the logical processors. Decode the
+ * bitstream of the parallel encode.
+ *
+ * Expected result: <br>
+ * Both encodes give the same bitstream, and the recon of each frame is the
+ * decoded picture.
+ *
+ * Test coverage:
+ * CDEF process, restoration process.
+ */
+TEST(EncPipelineTest, cdef_restoration_search_serial) {
+    EncSettings settings = {4, EB_FALSE, 0, 0, 1};
+    EncOutput serial_enc;
+    ASSERT_TRUE(encode_clip(settings, serial_enc));
+
+    settings.logical_processors = 0;
+    EncOutput enc;
+    ASSERT_TRUE(encode_clip(settings, enc));
+    EXPECT_TRUE(serial_enc.tus == enc.tus);
+
+    std::vector<Picture> pics;
+    ASSERT_TRUE(decode_clip(enc.tus, pics));
+    ASSERT_EQ(frame_count, pics.size());
+    for (uint32_t i = 0; i < frame_count; i++)
+        EXPECT_TRUE(enc.recon[i] == pics[i]) << "frame " << i;
+}
+
+/** @brief entropy_multi_tile is a api test case
+ * EncPipelineTest.entropy_multi_tile checks the tiles of a picture entropy
+ * coded by several entropy coding processes give the bitstream of a single
+ * process
+ *
+ * Test strategy: <br>
+ * Encode a clip with 4 tile rows, one per SB row, so each tile resets its own
+ * coder and neighbor arrays. With one logical processor one entropy coding
+ * process codes the tiles in order, with all the logical processors there is
+ * a process per tile. Decode the bitstream of the parallel encode.
+ *
+ * Expected result: <br>
+ * Both encodes give the same bitstream, and the recon of each frame is the
+ * decoded picture.
+ *
+ * Test coverage:
+ * Entropy coding process, packetization of the tiles.
+ */
+TEST(EncPipelineTest, entropy_multi_tile) {
+    EncSettings settings = {8, EB_FALSE, 2, 0, 1};
+    EncOutput serial_enc;
+    ASSERT_TRUE(encode_clip(settings, serial_enc));
+
+    settings.logical_processors = 0;
+    EncOutput enc;
+    ASSERT_TRUE(encode_clip(settings, enc));
+    EXPECT_TRUE(serial_enc.tus == enc.tus);
+
+    std::vector<Picture> pics;
+    ASSERT_TRUE(decode_clip(enc.tus, pics));
+    ASSERT_EQ(frame_count, pics.size());
+    for (uint32_t i = 0; i < frame_count; i++)
+        EXPECT_TRUE(enc.recon[i] == pics[i]) << "frame " << i;
+}
+
+/** @brief subframe_output_chunks is a api test case
+ * EncPipelineTest.subframe_output_chunks checks the packets of sub-frame
+ * output with several tiles make up the temporal units of the picture
+ * and decode incrementally
+ *
+ * Test strategy: <br>
+ * Encode a clip with 2x2 tiles and subframe_output, so the tiles of a frame
+ * are sent in packets flagged EB_BUFFERFLAG_PARTIAL_TU as they are entropy
+ * coded. Join the packets of each temporal unit and decode it. Feed the same
+ * packets one by one to svt_av1_dec_feed on a multi-threaded decoder, which
+ * holds the tile data of a frame while its buffer grows.
+ *
+ * Expected result: <br>
+ * Some packets are partial and every temporal unit ends with a packet that is
+ * not. The first packet of a temporal unit starts with a temporal delimiter
+ * and is flagged EB_BUFFERFLAG_HAS_TD, the other packets are not. Both decodes
+ * give the recon of each frame.
+ *
+ * Test coverage:
+ * Packetization process, svt_av1_enc_get_packet, svt_av1_dec_feed.
+ */
+TEST(EncPipelineTest, subframe_output_chunks) {
+    EncSettings settings = {8, EB_FALSE, 1, 1, 0, EB_TRUE};
+    EncOutput enc;
+    ASSERT_TRUE(encode_clip(settings, enc));
+
+    size_t partial_count = 0;
+    bool tu_start = true;
+    for (size_t i = 0; i < enc.packets.size(); i++) {
+        SCOPED_TRACE(i);
+        const uint32_t flags = enc.packet_flags[i];
+        const Packet &packet = enc.packets[i];
+        // the packet completing a temporal unit is empty when all its tiles
+        // were sent
+        const bool has_td =
+            packet.size() >= 2 && packet[0] == 0x12 && packet[1] == 0x00;
+        EXPECT_EQ(tu_start, has_td);
+        EXPECT_EQ(tu_start, (flags & EB_BUFFERFLAG_HAS_TD) != 0);
+        if (flags & EB_BUFFERFLAG_PARTIAL_TU)
+            partial_count++;
+        // the next temporal unit starts after a complete one
+        tu_start = !(flags &
+                     (EB_BUFFERFLAG_PARTIAL_TU | EB_BUFFERFLAG_IS_ALT_REF));
+    }
+    EXPECT_TRUE(tu_start);
+    EXPECT_LT(0u, partial_count);
+
+    std::vector<Picture> pics;
+    ASSERT_TRUE(decode_clip(enc.tus, pics));
+    ASSERT_EQ(frame_count, pics.size());
+    for (uint32_t i = 0; i < frame_count; i++)
+        EXPECT_TRUE(enc.recon[i] == pics[i]) << "frame " << i;
+
+    std::vector<Picture> fed_pics;
+    ASSERT_TRUE(decode_clip(enc.packets, fed_pics, true));
+    ASSERT_EQ(frame_count, fed_pics.size());
+    for (uint32_t i = 0; i < frame_count; i++)
+        EXPECT_TRUE(enc.recon[i] == fed_pics[i]) << "frame " << i;
+}
+
+/** @brief tpl_dispenser_serial is a api test case
+ * EncPipelineTest.tpl_dispenser_serial checks the TPL dispenser running the
+ * SB rows of a picture as task pool tasks gives the stats of the serial
+ * dispenser
+ *
+ * Test strategy: <br>
+ * Encode a clip with TPL in the look ahead, with one logical processor, where
+ * the rows run one after the other on the calling thread, and with all the
+ * logical processors. Decode the bitstream of the parallel encode.
+ *
+ * Expected result: <br>
+ * Both encodes give the same bitstream, and the recon of each frame is the
+ * decoded picture.
+ *
+ * Test coverage:
+ * Initial rate control process, TPL.
+ */
+TEST(EncPipelineTest, tpl_dispenser_serial) {
+    EncSettings settings = {8, EB_FALSE, 0, 0, 1, EB_FALSE, 1};
+    EncOutput serial_enc;
+    ASSERT_TRUE(encode_clip(settings, serial_enc));
+
+    settings.logical_processors = 0;
+    EncOutput enc;
+    ASSERT_TRUE(encode_clip(settings, enc));
+    EXPECT_TRUE(serial_enc.tus == enc.tus);
+
+    std::vector<Picture> pics;
+    ASSERT_TRUE(decode_clip(enc.tus, pics));
+    ASSERT_EQ(frame_count, pics.size());
+    for (uint32_t i = 0; i < frame_count; i++)
+        EXPECT_TRUE(enc.recon[i] == pics[i]) << "frame " << i;
+}
+
+/** @brief global_motion_serial is a api test case
+ * EncPipelineTest.global_motion_serial checks the global motion search with
+ * its models searched as task pool tasks picks what the serial search picks
+ *
+ * Test strategy: <br>
+ * Encode a clip with global motion enabled in a preset computing it, with one
+ * logical processor, where the model searches run one after the other on the
+ * calling thread, and with all the logical processors. Decode the bitstream
+ * of the parallel encode.
+ *
+ * Expected result: <br>
+ * Both encodes give the same bitstream, and the recon of each frame is the
+ * decoded picture.
+ *
+ * Test coverage:
+ * Motion estimation process, global motion estimation.
+ */
+TEST(EncPipelineTest, global_motion_serial) {
+    EncSettings settings = {6, EB_FALSE, 0, 0, 1, EB_FALSE, 0, EB_TRUE};
+    EncOutput serial_enc;
+    ASSERT_TRUE(encode_clip(settings, serial_enc));
+
+    settings.logical_processors = 0;
+    EncOutput enc;
+    ASSERT_TRUE(encode_clip(settings, enc));
+    EXPECT_TRUE(serial_enc.tus == enc.tus);
+
+    std::vector<Picture> pics;
+    ASSERT_TRUE(decode_clip(enc.tus, pics));
+    ASSERT_EQ(frame_count, pics.size());
+    for (uint32_t i = 0; i < frame_count; i++)
+        EXPECT_TRUE(enc.recon[i] == pics[i]) << "frame " << i;
+}
+
+}  // namespace
@@ -0,0 +1,42 @@
+#!/bin/sh
+#
+# Copyright(c) 2019 Intel Corporation
+# SPDX - License - Identifier: BSD - 2 - Clause - Patent
+#
+
+# Input throughput benchmark for SvtAv1EncApp.
+# Copies the input into tmpfs so the disk is out of the picture, then encodes it
+# with the default fread() input path and with --mmap-input, and prints the
+# average speed of each run.
+#
+# usage: enc_input_tmpfs.sh <SvtAv1EncApp> <input.y4m|input.yuv> [extra encoder options]
+# e.g.   enc_input_tmpfs.sh Bin/Release/SvtAv1EncApp park_joy_1080p.y4m --preset 8 -n 300
+
+set -e
+
+die() {
+    printf '%s\n' "$@" >&2
+    exit 1
+}
+
+[ $# -ge 2 ] || die "usage: $0 <SvtAv1EncApp> <input> [extra encoder options]"
+app=$1
+input=$2
+shift 2
+
+tmpfs_dir=${TMPFS_DIR:-/dev/shm}
+[ -d "$tmpfs_dir" ] || die "tmpfs directory $tmpfs_dir not found, set TMPFS_DIR"
+read_ahead=${MMAP_READ_AHEAD:-8}
+
+tmp_input="$tmpfs_dir/svt_enc_input_bench.${input##*.}"
+trap 'rm -f "$tmp_input"' EXIT INT TERM
+cp "$input" "$tmp_input"
+
+run() {
+    "$app" -i "$tmp_input" -b /dev/null "$@" 2>&1 | grep -E "Average Speed|Total Encoding Time"
+}
+
+printf '%s\n' "fread input:"
+run "$@"
+printf '%s\n' "mmap input, $read_ahead frames read-ahead:"
+run --mmap-input "$read_ahead" "$@"
@@ -0,0 +1,48 @@
+#!/bin/sh
+#
+# Copyright(c) 2019 Intel Corporation
+# SPDX - License - Identifier: BSD - 2 - Clause - Patent
+#
+
+# Tile scaling benchmark for SvtAv1EncApp.
+# Copies the input into tmpfs so the disk is out of the picture, then encodes it
+# once per logical processor count, with a single tile and with the automatic
+# tile layout, and prints the average speed of each run. The speed of the
+# automatic layout should keep growing with the core count where the single
+# tile flattens out.
+#
+# usage: enc_tiles_scaling.sh <SvtAv1EncApp> <input.y4m|input.yuv> [extra encoder options]
+# e.g.   enc_tiles_scaling.sh Bin/Release/SvtAv1EncApp crowd_run_2160p.y4m --preset 8 -n 120
+#
+# The logical processor counts default to 1 8 16 32 64, set LP_COUNTS to change them.
+
+set -e
+
+die() {
+    printf '%s\n' "$@" >&2
+    exit 1
+}
+
+[ $# -ge 2 ] || die "usage: $0 <SvtAv1EncApp> <input> [extra encoder options]"
+app=$1
+input=$2
+shift 2
+
+tmpfs_dir=${TMPFS_DIR:-/dev/shm}
+[ -d "$tmpfs_dir" ] || die "tmpfs directory $tmpfs_dir not found, set TMPFS_DIR"
+lp_counts=${LP_COUNTS:-1 8 16 32 64}
+
+tmp_input="$tmpfs_dir/svt_enc_tiles_bench.${input##*.}"
+trap 'rm -f "$tmp_input"' EXIT INT TERM
+cp "$input" "$tmp_input"
+
+run() {
+    "$app" -i "$tmp_input" -b /dev/null "$@" 2>&1 | grep -E "Average Speed"
+}
+
+for lp in $lp_counts; do
+    printf '%s\n' "$lp logical processors, single tile:"
+    run -lp "$lp" -tile-rows 0 -tile-columns 0 "$@"
+    printf '%s\n' "$lp logical processors, automatic tiles:"
+    run -lp "$lp" -tile-rows -1 -tile-columns -1 "$@"
+done
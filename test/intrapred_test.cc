@@ -396,4 +396,26 @@ const LBD_PARAMS LowbdIntraPredTestVectorAsm[] = {
 
 INSTANTIATE_TEST_CASE_P(intrapred, LowbdIntraPredTest,
                         ::testing::ValuesIn(LowbdIntraPredTestVectorAsm));
+
+#ifndef NON_AVX512_SUPPORT
+const LBD_PARAMS LowbdIntraPredTestVectorAvx512[] = {
+    lbd_entry(smooth, 32, 8, avx512),    lbd_entry(smooth, 32, 16, avx512),
+    lbd_entry(smooth, 32, 32, avx512),   lbd_entry(smooth, 32, 64, avx512),
+    lbd_entry(smooth, 64, 16, avx512),   lbd_entry(smooth, 64, 32, avx512),
+    lbd_entry(smooth, 64, 64, avx512),   lbd_entry(smooth_v, 32, 8, avx512),
+    lbd_entry(smooth_v, 32, 16, avx512), lbd_entry(smooth_v, 32, 32, avx512),
+    lbd_entry(smooth_v, 32, 64, avx512), lbd_entry(smooth_v, 64, 16, avx512),
+    lbd_entry(smooth_v, 64, 32, avx512), lbd_entry(smooth_v, 64, 64, avx512),
+    lbd_entry(smooth_h, 32, 8, avx512),  lbd_entry(smooth_h, 32, 16, avx512),
+    lbd_entry(smooth_h, 32, 32, avx512), lbd_entry(smooth_h, 32, 64, avx512),
+    lbd_entry(smooth_h, 64, 16, avx512), lbd_entry(smooth_h, 64, 32, avx512),
+    lbd_entry(smooth_h, 64, 64, avx512), lbd_entry(paeth, 32, 8, avx512),
+    lbd_entry(paeth, 32, 16, avx512),    lbd_entry(paeth, 32, 32, avx512),
+    lbd_entry(paeth, 32, 64, avx512),    lbd_entry(paeth, 64, 16, avx512),
+    lbd_entry(paeth, 64, 32, avx512),    lbd_entry(paeth, 64, 64, avx512),
+};
+
+INSTANTIATE_TEST_CASE_P(intrapred_avx512, LowbdIntraPredTest,
+                        ::testing::ValuesIn(LowbdIntraPredTestVectorAvx512));
+#endif
 }  // namespace